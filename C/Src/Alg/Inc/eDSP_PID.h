@@ -1,7 +1,7 @@
 /**
  * @file       eDSP_PID.h
  *
- * @brief      Multiple 2D point Linearization on a int64_t
+ * @brief      Fixed point PID controller
  *
  * @author     Lorenzo Rosin
  *
@@ -22,6 +22,8 @@ extern "C" {
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eDSP_TYPE.h"
+#include "eDSP_INTEGRAL.h"
+#include "eDSP_DERIVATIVE.h"
 
 
 
@@ -40,12 +42,26 @@ typedef enum
 
 typedef struct
 {
-    bool_t bIsInit;
-    bool_t bHasPrev;
-    bool_t bHasCurrent;
-    int64_t uPreviousVal;
-    int64_t uCurrentVal;
-    uint32_t uTimeElapsedFromCurToPre;
+    int32_t  iKp;
+    int32_t  iKi;
+    int32_t  iKd;
+    uint32_t uGainQ;
+    uint32_t uDFiltAlphaQ31;
+    int64_t  iOutMin;
+    int64_t  iOutMax;
+}t_eDSP_PID_Param;
+
+typedef struct
+{
+    bool_t   bIsInit;
+    t_eDSP_PID_Param tParam;
+    t_eDSP_INTEGRAL_Ctx tIntegral;
+    t_eDSP_DERIVATIVE_Ctx tDerivate;
+    int64_t  iIntegralMin;
+    int64_t  iIntegralMax;
+    int64_t  iDerivateAcc;
+    uint32_t uSatCnt;
+    e_eDSP_TYPE_OVFMODE eOvfMode;
 }t_eDSP_PID_Ctx;
 
 
@@ -54,21 +70,36 @@ typedef struct
  * GLOBAL PROTOTYPES
  **********************************************************************************************************************/
 /**
- * @brief       Initialize the multiple point linearizer using a series of point
+ * @brief       Initialize the PID controller. Every call of eDSP_PID_Calc calculate, with e = setpoint - measure:
+ *              P = Kp * e
+ *              I = I + Ki * e * dt, clamped between iOutMin and iOutMax so the integral can't wind up when the
+ *                  output is saturated. The integral is an eDSP_INTEGRAL context with the right rule, so it start
+ *                  from the second step
+ *              D = D + alpha * ( -Kd * ( measure - prevmeasure ) / dt - D ), the derivate is done on the measure
+ *                  so a step of the setpoint doesn't kick the output, and is filtered by a first order low pass.
+ *                  The measures are kept in an eDSP_DERIVATIVE context with the backward stencil
+ *              out = ( P + I + D ) / 2^uGainQ, clamped between iOutMin and iOutMax
+ *              P, I and D are kept in the Q format of the gains, so the fractions of the integral are not lost.
  *
- * @param[in]   p_ptCtx       - Multiple point linearizer context
- * @param[in]   p_tSeries     - Struct containing the series of point
+ * @param[in]   p_ptCtx         - PID context
+ * @param[in]   p_ptParam       - Parameters of the controller, copied in the context:
+ *                                iKp, iKi, iKd  - Gains in Q format, Ki per unit of time and Kd times unit of time
+ *                                uGainQ         - Numbers of fractional bit of the gains, cannot be greater than 31
+ *                                uDFiltAlphaQ31 - Alpha of the derivate filter in Q31, dt / ( RC + dt ), between 1 and
+ *                                                 2^31; 2^31 disable the filter
+ *                                iOutMin        - Minimum value of the output, cannot be greater than iOutMax
+ *                                iOutMax        - Maximum value of the output
  *
  * @return      e_eDSP_PID_RES_BADPOINTER     - In case of bad pointer passed to the function
  *		        e_eDSP_PID_RES_BADPARAM       - In case of an invalid parameter passed to the function
- *              e_eDSP_PID_RES_OK             - Multiple point linearizer initialized successfully
+ *              e_eDSP_PID_RES_OK             - PID initialized successfully
  */
-e_eDSP_PID_RES eDSP_PID_InitCtx(t_eDSP_PID_Ctx* const p_ptCtx);
+e_eDSP_PID_RES eDSP_PID_InitCtx(t_eDSP_PID_Ctx* const p_ptCtx, const t_eDSP_PID_Param* const p_ptParam);
 
 /**
  * @brief       Check if the lib is initialized
  *
- * @param[in]   p_ptCtx         - Multiple point linearizer context
+ * @param[in]   p_ptCtx         - PID context
  * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
  *
  * @return      e_eDSP_PID_RES_BADPOINTER    - In case of bad pointer passed to the function
@@ -77,41 +108,64 @@ e_eDSP_PID_RES eDSP_PID_InitCtx(t_eDSP_PID_Ctx* const p_ptCtx);
 e_eDSP_PID_RES eDSP_PID_IsInit(t_eDSP_PID_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
 
 /**
- * @brief       Given the series of point used during the init phase, calculate the Y value of the line passing in the
- *              provided two point, given an X value
+ * @brief       Run a step of the PID controller with the current setpoint and measure. p_timeFromLast cannot be
+ *              zero. The context, with the integral and derivate contexts that it embed, is validated once and all
+ *              the terms are calculated in a single pass; with e_eDSP_TYPE_OVFMODE_ERROR the context is updated only
+ *              if no operation overflow. The derivate term is zero until a previous measure is available.
  *
- * @param[in]   p_ptCtx         - Multiple point linearizer context
- * @param[in]   p_uX            - X value to use during the calculation of the Y value
- * @param[in]   p_puY           - Pointer to an int64_t where the value of the calculated Y will be placed.
+ * @param[in]   p_ptCtx         - PID context
+ * @param[in]   p_iSetpoint     - Wanted value of the measure
+ * @param[in]   p_iMeasure      - Current value of the measure
+ * @param[in]   p_timeFromLast  - Time elapsed from the previous step
+ * @param[out]  p_piOutput      - Pointer to an int64_t where the output of the controller will be placed
  *
  * @return      e_eDSP_PID_RES_BADPOINTER   - In case of bad pointer passed to the function
- *		        e_eDSP_PID_RES_BADPARAM     - In case of an invalid parameter passed to the function.
- *                                                    - so when the two point are the same or when the line as and angle
- *                                                    - of +-90 degree
+ *		        e_eDSP_PID_RES_BADPARAM     - In case of an invalid parameter passed to the function
  *		        e_eDSP_PID_RES_NOINITLIB    - Need to init the data stuffer context before taking some action
  *		        e_eDSP_PID_RES_CORRUPTCTX   - In case of an corrupted context
+ *		        e_eDSP_PID_RES_OVERFLOW     - An operation exceed the int64_t storage area, the context is not
+ *                                            updated
  *              e_eDSP_PID_RES_OK           - Operation ended correctly
  */
-e_eDSP_PID_RES eDSP_PID_InsertValue(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iValue,
-                                                  const uint32_t p_timeFromLast);
+e_eDSP_PID_RES eDSP_PID_Calc(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iSetpoint, const int64_t p_iMeasure,
+                             const uint32_t p_timeFromLast, int64_t* const p_piOutput);
 
 /**
- * @brief       Given the series of point used during the init phase, calculate the Y value of the line passing in the
- *              provided two point, given an X value
+ * @brief       Select how the arithmetic overflow are managed. With e_eDSP_TYPE_OVFMODE_ERROR, the default after
+ *              the init, an overflow is reported as e_eDSP_PID_RES_OVERFLOW.
+ *              With e_eDSP_TYPE_OVFMODE_SATURATE every operation is clamped to the int64_t storage area and counted,
+ *              so no step is discarded. The mode is applied to the embedded integral and derivate too. Setting the
+ *              mode restart the count of the saturated operations.
  *
- * @param[in]   p_ptCtx         - Multiple point linearizer context
- * @param[in]   p_uX            - X value to use during the calculation of the Y value
- * @param[in]   p_puY           - Pointer to an int64_t where the value of the calculated Y will be placed.
+ * @param[in]   p_ptCtx         - PID context
+ * @param[in]   p_eOvfMode      - Overflow mode to use
  *
- * @return      e_eDSP_PID_RES_BADPOINTER   - In case of bad pointer passed to the function
- *		        e_eDSP_PID_RES_BADPARAM     - In case of an invalid parameter passed to the function.
- *                                                    - so when the two point are the same or when the line as and angle
- *                                                    - of +-90 degree
- *		        e_eDSP_PID_RES_NOINITLIB    - Need to init the data stuffer context before taking some action
- *		        e_eDSP_PID_RES_CORRUPTCTX   - In case of an corrupted context
- *              e_eDSP_PID_RES_OK           - Operation ended correctly
+ * @return      e_eDSP_PID_RES_BADPOINTER                 - In case of bad pointer passed to the function
+ *		        e_eDSP_PID_RES_NOINITLIB                  - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_PID_RES_CORRUPTCTX                 - In case of an corrupted context
+ *		        e_eDSP_PID_RES_BADPARAM                   - In case of an invalid parameter passed to the function
+ *              e_eDSP_PID_RES_OK                         - Operation ended correctly
  */
-e_eDSP_PID_RES eDSP_PID_CalcDerivate(t_eDSP_PID_Ctx* const p_ptCtx, int64_t* const p_piDerivate);
+e_eDSP_PID_RES eDSP_PID_SetOvfMode(t_eDSP_PID_Ctx* const p_ptCtx, e_eDSP_TYPE_OVFMODE p_eOvfMode);
+
+/**
+ * @brief       Get the numbers of operation clamped since the overflow mode was set. The counter is sticky, it
+ *              never wrap around. The operations of the embedded integral are counted too, the clamp of the
+ *              output and of the integral to iOutMin and iOutMax is not.
+ *
+ * @param[in]   p_ptCtx         - PID context
+ * @param[out]  p_puSatCnt      - Pointer to an uint32_t where the numbers of saturated operation will be placed
+ *
+ * @return      e_eDSP_PID_RES_BADPOINTER                 - In case of bad pointer passed to the function
+ *		        e_eDSP_PID_RES_NOINITLIB                  - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_PID_RES_CORRUPTCTX                 - In case of an corrupted context
+ *              e_eDSP_PID_RES_OK                         - Operation ended correctly
+ */
+e_eDSP_PID_RES eDSP_PID_GetSatCnt(t_eDSP_PID_Ctx* const p_ptCtx, uint32_t* const p_puSatCnt);
+
+
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -1,7 +1,7 @@
 /**
- * @file       eDSP_PID.h
+ * @file       eDSP_PID.c
  *
- * @brief      Multiple 2D point Linearization on a int64_t
+ * @brief      Fixed point PID controller
  *
  * @author     Lorenzo Rosin
  *
@@ -12,6 +12,16 @@
  **********************************************************************************************************************/
 #include "eDSP_PID.h"
 #include "eDSP_MAXCHECK.h"
+#include "eDSP_SATARITH.h"
+#include "eDSP_Q31ARITH.h"
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE DEFINE
+ **********************************************************************************************************************/
+/* One in Q31 format */
+#define EDSP_PID_Q31ONE                                                                    ( ( uint32_t ) 0x80000000u )
 
 
 
@@ -19,34 +29,72 @@
  *  PRIVATE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eDSP_PID_IsStatusStillCoherent(t_eDSP_PID_Ctx* const p_ptCtx);
-static e_eDSP_PID_RES eDSP_PID_MaxCheckResToS2DP(const e_eDSP_MAXCHECK_RES p_tMaxRet);
+static bool_t eDSP_PID_IsParamValid(const t_eDSP_PID_Param* const p_ptParam);
+static e_eDSP_PID_RES eDSP_PID_MaxCheckResToPID(const e_eDSP_MAXCHECK_RES p_tMaxRet);
+static e_eDSP_PID_RES eDSP_PID_Add(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iFirst, const int64_t p_iSecond,
+                                   int64_t* const p_piRes);
+static e_eDSP_PID_RES eDSP_PID_Sub(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iFirst, const int64_t p_iSecond,
+                                   int64_t* const p_piRes);
+static e_eDSP_PID_RES eDSP_PID_Mul(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iFirst, const int64_t p_iSecond,
+                                   int64_t* const p_piRes);
+static e_eDSP_PID_RES eDSP_PID_MulDiv(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iFirst, const int64_t p_iSecond,
+                                      const int64_t p_iDivisor, int64_t* const p_piRes);
+static int64_t eDSP_PID_Clamp(const int64_t p_iValue, const int64_t p_iMin, const int64_t p_iMax);
+static int64_t eDSP_PID_ScaleLimit(const int64_t p_iLimit, const uint32_t p_uGainQ);
+
 
 
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
  **********************************************************************************************************************/
-e_eDSP_PID_RES eDSP_PID_InitCtx(t_eDSP_PID_Ctx* const p_ptCtx)
+e_eDSP_PID_RES eDSP_PID_InitCtx(t_eDSP_PID_Ctx* const p_ptCtx, const t_eDSP_PID_Param* const p_ptParam)
 {
 	/* Local variable */
 	e_eDSP_PID_RES l_eRes;
+	e_eDSP_INTEGRAL_RES l_eIntRes;
+	e_eDSP_DERIVATIVE_RES l_eDerRes;
 
 	/* Check pointer validity */
-	if( NULL == p_ptCtx )
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptParam ) )
 	{
 		l_eRes = e_eDSP_PID_RES_BADPOINTER;
 	}
 	else
 	{
-        /* Initialize internal status */
-        p_ptCtx->bIsInit = true;
-        p_ptCtx->bHasPrev = false;
-		p_ptCtx->bHasCurrent = false;
-		p_ptCtx->uPreviousVal = 0;
-		p_ptCtx->uCurrentVal = 0;
-		p_ptCtx->uTimeElapsedFromCurToPre = 0u;
+		/* Check data validity */
+		if( false == eDSP_PID_IsParamValid(p_ptParam) )
+		{
+			l_eRes = e_eDSP_PID_RES_BADPARAM;
+		}
+		else
+		{
+			/* The integral is done with the right rule, the value is integrated on the time elapsed before it,
+			   and the derivate with the backward stencil, the difference from the previous measure */
+			l_eIntRes = eDSP_INTEGRAL_InitCtx(&p_ptCtx->tIntegral, e_eDSP_INTEGRAL_RULE_RIGHT);
+			l_eDerRes = eDSP_DERIVATIVE_InitCtx(&p_ptCtx->tDerivate, e_eDSP_DERIVATIVE_STENCIL_BACKWARD);
 
-		/* All OK */
-        l_eRes = e_eDSP_PID_RES_OK;
+			if( ( e_eDSP_INTEGRAL_RES_OK != l_eIntRes ) || ( e_eDSP_DERIVATIVE_RES_OK != l_eDerRes ) )
+			{
+				l_eRes = e_eDSP_PID_RES_BADPARAM;
+			}
+			else
+			{
+				/* Initialize internal status */
+				p_ptCtx->bIsInit = true;
+				p_ptCtx->tParam = *p_ptParam;
+				p_ptCtx->iDerivateAcc = 0;
+				p_ptCtx->uSatCnt = 0u;
+				p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+
+				/* The integral is kept in the Q format of the gains, so its anti windup limits are the output
+				   limits scaled by the same factor */
+				p_ptCtx->iIntegralMin = eDSP_PID_ScaleLimit(p_ptParam->iOutMin, p_ptParam->uGainQ);
+				p_ptCtx->iIntegralMax = eDSP_PID_ScaleLimit(p_ptParam->iOutMax, p_ptParam->uGainQ);
+
+				/* All OK */
+				l_eRes = e_eDSP_PID_RES_OK;
+			}
+		}
 	}
 
 	return l_eRes;
@@ -71,14 +119,28 @@ e_eDSP_PID_RES eDSP_PID_IsInit(t_eDSP_PID_Ctx* const p_ptCtx, bool_t* p_pbIsInit
 	return l_eRes;
 }
 
-e_eDSP_PID_RES eDSP_PID_InsertValue(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iValue,
-                                                  const uint32_t p_timeFromLast)
+e_eDSP_PID_RES eDSP_PID_Calc(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iSetpoint, const int64_t p_iMeasure,
+                             const uint32_t p_timeFromLast, int64_t* const p_piOutput)
 {
 	/* Local variable for return */
 	e_eDSP_PID_RES l_eRes;
 
+	/* Local variable for calculation */
+	const t_eDSP_PID_Param* l_ptParam;
+	t_eDSP_INTEGRAL_Ctx l_tIntegralBak;
+	t_eDSP_DERIVATIVE_Ctx l_tDerivateBak;
+	e_eDSP_INTEGRAL_RES l_eIntRes;
+	e_eDSP_DERIVATIVE_RES l_eDerRes;
+	int64_t l_iErr;
+	int64_t l_iProp;
+	int64_t l_iValue;
+	int64_t l_iIntegral;
+	int64_t l_iDiff;
+	int64_t l_iDerivate;
+	int64_t l_iSum;
+
 	/* Check pointer validity */
-	if( NULL == p_ptCtx )
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piOutput ) )
 	{
 		l_eRes = e_eDSP_PID_RES_BADPOINTER;
 	}
@@ -98,42 +160,148 @@ e_eDSP_PID_RES eDSP_PID_InsertValue(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t
             }
 			else
 			{
-                /* Check data validity */
+				/* Check data validity */
 				if( 0u == p_timeFromLast )
 				{
 					l_eRes = e_eDSP_PID_RES_BADPARAM;
 				}
 				else
 				{
-					/* Check data validity */
-					p_ptCtx->uPreviousVal = p_ptCtx->uCurrentVal;
-					p_ptCtx->uCurrentVal = p_iValue;
-					p_ptCtx->uTimeElapsedFromCurToPre = p_timeFromLast;
+					/* Every term is calculated in local variables, the integral and derivate contexts are already
+					   validated with the PID one and are updated in place. Only an overflow in error mode can stop
+					   the step, so only in that mode a copy of them is kept to restore them, and an overflow
+					   doesn't leave a step half done */
+					l_ptParam = &p_ptCtx->tParam;
+
+					if( e_eDSP_TYPE_OVFMODE_ERROR == p_ptCtx->eOvfMode )
+					{
+						l_tIntegralBak = p_ptCtx->tIntegral;
+						l_tDerivateBak = p_ptCtx->tDerivate;
+					}
+
+					l_iProp = 0;
+					l_iValue = 0;
+					l_iIntegral = p_ptCtx->tIntegral.uIntegral;
+					l_iDiff = 0;
+					l_iDerivate = p_ptCtx->iDerivateAcc;
+					l_iSum = 0;
+
+					/* Proportional */
+					l_eRes = eDSP_PID_Sub(p_ptCtx, p_iSetpoint, p_iMeasure, &l_iErr);
+
+					if( e_eDSP_PID_RES_OK == l_eRes )
+					{
+						l_eRes = eDSP_PID_Mul(p_ptCtx, (int64_t) l_ptParam->iKp, l_iErr, &l_iProp);
+					}
+
+					/* Integral, clamped to the output limits to avoid the wind up */
+					if( e_eDSP_PID_RES_OK == l_eRes )
+					{
+						l_eRes = eDSP_PID_Mul(p_ptCtx, (int64_t) l_ptParam->iKi, l_iErr, &l_iValue);
+					}
+
+					if( e_eDSP_PID_RES_OK == l_eRes )
+					{
+						l_eIntRes = eDSP_INTEGRAL_InsertValueCore(&p_ptCtx->tIntegral, l_iValue, p_timeFromLast,
+																  &l_iIntegral);
+
+						if( e_eDSP_INTEGRAL_RES_OK == l_eIntRes )
+						{
+							eDSP_INTEGRAL_ClampCore(&p_ptCtx->tIntegral, p_ptCtx->iIntegralMin, p_ptCtx->iIntegralMax,
+													&l_iIntegral);
+						}
+						else if( e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE != l_eIntRes )
+						{
+							l_eRes = e_eDSP_PID_RES_OVERFLOW;
+						}
+						else
+						{
+							/* Nothing to integrate on the first step */
+						}
+					}
+
+					/* Derivate on the measure, so a step of the setpoint doesn't kick the output. The derivate
+					   context only hold the previous and the current measure, -Kd is applied to their difference and
+					   the product is kept on 128 bit before the division by the time, so a big measure that change
+					   slowly doesn't overflow */
+					if( e_eDSP_PID_RES_OK == l_eRes )
+					{
+						l_eDerRes = eDSP_DERIVATIVE_InsertValueOnlyCore(&p_ptCtx->tDerivate, p_iMeasure,
+																		p_timeFromLast);
+
+						/* The time is already checked, the window can only be full or not */
+						if( e_eDSP_DERIVATIVE_RES_OK == l_eDerRes )
+						{
+							l_eRes = eDSP_PID_Sub(p_ptCtx, p_ptCtx->tDerivate.aiValues[0u],
+												  p_ptCtx->tDerivate.aiValues[1u], &l_iDiff);
+
+							if( e_eDSP_PID_RES_OK == l_eRes )
+							{
+								l_eRes = eDSP_PID_MulDiv(p_ptCtx, (int64_t) l_ptParam->iKd, l_iDiff,
+														 (int64_t) p_timeFromLast, &l_iDiff);
+							}
+
+							if( e_eDSP_PID_RES_OK == l_eRes )
+							{
+								l_eRes = eDSP_PID_Sub(p_ptCtx, l_iDiff, p_ptCtx->iDerivateAcc, &l_iDiff);
+							}
+
+							if( e_eDSP_PID_RES_OK == l_eRes )
+							{
+								/* First order low pass: alpha is not greater than one, so the step is not greater
+								   than the distance from the new value and the sum can't overflow */
+								l_iDerivate = p_ptCtx->iDerivateAcc + eDSP_Q31ARITH_MulI64(l_iDiff,
+																						   l_ptParam->uDFiltAlphaQ31);
+							}
+						}
+						else
+						{
+							/* Nothing to derive on the first step */
+						}
+					}
+
+					/* Output */
+					if( e_eDSP_PID_RES_OK == l_eRes )
+					{
+						l_eRes = eDSP_PID_Add(p_ptCtx, l_iProp, l_iIntegral, &l_iSum);
+					}
+
+					if( e_eDSP_PID_RES_OK == l_eRes )
+					{
+						l_eRes = eDSP_PID_Add(p_ptCtx, l_iSum, l_iDerivate, &l_iSum);
+					}
 
-					if( false == p_ptCtx->bHasCurrent )
+					if( e_eDSP_PID_RES_OK == l_eRes )
+					{
+						p_ptCtx->iDerivateAcc = l_iDerivate;
+
+						l_iSum = l_iSum / ( ( (int64_t) 1 ) << l_ptParam->uGainQ );
+						*p_piOutput = eDSP_PID_Clamp(l_iSum, l_ptParam->iOutMin, l_ptParam->iOutMax);
+					}
+					else if( e_eDSP_TYPE_OVFMODE_ERROR == p_ptCtx->eOvfMode )
 					{
-						p_ptCtx->bHasCurrent = true;
+						p_ptCtx->tIntegral = l_tIntegralBak;
+						p_ptCtx->tDerivate = l_tDerivateBak;
 					}
 					else
 					{
-						p_ptCtx->bHasPrev = true;
+						/* In saturate mode no operation stop the step */
 					}
 				}
 			}
 		}
-    }
+	}
 
 	return l_eRes;
 }
 
-e_eDSP_PID_RES eDSP_PID_CalcDerivate(t_eDSP_PID_Ctx* const p_ptCtx, int64_t* const p_piDerivate)
+e_eDSP_PID_RES eDSP_PID_SetOvfMode(t_eDSP_PID_Ctx* const p_ptCtx, e_eDSP_TYPE_OVFMODE p_eOvfMode)
 {
-	/* Local variable for return */
+	/* Local variable */
 	e_eDSP_PID_RES l_eRes;
-	e_eDSP_MAXCHECK_RES l_eMaxRes;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_piDerivate ))
+	if( NULL == p_ptCtx )
 	{
 		l_eRes = e_eDSP_PID_RES_BADPOINTER;
 	}
@@ -153,25 +321,72 @@ e_eDSP_PID_RES eDSP_PID_CalcDerivate(t_eDSP_PID_Ctx* const p_ptCtx, int64_t* con
             }
 			else
 			{
-                /* Check if we can proceed */
-				if( false == p_ptCtx->bHasPrev )
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
 				{
 					l_eRes = e_eDSP_PID_RES_BADPARAM;
 				}
 				else
 				{
-					l_eMaxRes = eDSP_MAXCHECK_SUBTI64Check(p_ptCtx->uCurrentVal, p_ptCtx->uPreviousVal);
-					l_eRes = eDSP_PID_MaxCheckResToS2DP(l_eMaxRes);
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					p_ptCtx->tIntegral.eOvfMode = p_eOvfMode;
+					p_ptCtx->tIntegral.uSatCnt = 0u;
+					p_ptCtx->tDerivate.eOvfMode = p_eOvfMode;
+					p_ptCtx->tDerivate.uSatCnt = 0u;
+					l_eRes = e_eDSP_PID_RES_OK;
+				}
+			}
+		}
+	}
 
-					if( e_eDSP_PID_RES_OK == l_eRes )
-					{
-						/* calculate */
-						*p_piDerivate = p_ptCtx->uCurrentVal - p_ptCtx->uPreviousVal / p_ptCtx->uTimeElapsedFromCurToPre;
-					}
+	return l_eRes;
+}
+
+e_eDSP_PID_RES eDSP_PID_GetSatCnt(t_eDSP_PID_Ctx* const p_ptCtx, uint32_t* const p_puSatCnt)
+{
+	/* Local variable */
+	e_eDSP_PID_RES l_eRes;
+	uint64_t l_uSatCnt;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
+	{
+		l_eRes = e_eDSP_PID_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_PID_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_PID_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_PID_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Every counter is sticky, so is the sum. The derivate context only hold the measures, its
+				   operations are counted by the PID one */
+				l_uSatCnt = ( (uint64_t) p_ptCtx->uSatCnt ) + ( (uint64_t) p_ptCtx->tIntegral.uSatCnt );
+
+				if( l_uSatCnt > MAX_UINT32VAL )
+				{
+					*p_puSatCnt = MAX_UINT32VAL;
 				}
+				else
+				{
+					*p_puSatCnt = (uint32_t) l_uSatCnt;
+				}
+
+				l_eRes = e_eDSP_PID_RES_OK;
 			}
 		}
-    }
+	}
 
 	return l_eRes;
 }
@@ -186,12 +401,67 @@ static bool_t eDSP_PID_IsStatusStillCoherent(t_eDSP_PID_Ctx* const p_ptCtx)
     /* Return local var */
     bool_t l_eRes;
 
-	l_eRes = true;
+	/* Check data validity */
+	if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) )
+	{
+		l_eRes = false;
+	}
+	else if( false == eDSP_PID_IsParamValid(&p_ptCtx->tParam) )
+	{
+		l_eRes = false;
+	}
+	else if( ( eDSP_PID_ScaleLimit(p_ptCtx->tParam.iOutMin, p_ptCtx->tParam.uGainQ) != p_ptCtx->iIntegralMin ) ||
+			 ( eDSP_PID_ScaleLimit(p_ptCtx->tParam.iOutMax, p_ptCtx->tParam.uGainQ) != p_ptCtx->iIntegralMax ) )
+	{
+		/* The anti windup limits are always derived from the parameters */
+		l_eRes = false;
+	}
+	else if( ( false == p_ptCtx->tIntegral.bIsInit ) || ( e_eDSP_INTEGRAL_RULE_RIGHT != p_ptCtx->tIntegral.eRule ) ||
+			 ( p_ptCtx->eOvfMode != p_ptCtx->tIntegral.eOvfMode ) ||
+			 ( p_ptCtx->tIntegral.uIntegral < p_ptCtx->iIntegralMin ) ||
+			 ( p_ptCtx->tIntegral.uIntegral > p_ptCtx->iIntegralMax ) )
+	{
+		l_eRes = false;
+	}
+	else if( ( false == p_ptCtx->tDerivate.bIsInit ) ||
+			 ( e_eDSP_DERIVATIVE_STENCIL_BACKWARD != p_ptCtx->tDerivate.eStencil ) ||
+			 ( 2u != p_ptCtx->tDerivate.uNPoints ) || ( p_ptCtx->tDerivate.uFilledData > 2u ) ||
+			 ( p_ptCtx->eOvfMode != p_ptCtx->tDerivate.eOvfMode ) )
+	{
+		l_eRes = false;
+	}
+	else if( ( p_ptCtx->tDerivate.uFilledData < 2u ) && ( 0 != p_ptCtx->iDerivateAcc ) )
+	{
+		/* Nothing is derived before the second measure */
+		l_eRes = false;
+	}
+	else
+	{
+		l_eRes = true;
+	}
+
+    return l_eRes;
+}
+
+static bool_t eDSP_PID_IsParamValid(const t_eDSP_PID_Param* const p_ptParam)
+{
+    /* Return local var */
+    bool_t l_eRes;
+
+	if( ( p_ptParam->uGainQ > 31u ) || ( 0u == p_ptParam->uDFiltAlphaQ31 ) ||
+		( p_ptParam->uDFiltAlphaQ31 > EDSP_PID_Q31ONE ) || ( p_ptParam->iOutMin > p_ptParam->iOutMax ) )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+		l_eRes = true;
+	}
 
     return l_eRes;
 }
 
-static e_eDSP_PID_RES eDSP_PID_MaxCheckResToS2DP(const e_eDSP_MAXCHECK_RES p_tMaxRet)
+static e_eDSP_PID_RES eDSP_PID_MaxCheckResToPID(const e_eDSP_MAXCHECK_RES p_tMaxRet)
 {
 	e_eDSP_PID_RES l_eRet;
 
@@ -206,3 +476,127 @@ static e_eDSP_PID_RES eDSP_PID_MaxCheckResToS2DP(const e_eDSP_MAXCHECK_RES p_tMa
 
 	return l_eRet;
 }
+
+static e_eDSP_PID_RES eDSP_PID_Add(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iFirst, const int64_t p_iSecond,
+                                   int64_t* const p_piRes)
+{
+	/* Local variable for return */
+	e_eDSP_PID_RES l_eRes;
+
+	if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+	{
+		*p_piRes = eDSP_SATARITH_AddI64(p_iFirst, p_iSecond, &p_ptCtx->uSatCnt);
+		l_eRes = e_eDSP_PID_RES_OK;
+	}
+	else
+	{
+		l_eRes = eDSP_PID_MaxCheckResToPID(eDSP_MAXCHECK_AddI64(p_iFirst, p_iSecond, p_piRes));
+	}
+
+	return l_eRes;
+}
+
+static e_eDSP_PID_RES eDSP_PID_Sub(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iFirst, const int64_t p_iSecond,
+                                   int64_t* const p_piRes)
+{
+	/* Local variable for return */
+	e_eDSP_PID_RES l_eRes;
+
+	if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+	{
+		*p_piRes = eDSP_SATARITH_SubI64(p_iFirst, p_iSecond, &p_ptCtx->uSatCnt);
+		l_eRes = e_eDSP_PID_RES_OK;
+	}
+	else
+	{
+		l_eRes = eDSP_PID_MaxCheckResToPID(eDSP_MAXCHECK_SubI64(p_iFirst, p_iSecond, p_piRes));
+	}
+
+	return l_eRes;
+}
+
+static e_eDSP_PID_RES eDSP_PID_Mul(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iFirst, const int64_t p_iSecond,
+                                   int64_t* const p_piRes)
+{
+	/* Local variable for return */
+	e_eDSP_PID_RES l_eRes;
+
+	if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+	{
+		*p_piRes = eDSP_SATARITH_MulI64(p_iFirst, p_iSecond, &p_ptCtx->uSatCnt);
+		l_eRes = e_eDSP_PID_RES_OK;
+	}
+	else
+	{
+		l_eRes = eDSP_PID_MaxCheckResToPID(eDSP_MAXCHECK_MulI64(p_iFirst, p_iSecond, p_piRes));
+	}
+
+	return l_eRes;
+}
+
+static e_eDSP_PID_RES eDSP_PID_MulDiv(t_eDSP_PID_Ctx* const p_ptCtx, const int64_t p_iFirst, const int64_t p_iSecond,
+                                      const int64_t p_iDivisor, int64_t* const p_piRes)
+{
+	/* Local variable for return */
+	e_eDSP_PID_RES l_eRes;
+
+	if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+	{
+		*p_piRes = eDSP_SATARITH_MulDivI64(p_iFirst, p_iSecond, p_iDivisor, &p_ptCtx->uSatCnt);
+		l_eRes = e_eDSP_PID_RES_OK;
+	}
+	else
+	{
+		l_eRes = eDSP_PID_MaxCheckResToPID(eDSP_MAXCHECK_MulDivI64(p_iFirst, p_iSecond, p_iDivisor, p_piRes));
+	}
+
+	return l_eRes;
+}
+
+static int64_t eDSP_PID_Clamp(const int64_t p_iValue, const int64_t p_iMin, const int64_t p_iMax)
+{
+	/* Local variable */
+	int64_t l_iRes;
+
+	if( p_iValue < p_iMin )
+	{
+		l_iRes = p_iMin;
+	}
+	else if( p_iValue > p_iMax )
+	{
+		l_iRes = p_iMax;
+	}
+	else
+	{
+		l_iRes = p_iValue;
+	}
+
+	return l_iRes;
+}
+
+static int64_t eDSP_PID_ScaleLimit(const int64_t p_iLimit, const uint32_t p_uGainQ)
+{
+	/* Local variable */
+	int64_t l_iBound;
+	int64_t l_iRes;
+
+	/* The limit is multiplied by 2^p_uGainQ. Limits that don't fit an int64_t are clamped, the integral can't go
+	   further anyway. The bounds are 2^( 63 - p_uGainQ ) - 1 and -2^( 63 - p_uGainQ ), no multiplication is needed
+	   to check them so the limits can be verified cheaply on every step */
+	l_iBound = MAX_INT64VAL >> p_uGainQ;
+
+	if( p_iLimit > l_iBound )
+	{
+		l_iRes = MAX_INT64VAL;
+	}
+	else if( p_iLimit < ( -l_iBound - 1 ) )
+	{
+		l_iRes = MIN_INT64VAL;
+	}
+	else
+	{
+		l_iRes = p_iLimit * ( ( (int64_t) 1 ) << p_uGainQ );
+	}
+
+	return l_iRes;
+}
\ No newline at end of file
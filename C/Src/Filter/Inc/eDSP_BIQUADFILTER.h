@@ -0,0 +1,198 @@
+/**
+ * @file       eDSP_BIQUADFILTER.h
+ *
+ * @brief      Cascade of biquad (second order IIR) filters implementation
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_BIQUADFILTER_H
+#define EDSP_BIQUADFILTER_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eDSP_BIQUADFILTER_RES_OK = 0,
+    e_eDSP_BIQUADFILTER_RES_BADPOINTER,
+    e_eDSP_BIQUADFILTER_RES_BADPARAM,
+    e_eDSP_BIQUADFILTER_RES_OVERFLOW,
+    e_eDSP_BIQUADFILTER_RES_NEEDSMOREVALUE,
+    e_eDSP_BIQUADFILTER_RES_CORRUPTCTX,
+    e_eDSP_BIQUADFILTER_RES_NOINITLIB
+}e_eDSP_BIQUADFILTER_RES;
+
+typedef struct
+{
+    int32_t iB0;
+    int32_t iB1;
+    int32_t iB2;
+    int32_t iA1;
+    int32_t iA2;
+}t_eDSP_BIQUADFILTER_Coeff;
+
+typedef struct
+{
+    int64_t iX1;
+    int64_t iX2;
+    int64_t iY1;
+    int64_t iY2;
+}t_eDSP_BIQUADFILTER_State;
+
+typedef struct
+{
+    bool_t   bIsInit;
+    uint32_t uNSections;
+    uint32_t uCoeffQ;
+    const t_eDSP_BIQUADFILTER_Coeff* ptCoeff;
+    t_eDSP_BIQUADFILTER_State* ptState;
+    uint32_t uSatCnt;
+    e_eDSP_TYPE_OVFMODE eOvfMode;
+}t_eDSP_BIQUADFILTER_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the biquad cascade with used buffer. Every section is a Direct Form I biquad, with a0
+ *              normalized to one:
+ *              y(i) = ( b0 x(i) + b1 x(i-1) + b2 x(i-2) - a1 y(i-1) - a2 y(i-2) ) / 2^p_uCoeffQ
+ *              and the output of every section is the input of the next one. Direct Form I keep the delay lines at
+ *              the signal scale, but the accumulator of a section hold the products of the coefficients and the
+ *              samples, 2^p_uCoeffQ times the signal. A section can't overflow when its largest input and output
+ *              multiplied by |b0| + |b1| + |b2| + |a1| + |a2| fit an int64_t: for example coefficients in Q30 whose
+ *              absolute values sum to 8 allow samples up to 2^30.
+ *
+ * @param[in]   p_ptCtx             - Biquad cascade context
+ * @param[in]   p_ptCoeff           - Coefficients of every section, in Q format. The buffer is not copied and must
+ *                                    stay valid for the whole life of the context.
+ * @param[in]   p_ptState           - Buffer that must be provided in order to store the status of every section
+ * @param[in]   p_uNSections        - Numbers of element of p_ptCoeff and of p_ptState, cannot be zero
+ * @param[in]   p_uCoeffQ           - Numbers of fractional bit of the coefficients, cannot be greater than 31
+ *
+ * @return      e_eDSP_BIQUADFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_BIQUADFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eDSP_BIQUADFILTER_RES_OK             - Biquad cascade initialized successfully
+ */
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_InitCtx(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                  const t_eDSP_BIQUADFILTER_Coeff* p_ptCoeff,
+                                                  t_eDSP_BIQUADFILTER_State* p_ptState, uint32_t p_uNSections,
+                                                  uint32_t p_uCoeffQ);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - Biquad cascade context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eDSP_BIQUADFILTER_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eDSP_BIQUADFILTER_RES_OK            - Operation ended correctly
+ */
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_IsInit(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Insert a new value in the biquad cascade and calculate the filtered value. The status of every section
+ *              starts from zero. With e_eDSP_TYPE_OVFMODE_ERROR the whole cascade is checked before updating it, so
+ *              when a section overflow the status of no section is updated.
+ *
+ * @param[in]   p_ptCtx         - Biquad cascade context
+ * @param[in]   p_iValue        - Current value that we want to filter
+ * @param[out]  p_pFilteredVal  - Pointer to an int64_t where the filtered value will be placed.
+ *
+ * @return      e_eDSP_BIQUADFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_BIQUADFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_BIQUADFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_BIQUADFILTER_RES_OVERFLOW       - The inserted value generate an overflow
+ *              e_eDSP_BIQUADFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_InsertValueAndCalculate(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                                  const int64_t p_iValue, int64_t* const p_pFilteredVal);
+
+/**
+ * @brief       Insert a block of values in the biquad cascade and calculate the filtered values. The context is
+ *              validated only once for the whole block. Values are processed in order, and every filtered value is
+ *              stored sequentially in p_piFilteredVal. Processing stop at the first value that generate an error.
+ *
+ * @param[in]   p_ptCtx         - Biquad cascade context
+ * @param[in]   p_piValues      - Pointer to the values that we want to filter
+ * @param[in]   p_uNValues      - Numbers of values in p_piValues, cannot be zero
+ * @param[out]  p_piFilteredVal - Pointer to a buffer of at least p_uNValues int64_t where the filtered values will be
+ *                                placed
+ * @param[out]  p_puNFiltered   - Pointer to an uint32_t where the numbers of filtered values will be placed
+ * @param[out]  p_puNProcessed  - Pointer to an uint32_t where the numbers of values taken from p_piValues
+ *                                will be placed, the value that generated an error is counted too
+ *
+ * @return      e_eDSP_BIQUADFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_BIQUADFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function.
+ *		        e_eDSP_BIQUADFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_BIQUADFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_BIQUADFILTER_RES_OVERFLOW       - The last processed value generate an overflow
+ *              e_eDSP_BIQUADFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_ProcessBlock(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                       const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                       int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                       uint32_t* const p_puNProcessed);
+
+/**
+ * @brief       Select how the arithmetic overflow are managed. With e_eDSP_TYPE_OVFMODE_ERROR, the default after
+ *              the init, an overflow is reported as e_eDSP_BIQUADFILTER_RES_OVERFLOW.
+ *              With e_eDSP_TYPE_OVFMODE_SATURATE every operation is clamped to the int64_t storage area and counted,
+ *              so no value is discarded. Setting the mode restart the count of the saturated operations.
+ *
+ * @param[in]   p_ptCtx         - Biquad cascade context
+ * @param[in]   p_eOvfMode      - Overflow mode to use
+ *
+ * @return      e_eDSP_BIQUADFILTER_RES_BADPOINTER        - In case of bad pointer passed to the function
+ *		        e_eDSP_BIQUADFILTER_RES_NOINITLIB         - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_BIQUADFILTER_RES_CORRUPTCTX        - In case of an corrupted context
+ *		        e_eDSP_BIQUADFILTER_RES_BADPARAM          - In case of an invalid parameter passed to the function
+ *              e_eDSP_BIQUADFILTER_RES_OK                - Operation ended correctly
+ */
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_SetOvfMode(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                     e_eDSP_TYPE_OVFMODE p_eOvfMode);
+
+/**
+ * @brief       Get the numbers of operation clamped since the overflow mode was set. The counter is sticky, it
+ *              never wrap around.
+ *
+ * @param[in]   p_ptCtx         - Biquad cascade context
+ * @param[out]  p_puSatCnt      - Pointer to an uint32_t where the numbers of saturated operation will be placed
+ *
+ * @return      e_eDSP_BIQUADFILTER_RES_BADPOINTER        - In case of bad pointer passed to the function
+ *		        e_eDSP_BIQUADFILTER_RES_NOINITLIB         - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_BIQUADFILTER_RES_CORRUPTCTX        - In case of an corrupted context
+ *              e_eDSP_BIQUADFILTER_RES_OK                - Operation ended correctly
+ */
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_GetSatCnt(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx, uint32_t* const p_puSatCnt);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_BIQUADFILTER_H */
\ No newline at end of file
@@ -0,0 +1,155 @@
+/**
+ * @file       eDSP_CICDECIMATOR.h
+ *
+ * @brief      CIC (cascaded integrator-comb) decimator implementation
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_CICDECIMATOR_H
+#define EDSP_CICDECIMATOR_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eDSP_CICDECIMATOR_RES_OK = 0,
+    e_eDSP_CICDECIMATOR_RES_BADPOINTER,
+    e_eDSP_CICDECIMATOR_RES_BADPARAM,
+    e_eDSP_CICDECIMATOR_RES_NEEDSMOREVALUE,
+    e_eDSP_CICDECIMATOR_RES_CORRUPTCTX,
+    e_eDSP_CICDECIMATOR_RES_NOINITLIB
+}e_eDSP_CICDECIMATOR_RES;
+
+typedef struct
+{
+    bool_t    bIsInit;
+    uint32_t  uNStages;
+    uint32_t  uDecimRatio;
+    uint32_t  uSampleCnt;
+    uint64_t  uGain;
+    uint64_t* puStateBuffer;
+}t_eDSP_CICDECIMATOR_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the CIC decimator with used buffer. The filter is made of p_uNStages integrators running at
+ *              the input rate followed by p_uNStages combs with unitary differential delay running at the output rate.
+ *              No multiplication is done, integrators and combs use wraparound arithmetic on 64 bit: the
+ *              intermediate values can overflow, but the filtered value is exact until the real output fits in an
+ *              int64_t. The filtered value is not normalized, the DC gain of the filter is p_uDecimRatio^p_uNStages
+ *              and can be read with eDSP_CICDECIMATOR_GetGain.
+ *
+ * @param[in]   p_ptCtx             - CIC decimator context
+ * @param[in]   p_puStateBuffer     - Buffer that must be provided in order to store the integrators and combs status
+ * @param[in]   p_uStateBuffLen     - Numbers of element of the p_puStateBuffer, must be two times p_uNStages
+ * @param[in]   p_uNStages          - Numbers of integrator and comb stages, cannot be zero
+ * @param[in]   p_uDecimRatio       - Decimation ratio, one filtered value is returned every p_uDecimRatio inserted
+ *                                    values. Cannot be zero, and p_uDecimRatio^p_uNStages must fit in an int64_t
+ *
+ * @return      e_eDSP_CICDECIMATOR_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_CICDECIMATOR_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eDSP_CICDECIMATOR_RES_OK             - CIC decimator initialized successfully
+ */
+e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_InitCtx(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx, uint64_t* p_puStateBuffer,
+                                                  uint32_t p_uStateBuffLen, uint32_t p_uNStages, uint32_t p_uDecimRatio);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - CIC decimator context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eDSP_CICDECIMATOR_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eDSP_CICDECIMATOR_RES_OK            - Operation ended correctly
+ */
+e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_IsInit(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Get the DC gain of the CIC decimator, p_uDecimRatio^p_uNStages
+ *
+ * @param[in]   p_ptCtx         - CIC decimator context
+ * @param[out]  p_puGain        - Pointer to an uint64_t where the gain of the filter will be placed
+ *
+ * @return      e_eDSP_CICDECIMATOR_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eDSP_CICDECIMATOR_RES_NOINITLIB     - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_CICDECIMATOR_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eDSP_CICDECIMATOR_RES_OK            - Operation ended correctly
+ */
+e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_GetGain(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx, uint64_t* const p_puGain);
+
+/**
+ * @brief       Insert a new value in the CIC decimator. Every value updates the integrators, only one value every
+ *              p_uDecimRatio goes through the combs and generate a filtered value.
+ *
+ * @param[in]   p_ptCtx         - CIC decimator context
+ * @param[in]   p_iValue        - Current value that we want to filter
+ * @param[out]  p_pFilteredVal  - Pointer to an int64_t where the filtered value will be placed.
+ *
+ * @return      e_eDSP_CICDECIMATOR_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_CICDECIMATOR_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_CICDECIMATOR_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eDSP_CICDECIMATOR_RES_NEEDSMOREVALUE - Need to add more value to be able to calculate the next
+ *                                                       decimated value
+ *              e_eDSP_CICDECIMATOR_RES_OK             - Operation ended correctly
+ */
+e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_InsertValueAndCalculate(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx,
+                                                                  const int64_t p_iValue, int64_t* const p_pFilteredVal);
+
+/**
+ * @brief       Insert a block of values in the CIC decimator and calculate the filtered values. The context is
+ *              validated only once for the whole block. Values are processed in order, and every filtered value is
+ *              stored sequentially in p_piFilteredVal.
+ *
+ * @param[in]   p_ptCtx         - CIC decimator context
+ * @param[in]   p_piValues      - Pointer to the values that we want to filter
+ * @param[in]   p_uNValues      - Numbers of values in p_piValues, cannot be zero
+ * @param[out]  p_piFilteredVal - Pointer to a buffer of at least p_uNValues int64_t where the filtered values will be
+ *                                placed. Only one value every p_uDecimRatio inserted values is placed.
+ * @param[out]  p_puNFiltered   - Pointer to an uint32_t where the numbers of filtered values will be placed
+ * @param[out]  p_puNProcessed  - Pointer to an uint32_t where the numbers of values taken from p_piValues
+ *                                will be placed. Nothing can fail in the block, so it is always p_uNValues, it is
+ *                                reported like the other filters so every block filter is handled the same way
+ *
+ * @return      e_eDSP_CICDECIMATOR_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_CICDECIMATOR_RES_BADPARAM       - In case of an invalid parameter passed to the function.
+ *		        e_eDSP_CICDECIMATOR_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_CICDECIMATOR_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eDSP_CICDECIMATOR_RES_NEEDSMOREVALUE - All value inserted but no filtered value is available
+ *              e_eDSP_CICDECIMATOR_RES_OK             - Operation ended correctly
+ */
+e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_ProcessBlock(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx,
+                                                       const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                       int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                       uint32_t* const p_puNProcessed);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_CICDECIMATOR_H */
\ No newline at end of file
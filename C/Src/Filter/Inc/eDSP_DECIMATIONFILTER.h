@@ -51,8 +51,12 @@ typedef struct
     uint32_t uWindowsLen;
     uint32_t uFilledData;
     uint32_t uCurDataLocation;
-    int64_t* piWindowsBuffer;    
+    uint32_t uDecimRatio;
+    uint32_t uSinceLastOut;
+    int64_t* piWindowsBuffer;
     e_eDSP_DECIMATIONFILTER_TYPE eDecimType;
+    uint32_t uSatCnt;
+    e_eDSP_TYPE_OVFMODE eOvfMode;
 }t_eDSP_DECIMATIONFILTER_Ctx;
 
 
@@ -61,18 +65,22 @@ typedef struct
  * GLOBAL PROTOTYPES
  **********************************************************************************************************************/
 /**
- * @brief       Initialize the median filter with used buffer
+ * @brief       Initialize the decimator filter with used buffer
  *
  * @param[in]   p_ptCtx             - Decimator filter context
- * @param[in]   p_piWindowsBuffer   - Buffer that must be provided in order to calculate the median value
- * @param[in]   p_uWindowsBuffLen   - Numbers of element of the p_piWindowsBuffer, and len of the median windows.
+ * @param[in]   p_piWindowsBuffer   - Buffer that must be provided in order to calculate the decimated value
+ * @param[in]   p_uWindowsBuffLen   - Numbers of element of the p_piWindowsBuffer, and len of the decimator windows.
+ * @param[in]   p_eDecimType        - Value calculated on the window for every decimated output
+ * @param[in]   p_uDecimRatio       - Decimation ratio, one filtered value is returned every p_uDecimRatio inserted
+ *                                    values once the window is full. Cannot be zero.
  *
  * @return      e_eDSP_DECIMATIONFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
  *		        e_eDSP_DECIMATIONFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
  *              e_eDSP_DECIMATIONFILTER_RES_OK             - Decimator filter initialized successfully
  */
 e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_InitCtx(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx, int64_t* p_piWindowsBuffer, 
-                                                  uint32_t p_uWindowsBuffLen, e_eDSP_DECIMATIONFILTER_TYPE p_eDecimType);
+                                                  uint32_t p_uWindowsBuffLen, e_eDSP_DECIMATIONFILTER_TYPE p_eDecimType,
+                                                  uint32_t p_uDecimRatio);
 
 /**
  * @brief       Check if the lib is initialized
@@ -86,8 +94,10 @@ e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_InitCtx(t_eDSP_DECIMATIONFILTE
 e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_IsInit(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
 
 /**
- * @brief       Insert a new value for the median filter and calculate the filtered values. Keep in mind that during
- *              the first insertion we are not able o have some filtered data.
+ * @brief       Insert a new value in the decimator filter and calculate the filtered values. Keep in mind that during
+ *              the first insertion we are not able o have some filtered data. Once the window is full a filtered
+ *              value is calculated only every p_uDecimRatio inserted values, all the other insertion return
+ *              e_eDSP_DECIMATIONFILTER_RES_NEEDSMOREVALUE without doing any calculation.
  *
  * @param[in]   p_ptCtx         - Decimator filter context
  * @param[in]   p_iValue        - Current value that we want to filter
@@ -97,12 +107,77 @@ e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_IsInit(t_eDSP_DECIMATIONFILTER
  *		        e_eDSP_DECIMATIONFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function.
  *		        e_eDSP_DECIMATIONFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
  *		        e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX     - In case of an corrupted context
- *              e_eDSP_DECIMATIONFILTER_RES_NEEDSMOREVALUE - Need to add more value to be able to calculate the derivate
+ *              e_eDSP_DECIMATIONFILTER_RES_NEEDSMOREVALUE - Need to add more value to be able to calculate the next
+ *                                                           decimated value
  *              e_eDSP_DECIMATIONFILTER_RES_OK             - Operation ended correctly
  */
 e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_InsertValueAndCalculate(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx, 
                                                                   const int64_t p_iValue, int64_t* const p_pFilteredVal);
 
+/**
+ * @brief       Insert a block of values in the decimator filter and calculate the filtered values. The context is validated
+ *              only once for the whole block. Values are processed in order, and every filtered value is stored
+ *              sequentially in p_piFilteredVal. Processing stop at the first value that generate an error.
+ *              The window and the block are pre-scanned for their minimum and maximum: when no window sum can
+ *              overflow, every output of the block is calculated with unchecked arithmetic and the same result.
+ *
+ * @param[in]   p_ptCtx         - Decimator filter context
+ * @param[in]   p_piValues      - Pointer to the values that we want to filter
+ * @param[in]   p_uNValues      - Numbers of values in p_piValues, cannot be zero
+ * @param[out]  p_piFilteredVal - Pointer to a buffer of at least p_uNValues int64_t where the filtered values will be
+ *                                placed. Only one value every p_uDecimRatio inserted values is placed.
+ * @param[out]  p_puNFiltered   - Pointer to an uint32_t where the numbers of filtered values will be placed
+ * @param[out]  p_puNProcessed  - Pointer to an uint32_t where the numbers of values taken from p_piValues
+ *                                will be placed, the value that generated an error is counted too
+ *
+ * @return      e_eDSP_DECIMATIONFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_DECIMATIONFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function.
+ *		        e_eDSP_DECIMATIONFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_DECIMATIONFILTER_RES_OVERFLOW       - The last processed value generate an overflow
+ *              e_eDSP_DECIMATIONFILTER_RES_NEEDSMOREVALUE - All value inserted but no filtered value is available
+ *              e_eDSP_DECIMATIONFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_ProcessBlock(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx,
+                                                               const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                               int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                               uint32_t* const p_puNProcessed);
+
+/**
+ * @brief       Select how the arithmetic overflow are managed. With e_eDSP_TYPE_OVFMODE_ERROR, the default after
+ *              the init, an overflow is reported as e_eDSP_DECIMATIONFILTER_RES_OVERFLOW.
+ *              With e_eDSP_TYPE_OVFMODE_SATURATE every operation is clamped to the int64_t storage area and counted,
+ *              so no value is discarded. Setting the mode restart the count of the saturated operations.
+ *
+ * @param[in]   p_ptCtx         - Decimator filter context
+ * @param[in]   p_eOvfMode      - Overflow mode to use
+ *
+ * @return      e_eDSP_DECIMATIONFILTER_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eDSP_DECIMATIONFILTER_RES_NOINITLIB     - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX    - In case of an corrupted context
+ *		        e_eDSP_DECIMATIONFILTER_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *              e_eDSP_DECIMATIONFILTER_RES_OK            - Operation ended correctly
+ */
+e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_SetOvfMode(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx,
+                                                             e_eDSP_TYPE_OVFMODE p_eOvfMode);
+
+/**
+ * @brief       Get the numbers of operation clamped since the overflow mode was set. The counter is sticky, it
+ *              never wrap around.
+ *
+ * @param[in]   p_ptCtx         - Decimator filter context
+ * @param[out]  p_puSatCnt      - Pointer to an uint32_t where the numbers of saturated operation will be placed
+ *
+ * @return      e_eDSP_DECIMATIONFILTER_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eDSP_DECIMATIONFILTER_RES_NOINITLIB     - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eDSP_DECIMATIONFILTER_RES_OK            - Operation ended correctly
+ */
+e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_GetSatCnt(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx,
+                                                            uint32_t* const p_puSatCnt);
+
 
 
 #ifdef __cplusplus
@@ -1,7 +1,7 @@
 /**
  * @file       eDSP_DOWNSAMPLE.h
  *
- * @brief      Decimator filter implementation
+ * @brief      Downsampler implementation
  *
  * @author     Lorenzo Rosin
  *
@@ -42,11 +42,8 @@ typedef enum
 typedef struct
 {
     bool_t   bIsInit;
-    uint32_t uWindowsLen;
-    uint32_t uFilledData;
-    uint32_t uCurDataLocation;
-    int64_t* piWindowsBuffer;    
     uint32_t uDowSampleIndex;
+    uint32_t uSampleCnt;
 }t_eDSP_DOWNSAMPLE_Ctx;
 
 
@@ -55,23 +52,21 @@ typedef struct
  * GLOBAL PROTOTYPES
  **********************************************************************************************************************/
 /**
- * @brief       Initialize the median filter with used buffer
+ * @brief       Initialize the downsampler, one value every p_uDowSampleIndex inserted values is kept
  *
- * @param[in]   p_ptCtx             - Decimator filter context
- * @param[in]   p_piWindowsBuffer   - Buffer that must be provided in order to calculate the median value
- * @param[in]   p_uWindowsBuffLen   - Numbers of element of the p_piWindowsBuffer, and len of the median windows.
+ * @param[in]   p_ptCtx             - Downsampler context
+ * @param[in]   p_uDowSampleIndex   - Downsample ratio, cannot be zero
  *
  * @return      e_eDSP_DOWNSAMPLE_RES_BADPOINTER     - In case of bad pointer passed to the function
  *		        e_eDSP_DOWNSAMPLE_RES_BADPARAM       - In case of an invalid parameter passed to the function
- *              e_eDSP_DOWNSAMPLE_RES_OK             - Decimator filter initialized successfully
+ *              e_eDSP_DOWNSAMPLE_RES_OK             - Downsampler initialized successfully
  */
-e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_InitCtx(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCtx, int64_t* p_piWindowsBuffer, 
-                                              uint32_t p_uWindowsBuffLen, uint32_t p_uDowSampleIndex);
+e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_InitCtx(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCtx, uint32_t p_uDowSampleIndex);
 
 /**
  * @brief       Check if the lib is initialized
  *
- * @param[in]   p_ptCtx         - Decimator filter context
+ * @param[in]   p_ptCtx         - Downsampler context
  * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
  *
  * @return      e_eDSP_DOWNSAMPLE_RES_BADPOINTER    - In case of bad pointer passed to the function
@@ -80,12 +75,12 @@ e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_InitCtx(t_eDSP_DOWNSAMPLE_Ctx* const p_ptC
 e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_IsInit(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
 
 /**
- * @brief       Insert a new value for the median filter and calculate the filtered values. Keep in mind that during
- *              the first insertion we are not able o have some filtered data.
+ * @brief       Insert a new value in the downsampler. The first value inserted and then one value every
+ *              p_uDowSampleIndex are returned, for the other values no data is available.
  *
- * @param[in]   p_ptCtx         - Decimator filter context
- * @param[in]   p_iValue        - Current value that we want to filter
- * @param[out]  p_pFilteredVal  - Pointer to an int64_t where the value of the calculated derivate will be placed.
+ * @param[in]   p_ptCtx         - Downsampler context
+ * @param[in]   p_iValue        - Current value that we want to downsample
+ * @param[out]  p_pFilteredVal  - Pointer to an int64_t where the downsampled value will be placed.
  *
  * @return      e_eDSP_DOWNSAMPLE_RES_BADPOINTER     - In case of bad pointer passed to the function
  *		        e_eDSP_DOWNSAMPLE_RES_BADPARAM       - In case of an invalid parameter passed to the function.
@@ -97,6 +92,32 @@ e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_IsInit(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCt
 e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_InsertValueAndCalculate(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCtx, 
                                                                   const int64_t p_iValue, int64_t* const p_pFilteredVal);
 
+/**
+ * @brief       Insert a block of values in the downsampler and calculate the filtered values. The context is validated
+ *              only once for the whole block. Values are processed in order, and every filtered value is stored
+ *              sequentially in p_piFilteredVal. Processing stop at the first value that generate an error.
+ *
+ * @param[in]   p_ptCtx         - Downsampler context
+ * @param[in]   p_piValues      - Pointer to the values that we want to filter
+ * @param[in]   p_uNValues      - Numbers of values in p_piValues, cannot be zero
+ * @param[out]  p_piFilteredVal - Pointer to a buffer of at least p_uNValues int64_t where the filtered values will be
+ *                                placed
+ * @param[out]  p_puNFiltered   - Pointer to an uint32_t where the numbers of filtered values will be placed
+ * @param[out]  p_puNProcessed  - Pointer to an uint32_t where the numbers of values taken from p_piValues
+ *                                will be placed, the value that generated an error is counted too
+ *
+ * @return      e_eDSP_DOWNSAMPLE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_DOWNSAMPLE_RES_BADPARAM       - In case of an invalid parameter passed to the function.
+ *		        e_eDSP_DOWNSAMPLE_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_DOWNSAMPLE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eDSP_DOWNSAMPLE_RES_NEEDSMOREVALUE - All value inserted but no filtered value is available
+ *              e_eDSP_DOWNSAMPLE_RES_OK             - Operation ended correctly
+ */
+e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_ProcessBlock(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCtx,
+                                                   const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                   int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                   uint32_t* const p_puNProcessed);
+
 
 
 #ifdef __cplusplus
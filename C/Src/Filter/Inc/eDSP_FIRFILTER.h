@@ -0,0 +1,198 @@
+/**
+ * @file       eDSP_FIRFILTER.h
+ *
+ * @brief      Polyphase FIR filter, decimator and interpolator implementation
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_FIRFILTER_H
+#define EDSP_FIRFILTER_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eDSP_FIRFILTER_RES_OK = 0,
+    e_eDSP_FIRFILTER_RES_BADPOINTER,
+    e_eDSP_FIRFILTER_RES_BADPARAM,
+    e_eDSP_FIRFILTER_RES_OVERFLOW,
+    e_eDSP_FIRFILTER_RES_NEEDSMOREVALUE,
+    e_eDSP_FIRFILTER_RES_CORRUPTCTX,
+    e_eDSP_FIRFILTER_RES_NOINITLIB
+}e_eDSP_FIRFILTER_RES;
+
+typedef struct
+{
+    bool_t   bIsInit;
+    uint32_t uNCoeff;
+    uint32_t uCoeffQ;
+    uint32_t uInterpFactor;
+    uint32_t uDecimFactor;
+    uint32_t uHistoryLen;
+    uint32_t uCurDataLocation;
+    uint32_t uNextOutPhase;
+    const int32_t* piCoeff;
+    int64_t* piHistoryBuffer;
+    uint32_t uSatCnt;
+    e_eDSP_TYPE_OVFMODE eOvfMode;
+}t_eDSP_FIRFILTER_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the FIR filter with used buffer. The input is interpolated by p_uInterpFactor (L), filtered
+ *              with the p_piCoeff FIR and then decimated by p_uDecimFactor (M). The filter is evaluated in polyphase
+ *              form: the zeros inserted by the interpolation are never multiplied and only the outputs that survive
+ *              the decimation are calculated, so every output cost p_uNCoeff / L multiply accumulate. With L and M
+ *              equal to one the module is a plain FIR filter. The history starts filled with zero.
+ *
+ * @param[in]   p_ptCtx             - FIR filter context
+ * @param[in]   p_piCoeff           - Coefficients of the filter, at the interpolated rate, in Q format. The buffer is
+ *                                    not copied and must stay valid for the whole life of the context.
+ * @param[in]   p_uNCoeff           - Numbers of element of the p_piCoeff buffer, cannot be zero
+ * @param[in]   p_uCoeffQ           - Numbers of fractional bit of the coefficients, cannot be greater than 31
+ * @param[in]   p_piHistoryBuffer   - Buffer that must be provided in order to store the last input values
+ * @param[in]   p_uHistoryBuffLen   - Numbers of element of the p_piHistoryBuffer, must be equals to the numbers of
+ *                                    coefficients of every phase: ( p_uNCoeff + L - 1 ) / L
+ * @param[in]   p_uInterpFactor     - Interpolation factor L, cannot be zero or greater than MAX_UINT16VAL
+ * @param[in]   p_uDecimFactor      - Decimation factor M, cannot be zero or greater than MAX_UINT16VAL
+ *
+ * @return      e_eDSP_FIRFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_FIRFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eDSP_FIRFILTER_RES_OK             - FIR filter initialized successfully
+ */
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_InitCtx(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, const int32_t* p_piCoeff,
+                                            uint32_t p_uNCoeff, uint32_t p_uCoeffQ, int64_t* p_piHistoryBuffer,
+                                            uint32_t p_uHistoryBuffLen, uint32_t p_uInterpFactor,
+                                            uint32_t p_uDecimFactor);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - FIR filter context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eDSP_FIRFILTER_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eDSP_FIRFILTER_RES_OK            - Operation ended correctly
+ */
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_IsInit(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Insert a new value in the FIR filter and calculate the filtered values. The inserted value can generate
+ *              from zero up to ( L + M - 1 ) / M filtered values, that are stored sequentially in p_piFilteredVal.
+ *              With L not greater than M at most one filtered value is generated. When a filtered value overflow
+ *              it is discarded, the value is inserted anyway.
+ *
+ * @param[in]   p_ptCtx             - FIR filter context
+ * @param[in]   p_iValue            - Current value that we want to filter
+ * @param[out]  p_piFilteredVal     - Pointer to a buffer where the filtered values will be placed
+ * @param[in]   p_uFilteredBuffLen  - Numbers of element of p_piFilteredVal, must be enough to store all the filtered
+ *                                    values generated by the inserted value
+ * @param[out]  p_puNFiltered       - Pointer to an uint32_t where the numbers of filtered values will be placed
+ *
+ * @return      e_eDSP_FIRFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_FIRFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eDSP_FIRFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_FIRFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_FIRFILTER_RES_OVERFLOW       - A filtered value generate an overflow
+ *              e_eDSP_FIRFILTER_RES_NEEDSMOREVALUE - Need to add more value to be able to calculate the next
+ *                                                    filtered value
+ *              e_eDSP_FIRFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_InsertValueAndCalculate(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, const int64_t p_iValue,
+                                                            int64_t* const p_piFilteredVal,
+                                                            const uint32_t p_uFilteredBuffLen,
+                                                            uint32_t* const p_puNFiltered);
+
+/**
+ * @brief       Insert a block of values in the FIR filter and calculate the filtered values. Every inserted value can
+ *              generate from zero up to ( L + M - 1 ) / M filtered values, that are stored sequentially in
+ *              p_piFilteredVal. The context is validated only once for the whole block. When a filtered value
+ *              overflow it is discarded and the processing stop after the value that generated it.
+ *
+ * @param[in]   p_ptCtx             - FIR filter context
+ * @param[in]   p_piValues          - Pointer to the values that we want to filter
+ * @param[in]   p_uNValues          - Numbers of values in p_piValues, cannot be zero
+ * @param[out]  p_piFilteredVal     - Pointer to a buffer where the filtered values will be placed
+ * @param[in]   p_uFilteredBuffLen  - Numbers of element of p_piFilteredVal, must be enough to store all the filtered
+ *                                    values generated by the block
+ * @param[out]  p_puNFiltered       - Pointer to an uint32_t where the numbers of filtered values will be placed
+ * @param[out]  p_puNProcessed      - Pointer to an uint32_t where the numbers of values taken from p_piValues
+ *                                    will be placed, the value that generated an error is counted too
+ *
+ * @return      e_eDSP_FIRFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_FIRFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function.
+ *		        e_eDSP_FIRFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_FIRFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_FIRFILTER_RES_OVERFLOW       - The last processed value generate an overflow
+ *              e_eDSP_FIRFILTER_RES_NEEDSMOREVALUE - All value inserted but no filtered value is available
+ *              e_eDSP_FIRFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_ProcessBlock(t_eDSP_FIRFILTER_Ctx* const p_ptCtx,
+                                                 const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                 int64_t* const p_piFilteredVal, const uint32_t p_uFilteredBuffLen,
+                                                 uint32_t* const p_puNFiltered, uint32_t* const p_puNProcessed);
+
+/**
+ * @brief       Select how the arithmetic overflow are managed. With e_eDSP_TYPE_OVFMODE_ERROR, the default after
+ *              the init, an overflow is reported as e_eDSP_FIRFILTER_RES_OVERFLOW.
+ *              With e_eDSP_TYPE_OVFMODE_SATURATE every operation is clamped to the int64_t storage area and counted,
+ *              so no value is discarded. Setting the mode restart the count of the saturated operations.
+ *
+ * @param[in]   p_ptCtx         - FIR filter context
+ * @param[in]   p_eOvfMode      - Overflow mode to use
+ *
+ * @return      e_eDSP_FIRFILTER_RES_BADPOINTER           - In case of bad pointer passed to the function
+ *		        e_eDSP_FIRFILTER_RES_NOINITLIB            - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_FIRFILTER_RES_CORRUPTCTX           - In case of an corrupted context
+ *		        e_eDSP_FIRFILTER_RES_BADPARAM             - In case of an invalid parameter passed to the function
+ *              e_eDSP_FIRFILTER_RES_OK                   - Operation ended correctly
+ */
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_SetOvfMode(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, e_eDSP_TYPE_OVFMODE p_eOvfMode);
+
+/**
+ * @brief       Get the numbers of operation clamped since the overflow mode was set. The counter is sticky, it
+ *              never wrap around.
+ *
+ * @param[in]   p_ptCtx         - FIR filter context
+ * @param[out]  p_puSatCnt      - Pointer to an uint32_t where the numbers of saturated operation will be placed
+ *
+ * @return      e_eDSP_FIRFILTER_RES_BADPOINTER           - In case of bad pointer passed to the function
+ *		        e_eDSP_FIRFILTER_RES_NOINITLIB            - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_FIRFILTER_RES_CORRUPTCTX           - In case of an corrupted context
+ *              e_eDSP_FIRFILTER_RES_OK                   - Operation ended correctly
+ */
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_GetSatCnt(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, uint32_t* const p_puSatCnt);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_FIRFILTER_H */
\ No newline at end of file
@@ -39,11 +39,28 @@ typedef enum
     e_eDSP_FOHPASSFILTER_RES_NOINITLIB
 }e_eDSP_FOHPASSFILTER_RES;
 
+typedef struct
+{
+    uint32_t uDtKey;
+    uint32_t uCoeffQ31;
+}t_eDSP_FOHPASSFILTER_CoeffCache;
+
 typedef struct
 {
     bool_t   bIsInit;
+    bool_t   bHasPrevValue;
+    int64_t  iPrevInValue;
     int64_t  iPrevOutValue;
     uint64_t uCutFreqMilHz;
+    uint32_t uSamplePeriodUs;
+    uint32_t uBetaQ31;
+    uint32_t uCacheLen;
+    uint32_t uDtQuantShift;
+    uint32_t uCacheHit;
+    uint32_t uCacheMiss;
+    t_eDSP_FOHPASSFILTER_CoeffCache* ptCoeffCache;
+    uint32_t uSatCnt;
+    e_eDSP_TYPE_OVFMODE eOvfMode;
 }t_eDSP_FOHPASSFILTER_Ctx;
 
 
@@ -52,17 +69,21 @@ typedef struct
  * GLOBAL PROTOTYPES
  **********************************************************************************************************************/
 /**
- * @brief       Initialize the first order High pass filter
+ * @brief       Initialize the first order High pass filter. The filter coefficient beta = RC / ( RC + dt ) is
+ *              calculated here in Q31, so that every inserted value cost only one multiply and add with rounding:
+ *              Vout(i) = beta * ( Vout(i-1) + Vin(i) - Vin(i-1) )
  *
  * @param[in]   p_ptCtx            - First order High pass filter context
  * @param[in]   p_uCutFreqMilHz    - Cuttoff frequency of the first order High pass filter, in milli Hertz
+ * @param[in]   p_uSamplePeriodUs  - Time elapsed between two inserted values, in micro seconds
 
  *
  * @return      e_eDSP_FOHPASSFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
  *		        e_eDSP_FOHPASSFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
  *              e_eDSP_FOHPASSFILTER_RES_OK             - First order High pass filter initialized successfully
  */
-e_eDSP_FOHPASSFILTER_RES eDSP_FOHPASSFILTER_InitCtx(t_eDSP_FOHPASSFILTER_Ctx* const p_ptCtx, uint64_t p_uCutFreqMilHz);
+e_eDSP_FOHPASSFILTER_RES eDSP_FOHPASSFILTER_InitCtx(t_eDSP_FOHPASSFILTER_Ctx* const p_ptCtx, uint64_t p_uCutFreqMilHz,
+                                                    uint32_t p_uSamplePeriodUs);
 
 /**
  * @brief       Check if the lib is initialized
@@ -75,25 +96,155 @@ e_eDSP_FOHPASSFILTER_RES eDSP_FOHPASSFILTER_InitCtx(t_eDSP_FOHPASSFILTER_Ctx* co
  */
 e_eDSP_FOHPASSFILTER_RES eDSP_FOHPASSFILTER_IsInit(t_eDSP_FOHPASSFILTER_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
 
+/**
+ * @brief       Set the cache of beta coefficients used by eDSP_FOHPASSFILTER_InsertValueDtAndCalculate. The
+ *              time elapsed between two values is quantized in steps of 2^p_uDtQuantShift micro seconds and used as
+ *              key of a direct mapped cache, so that the division needed to calculate the coefficient is done only
+ *              when a new time step is found. All the entry of the cache and the hit/miss counters are cleared.
+ *
+ * @param[in]   p_ptCtx         - First order High pass filter context
+ * @param[in]   p_ptCache       - Buffer that must be provided in order to store the cached coefficients
+ * @param[in]   p_uCacheLen     - Numbers of element of p_ptCache, must be a power of two
+ * @param[in]   p_uDtQuantShift - Quantization step of the elapsed time, expressed as a power of two of micro
+ *                                seconds. Cannot be greater than 31
+ *
+ * @return      e_eDSP_FOHPASSFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_FOHPASSFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eDSP_FOHPASSFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eDSP_FOHPASSFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_FOHPASSFILTER_RES eDSP_FOHPASSFILTER_SetCoeffCache(t_eDSP_FOHPASSFILTER_Ctx* const p_ptCtx,
+                                                          t_eDSP_FOHPASSFILTER_CoeffCache* p_ptCache,
+                                                          uint32_t p_uCacheLen,
+                                                          uint32_t p_uDtQuantShift);
+
 /**
  * @brief       Insert a new value for the first order High pass filter and calculate the filtered values. Keep in mind
  *              that during the first insertion we are not able o have some filtered data.
  *
  * @param[in]   p_ptCtx         - First order High pass filter context
  * @param[in]   p_iValue        - Current value that we want to filter
- * @param[out]  p_pFilteredVal  - Pointer to an int64_t where the value of the calculated derivate will be placed.
+ * @param[out]  p_pFilteredVal  - Pointer to an int64_t where the filtered value will be placed.
  *
  * @return      e_eDSP_FOHPASSFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
  *		        e_eDSP_FOHPASSFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function.
  *		        e_eDSP_FOHPASSFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
  *		        e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX     - In case of an corrupted context
- *              e_eDSP_FOHPASSFILTER_RES_NEEDSMOREVALUE - Need to add more value to be able to calculate the derivate
+ *		        e_eDSP_FOHPASSFILTER_RES_OVERFLOW       - The inserted value generate an overflow
+ *              e_eDSP_FOHPASSFILTER_RES_NEEDSMOREVALUE - Need to add more value to be able to calculate the filtered
+ *                                                        value
  *              e_eDSP_FOHPASSFILTER_RES_OK             - Operation ended correctly
  */
 e_eDSP_FOHPASSFILTER_RES eDSP_FOHPASSFILTER_InsertValueAndCalculate(t_eDSP_FOHPASSFILTER_Ctx* const p_ptCtx,
                                                                     const int64_t p_iValue,
                                                                     int64_t* const p_pFilteredVal);
 
+/**
+ * @brief       Insert a new value for the first order High pass filter, using the time elapsed from the previous
+ *              value in place of the sample period passed to eDSP_FOHPASSFILTER_InitCtx. The beta coefficient
+ *              of the elapsed time is read from the cache set with eDSP_FOHPASSFILTER_SetCoeffCache, and
+ *              calculated only on a cache miss. Without a cache the coefficient is calculated for every value.
+ *
+ * @param[in]   p_ptCtx             - First order High pass filter context
+ * @param[in]   p_iValue            - Current value that we want to filter
+ * @param[in]   p_uTimeFromLastUs   - Time elapsed from the previously inserted value, in micro seconds. Cannot be
+ *                                    zero
+ * @param[out]  p_pFilteredVal      - Pointer to an int64_t where the filtered value will be placed.
+ *
+ * @return      e_eDSP_FOHPASSFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_FOHPASSFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function.
+ *		        e_eDSP_FOHPASSFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_FOHPASSFILTER_RES_OVERFLOW       - The inserted value generate an overflow
+ *              e_eDSP_FOHPASSFILTER_RES_NEEDSMOREVALUE - Need to add more value to be able to calculate the filtered
+ *                                                        value
+ *              e_eDSP_FOHPASSFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_FOHPASSFILTER_RES eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(t_eDSP_FOHPASSFILTER_Ctx* const p_ptCtx,
+                                                                      const int64_t p_iValue,
+                                                                      const uint32_t p_uTimeFromLastUs,
+                                                                      int64_t* const p_pFilteredVal);
+
+/**
+ * @brief       Insert a block of values in the first order High pass filter and calculate the filtered values. The
+ *              context is validated only once for the whole block. Values are processed in order, and every filtered
+ *              value is stored sequentially in p_piFilteredVal. Processing stop at the first value that generate an
+ *              error.
+ *
+ * @param[in]   p_ptCtx         - First order High pass filter context
+ * @param[in]   p_piValues      - Pointer to the values that we want to filter
+ * @param[in]   p_uNValues      - Numbers of values in p_piValues, cannot be zero
+ * @param[out]  p_piFilteredVal - Pointer to a buffer of at least p_uNValues int64_t where the filtered values will be
+ *                                placed
+ * @param[out]  p_puNFiltered   - Pointer to an uint32_t where the numbers of filtered values will be placed
+ * @param[out]  p_puNProcessed  - Pointer to an uint32_t where the numbers of values taken from p_piValues
+ *                                will be placed, the value that generated an error is counted too
+ *
+ * @return      e_eDSP_FOHPASSFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_FOHPASSFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function.
+ *		        e_eDSP_FOHPASSFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_FOHPASSFILTER_RES_OVERFLOW       - The last processed value generate an overflow
+ *              e_eDSP_FOHPASSFILTER_RES_NEEDSMOREVALUE - All value inserted but no filtered value is available
+ *              e_eDSP_FOHPASSFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_FOHPASSFILTER_RES eDSP_FOHPASSFILTER_ProcessBlock(t_eDSP_FOHPASSFILTER_Ctx* const p_ptCtx,
+                                                         const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                         int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                         uint32_t* const p_puNProcessed);
+
+/**
+ * @brief       Get the numbers of cache hit and miss of the coefficient cache since it was set
+ *
+ * @param[in]   p_ptCtx         - First order High pass filter context
+ * @param[out]  p_puHit         - Pointer to an uint32_t where the numbers of cache hit will be placed
+ * @param[out]  p_puMiss        - Pointer to an uint32_t where the numbers of cache miss will be placed
+ *
+ * @return      e_eDSP_FOHPASSFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_FOHPASSFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eDSP_FOHPASSFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_FOHPASSFILTER_RES eDSP_FOHPASSFILTER_GetCacheStats(t_eDSP_FOHPASSFILTER_Ctx* const p_ptCtx,
+                                                          uint32_t* const p_puHit,
+                                                          uint32_t* const p_puMiss);
+
+/**
+ * @brief       Select how the arithmetic overflow are managed. With e_eDSP_TYPE_OVFMODE_ERROR, the default after
+ *              the init, an overflow is reported as e_eDSP_FOHPASSFILTER_RES_OVERFLOW.
+ *              With e_eDSP_TYPE_OVFMODE_SATURATE every operation is clamped to the int64_t storage area and counted,
+ *              so no value is discarded. Setting the mode restart the count of the saturated operations.
+ *
+ * @param[in]   p_ptCtx         - First order High pass filter context
+ * @param[in]   p_eOvfMode      - Overflow mode to use
+ *
+ * @return      e_eDSP_FOHPASSFILTER_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eDSP_FOHPASSFILTER_RES_NOINITLIB        - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX       - In case of an corrupted context
+ *		        e_eDSP_FOHPASSFILTER_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *              e_eDSP_FOHPASSFILTER_RES_OK               - Operation ended correctly
+ */
+e_eDSP_FOHPASSFILTER_RES eDSP_FOHPASSFILTER_SetOvfMode(t_eDSP_FOHPASSFILTER_Ctx* const p_ptCtx,
+                                                       e_eDSP_TYPE_OVFMODE p_eOvfMode);
+
+/**
+ * @brief       Get the numbers of operation clamped since the overflow mode was set. The counter is sticky, it
+ *              never wrap around.
+ *
+ * @param[in]   p_ptCtx         - First order High pass filter context
+ * @param[out]  p_puSatCnt      - Pointer to an uint32_t where the numbers of saturated operation will be placed
+ *
+ * @return      e_eDSP_FOHPASSFILTER_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eDSP_FOHPASSFILTER_RES_NOINITLIB        - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX       - In case of an corrupted context
+ *              e_eDSP_FOHPASSFILTER_RES_OK               - Operation ended correctly
+ */
+e_eDSP_FOHPASSFILTER_RES eDSP_FOHPASSFILTER_GetSatCnt(t_eDSP_FOHPASSFILTER_Ctx* const p_ptCtx,
+                                                      uint32_t* const p_puSatCnt);
+
 
 
 #ifdef __cplusplus
@@ -0,0 +1,161 @@
+/**
+ * @file       eDSP_MCFOHPASSFILTER.h
+ *
+ * @brief      Multi channel first order High pass filter implementation
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_MCFOHPASSFILTER_H
+#define EDSP_MCFOHPASSFILTER_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eDSP_MCFOHPASSFILTER_RES_OK = 0,
+    e_eDSP_MCFOHPASSFILTER_RES_BADPOINTER,
+    e_eDSP_MCFOHPASSFILTER_RES_BADPARAM,
+    e_eDSP_MCFOHPASSFILTER_RES_OVERFLOW,
+    e_eDSP_MCFOHPASSFILTER_RES_NEEDSMOREVALUE,
+    e_eDSP_MCFOHPASSFILTER_RES_CORRUPTCTX,
+    e_eDSP_MCFOHPASSFILTER_RES_NOINITLIB
+}e_eDSP_MCFOHPASSFILTER_RES;
+
+typedef struct
+{
+    bool_t   bIsInit;
+    bool_t   bHasPrevValue;
+    uint32_t uNChannels;
+    uint64_t uCutFreqMilHz;
+    uint32_t uSamplePeriodUs;
+    uint32_t uBetaQ31;
+    int64_t* piPrevInValue;
+    int64_t* piPrevOutValue;
+    uint32_t uSatCnt;
+    e_eDSP_TYPE_OVFMODE eOvfMode;
+}t_eDSP_MCFOHPASSFILTER_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the multi channel first order High pass filter. All the channels share the same cutoff
+ *              frequency and sample period, and are advanced together by one tick. The status of every channel is its
+ *              previous input and output, stored in p_piPrevInBuffer and p_piPrevOutBuffer so that a tick read and
+ *              write contiguous memory. Every channel is calculated like eDSP_FOHPASSFILTER:
+ *              Vout(i) = beta * ( Vout(i-1) + Vin(i) - Vin(i-1) )
+ *
+ * @param[in]   p_ptCtx             - Multi channel first order High pass filter context
+ * @param[in]   p_piPrevInBuffer    - Buffer of p_uNChannels element used to store the previous input of every channel
+ * @param[in]   p_piPrevOutBuffer   - Buffer of p_uNChannels element used to store the previous output of every channel
+ * @param[in]   p_uNChannels        - Numbers of channels, cannot be zero
+ * @param[in]   p_uCutFreqMilHz     - Cuttoff frequency of the filter, in milli Hertz
+ * @param[in]   p_uSamplePeriodUs   - Time elapsed between two ticks, in micro seconds
+ *
+ * @return      e_eDSP_MCFOHPASSFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_MCFOHPASSFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eDSP_MCFOHPASSFILTER_RES_OK             - Filter initialized successfully
+ */
+e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_InitCtx(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx,
+                                                        int64_t* p_piPrevInBuffer, int64_t* p_piPrevOutBuffer,
+                                                        uint32_t p_uNChannels, uint64_t p_uCutFreqMilHz,
+                                                        uint32_t p_uSamplePeriodUs);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - Multi channel first order High pass filter context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eDSP_MCFOHPASSFILTER_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eDSP_MCFOHPASSFILTER_RES_OK            - Operation ended correctly
+ */
+e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_IsInit(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Insert one new value for every channel and calculate the filtered value of every channel. The
+ *              context is validated only once for all the channels. The first tick is used as reference for the next
+ *              one. A tick is applied to all the channels or to none: when a channel overflow no status and no
+ *              filtered value is updated. When the library is built for x86 with EDSP_CONFIG_X86SIMD defined,
+ *              the channels are processed by AVX2 or AVX-512 kernels selected at run time, with the same result.
+ *
+ * @param[in]   p_ptCtx         - Multi channel first order High pass filter context
+ * @param[in]   p_piValues      - Pointer to p_uNChannels values, one for every channel
+ * @param[out]  p_piFilteredVal - Pointer to a buffer of p_uNChannels int64_t where the filtered values will be placed
+ *
+ * @return      e_eDSP_MCFOHPASSFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_MCFOHPASSFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_MCFOHPASSFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_MCFOHPASSFILTER_RES_OVERFLOW       - The values of at least one channel generate an overflow
+ *              e_eDSP_MCFOHPASSFILTER_RES_NEEDSMOREVALUE - Need to add more value to be able to filter
+ *              e_eDSP_MCFOHPASSFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_InsertValuesAndCalculate(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx,
+                                                                         const int64_t* p_piValues,
+                                                                         int64_t* const p_piFilteredVal);
+
+/**
+ * @brief       Select how the arithmetic overflow are managed. With e_eDSP_TYPE_OVFMODE_ERROR, the default after
+ *              the init, an overflow is reported as e_eDSP_MCFOHPASSFILTER_RES_OVERFLOW.
+ *              With e_eDSP_TYPE_OVFMODE_SATURATE every operation is clamped to the int64_t storage area and counted,
+ *              so no value is discarded. Setting the mode restart the count of the saturated operations.
+ *
+ * @param[in]   p_ptCtx         - Multi channel first order High pass filter context
+ * @param[in]   p_eOvfMode      - Overflow mode to use
+ *
+ * @return      e_eDSP_MCFOHPASSFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_MCFOHPASSFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_MCFOHPASSFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_MCFOHPASSFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eDSP_MCFOHPASSFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_SetOvfMode(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx,
+                                                           e_eDSP_TYPE_OVFMODE p_eOvfMode);
+
+/**
+ * @brief       Get the numbers of operation clamped since the overflow mode was set. The counter is sticky, it
+ *              never wrap around.
+ *
+ * @param[in]   p_ptCtx         - Multi channel first order High pass filter context
+ * @param[out]  p_puSatCnt      - Pointer to an uint32_t where the numbers of saturated operation will be placed
+ *
+ * @return      e_eDSP_MCFOHPASSFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_MCFOHPASSFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_MCFOHPASSFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eDSP_MCFOHPASSFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_GetSatCnt(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx,
+                                                          uint32_t* const p_puSatCnt);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_MCFOHPASSFILTER_H */
\ No newline at end of file
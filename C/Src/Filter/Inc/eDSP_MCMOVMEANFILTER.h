@@ -0,0 +1,164 @@
+/**
+ * @file       eDSP_MCMOVMEANFILTER.h
+ *
+ * @brief      Multi channel mean filter implementation
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_MCMOVMEANFILTER_H
+#define EDSP_MCMOVMEANFILTER_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eDSP_MCMOVMEANFILTER_RES_OK = 0,
+    e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER,
+    e_eDSP_MCMOVMEANFILTER_RES_BADPARAM,
+    e_eDSP_MCMOVMEANFILTER_RES_OVERFLOW,
+    e_eDSP_MCMOVMEANFILTER_RES_NEEDSMOREVALUE,
+    e_eDSP_MCMOVMEANFILTER_RES_CORRUPTCTX,
+    e_eDSP_MCMOVMEANFILTER_RES_NOINITLIB
+}e_eDSP_MCMOVMEANFILTER_RES;
+
+typedef struct
+{
+    bool_t    bIsInit;
+    uint32_t  uNChannels;
+    uint32_t  uWindowsLen;
+    uint32_t  uFilledData;
+    uint32_t  uCurDataLocation;
+    int64_t*  piWindowsBuffer;
+    uint64_t* puWindowsSumLow;
+    int64_t*  piWindowsSumHigh;
+    uint32_t  uSatCnt;
+    e_eDSP_TYPE_OVFMODE eOvfMode;
+}t_eDSP_MCMOVMEANFILTER_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the multi channel mean filter with used buffer. Every channel has its own windows, but all
+ *              the channels are advanced together by one tick. The status is stored as structure of arrays: the
+ *              windows buffer contains one row of p_uNChannels values for every position of the windows, and every
+ *              channel has one element in each running sum buffer. In this way every tick read and write only
+ *              contiguous memory.
+ *
+ * @param[in]   p_ptCtx             - Multi channel mean filter context
+ * @param[in]   p_piWindowsBuffer   - Buffer that must be provided in order to store the windows of every channel
+ * @param[in]   p_uWindowsBuffLen   - Numbers of element of the p_piWindowsBuffer, must be p_uWindowsLen * p_uNChannels
+ * @param[in]   p_puSumLowBuffer    - Buffer of p_uNChannels element used to store the low part of the running sums
+ * @param[in]   p_piSumHighBuffer   - Buffer of p_uNChannels element used to store the high part of the running sums
+ * @param[in]   p_uNChannels        - Numbers of channels, cannot be zero
+ * @param[in]   p_uWindowsLen       - Len of the mean windows, must be greater than two
+ *
+ * @return      e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_MCMOVMEANFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eDSP_MCMOVMEANFILTER_RES_OK             - Multi channel mean filter initialized successfully
+ */
+e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_InitCtx(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx,
+                                                        int64_t* p_piWindowsBuffer, uint32_t p_uWindowsBuffLen,
+                                                        uint64_t* p_puSumLowBuffer, int64_t* p_piSumHighBuffer,
+                                                        uint32_t p_uNChannels, uint32_t p_uWindowsLen);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - Multi channel mean filter context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eDSP_MCMOVMEANFILTER_RES_OK            - Operation ended correctly
+ */
+e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_IsInit(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Insert one new value for every channel and calculate the filtered value of every channel. The
+ *              context is validated only once for all the channels. Every channel behave like a
+ *              eDSP_MOVMEANFILTER: the values are always inserted, and the filtered value of a channel whose sum
+ *              exceed the int64_t storage area is left unchanged. When the library is built for x86 with
+ *              EDSP_CONFIG_X86SIMD defined, the running sums are updated by AVX2 or AVX-512 kernels selected at run
+ *              time, with the same result.
+ *
+ * @param[in]   p_ptCtx         - Multi channel mean filter context
+ * @param[in]   p_piValues      - Pointer to p_uNChannels values, one for every channel
+ * @param[out]  p_piFilteredVal - Pointer to a buffer of p_uNChannels int64_t where the filtered values will be placed
+ *
+ * @return      e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_MCMOVMEANFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_MCMOVMEANFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_MCMOVMEANFILTER_RES_OVERFLOW       - The sum of the windows of at least one channel exceed the
+ *                                                          int64_t storage area, the values are inserted anyway
+ *              e_eDSP_MCMOVMEANFILTER_RES_NEEDSMOREVALUE - Need to add more value to be able to calculate the mean
+ *              e_eDSP_MCMOVMEANFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_InsertValuesAndCalculate(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx,
+                                                                         const int64_t* p_piValues,
+                                                                         int64_t* const p_piFilteredVal);
+
+/**
+ * @brief       Select how the arithmetic overflow are managed. With e_eDSP_TYPE_OVFMODE_ERROR, the default after
+ *              the init, an overflow is reported as e_eDSP_MCMOVMEANFILTER_RES_OVERFLOW.
+ *              With e_eDSP_TYPE_OVFMODE_SATURATE every operation is clamped to the int64_t storage area and counted,
+ *              so no value is discarded. Setting the mode restart the count of the saturated operations.
+ *
+ * @param[in]   p_ptCtx         - Multi channel mean filter context
+ * @param[in]   p_eOvfMode      - Overflow mode to use
+ *
+ * @return      e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_MCMOVMEANFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_MCMOVMEANFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_MCMOVMEANFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eDSP_MCMOVMEANFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_SetOvfMode(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx,
+                                                           e_eDSP_TYPE_OVFMODE p_eOvfMode);
+
+/**
+ * @brief       Get the numbers of operation clamped since the overflow mode was set. The counter is sticky, it
+ *              never wrap around.
+ *
+ * @param[in]   p_ptCtx         - Multi channel mean filter context
+ * @param[out]  p_puSatCnt      - Pointer to an uint32_t where the numbers of saturated operation will be placed
+ *
+ * @return      e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_MCMOVMEANFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_MCMOVMEANFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eDSP_MCMOVMEANFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_GetSatCnt(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx,
+                                                          uint32_t* const p_puSatCnt);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_MCMOVMEANFILTER_H */
\ No newline at end of file
@@ -45,7 +45,10 @@ typedef struct
     uint32_t uWindowsLen;
     uint32_t uFilledData;
     uint32_t uCurDataLocation;
-    int64_t* piWindowsBuffer;    
+    int64_t* piWindowsBuffer;
+    uint32_t* puHeapBuffer;
+    uint32_t uSatCnt;
+    e_eDSP_TYPE_OVFMODE eOvfMode;
 }t_eDSP_MOVMEDIANFILTER_Ctx;
 
 
@@ -54,18 +57,24 @@ typedef struct
  * GLOBAL PROTOTYPES
  **********************************************************************************************************************/
 /**
- * @brief       Initialize the median filter with used buffer
+ * @brief       Initialize the median filter with used buffer. The values of the windows are kept ordered in two heap,
+ *              a max heap with the lower half of the values and a min heap with the upper half, joined by the median
+ *              value. In this way every insertion cost O(log(N)) and the median is always available.
  *
  * @param[in]   p_ptCtx             - Median filter context
  * @param[in]   p_piWindowsBuffer   - Buffer that must be provided in order to calculate the median value
  * @param[in]   p_uWindowsBuffLen   - Numbers of element of the p_piWindowsBuffer, and len of the median windows.
+ *                                    Must be greater than two and lower than 2^30
+ * @param[in]   p_puHeapBuffer      - Buffer that must be provided in order to store the heap index of the values
+ * @param[in]   p_uHeapBuffLen      - Numbers of element of the p_puHeapBuffer, must be two times p_uWindowsBuffLen
  *
  * @return      e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
  *		        e_eDSP_MOVMEDIANFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
  *              e_eDSP_MOVMEDIANFILTER_RES_OK             - Median filter initialized successfully
  */
 e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_InitCtx(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, int64_t* p_piWindowsBuffer, 
-                                                  uint32_t p_uWindowsBuffLen);
+                                                  uint32_t p_uWindowsBuffLen, uint32_t* p_puHeapBuffer,
+                                                  uint32_t p_uHeapBuffLen);
 
 /**
  * @brief       Check if the lib is initialized
@@ -80,7 +89,8 @@ e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_IsInit(t_eDSP_MOVMEDIANFILTER_Ct
 
 /**
  * @brief       Insert a new value for the median filter and calculate the filtered values. Keep in mind that during
- *              the first insertion we are not able o have some filtered data.
+ *              the first insertion we are not able o have some filtered data. When the windows len is even the
+ *              returned value is the mean of the two central values.
  *
  * @param[in]   p_ptCtx         - Median filter context
  * @param[in]   p_iValue        - Current value that we want to filter
@@ -90,12 +100,76 @@ e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_IsInit(t_eDSP_MOVMEDIANFILTER_Ct
  *		        e_eDSP_MOVMEDIANFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function.
  *		        e_eDSP_MOVMEDIANFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
  *		        e_eDSP_MOVMEDIANFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_MOVMEDIANFILTER_RES_OVERFLOW       - The sum of the two central values exceed the int64_t
+ *                                                          storage area, the value is inserted anyway
  *              e_eDSP_MOVMEDIANFILTER_RES_NEEDSMOREVALUE - Need to add more value to be able to calculate the derivate
  *              e_eDSP_MOVMEDIANFILTER_RES_OK             - Operation ended correctly
  */
 e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, 
                                                                   const int64_t p_iValue, int64_t* const p_pFilteredVal);
 
+/**
+ * @brief       Insert a block of values in the median filter and calculate the filtered values. The context is validated
+ *              only once for the whole block. Values are processed in order, and every filtered value is stored
+ *              sequentially in p_piFilteredVal. Processing stop at the first value that generate an error.
+ *
+ * @param[in]   p_ptCtx         - Median filter context
+ * @param[in]   p_piValues      - Pointer to the values that we want to filter
+ * @param[in]   p_uNValues      - Numbers of values in p_piValues, cannot be zero
+ * @param[out]  p_piFilteredVal - Pointer to a buffer of at least p_uNValues int64_t where the filtered values will be
+ *                                placed
+ * @param[out]  p_puNFiltered   - Pointer to an uint32_t where the numbers of filtered values will be placed
+ * @param[out]  p_puNProcessed  - Pointer to an uint32_t where the numbers of values taken from p_piValues
+ *                                will be placed, the value that generated an error is counted too
+ *
+ * @return      e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_MOVMEDIANFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function.
+ *		        e_eDSP_MOVMEDIANFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_MOVMEDIANFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_MOVMEDIANFILTER_RES_OVERFLOW       - The last processed value generate an overflow
+ *              e_eDSP_MOVMEDIANFILTER_RES_NEEDSMOREVALUE - All value inserted but no filtered value is available
+ *              e_eDSP_MOVMEDIANFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_ProcessBlock(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx,
+                                                             const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                             int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                             uint32_t* const p_puNProcessed);
+
+/**
+ * @brief       Select how the arithmetic overflow are managed. With e_eDSP_TYPE_OVFMODE_ERROR, the default after
+ *              the init, an overflow is reported as e_eDSP_MOVMEDIANFILTER_RES_OVERFLOW.
+ *              With e_eDSP_TYPE_OVFMODE_SATURATE every operation is clamped to the int64_t storage area and counted,
+ *              so no value is discarded. Setting the mode restart the count of the saturated operations.
+ *
+ * @param[in]   p_ptCtx         - Median filter context
+ * @param[in]   p_eOvfMode      - Overflow mode to use
+ *
+ * @return      e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_MOVMEDIANFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_MOVMEDIANFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_MOVMEDIANFILTER_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eDSP_MOVMEDIANFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_SetOvfMode(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx,
+                                                           e_eDSP_TYPE_OVFMODE p_eOvfMode);
+
+/**
+ * @brief       Get the numbers of operation clamped since the overflow mode was set. The counter is sticky, it
+ *              never wrap around.
+ *
+ * @param[in]   p_ptCtx         - Median filter context
+ * @param[out]  p_puSatCnt      - Pointer to an uint32_t where the numbers of saturated operation will be placed
+ *
+ * @return      e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_MOVMEDIANFILTER_RES_NOINITLIB      - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_MOVMEDIANFILTER_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eDSP_MOVMEDIANFILTER_RES_OK             - Operation ended correctly
+ */
+e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_GetSatCnt(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx,
+                                                          uint32_t* const p_puSatCnt);
+
 
 
 #ifdef __cplusplus
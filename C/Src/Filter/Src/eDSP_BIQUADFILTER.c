@@ -0,0 +1,508 @@
+/**
+ * @file       eDSP_BIQUADFILTER.c
+ *
+ * @brief      Cascade of biquad (second order IIR) filters implementation
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_BIQUADFILTER.h"
+#include "eDSP_MAXCHECK.h"
+#include "eDSP_SATARITH.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eDSP_BIQUADFILTER_IsStatusStillCoherent(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx);
+static e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_InsertValueCore(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                                 const int64_t p_iValue, int64_t* const p_pFilteredVal);
+static e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_CalcSection(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                             const uint32_t p_uSect, const int64_t p_iValue,
+                                                             int64_t* const p_pFilteredVal);
+static int64_t eDSP_BIQUADFILTER_CalcSectionNoOvf(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx, const uint32_t p_uSect,
+                                                  const int64_t p_iValue);
+static void eDSP_BIQUADFILTER_ShiftSection(t_eDSP_BIQUADFILTER_State* const p_ptState, const int64_t p_iValue,
+                                           const int64_t p_iFilteredVal);
+static e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_MulAcc(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx, int64_t* const p_piAcc,
+                                                        const int64_t p_iCoeff, const int64_t p_iValue);
+static e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_MaxCheckResToBQ(const e_eDSP_MAXCHECK_RES p_tMaxRet);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_InitCtx(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                  const t_eDSP_BIQUADFILTER_Coeff* p_ptCoeff,
+                                                  t_eDSP_BIQUADFILTER_State* p_ptState, uint32_t p_uNSections,
+                                                  uint32_t p_uCoeffQ)
+{
+	/* Local variable */
+	e_eDSP_BIQUADFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptCoeff ) || ( NULL == p_ptState ) )
+	{
+		l_eRes = e_eDSP_BIQUADFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check data validity */
+		if( ( 0u == p_uNSections ) || ( p_uCoeffQ > 31u ) )
+		{
+			l_eRes = e_eDSP_BIQUADFILTER_RES_BADPARAM;
+		}
+		else
+		{
+			/* Initialize internal status */
+			p_ptCtx->bIsInit = true;
+			p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+			p_ptCtx->uSatCnt = 0u;
+			p_ptCtx->uNSections = p_uNSections;
+			p_ptCtx->uCoeffQ = p_uCoeffQ;
+			p_ptCtx->ptCoeff = p_ptCoeff;
+			p_ptCtx->ptState = p_ptState;
+			memset(p_ptState, 0, sizeof(t_eDSP_BIQUADFILTER_State) * p_uNSections);
+
+			/* All OK */
+			l_eRes = e_eDSP_BIQUADFILTER_RES_OK;
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_IsInit(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eDSP_BIQUADFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eDSP_BIQUADFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eDSP_BIQUADFILTER_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_InsertValueAndCalculate(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                                  const int64_t p_iValue, int64_t* const p_pFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_BIQUADFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pFilteredVal ) )
+	{
+		l_eRes = e_eDSP_BIQUADFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_BIQUADFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_BIQUADFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_BIQUADFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				l_eRes = eDSP_BIQUADFILTER_InsertValueCore(p_ptCtx, p_iValue, p_pFilteredVal);
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_ProcessBlock(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                       const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                       int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                       uint32_t* const p_puNProcessed)
+{
+	/* Local variable for return */
+	e_eDSP_BIQUADFILTER_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uNFiltered;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_piFilteredVal ) ||
+		( NULL == p_puNFiltered ) || ( NULL == p_puNProcessed ) )
+	{
+		l_eRes = e_eDSP_BIQUADFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_BIQUADFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_BIQUADFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_BIQUADFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( 0u == p_uNValues )
+				{
+					l_eRes = e_eDSP_BIQUADFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					/* Init variable */
+					l_uCnt = 0u;
+					l_uNFiltered = 0u;
+					l_eRes = e_eDSP_BIQUADFILTER_RES_NEEDSMOREVALUE;
+
+					/* Context is checked only once, every value of the block is processed without other check */
+					while( ( l_uCnt < p_uNValues ) && ( ( e_eDSP_BIQUADFILTER_RES_OK == l_eRes ) ||
+						   ( e_eDSP_BIQUADFILTER_RES_NEEDSMOREVALUE == l_eRes ) ) )
+					{
+						l_eRes = eDSP_BIQUADFILTER_InsertValueCore(p_ptCtx, p_piValues[l_uCnt],
+						                                           &p_piFilteredVal[l_uNFiltered]);
+
+						if( e_eDSP_BIQUADFILTER_RES_OK == l_eRes )
+						{
+							l_uNFiltered++;
+						}
+
+						/* Increase counter */
+						l_uCnt++;
+					}
+
+					/* Some value are filtered and the last one doesn't generate any error */
+					if( ( e_eDSP_BIQUADFILTER_RES_NEEDSMOREVALUE == l_eRes ) && ( l_uNFiltered > 0u ) )
+					{
+						l_eRes = e_eDSP_BIQUADFILTER_RES_OK;
+					}
+
+					*p_puNFiltered = l_uNFiltered;
+					*p_puNProcessed = l_uCnt;
+				}
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_SetOvfMode(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                     e_eDSP_TYPE_OVFMODE p_eOvfMode)
+{
+	/* Local variable */
+	e_eDSP_BIQUADFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_BIQUADFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_BIQUADFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_BIQUADFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_BIQUADFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
+				{
+					l_eRes = e_eDSP_BIQUADFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					l_eRes = e_eDSP_BIQUADFILTER_RES_OK;
+				}
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_GetSatCnt(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx, uint32_t* const p_puSatCnt)
+{
+	/* Local variable */
+	e_eDSP_BIQUADFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
+	{
+		l_eRes = e_eDSP_BIQUADFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_BIQUADFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_BIQUADFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_BIQUADFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puSatCnt = p_ptCtx->uSatCnt;
+				l_eRes = e_eDSP_BIQUADFILTER_RES_OK;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eDSP_BIQUADFILTER_IsStatusStillCoherent(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+    bool_t l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx->ptCoeff ) || ( NULL == p_ptCtx->ptState ) )
+	{
+		l_eRes = false;
+	}
+    else
+    {
+		/* Check data validity */
+		if( ( 0u == p_ptCtx->uNSections ) || ( p_ptCtx->uCoeffQ > 31u ) ||
+			( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) &&
+			  ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) ) )
+		{
+			l_eRes = false;
+		}
+		else
+		{
+			l_eRes = true;
+		}
+    }
+
+    return l_eRes;
+}
+
+static e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_InsertValueCore(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                                 const int64_t p_iValue, int64_t* const p_pFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_BIQUADFILTER_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uSect;
+	int64_t l_iSectVal;
+	int64_t l_iSectOut;
+
+	/* Init variable */
+	l_eRes = e_eDSP_BIQUADFILTER_RES_OK;
+	l_uSect = 0u;
+	l_iSectVal = p_iValue;
+
+	/* With e_eDSP_TYPE_OVFMODE_ERROR every section is checked before updating any status, so an overflow in a
+	   section doesn't leave the previous ones already advanced. The output of every section is the input of the
+	   next one */
+	if( e_eDSP_TYPE_OVFMODE_ERROR == p_ptCtx->eOvfMode )
+	{
+		while( ( e_eDSP_BIQUADFILTER_RES_OK == l_eRes ) && ( l_uSect < p_ptCtx->uNSections ) )
+		{
+			l_eRes = eDSP_BIQUADFILTER_CalcSection(p_ptCtx, l_uSect, l_iSectVal, &l_iSectVal);
+			l_uSect++;
+		}
+	}
+
+	if( e_eDSP_BIQUADFILTER_RES_OK == l_eRes )
+	{
+		/* Commit the whole cascade. Once checked the same operations can't overflow, so they are done again
+		   natively; with e_eDSP_TYPE_OVFMODE_SATURATE nothing can fail and the sections are clamped in a single
+		   pass */
+		l_iSectVal = p_iValue;
+
+		for( l_uSect = 0u; l_uSect < p_ptCtx->uNSections; l_uSect++ )
+		{
+			if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+			{
+				l_eRes = eDSP_BIQUADFILTER_CalcSection(p_ptCtx, l_uSect, l_iSectVal, &l_iSectOut);
+			}
+			else
+			{
+				l_iSectOut = eDSP_BIQUADFILTER_CalcSectionNoOvf(p_ptCtx, l_uSect, l_iSectVal);
+			}
+
+			eDSP_BIQUADFILTER_ShiftSection(&p_ptCtx->ptState[l_uSect], l_iSectVal, l_iSectOut);
+			l_iSectVal = l_iSectOut;
+		}
+
+		*p_pFilteredVal = l_iSectVal;
+	}
+
+	return l_eRes;
+}
+
+static e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_CalcSection(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx,
+                                                             const uint32_t p_uSect, const int64_t p_iValue,
+                                                             int64_t* const p_pFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_BIQUADFILTER_RES l_eRes;
+
+	/* Local variable for calculation */
+	const t_eDSP_BIQUADFILTER_Coeff* l_ptCoeff;
+	const t_eDSP_BIQUADFILTER_State* l_ptState;
+	int64_t l_iAcc;
+
+	l_ptCoeff = &p_ptCtx->ptCoeff[p_uSect];
+	l_ptState = &p_ptCtx->ptState[p_uSect];
+
+	/* y(i) = b0 x(i) + b1 x(i-1) + b2 x(i-2) - a1 y(i-1) - a2 y(i-2), every step checked for overflow */
+	l_iAcc = 0;
+	l_eRes = eDSP_BIQUADFILTER_MulAcc(p_ptCtx, &l_iAcc, (int64_t) l_ptCoeff->iB0, p_iValue);
+
+	if( e_eDSP_BIQUADFILTER_RES_OK == l_eRes )
+	{
+		l_eRes = eDSP_BIQUADFILTER_MulAcc(p_ptCtx, &l_iAcc, (int64_t) l_ptCoeff->iB1, l_ptState->iX1);
+	}
+
+	if( e_eDSP_BIQUADFILTER_RES_OK == l_eRes )
+	{
+		l_eRes = eDSP_BIQUADFILTER_MulAcc(p_ptCtx, &l_iAcc, (int64_t) l_ptCoeff->iB2, l_ptState->iX2);
+	}
+
+	if( e_eDSP_BIQUADFILTER_RES_OK == l_eRes )
+	{
+		l_eRes = eDSP_BIQUADFILTER_MulAcc(p_ptCtx, &l_iAcc, -( (int64_t) l_ptCoeff->iA1 ), l_ptState->iY1);
+	}
+
+	if( e_eDSP_BIQUADFILTER_RES_OK == l_eRes )
+	{
+		l_eRes = eDSP_BIQUADFILTER_MulAcc(p_ptCtx, &l_iAcc, -( (int64_t) l_ptCoeff->iA2 ), l_ptState->iY2);
+	}
+
+	if( e_eDSP_BIQUADFILTER_RES_OK == l_eRes )
+	{
+		/* Remove the Q format of the coefficients, the status is updated by the caller */
+		*p_pFilteredVal = l_iAcc / ( ( (int64_t) 1 ) << p_ptCtx->uCoeffQ );
+	}
+
+	return l_eRes;
+}
+
+static int64_t eDSP_BIQUADFILTER_CalcSectionNoOvf(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx, const uint32_t p_uSect,
+                                                  const int64_t p_iValue)
+{
+	/* Local variable for calculation */
+	const t_eDSP_BIQUADFILTER_Coeff* l_ptCoeff;
+	const t_eDSP_BIQUADFILTER_State* l_ptState;
+	int64_t l_iAcc;
+
+	l_ptCoeff = &p_ptCtx->ptCoeff[p_uSect];
+	l_ptState = &p_ptCtx->ptState[p_uSect];
+
+	/* Same operations of eDSP_BIQUADFILTER_CalcSection, in the same order, already checked for overflow */
+	l_iAcc = ( (int64_t) l_ptCoeff->iB0 ) * p_iValue;
+	l_iAcc += ( (int64_t) l_ptCoeff->iB1 ) * l_ptState->iX1;
+	l_iAcc += ( (int64_t) l_ptCoeff->iB2 ) * l_ptState->iX2;
+	l_iAcc += ( -( (int64_t) l_ptCoeff->iA1 ) ) * l_ptState->iY1;
+	l_iAcc += ( -( (int64_t) l_ptCoeff->iA2 ) ) * l_ptState->iY2;
+
+	return l_iAcc / ( ( (int64_t) 1 ) << p_ptCtx->uCoeffQ );
+}
+
+static void eDSP_BIQUADFILTER_ShiftSection(t_eDSP_BIQUADFILTER_State* const p_ptState, const int64_t p_iValue,
+                                           const int64_t p_iFilteredVal)
+{
+	/* Shift the delay lines */
+	p_ptState->iX2 = p_ptState->iX1;
+	p_ptState->iX1 = p_iValue;
+	p_ptState->iY2 = p_ptState->iY1;
+	p_ptState->iY1 = p_iFilteredVal;
+}
+
+static e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_MulAcc(t_eDSP_BIQUADFILTER_Ctx* const p_ptCtx, int64_t* const p_piAcc,
+                                                        const int64_t p_iCoeff, const int64_t p_iValue)
+{
+	/* Local variable for return */
+	e_eDSP_BIQUADFILTER_RES l_eRes;
+	e_eDSP_MAXCHECK_RES l_eMaxRes;
+
+	/* Local variable for calculation */
+	int64_t l_iProd;
+
+	if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+	{
+		/* Both steps are clamped, the accumulator is always updated */
+		l_iProd = eDSP_SATARITH_MulI64(p_iCoeff, p_iValue, &p_ptCtx->uSatCnt);
+		*p_piAcc = eDSP_SATARITH_AddI64(*p_piAcc, l_iProd, &p_ptCtx->uSatCnt);
+		l_eRes = e_eDSP_BIQUADFILTER_RES_OK;
+	}
+	else
+	{
+		l_eMaxRes = eDSP_MAXCHECK_MulI64(p_iCoeff, p_iValue, &l_iProd);
+		l_eRes = eDSP_BIQUADFILTER_MaxCheckResToBQ(l_eMaxRes);
+
+		if( e_eDSP_BIQUADFILTER_RES_OK == l_eRes )
+		{
+			/* The accumulator is updated only if the sum doesn't overflow */
+			l_eMaxRes = eDSP_MAXCHECK_AddI64(*p_piAcc, l_iProd, p_piAcc);
+			l_eRes = eDSP_BIQUADFILTER_MaxCheckResToBQ(l_eMaxRes);
+		}
+	}
+
+	return l_eRes;
+}
+
+static e_eDSP_BIQUADFILTER_RES eDSP_BIQUADFILTER_MaxCheckResToBQ(const e_eDSP_MAXCHECK_RES p_tMaxRet)
+{
+	e_eDSP_BIQUADFILTER_RES l_eRet;
+
+	if( e_eDSP_MAXCHECK_RES_OK == p_tMaxRet )
+	{
+		l_eRet = e_eDSP_BIQUADFILTER_RES_OK;
+	}
+	else
+	{
+		l_eRet = e_eDSP_BIQUADFILTER_RES_OVERFLOW;
+	}
+
+	return l_eRet;
+}
@@ -0,0 +1,348 @@
+/**
+ * @file       eDSP_CICDECIMATOR.c
+ *
+ * @brief      CIC (cascaded integrator-comb) decimator implementation
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_CICDECIMATOR.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eDSP_CICDECIMATOR_IsStatusStillCoherent(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx);
+static e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_InsertValueCore(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx,
+                                                                 const int64_t p_iValue, int64_t* const p_pFilteredVal);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_InitCtx(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx, uint64_t* p_puStateBuffer,
+                                                  uint32_t p_uStateBuffLen, uint32_t p_uNStages, uint32_t p_uDecimRatio)
+{
+	/* Local variable */
+	e_eDSP_CICDECIMATOR_RES l_eRes;
+	uint32_t l_uCnt;
+	uint64_t l_uGain;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puStateBuffer ) )
+	{
+		l_eRes = e_eDSP_CICDECIMATOR_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check data validity */
+		if( ( 0u == p_uNStages ) || ( 0u == p_uDecimRatio ) || ( p_uNStages > ( MAX_UINT32VAL / 2u ) ) ||
+			( p_uStateBuffLen != ( 2u * p_uNStages ) ) )
+		{
+			l_eRes = e_eDSP_CICDECIMATOR_RES_BADPARAM;
+		}
+		else
+		{
+			/* Calculate the gain of the filter, it must be representable in an int64_t */
+			l_eRes = e_eDSP_CICDECIMATOR_RES_OK;
+			l_uGain = 1u;
+			l_uCnt = 0u;
+
+			while( ( e_eDSP_CICDECIMATOR_RES_OK == l_eRes ) && ( l_uCnt < p_uNStages ) )
+			{
+				if( l_uGain > ( ( (uint64_t) MAX_INT64VAL ) / ( (uint64_t) p_uDecimRatio ) ) )
+				{
+					l_eRes = e_eDSP_CICDECIMATOR_RES_BADPARAM;
+				}
+				else
+				{
+					l_uGain = l_uGain * ( (uint64_t) p_uDecimRatio );
+					l_uCnt++;
+				}
+			}
+
+			if( e_eDSP_CICDECIMATOR_RES_OK == l_eRes )
+			{
+				/* Initialize internal status */
+				p_ptCtx->bIsInit = true;
+				p_ptCtx->uNStages = p_uNStages;
+				p_ptCtx->uDecimRatio = p_uDecimRatio;
+				p_ptCtx->uSampleCnt = 0u;
+				p_ptCtx->uGain = l_uGain;
+				p_ptCtx->puStateBuffer = p_puStateBuffer;
+				memset(p_puStateBuffer, 0, sizeof(uint64_t) * p_uStateBuffLen);
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_IsInit(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eDSP_CICDECIMATOR_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eDSP_CICDECIMATOR_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eDSP_CICDECIMATOR_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_GetGain(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx, uint64_t* const p_puGain)
+{
+	/* Local variable */
+	e_eDSP_CICDECIMATOR_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puGain ) )
+	{
+		l_eRes = e_eDSP_CICDECIMATOR_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_CICDECIMATOR_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_CICDECIMATOR_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_CICDECIMATOR_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puGain = p_ptCtx->uGain;
+				l_eRes = e_eDSP_CICDECIMATOR_RES_OK;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_InsertValueAndCalculate(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx,
+                                                                  const int64_t p_iValue, int64_t* const p_pFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_CICDECIMATOR_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pFilteredVal ) )
+	{
+		l_eRes = e_eDSP_CICDECIMATOR_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_CICDECIMATOR_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_CICDECIMATOR_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_CICDECIMATOR_RES_CORRUPTCTX;
+            }
+			else
+			{
+				l_eRes = eDSP_CICDECIMATOR_InsertValueCore(p_ptCtx, p_iValue, p_pFilteredVal);
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_ProcessBlock(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx,
+                                                       const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                       int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                       uint32_t* const p_puNProcessed)
+{
+	/* Local variable for return */
+	e_eDSP_CICDECIMATOR_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uNFiltered;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_piFilteredVal ) ||
+		( NULL == p_puNFiltered ) || ( NULL == p_puNProcessed ) )
+	{
+		l_eRes = e_eDSP_CICDECIMATOR_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_CICDECIMATOR_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_CICDECIMATOR_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_CICDECIMATOR_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( 0u == p_uNValues )
+				{
+					l_eRes = e_eDSP_CICDECIMATOR_RES_BADPARAM;
+				}
+				else
+				{
+					/* Init variable */
+					l_uCnt = 0u;
+					l_uNFiltered = 0u;
+					l_eRes = e_eDSP_CICDECIMATOR_RES_NEEDSMOREVALUE;
+
+					/* Context is checked only once, every value of the block is processed without other check */
+					while( ( l_uCnt < p_uNValues ) && ( ( e_eDSP_CICDECIMATOR_RES_OK == l_eRes ) ||
+						   ( e_eDSP_CICDECIMATOR_RES_NEEDSMOREVALUE == l_eRes ) ) )
+					{
+						l_eRes = eDSP_CICDECIMATOR_InsertValueCore(p_ptCtx, p_piValues[l_uCnt],
+						                                           &p_piFilteredVal[l_uNFiltered]);
+
+						if( e_eDSP_CICDECIMATOR_RES_OK == l_eRes )
+						{
+							l_uNFiltered++;
+						}
+
+						/* Increase counter */
+						l_uCnt++;
+					}
+
+					/* Some value are filtered and the last one doesn't generate any error */
+					if( ( e_eDSP_CICDECIMATOR_RES_NEEDSMOREVALUE == l_eRes ) && ( l_uNFiltered > 0u ) )
+					{
+						l_eRes = e_eDSP_CICDECIMATOR_RES_OK;
+					}
+
+					*p_puNFiltered = l_uNFiltered;
+					*p_puNProcessed = l_uCnt;
+				}
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eDSP_CICDECIMATOR_IsStatusStillCoherent(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+    bool_t l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx->puStateBuffer )
+	{
+		l_eRes = false;
+	}
+    else
+    {
+		/* Check data validity */
+		if( ( 0u == p_ptCtx->uNStages ) || ( p_ptCtx->uNStages > ( MAX_UINT32VAL / 2u ) ) ||
+			( 0u == p_ptCtx->uDecimRatio ) || ( p_ptCtx->uSampleCnt >= p_ptCtx->uDecimRatio ) ||
+			( 0u == p_ptCtx->uGain ) || ( p_ptCtx->uGain > ( (uint64_t) MAX_INT64VAL ) ) )
+		{
+			l_eRes = false;
+		}
+		else
+		{
+			l_eRes = true;
+		}
+    }
+
+    return l_eRes;
+}
+
+static e_eDSP_CICDECIMATOR_RES eDSP_CICDECIMATOR_InsertValueCore(t_eDSP_CICDECIMATOR_Ctx* const p_ptCtx,
+                                                                 const int64_t p_iValue, int64_t* const p_pFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_CICDECIMATOR_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint64_t l_uAcc;
+	uint64_t l_uPrev;
+	uint64_t* l_puIntegrator;
+	uint64_t* l_puComb;
+
+	/* Integrators are stored in the first half of the buffer, combs delay line in the second half */
+	l_puIntegrator = p_ptCtx->puStateBuffer;
+	l_puComb = &p_ptCtx->puStateBuffer[p_ptCtx->uNStages];
+
+	/* Integrator section, unsigned arithmetic is used to have a defined wraparound on overflow */
+	l_uAcc = (uint64_t) p_iValue;
+
+	for( l_uCnt = 0u; l_uCnt < p_ptCtx->uNStages; l_uCnt++ )
+	{
+		l_puIntegrator[l_uCnt] += l_uAcc;
+		l_uAcc = l_puIntegrator[l_uCnt];
+	}
+
+	/* Manage decimation */
+	p_ptCtx->uSampleCnt++;
+
+	if( p_ptCtx->uSampleCnt < p_ptCtx->uDecimRatio )
+	{
+		/* Need more data */
+		l_eRes = e_eDSP_CICDECIMATOR_RES_NEEDSMOREVALUE;
+	}
+	else
+	{
+		p_ptCtx->uSampleCnt = 0u;
+
+		/* Comb section, runs only at the output rate */
+		for( l_uCnt = 0u; l_uCnt < p_ptCtx->uNStages; l_uCnt++ )
+		{
+			l_uPrev = l_puComb[l_uCnt];
+			l_puComb[l_uCnt] = l_uAcc;
+			l_uAcc -= l_uPrev;
+		}
+
+		/* Wraparound cancel out, the result is the real output when it fits in an int64_t */
+		if( 0u != ( l_uAcc >> 63u ) )
+		{
+			/* Negative output, converted without an implementation defined cast */
+			*p_pFilteredVal = -( (int64_t) ( ~l_uAcc ) ) - 1;
+		}
+		else
+		{
+			*p_pFilteredVal = (int64_t) l_uAcc;
+		}
+
+		l_eRes = e_eDSP_CICDECIMATOR_RES_OK;
+	}
+
+	return l_eRes;
+}
\ No newline at end of file
@@ -12,6 +12,8 @@
  **********************************************************************************************************************/
 #include "eDSP_DECIMATIONFILTER.h"
 #include "eDSP_MAXCHECK.h"
+#include "eDSP_SATARITH.h"
+#include "eDSP_BLOCKSCAN.h"
 
 
 
@@ -19,6 +21,9 @@
  *  PRIVATE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eDSP_DECIMATIONFILTER_IsStatusStillCoherent(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx);
+static e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_InsertValueCore(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx,
+                                                                         const int64_t p_iValue,
+                                                                         int64_t* const p_pFilteredVal, const bool_t p_bNoOvf);
 static e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_MaxCheckResToMED(const e_eDSP_MAXCHECK_RES p_tMaxRet);
 
 
@@ -26,7 +31,8 @@ static e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_MaxCheckResToMED(const
  *   GLOBAL FUNCTIONS
  **********************************************************************************************************************/
 e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_InitCtx(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx, int64_t* p_piWindowsBuffer, 
-                                                  uint32_t p_uWindowsBuffLen, e_eDSP_DECIMATIONFILTER_TYPE p_eDecimType)
+                                                  uint32_t p_uWindowsBuffLen, e_eDSP_DECIMATIONFILTER_TYPE p_eDecimType,
+                                                  uint32_t p_uDecimRatio)
 {
 	/* Local variable */
 	e_eDSP_DECIMATIONFILTER_RES l_eRes;
@@ -39,7 +45,9 @@ e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_InitCtx(t_eDSP_DECIMATIONFILTE
 	else
 	{
 		/* Check data validity */
-		if( p_uWindowsBuffLen <= 2u )
+		if( ( p_uWindowsBuffLen <= 2u ) || ( 0u == p_uDecimRatio ) ||
+			( ( e_eDSP_DECIMATIONFILTER_TYPE_MEAN != p_eDecimType ) &&
+			  ( e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN != p_eDecimType ) ) )
 		{
 			l_eRes = e_eDSP_DECIMATIONFILTER_RES_BADPARAM;
 		}
@@ -47,10 +55,16 @@ e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_InitCtx(t_eDSP_DECIMATIONFILTE
 		{
 			/* Initialize internal status */
 			p_ptCtx->bIsInit = true;
+			p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+			p_ptCtx->uSatCnt = 0u;
 			p_ptCtx->uWindowsLen = p_uWindowsBuffLen;
 			p_ptCtx->uFilledData = 0u;
 			p_ptCtx->uCurDataLocation = 0u;
-			memset(p_piWindowsBuffer, 0, sizeof(int64_t));
+			p_ptCtx->uDecimRatio = p_uDecimRatio;
+			p_ptCtx->uSinceLastOut = 0u;
+			p_ptCtx->piWindowsBuffer = p_piWindowsBuffer;
+			p_ptCtx->eDecimType = p_eDecimType;
+			memset(p_piWindowsBuffer, 0, sizeof(int64_t) * p_uWindowsBuffLen);
 
 			/* All OK */
 			l_eRes = e_eDSP_DECIMATIONFILTER_RES_OK;
@@ -84,15 +98,6 @@ e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_InsertValueAndCalculate(t_eDSP
 {
 	/* Local variable for return */
 	e_eDSP_DECIMATIONFILTER_RES l_eRes;
-	e_eDSP_MAXCHECK_RES l_eMaxRes;
-
-	/* Local variable for calculation */
-	uint32_t l_uCnt;
-	int64_t l_iSum;
-	int64_t l_iMean;
-	int64_t l_iNearest;
-	int64_t l_iNearestDiff;
-	int64_t l_iCurrDiff;
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_pFilteredVal ) )
@@ -115,97 +120,180 @@ e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_InsertValueAndCalculate(t_eDSP
             }
 			else
 			{
-				/* Insert data */
-				p_ptCtx->piWindowsBuffer[p_ptCtx->uCurDataLocation] = p_iValue;
-				p_ptCtx->uCurDataLocation++;
+				l_eRes = eDSP_DECIMATIONFILTER_InsertValueCore(p_ptCtx, p_iValue, p_pFilteredVal, false);
+			}
+		}
+    }
 
-				/* Manage rolback */
-				if( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )
-				{
-					p_ptCtx->uCurDataLocation = 0u;
-				}
+	return l_eRes;
+}
 
-				if( p_ptCtx->uFilledData < ( p_ptCtx->uWindowsLen - 1u ) )
-				{
-					/* Increase filler counter */
-					p_ptCtx->uFilledData++;
+e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_ProcessBlock(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx,
+                                                               const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                               int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                               uint32_t* const p_puNProcessed)
+{
+	/* Local variable for return */
+	e_eDSP_DECIMATIONFILTER_RES l_eRes;
 
-					/* Need more data */
-					l_eRes = e_eDSP_DECIMATIONFILTER_RES_NEEDSMOREVALUE;
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uNFiltered;
+	bool_t   l_bNoOvf;
+	int64_t  l_iMin;
+	int64_t  l_iMax;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_piFilteredVal ) ||
+		( NULL == p_puNFiltered ) || ( NULL == p_puNProcessed ) )
+	{
+		l_eRes = e_eDSP_DECIMATIONFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_DECIMATIONFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_DECIMATIONFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( 0u == p_uNValues )
+				{
+					l_eRes = e_eDSP_DECIMATIONFILTER_RES_BADPARAM;
 				}
 				else
 				{
-					/* The window is full */
-					l_eRes = e_eDSP_DECIMATIONFILTER_RES_OK;
+					/* Init variable */
 					l_uCnt = 0u;
-					l_iSum = 0u;
+					l_uNFiltered = 0u;
+					l_eRes = e_eDSP_DECIMATIONFILTER_RES_NEEDSMOREVALUE;
 
-					/* Calculate the factibility of the sum for the means */
-					while( ( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes ) && ( l_uCnt < p_ptCtx->uWindowsLen ) )
+					/* Every output already scan the whole window, so a pre-scan of the window and the block is
+					   cheap and prove once if the sums and the distances of the block can overflow */
+					l_iMin = MAX_INT64VAL;
+					l_iMax = MIN_INT64VAL;
+					eDSP_BLOCKSCAN_MinMaxI64(p_ptCtx->piWindowsBuffer, p_ptCtx->uWindowsLen, &l_iMin, &l_iMax);
+					eDSP_BLOCKSCAN_MinMaxI64(p_piValues, p_uNValues, &l_iMin, &l_iMax);
+					l_bNoOvf = eDSP_BLOCKSCAN_IsWindowSafe(l_iMin, l_iMax, p_ptCtx->uWindowsLen);
+
+					/* Context is checked only once, every value of the block is processed without other check */
+					while( ( l_uCnt < p_uNValues ) && ( ( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes ) ||
+						   ( e_eDSP_DECIMATIONFILTER_RES_NEEDSMOREVALUE == l_eRes ) ) )
 					{
-						l_eMaxRes = eDSP_MAXCHECK_SUMI64Check(l_iSum, p_ptCtx->piWindowsBuffer[l_uCnt]);
-						l_eRes = eDSP_DECIMATIONFILTER_MaxCheckResToMED(l_eMaxRes);
+						l_eRes = eDSP_DECIMATIONFILTER_InsertValueCore(p_ptCtx, p_piValues[l_uCnt],
+						                                               &p_piFilteredVal[l_uNFiltered], l_bNoOvf);
 
 						if( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes )
 						{
-							l_uCnt++;
-							l_iSum += p_ptCtx->piWindowsBuffer[l_uCnt];
+							l_uNFiltered++;
 						}
+
+						/* Increase counter */
+						l_uCnt++;
 					}
 
-					if( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes )
+					/* Some value are filtered and the last one doesn't generate any error */
+					if( ( e_eDSP_DECIMATIONFILTER_RES_NEEDSMOREVALUE == l_eRes ) && ( l_uNFiltered > 0u ) )
 					{
-						/* Calculate the mean */
-						l_iMean = l_iSum / p_ptCtx->uWindowsLen;
+						l_eRes = e_eDSP_DECIMATIONFILTER_RES_OK;
+					}
+
+					*p_puNFiltered = l_uNFiltered;
+					*p_puNProcessed = l_uCnt;
+				}
+			}
+		}
+    }
 
-						/* re-init counter */
-						l_uCnt = 0u;
+	return l_eRes;
+}
 
-						/* search for the nearest one */
-						while( ( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes ) && ( l_uCnt < p_ptCtx->uWindowsLen ) )
-						{
-							l_eMaxRes = eDSP_MAXCHECK_SUBTI64Check(l_iMean, p_ptCtx->piWindowsBuffer[l_uCnt]);
-							l_eRes = eDSP_DECIMATIONFILTER_MaxCheckResToMED(l_eMaxRes);
-
-							if( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes )
-							{
-								/* Calc diff */
-								l_iCurrDiff = l_iMean - p_ptCtx->piWindowsBuffer[l_uCnt];
-
-								/* abs of the difference */
-								if( l_iCurrDiff < 0u )
-								{
-									l_iCurrDiff = -l_iCurrDiff;
-								}
-
-								/* On first round init default variable */
-								if( 0u == l_uCnt )
-								{
-									/* On first round init default variable */
-									l_iNearest = p_ptCtx->piWindowsBuffer[l_uCnt];
-									l_iNearestDiff = l_iCurrDiff;
-								}
-								else
-								{
-									/* Compare with the alredy founded */
-									if( l_iCurrDiff < l_iNearestDiff )
-									{
-										l_iNearestDiff = p_ptCtx->piWindowsBuffer[l_uCnt];
-									}
-								}
-							}
-						}
+e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_SetOvfMode(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx,
+                                                             e_eDSP_TYPE_OVFMODE p_eOvfMode)
+{
+	/* Local variable */
+	e_eDSP_DECIMATIONFILTER_RES l_eRes;
 
-						/* if all ok return value */
-						if( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes )
-						{
-							*p_pFilteredVal = l_iNearest;
-						}
-					}
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_DECIMATIONFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_DECIMATIONFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_DECIMATIONFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
+				{
+					l_eRes = e_eDSP_DECIMATIONFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					l_eRes = e_eDSP_DECIMATIONFILTER_RES_OK;
 				}
 			}
 		}
-    }
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_GetSatCnt(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx,
+                                                            uint32_t* const p_puSatCnt)
+{
+	/* Local variable */
+	e_eDSP_DECIMATIONFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
+	{
+		l_eRes = e_eDSP_DECIMATIONFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_DECIMATIONFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_DECIMATIONFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puSatCnt = p_ptCtx->uSatCnt;
+				l_eRes = e_eDSP_DECIMATIONFILTER_RES_OK;
+			}
+		}
+	}
 
 	return l_eRes;
 }
@@ -229,14 +317,20 @@ static bool_t eDSP_DECIMATIONFILTER_IsStatusStillCoherent(t_eDSP_DECIMATIONFILTE
     {
 		/* Check data validity */
 		if( ( p_ptCtx->uWindowsLen <= 2u ) || ( p_ptCtx->uFilledData > p_ptCtx->uWindowsLen ) ||
-			( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )  )
+			( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen ) || ( 0u == p_ptCtx->uDecimRatio ) ||
+			( p_ptCtx->uSinceLastOut >= p_ptCtx->uDecimRatio ) ||
+			( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) &&
+			  ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) ) )
 		{
 			l_eRes = false;
 		}
 		else
 		{
 			/* Check data validity */
-			if( ( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen ) && ( p_ptCtx->uCurDataLocation >= p_ptCtx->uFilledData ) )
+			if( ( ( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen ) &&
+				  ( ( p_ptCtx->uCurDataLocation != p_ptCtx->uFilledData ) || ( 0u != p_ptCtx->uSinceLastOut ) ) ) ||
+				( ( e_eDSP_DECIMATIONFILTER_TYPE_MEAN != p_ptCtx->eDecimType ) &&
+				  ( e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN != p_ptCtx->eDecimType ) ) )
 			{
 				l_eRes = false;
 			}
@@ -250,6 +344,165 @@ static bool_t eDSP_DECIMATIONFILTER_IsStatusStillCoherent(t_eDSP_DECIMATIONFILTE
     return l_eRes;
 }
 
+static e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_InsertValueCore(t_eDSP_DECIMATIONFILTER_Ctx* const p_ptCtx,
+                                                                         const int64_t p_iValue,
+                                                                         int64_t* const p_pFilteredVal, const bool_t p_bNoOvf)
+{
+	/* Local variable for return */
+	e_eDSP_DECIMATIONFILTER_RES l_eRes;
+	e_eDSP_MAXCHECK_RES l_eMaxRes;
+
+	/* Local variable for calculation */
+	bool_t l_bCalcOut;
+	uint32_t l_uCnt;
+	int64_t l_iSum;
+	uint64_t l_uSumLow;
+	uint64_t l_uPrevLow;
+	int64_t l_iSumHigh;
+	int64_t l_iMean;
+	int64_t l_iNearest;
+	uint64_t l_uNearestDiff;
+	uint64_t l_uCurrDiff;
+
+	/* Insert data */
+	p_ptCtx->piWindowsBuffer[p_ptCtx->uCurDataLocation] = p_iValue;
+	p_ptCtx->uCurDataLocation++;
+
+	/* Manage rolback */
+	if( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )
+	{
+		p_ptCtx->uCurDataLocation = 0u;
+	}
+
+	if( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen )
+	{
+		/* Increase filler counter, the first output is generated as soon as the window is full */
+		p_ptCtx->uFilledData++;
+		l_bCalcOut = ( p_ptCtx->uFilledData >= p_ptCtx->uWindowsLen );
+	}
+	else
+	{
+		/* Window already full, generate an output only every uDecimRatio values */
+		p_ptCtx->uSinceLastOut++;
+
+		if( p_ptCtx->uSinceLastOut >= p_ptCtx->uDecimRatio )
+		{
+			p_ptCtx->uSinceLastOut = 0u;
+			l_bCalcOut = true;
+		}
+		else
+		{
+			l_bCalcOut = false;
+		}
+	}
+
+	if( false == l_bCalcOut )
+	{
+		/* Need more data, skip any calculation on the discarded sample */
+		l_eRes = e_eDSP_DECIMATIONFILTER_RES_NEEDSMOREVALUE;
+	}
+	else
+	{
+		/* Decimation point reached */
+		l_eRes = e_eDSP_DECIMATIONFILTER_RES_OK;
+
+		if( true == p_bNoOvf )
+		{
+			/* The block was pre-scanned, every partial sum fit an int64_t */
+			l_iSum = 0;
+
+			for( l_uCnt = 0u; l_uCnt < p_ptCtx->uWindowsLen; l_uCnt++ )
+			{
+				l_iSum += p_ptCtx->piWindowsBuffer[l_uCnt];
+			}
+
+			l_iMean = l_iSum / ( (int64_t) p_ptCtx->uWindowsLen );
+		}
+		else if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+		{
+			/* The sum is kept on 128 bit, so the mean is always exact and never need to be clamped */
+			l_uSumLow = 0u;
+			l_iSumHigh = 0;
+
+			for( l_uCnt = 0u; l_uCnt < p_ptCtx->uWindowsLen; l_uCnt++ )
+			{
+				l_uPrevLow = l_uSumLow;
+				l_uSumLow += (uint64_t) p_ptCtx->piWindowsBuffer[l_uCnt];
+				l_iSumHigh += ( (int64_t) ( l_uSumLow < l_uPrevLow ) ) -
+				              ( (int64_t) ( p_ptCtx->piWindowsBuffer[l_uCnt] < 0 ) );
+			}
+
+			l_iMean = eDSP_SATARITH_DivI128(l_iSumHigh, l_uSumLow, (int64_t) p_ptCtx->uWindowsLen,
+			                                &p_ptCtx->uSatCnt);
+		}
+		else
+		{
+			l_uCnt = 0u;
+			l_iSum = 0;
+
+			/* Calculate the factibility of the sum for the means */
+			while( ( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes ) && ( l_uCnt < p_ptCtx->uWindowsLen ) )
+			{
+				l_eMaxRes = eDSP_MAXCHECK_AddI64(l_iSum, p_ptCtx->piWindowsBuffer[l_uCnt], &l_iSum);
+				l_eRes = eDSP_DECIMATIONFILTER_MaxCheckResToMED(l_eMaxRes);
+
+				if( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes )
+				{
+					l_uCnt++;
+				}
+			}
+
+			if( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes )
+			{
+				/* Calculate the mean */
+				l_iMean = l_iSum / ( (int64_t) p_ptCtx->uWindowsLen );
+			}
+		}
+
+		if( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes )
+		{
+			/* re-init counter */
+			l_uCnt = 0u;
+			l_iNearest = l_iMean;
+			l_uNearestDiff = 0u;
+
+			/* search for the nearest one, only when requested. The distance of two int64_t always fit an uint64_t,
+			   so it is calculated on unsigned values and can never overflow, even against MIN_INT64VAL */
+			while( ( e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN == p_ptCtx->eDecimType ) &&
+				   ( l_uCnt < p_ptCtx->uWindowsLen ) )
+			{
+				/* Calc distance */
+				if( l_iMean >= p_ptCtx->piWindowsBuffer[l_uCnt] )
+				{
+					l_uCurrDiff = ( (uint64_t) l_iMean ) - ( (uint64_t) p_ptCtx->piWindowsBuffer[l_uCnt] );
+				}
+				else
+				{
+					l_uCurrDiff = ( (uint64_t) p_ptCtx->piWindowsBuffer[l_uCnt] ) - ( (uint64_t) l_iMean );
+				}
+
+				/* On first round init default variable */
+				if( ( 0u == l_uCnt ) || ( l_uCurrDiff < l_uNearestDiff ) )
+				{
+					l_iNearest = p_ptCtx->piWindowsBuffer[l_uCnt];
+					l_uNearestDiff = l_uCurrDiff;
+				}
+
+				/* Increase counter */
+				l_uCnt++;
+			}
+
+			/* if all ok return value */
+			if( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes )
+			{
+				*p_pFilteredVal = l_iNearest;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
 static e_eDSP_DECIMATIONFILTER_RES eDSP_DECIMATIONFILTER_MaxCheckResToMED(const e_eDSP_MAXCHECK_RES p_tMaxRet)
 {
 	e_eDSP_DECIMATIONFILTER_RES l_eRet;
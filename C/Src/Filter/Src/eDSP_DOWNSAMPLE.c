@@ -1,7 +1,7 @@
 /**
  * @file       eDSP_DOWNSAMPLE.c
  *
- * @brief      Decimator filter implementation
+ * @brief      Downsampler implementation
  *
  * @author     Lorenzo Rosin
  *
@@ -11,7 +11,6 @@
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eDSP_DOWNSAMPLE.h"
-#include "eDSP_MAXCHECK.h"
 
 
 
@@ -19,28 +18,28 @@
  *  PRIVATE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eDSP_DOWNSAMPLE_IsStatusStillCoherent(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCtx);
-static e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_MaxCheckResToMED(const e_eDSP_MAXCHECK_RES p_tMaxRet);
+static e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_InsertValueCore(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCtx,
+                                                             const int64_t p_iValue, int64_t* const p_pFilteredVal);
 
 
 
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
  **********************************************************************************************************************/
-e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_InitCtx(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCtx, int64_t* p_piWindowsBuffer, 
-                                              uint32_t p_uWindowsBuffLen, uint32_t p_uDowSampleIndex)
+e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_InitCtx(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCtx, uint32_t p_uDowSampleIndex)
 {
 	/* Local variable */
 	e_eDSP_DOWNSAMPLE_RES l_eRes;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_piWindowsBuffer ) )
+	if( NULL == p_ptCtx )
 	{
 		l_eRes = e_eDSP_DOWNSAMPLE_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check data validity */
-		if( p_uWindowsBuffLen <= 2u )
+		if( 0u == p_uDowSampleIndex )
 		{
 			l_eRes = e_eDSP_DOWNSAMPLE_RES_BADPARAM;
 		}
@@ -48,10 +47,8 @@ e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_InitCtx(t_eDSP_DOWNSAMPLE_Ctx* const p_ptC
 		{
 			/* Initialize internal status */
 			p_ptCtx->bIsInit = true;
-			p_ptCtx->uWindowsLen = p_uWindowsBuffLen;
-			p_ptCtx->uFilledData = 0u;
-			p_ptCtx->uCurDataLocation = 0u;
-			memset(p_piWindowsBuffer, 0, sizeof(int64_t));
+			p_ptCtx->uDowSampleIndex = p_uDowSampleIndex;
+			p_ptCtx->uSampleCnt = 0u;
 
 			/* All OK */
 			l_eRes = e_eDSP_DOWNSAMPLE_RES_OK;
@@ -85,15 +82,6 @@ e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_InsertValueAndCalculate(t_eDSP_DOWNSAMPLE_
 {
 	/* Local variable for return */
 	e_eDSP_DOWNSAMPLE_RES l_eRes;
-	e_eDSP_MAXCHECK_RES l_eMaxRes;
-
-	/* Local variable for calculation */
-	uint32_t l_uCnt;
-	int64_t l_iSum;
-	int64_t l_iMean;
-	int64_t l_iNearest;
-	int64_t l_iNearestDiff;
-	int64_t l_iCurrDiff;
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_pFilteredVal ) )
@@ -116,93 +104,84 @@ e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_InsertValueAndCalculate(t_eDSP_DOWNSAMPLE_
             }
 			else
 			{
-				/* Insert data */
-				p_ptCtx->piWindowsBuffer[p_ptCtx->uCurDataLocation] = p_iValue;
-				p_ptCtx->uCurDataLocation++;
+				l_eRes = eDSP_DOWNSAMPLE_InsertValueCore(p_ptCtx, p_iValue, p_pFilteredVal);
+			}
+		}
+    }
 
-				/* Manage rolback */
-				if( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )
-				{
-					p_ptCtx->uCurDataLocation = 0u;
-				}
+	return l_eRes;
+}
 
-				if( p_ptCtx->uFilledData < ( p_ptCtx->uWindowsLen - 1u ) )
-				{
-					/* Increase filler counter */
-					p_ptCtx->uFilledData++;
+e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_ProcessBlock(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCtx,
+                                                   const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                   int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                   uint32_t* const p_puNProcessed)
+{
+	/* Local variable for return */
+	e_eDSP_DOWNSAMPLE_RES l_eRes;
 
-					/* Need more data */
-					l_eRes = e_eDSP_DOWNSAMPLE_RES_NEEDSMOREVALUE;
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uNFiltered;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_piFilteredVal ) ||
+		( NULL == p_puNFiltered ) || ( NULL == p_puNProcessed ) )
+	{
+		l_eRes = e_eDSP_DOWNSAMPLE_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_DOWNSAMPLE_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_DOWNSAMPLE_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_DOWNSAMPLE_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( 0u == p_uNValues )
+				{
+					l_eRes = e_eDSP_DOWNSAMPLE_RES_BADPARAM;
 				}
 				else
 				{
-					/* The window is full */
-					l_eRes = e_eDSP_DOWNSAMPLE_RES_OK;
+					/* Init variable */
 					l_uCnt = 0u;
-					l_iSum = 0u;
+					l_uNFiltered = 0u;
+					l_eRes = e_eDSP_DOWNSAMPLE_RES_NEEDSMOREVALUE;
 
-					/* Calculate the factibility of the sum for the means */
-					while( ( e_eDSP_DOWNSAMPLE_RES_OK == l_eRes ) && ( l_uCnt < p_ptCtx->uWindowsLen ) )
+					/* Context is checked only once, every value of the block is processed without other check */
+					while( ( l_uCnt < p_uNValues ) && ( ( e_eDSP_DOWNSAMPLE_RES_OK == l_eRes ) ||
+						   ( e_eDSP_DOWNSAMPLE_RES_NEEDSMOREVALUE == l_eRes ) ) )
 					{
-						l_eMaxRes = eDSP_MAXCHECK_SUMI64Check(l_iSum, p_ptCtx->piWindowsBuffer[l_uCnt]);
-						l_eRes = eDSP_DOWNSAMPLE_MaxCheckResToMED(l_eMaxRes);
+						l_eRes = eDSP_DOWNSAMPLE_InsertValueCore(p_ptCtx, p_piValues[l_uCnt],
+						                                         &p_piFilteredVal[l_uNFiltered]);
 
 						if( e_eDSP_DOWNSAMPLE_RES_OK == l_eRes )
 						{
-							l_uCnt++;
-							l_iSum += p_ptCtx->piWindowsBuffer[l_uCnt];
+							l_uNFiltered++;
 						}
+
+						/* Increase counter */
+						l_uCnt++;
 					}
 
-					if( e_eDSP_DOWNSAMPLE_RES_OK == l_eRes )
+					/* Some value are filtered and the last one doesn't generate any error */
+					if( ( e_eDSP_DOWNSAMPLE_RES_NEEDSMOREVALUE == l_eRes ) && ( l_uNFiltered > 0u ) )
 					{
-						/* Calculate the mean */
-						l_iMean = l_iSum / p_ptCtx->uWindowsLen;
-
-						/* re-init counter */
-						l_uCnt = 0u;
-
-						/* search for the nearest one */
-						while( ( e_eDSP_DOWNSAMPLE_RES_OK == l_eRes ) && ( l_uCnt < p_ptCtx->uWindowsLen ) )
-						{
-							l_eMaxRes = eDSP_MAXCHECK_SUBTI64Check(l_iMean, p_ptCtx->piWindowsBuffer[l_uCnt]);
-							l_eRes = eDSP_DOWNSAMPLE_MaxCheckResToMED(l_eMaxRes);
-
-							if( e_eDSP_DOWNSAMPLE_RES_OK == l_eRes )
-							{
-								/* Calc diff */
-								l_iCurrDiff = l_iMean - p_ptCtx->piWindowsBuffer[l_uCnt];
-
-								/* abs of the difference */
-								if( l_iCurrDiff < 0u )
-								{
-									l_iCurrDiff = -l_iCurrDiff;
-								}
-
-								/* On first round init default variable */
-								if( 0u == l_uCnt )
-								{
-									/* On first round init default variable */
-									l_iNearest = p_ptCtx->piWindowsBuffer[l_uCnt];
-									l_iNearestDiff = l_iCurrDiff;
-								}
-								else
-								{
-									/* Compare with the alredy founded */
-									if( l_iCurrDiff < l_iNearestDiff )
-									{
-										l_iNearestDiff = p_ptCtx->piWindowsBuffer[l_uCnt];
-									}
-								}
-							}
-						}
-
-						/* if all ok return value */
-						if( e_eDSP_DOWNSAMPLE_RES_OK == l_eRes )
-						{
-							*p_pFilteredVal = l_iNearest;
-						}
+						l_eRes = e_eDSP_DOWNSAMPLE_RES_OK;
 					}
+
+					*p_puNFiltered = l_uNFiltered;
+					*p_puNProcessed = l_uCnt;
 				}
 			}
 		}
@@ -221,48 +200,44 @@ static bool_t eDSP_DOWNSAMPLE_IsStatusStillCoherent(t_eDSP_DOWNSAMPLE_Ctx* const
     /* Return local var */
     bool_t l_eRes;
 
-	/* Check pointer validity */
-	if( NULL == p_ptCtx->piWindowsBuffer )
+	/* Check data validity */
+	if( ( 0u == p_ptCtx->uDowSampleIndex ) || ( p_ptCtx->uSampleCnt >= p_ptCtx->uDowSampleIndex ) )
 	{
 		l_eRes = false;
 	}
-    else
-    {
-		/* Check data validity */
-		if( ( p_ptCtx->uWindowsLen <= 2u ) || ( p_ptCtx->uFilledData > p_ptCtx->uWindowsLen ) ||
-			( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )  )
-		{
-			l_eRes = false;
-		}
-		else
-		{
-			/* Check data validity */
-			if( ( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen ) && ( p_ptCtx->uCurDataLocation >= p_ptCtx->uFilledData ) )
-			{
-				l_eRes = false;
-			}
-			else
-			{
-				l_eRes = true;
-			}
-		}
-    }
+	else
+	{
+		l_eRes = true;
+	}
 
     return l_eRes;
 }
 
-static e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_MaxCheckResToMED(const e_eDSP_MAXCHECK_RES p_tMaxRet)
+static e_eDSP_DOWNSAMPLE_RES eDSP_DOWNSAMPLE_InsertValueCore(t_eDSP_DOWNSAMPLE_Ctx* const p_ptCtx,
+                                                             const int64_t p_iValue, int64_t* const p_pFilteredVal)
 {
-	e_eDSP_DOWNSAMPLE_RES l_eRet;
+	/* Local variable for return */
+	e_eDSP_DOWNSAMPLE_RES l_eRes;
 
-	if( e_eDSP_MAXCHECK_RES_OK == p_tMaxRet )
+	/* Keep the first value of every group of uDowSampleIndex values */
+	if( 0u == p_ptCtx->uSampleCnt )
 	{
-		l_eRet = e_eDSP_DOWNSAMPLE_RES_OK;
+		*p_pFilteredVal = p_iValue;
+		l_eRes = e_eDSP_DOWNSAMPLE_RES_OK;
 	}
 	else
 	{
-		l_eRet = e_eDSP_DOWNSAMPLE_RES_OVERFLOW;
+		/* Need more data */
+		l_eRes = e_eDSP_DOWNSAMPLE_RES_NEEDSMOREVALUE;
 	}
 
-	return l_eRet;
-}
+	/* Manage rolback */
+	p_ptCtx->uSampleCnt++;
+
+	if( p_ptCtx->uSampleCnt >= p_ptCtx->uDowSampleIndex )
+	{
+		p_ptCtx->uSampleCnt = 0u;
+	}
+
+	return l_eRes;
+}
\ No newline at end of file
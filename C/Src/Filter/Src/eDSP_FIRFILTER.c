@@ -0,0 +1,522 @@
+/**
+ * @file       eDSP_FIRFILTER.c
+ *
+ * @brief      Polyphase FIR filter, decimator and interpolator implementation
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_FIRFILTER.h"
+#include "eDSP_MAXCHECK.h"
+#include "eDSP_SATARITH.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eDSP_FIRFILTER_IsStatusStillCoherent(t_eDSP_FIRFILTER_Ctx* const p_ptCtx);
+static uint64_t eDSP_FIRFILTER_CalcNExpected(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, const uint32_t p_uNValues);
+static e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_InsertValueCore(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, const int64_t p_iValue,
+                                                           int64_t* const p_piFilteredVal,
+                                                           uint32_t* const p_puNFiltered);
+static e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_CalcPhase(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, const uint32_t p_uPhase,
+                                                     int64_t* const p_pFilteredVal);
+static e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_MaxCheckResToFIR(const e_eDSP_MAXCHECK_RES p_tMaxRet);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_InitCtx(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, const int32_t* p_piCoeff,
+                                            uint32_t p_uNCoeff, uint32_t p_uCoeffQ, int64_t* p_piHistoryBuffer,
+                                            uint32_t p_uHistoryBuffLen, uint32_t p_uInterpFactor,
+                                            uint32_t p_uDecimFactor)
+{
+	/* Local variable */
+	e_eDSP_FIRFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piCoeff ) || ( NULL == p_piHistoryBuffer ) )
+	{
+		l_eRes = e_eDSP_FIRFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check data validity */
+		if( ( 0u == p_uNCoeff ) || ( p_uCoeffQ > 31u ) || ( 0u == p_uInterpFactor ) || ( 0u == p_uDecimFactor ) ||
+			( p_uInterpFactor > MAX_UINT16VAL ) || ( p_uDecimFactor > MAX_UINT16VAL ) ||
+			( p_uNCoeff > ( MAX_UINT32VAL - p_uInterpFactor ) ) )
+		{
+			l_eRes = e_eDSP_FIRFILTER_RES_BADPARAM;
+		}
+		else
+		{
+			/* Every phase use one coefficient every L, the history must store one value for each of them */
+			if( p_uHistoryBuffLen != ( ( p_uNCoeff + p_uInterpFactor - 1u ) / p_uInterpFactor ) )
+			{
+				l_eRes = e_eDSP_FIRFILTER_RES_BADPARAM;
+			}
+			else
+			{
+				/* Initialize internal status */
+				p_ptCtx->bIsInit = true;
+				p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+				p_ptCtx->uSatCnt = 0u;
+				p_ptCtx->uNCoeff = p_uNCoeff;
+				p_ptCtx->uCoeffQ = p_uCoeffQ;
+				p_ptCtx->uInterpFactor = p_uInterpFactor;
+				p_ptCtx->uDecimFactor = p_uDecimFactor;
+				p_ptCtx->uHistoryLen = p_uHistoryBuffLen;
+				p_ptCtx->uCurDataLocation = 0u;
+				p_ptCtx->uNextOutPhase = 0u;
+				p_ptCtx->piCoeff = p_piCoeff;
+				p_ptCtx->piHistoryBuffer = p_piHistoryBuffer;
+				memset(p_piHistoryBuffer, 0, sizeof(int64_t) * p_uHistoryBuffLen);
+
+				/* All OK */
+				l_eRes = e_eDSP_FIRFILTER_RES_OK;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_IsInit(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eDSP_FIRFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eDSP_FIRFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eDSP_FIRFILTER_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_InsertValueAndCalculate(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, const int64_t p_iValue,
+                                                            int64_t* const p_piFilteredVal,
+                                                            const uint32_t p_uFilteredBuffLen,
+                                                            uint32_t* const p_puNFiltered)
+{
+	/* Local variable for return */
+	e_eDSP_FIRFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piFilteredVal ) || ( NULL == p_puNFiltered ) )
+	{
+		l_eRes = e_eDSP_FIRFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_FIRFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_FIRFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_FIRFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( eDSP_FIRFILTER_CalcNExpected(p_ptCtx, 1u) > ( (uint64_t) p_uFilteredBuffLen ) )
+				{
+					l_eRes = e_eDSP_FIRFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					l_eRes = eDSP_FIRFILTER_InsertValueCore(p_ptCtx, p_iValue, p_piFilteredVal, p_puNFiltered);
+				}
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_ProcessBlock(t_eDSP_FIRFILTER_Ctx* const p_ptCtx,
+                                                 const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                 int64_t* const p_piFilteredVal, const uint32_t p_uFilteredBuffLen,
+                                                 uint32_t* const p_puNFiltered, uint32_t* const p_puNProcessed)
+{
+	/* Local variable for return */
+	e_eDSP_FIRFILTER_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uNFiltered;
+	uint32_t l_uNCurFiltered;
+	uint64_t l_uNExpected;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_piFilteredVal ) ||
+		( NULL == p_puNFiltered ) || ( NULL == p_puNProcessed ) )
+	{
+		l_eRes = e_eDSP_FIRFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_FIRFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_FIRFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_FIRFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Calculate how many filtered values will be generated by this block */
+				l_uNExpected = eDSP_FIRFILTER_CalcNExpected(p_ptCtx, p_uNValues);
+
+				/* Check data validity */
+				if( ( 0u == p_uNValues ) || ( l_uNExpected > ( (uint64_t) p_uFilteredBuffLen ) ) )
+				{
+					l_eRes = e_eDSP_FIRFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					/* Init variable */
+					l_uCnt = 0u;
+					l_uNFiltered = 0u;
+					l_eRes = e_eDSP_FIRFILTER_RES_NEEDSMOREVALUE;
+
+					/* Context is checked only once, every value of the block is processed without other check */
+					while( ( l_uCnt < p_uNValues ) && ( ( e_eDSP_FIRFILTER_RES_OK == l_eRes ) ||
+						   ( e_eDSP_FIRFILTER_RES_NEEDSMOREVALUE == l_eRes ) ) )
+					{
+						l_eRes = eDSP_FIRFILTER_InsertValueCore(p_ptCtx, p_piValues[l_uCnt],
+						                                        &p_piFilteredVal[l_uNFiltered], &l_uNCurFiltered);
+						l_uNFiltered += l_uNCurFiltered;
+
+						/* Increase counter */
+						l_uCnt++;
+					}
+
+					/* Some value are filtered and the last one doesn't generate any error */
+					if( ( e_eDSP_FIRFILTER_RES_NEEDSMOREVALUE == l_eRes ) && ( l_uNFiltered > 0u ) )
+					{
+						l_eRes = e_eDSP_FIRFILTER_RES_OK;
+					}
+
+					*p_puNFiltered = l_uNFiltered;
+					*p_puNProcessed = l_uCnt;
+				}
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_SetOvfMode(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, e_eDSP_TYPE_OVFMODE p_eOvfMode)
+{
+	/* Local variable */
+	e_eDSP_FIRFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_FIRFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_FIRFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_FIRFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_FIRFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
+				{
+					l_eRes = e_eDSP_FIRFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					l_eRes = e_eDSP_FIRFILTER_RES_OK;
+				}
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_GetSatCnt(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, uint32_t* const p_puSatCnt)
+{
+	/* Local variable */
+	e_eDSP_FIRFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
+	{
+		l_eRes = e_eDSP_FIRFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_FIRFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_FIRFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_FIRFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puSatCnt = p_ptCtx->uSatCnt;
+				l_eRes = e_eDSP_FIRFILTER_RES_OK;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eDSP_FIRFILTER_IsStatusStillCoherent(t_eDSP_FIRFILTER_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+    bool_t l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx->piCoeff ) || ( NULL == p_ptCtx->piHistoryBuffer ) )
+	{
+		l_eRes = false;
+	}
+    else
+    {
+		/* Check data validity */
+		if( ( 0u == p_ptCtx->uNCoeff ) || ( p_ptCtx->uCoeffQ > 31u ) || ( 0u == p_ptCtx->uInterpFactor ) ||
+			( 0u == p_ptCtx->uDecimFactor ) || ( p_ptCtx->uInterpFactor > MAX_UINT16VAL ) ||
+			( p_ptCtx->uDecimFactor > MAX_UINT16VAL ) || ( p_ptCtx->uNCoeff > ( MAX_UINT32VAL - p_ptCtx->uInterpFactor ) ) )
+		{
+			l_eRes = false;
+		}
+		else
+		{
+			/* Check data validity */
+			if( ( p_ptCtx->uHistoryLen != ( ( p_ptCtx->uNCoeff + p_ptCtx->uInterpFactor - 1u ) / p_ptCtx->uInterpFactor ) ) ||
+				( p_ptCtx->uCurDataLocation >= p_ptCtx->uHistoryLen ) ||
+				( p_ptCtx->uNextOutPhase >= p_ptCtx->uDecimFactor ) ||
+				( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) &&
+				  ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) ) )
+			{
+				l_eRes = false;
+			}
+			else
+			{
+				l_eRes = true;
+			}
+		}
+    }
+
+    return l_eRes;
+}
+
+static uint64_t eDSP_FIRFILTER_CalcNExpected(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, const uint32_t p_uNValues)
+{
+	/* Local variable for return */
+	uint64_t l_uNExpected;
+
+	/* Local variable for calculation */
+	uint64_t l_uNHighRate;
+
+	/* Every value cover L samples at the interpolated rate, one every M of them is a filtered value */
+	l_uNHighRate = ( (uint64_t) p_uNValues ) * ( (uint64_t) p_ptCtx->uInterpFactor );
+
+	if( l_uNHighRate <= ( (uint64_t) p_ptCtx->uNextOutPhase ) )
+	{
+		l_uNExpected = 0u;
+	}
+	else
+	{
+		l_uNExpected = ( ( l_uNHighRate - p_ptCtx->uNextOutPhase - 1u ) / p_ptCtx->uDecimFactor ) + 1u;
+	}
+
+	return l_uNExpected;
+}
+
+static e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_InsertValueCore(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, const int64_t p_iValue,
+                                                           int64_t* const p_piFilteredVal,
+                                                           uint32_t* const p_puNFiltered)
+{
+	/* Local variable for return */
+	e_eDSP_FIRFILTER_RES l_eRes;
+	e_eDSP_FIRFILTER_RES l_eCalcRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uPhase;
+	uint32_t l_uNFiltered;
+	int64_t l_iFiltered;
+
+	/* Insert data, the newest value is always at uCurDataLocation during the calculation */
+	p_ptCtx->piHistoryBuffer[p_ptCtx->uCurDataLocation] = p_iValue;
+
+	/* The value inserted cover L samples at the interpolated rate, calculate only the one kept by the decimation */
+	l_eRes = e_eDSP_FIRFILTER_RES_NEEDSMOREVALUE;
+	l_uNFiltered = 0u;
+	l_uPhase = p_ptCtx->uNextOutPhase;
+
+	while( l_uPhase < p_ptCtx->uInterpFactor )
+	{
+		l_eCalcRes = eDSP_FIRFILTER_CalcPhase(p_ptCtx, l_uPhase, &l_iFiltered);
+
+		if( e_eDSP_FIRFILTER_RES_OK == l_eCalcRes )
+		{
+			p_piFilteredVal[l_uNFiltered] = l_iFiltered;
+			l_uNFiltered++;
+
+			if( e_eDSP_FIRFILTER_RES_NEEDSMOREVALUE == l_eRes )
+			{
+				l_eRes = e_eDSP_FIRFILTER_RES_OK;
+			}
+		}
+		else
+		{
+			/* Discard the value, but keep the phase aligned */
+			l_eRes = l_eCalcRes;
+		}
+
+		l_uPhase += p_ptCtx->uDecimFactor;
+	}
+
+	/* Phase of the next output relative to the next inserted value */
+	p_ptCtx->uNextOutPhase = l_uPhase - p_ptCtx->uInterpFactor;
+
+	/* Manage rolback */
+	p_ptCtx->uCurDataLocation++;
+
+	if( p_ptCtx->uCurDataLocation >= p_ptCtx->uHistoryLen )
+	{
+		p_ptCtx->uCurDataLocation = 0u;
+	}
+
+	*p_puNFiltered = l_uNFiltered;
+
+	return l_eRes;
+}
+
+static e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_CalcPhase(t_eDSP_FIRFILTER_Ctx* const p_ptCtx, const uint32_t p_uPhase,
+                                                     int64_t* const p_pFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_FIRFILTER_RES l_eRes;
+	e_eDSP_MAXCHECK_RES l_eMaxRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCoeffIdx;
+	uint32_t l_uHistIdx;
+	int64_t l_iProd;
+	int64_t l_iAcc;
+
+	/* Init variable */
+	l_eRes = e_eDSP_FIRFILTER_RES_OK;
+	l_uCoeffIdx = p_uPhase;
+	l_uHistIdx = p_ptCtx->uCurDataLocation;
+	l_iAcc = 0;
+
+	/* The phase p use the coefficients p, p + L, p + 2L ... applied to the newest values going back in time */
+	while( ( e_eDSP_FIRFILTER_RES_OK == l_eRes ) && ( l_uCoeffIdx < p_ptCtx->uNCoeff ) )
+	{
+		if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+		{
+			/* Both steps are clamped, the accumulation never stop */
+			l_iProd = eDSP_SATARITH_MulI64( (int64_t) p_ptCtx->piCoeff[l_uCoeffIdx],
+			                                p_ptCtx->piHistoryBuffer[l_uHistIdx], &p_ptCtx->uSatCnt );
+			l_iAcc = eDSP_SATARITH_AddI64(l_iAcc, l_iProd, &p_ptCtx->uSatCnt);
+		}
+		else
+		{
+			l_eMaxRes = eDSP_MAXCHECK_MulI64( (int64_t) p_ptCtx->piCoeff[l_uCoeffIdx],
+			                                  p_ptCtx->piHistoryBuffer[l_uHistIdx], &l_iProd );
+			l_eRes = eDSP_FIRFILTER_MaxCheckResToFIR(l_eMaxRes);
+
+			if( e_eDSP_FIRFILTER_RES_OK == l_eRes )
+			{
+				l_eMaxRes = eDSP_MAXCHECK_AddI64(l_iAcc, l_iProd, &l_iAcc);
+				l_eRes = eDSP_FIRFILTER_MaxCheckResToFIR(l_eMaxRes);
+			}
+		}
+
+		if( e_eDSP_FIRFILTER_RES_OK == l_eRes )
+		{
+			l_uCoeffIdx += p_ptCtx->uInterpFactor;
+
+			/* Go back in the history */
+			if( 0u == l_uHistIdx )
+			{
+				l_uHistIdx = p_ptCtx->uHistoryLen - 1u;
+			}
+			else
+			{
+				l_uHistIdx--;
+			}
+		}
+	}
+
+	if( e_eDSP_FIRFILTER_RES_OK == l_eRes )
+	{
+		/* Remove the Q format of the coefficients */
+		*p_pFilteredVal = l_iAcc / ( ( (int64_t) 1 ) << p_ptCtx->uCoeffQ );
+	}
+
+	return l_eRes;
+}
+
+static e_eDSP_FIRFILTER_RES eDSP_FIRFILTER_MaxCheckResToFIR(const e_eDSP_MAXCHECK_RES p_tMaxRet)
+{
+	e_eDSP_FIRFILTER_RES l_eRet;
+
+	if( e_eDSP_MAXCHECK_RES_OK == p_tMaxRet )
+	{
+		l_eRet = e_eDSP_FIRFILTER_RES_OK;
+	}
+	else
+	{
+		l_eRet = e_eDSP_FIRFILTER_RES_OVERFLOW;
+	}
+
+	return l_eRet;
+}
\ No newline at end of file
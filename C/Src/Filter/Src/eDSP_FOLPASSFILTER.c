@@ -12,6 +12,16 @@
  **********************************************************************************************************************/
 #include "eDSP_FOLPASSFILTER.h"
 #include "eDSP_MAXCHECK.h"
+#include "eDSP_SATARITH.h"
+#include "eDSP_Q31ARITH.h"
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE DEFINE
+ **********************************************************************************************************************/
+/* Unitary value of a Q31 coefficient */
+#define EDSP_FOLPASSFILTER_Q31ONE                                                          ( ( uint32_t ) 0x80000000u )
 
 
 
@@ -19,14 +29,20 @@
  *  PRIVATE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eDSP_FOLPASSFILTER_IsStatusStillCoherent(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx);
+static e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_InsertValueCore(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx,
+                                                                   const int64_t p_iValue,
+                                                                   const uint32_t p_uCoeffQ31,
+                                                                   int64_t* const p_pFilteredVal);
 static e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_MaxCheckResToFOLPF(const e_eDSP_MAXCHECK_RES p_tMaxRet);
+static uint32_t eDSP_FOLPASSFILTER_GetCoeffForDt(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx, const uint32_t p_uTimeUs);
 
 
 
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
  **********************************************************************************************************************/
-e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_InitCtx(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx, uint64_t p_uCutFreqMilHz)
+e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_InitCtx(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx, uint64_t p_uCutFreqMilHz,
+                                                    uint32_t p_uSamplePeriodUs)
 {
 	/* Local variable */
 	e_eDSP_FOLPASSFILTER_RES l_eRes;
@@ -39,7 +55,7 @@ e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_InitCtx(t_eDSP_FOLPASSFILTER_Ctx* co
 	else
 	{
 		/* Check data validity */
-		if( 0u == p_uCutFreqMilHz )
+		if( ( 0u == p_uCutFreqMilHz ) || ( 0u == p_uSamplePeriodUs ) )
 		{
 			l_eRes = e_eDSP_FOLPASSFILTER_RES_BADPARAM;
 		}
@@ -47,8 +63,18 @@ e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_InitCtx(t_eDSP_FOLPASSFILTER_Ctx* co
 		{
 			/* Initialize internal status */
 			p_ptCtx->bIsInit = true;
+			p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+			p_ptCtx->uSatCnt = 0u;
+			p_ptCtx->bHasPrevValue = false;
 			p_ptCtx->uCutFreqMilHz = p_uCutFreqMilHz;
-			p_ptCtx->iPrevOutValue = 0u;
+			p_ptCtx->uSamplePeriodUs = p_uSamplePeriodUs;
+			p_ptCtx->uAlphaQ31 = eDSP_Q31ARITH_CalcAlpha(p_uCutFreqMilHz, p_uSamplePeriodUs);
+			p_ptCtx->iPrevOutValue = 0;
+			p_ptCtx->uCacheLen = 0u;
+			p_ptCtx->uDtQuantShift = 0u;
+			p_ptCtx->uCacheHit = 0u;
+			p_ptCtx->uCacheMiss = 0u;
+			p_ptCtx->ptCoeffCache = NULL;
 
 			/* All OK */
 			l_eRes = e_eDSP_FOLPASSFILTER_RES_OK;
@@ -77,21 +103,111 @@ e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_IsInit(t_eDSP_FOLPASSFILTER_Ctx* con
 	return l_eRes;
 }
 
+e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_SetCoeffCache(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx,
+                                                          t_eDSP_FOLPASSFILTER_CoeffCache* p_ptCache,
+                                                          uint32_t p_uCacheLen,
+                                                          uint32_t p_uDtQuantShift)
+{
+	/* Local variable */
+	e_eDSP_FOLPASSFILTER_RES l_eRes;
+	uint32_t l_uCnt;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptCache ) )
+	{
+		l_eRes = e_eDSP_FOLPASSFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_FOLPASSFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_FOLPASSFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_FOLPASSFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity, the len must be a power of two to map the key without division */
+				if( ( 0u == p_uCacheLen ) || ( 0u != ( p_uCacheLen & ( p_uCacheLen - 1u ) ) ) ||
+					( p_uDtQuantShift > 31u ) )
+				{
+					l_eRes = e_eDSP_FOLPASSFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					/* Key zero is never used, and mark an empty entry */
+					for( l_uCnt = 0u; l_uCnt < p_uCacheLen; l_uCnt++ )
+					{
+						p_ptCache[l_uCnt].uDtKey = 0u;
+						p_ptCache[l_uCnt].uCoeffQ31 = 0u;
+					}
+
+					p_ptCtx->uCacheLen = p_uCacheLen;
+					p_ptCtx->uDtQuantShift = p_uDtQuantShift;
+					p_ptCtx->uCacheHit = 0u;
+					p_ptCtx->uCacheMiss = 0u;
+					p_ptCtx->ptCoeffCache = p_ptCache;
+					l_eRes = e_eDSP_FOLPASSFILTER_RES_OK;
+				}
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
 e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_InsertValueAndCalculate(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx,
                                                                     const int64_t p_iValue,
                                                                     int64_t* const p_pFilteredVal)
 {
 	/* Local variable for return */
 	e_eDSP_FOLPASSFILTER_RES l_eRes;
-	e_eDSP_MAXCHECK_RES l_eMaxRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pFilteredVal ) )
+	{
+		l_eRes = e_eDSP_FOLPASSFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_FOLPASSFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_FOLPASSFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_FOLPASSFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				l_eRes = eDSP_FOLPASSFILTER_InsertValueCore(p_ptCtx, p_iValue, p_ptCtx->uAlphaQ31, p_pFilteredVal);
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_InsertValueDtAndCalculate(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx,
+                                                                      const int64_t p_iValue,
+                                                                      const uint32_t p_uTimeFromLastUs,
+                                                                      int64_t* const p_pFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_FOLPASSFILTER_RES l_eRes;
 
 	/* Local variable for calculation */
-	uint32_t l_uCnt;
-	int64_t l_iSum;
-	int64_t l_iMean;
-	int64_t l_iNearest;
-	int64_t l_iNearestDiff;
-	int64_t l_iCurrDiff;
+	uint32_t l_uCoeffQ31;
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_pFilteredVal ) )
@@ -114,30 +230,94 @@ e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_InsertValueAndCalculate(t_eDSP_FOLPA
             }
 			else
 			{
-				/* To calculate the First order Low pass filter we will use an RC circuit.
-
-					-----/\/\/\----------
-									|
-						Vin		   ___    Vout
-								   ___
-									|
-					---------------------
-					The equantion of the circuit is:
-					Vin(ti) - Vout(ti) = Vr(ti)
-					Vin(ti) - Vout(ti) = R * Ir(ti)
-					Vin(ti) - Vout(ti) = R *  ( C * ( dVout(ti) / dT ) )
-					Vin(ti) - Vout(ti) = RC * ( dVout(ti) / dT )
-					and using discrete time we have:
-					Vin(ti) - Vout(ti) = RC * (    ( Vout(i) - Vout(i-1) )    /    ( t(i) - t(i-1) )    )
-					Vout(ti) = Vin(ti) - RC * (    ( Vout(i) - Vout(i-1) )    /    ( t(i) - t(i-1) )    )
-					... More calc ...
-					Vout(ti) = ( ( t(i)-t(i-1) ) / ( RC + ( t(i)-t(i-1) ) ) * Vin(ti) +
-							   ( RC / ( RC + ( t(i)-t(i-1) ) )              * Vout(ti-1)
-					Doing other math in the frequency domains we found out that the cutoff frequency is
-					Fc = 1 / ( 2 pi RC ) and so the value of RC = 1 / ( 2 pi Fc )
-				*/
+				/* Check data validity */
+				if( 0u == p_uTimeFromLastUs )
+				{
+					l_eRes = e_eDSP_FOLPASSFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					l_uCoeffQ31 = eDSP_FOLPASSFILTER_GetCoeffForDt(p_ptCtx, p_uTimeFromLastUs);
+					l_eRes = eDSP_FOLPASSFILTER_InsertValueCore(p_ptCtx, p_iValue, l_uCoeffQ31, p_pFilteredVal);
+				}
+			}
+		}
+    }
 
-				l_eRes = e_eDSP_FOLPASSFILTER_RES_OK;
+	return l_eRes;
+}
+
+e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_ProcessBlock(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx,
+                                                         const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                         int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                         uint32_t* const p_puNProcessed)
+{
+	/* Local variable for return */
+	e_eDSP_FOLPASSFILTER_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uNFiltered;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_piFilteredVal ) ||
+		( NULL == p_puNFiltered ) || ( NULL == p_puNProcessed ) )
+	{
+		l_eRes = e_eDSP_FOLPASSFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_FOLPASSFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_FOLPASSFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_FOLPASSFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( 0u == p_uNValues )
+				{
+					l_eRes = e_eDSP_FOLPASSFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					/* Init variable */
+					l_uCnt = 0u;
+					l_uNFiltered = 0u;
+					l_eRes = e_eDSP_FOLPASSFILTER_RES_NEEDSMOREVALUE;
+
+					/* Context is checked only once, every value of the block is processed without other check */
+					while( ( l_uCnt < p_uNValues ) && ( ( e_eDSP_FOLPASSFILTER_RES_OK == l_eRes ) ||
+						   ( e_eDSP_FOLPASSFILTER_RES_NEEDSMOREVALUE == l_eRes ) ) )
+					{
+						l_eRes = eDSP_FOLPASSFILTER_InsertValueCore(p_ptCtx, p_piValues[l_uCnt], p_ptCtx->uAlphaQ31,
+						                                            &p_piFilteredVal[l_uNFiltered]);
+
+						if( e_eDSP_FOLPASSFILTER_RES_OK == l_eRes )
+						{
+							l_uNFiltered++;
+						}
+
+						/* Increase counter */
+						l_uCnt++;
+					}
+
+					/* Some value are filtered and the last one doesn't generate any error */
+					if( ( e_eDSP_FOLPASSFILTER_RES_NEEDSMOREVALUE == l_eRes ) && ( l_uNFiltered > 0u ) )
+					{
+						l_eRes = e_eDSP_FOLPASSFILTER_RES_OK;
+					}
+
+					*p_puNFiltered = l_uNFiltered;
+					*p_puNProcessed = l_uCnt;
+				}
 			}
 		}
     }
@@ -145,6 +325,125 @@ e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_InsertValueAndCalculate(t_eDSP_FOLPA
 	return l_eRes;
 }
 
+e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_GetCacheStats(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx,
+                                                          uint32_t* const p_puHit,
+                                                          uint32_t* const p_puMiss)
+{
+	/* Local variable */
+	e_eDSP_FOLPASSFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puHit ) || ( NULL == p_puMiss ) )
+	{
+		l_eRes = e_eDSP_FOLPASSFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_FOLPASSFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_FOLPASSFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_FOLPASSFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puHit = p_ptCtx->uCacheHit;
+				*p_puMiss = p_ptCtx->uCacheMiss;
+				l_eRes = e_eDSP_FOLPASSFILTER_RES_OK;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_SetOvfMode(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx,
+                                                       e_eDSP_TYPE_OVFMODE p_eOvfMode)
+{
+	/* Local variable */
+	e_eDSP_FOLPASSFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_FOLPASSFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_FOLPASSFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_FOLPASSFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_FOLPASSFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
+				{
+					l_eRes = e_eDSP_FOLPASSFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					l_eRes = e_eDSP_FOLPASSFILTER_RES_OK;
+				}
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_GetSatCnt(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx,
+                                                      uint32_t* const p_puSatCnt)
+{
+	/* Local variable */
+	e_eDSP_FOLPASSFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
+	{
+		l_eRes = e_eDSP_FOLPASSFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_FOLPASSFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_FOLPASSFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_FOLPASSFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puSatCnt = p_ptCtx->uSatCnt;
+				l_eRes = e_eDSP_FOLPASSFILTER_RES_OK;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
 
 
 /***********************************************************************************************************************
@@ -155,8 +454,14 @@ static bool_t eDSP_FOLPASSFILTER_IsStatusStillCoherent(t_eDSP_FOLPASSFILTER_Ctx*
     /* Return local var */
     bool_t l_eRes;
 
-	/* Check pointer validity */
-	if( 0u == p_ptCtx->uCutFreqMilHz )
+	/* Check data validity */
+	if( ( 0u == p_ptCtx->uCutFreqMilHz ) || ( 0u == p_ptCtx->uSamplePeriodUs ) ||
+		( p_ptCtx->uAlphaQ31 > EDSP_FOLPASSFILTER_Q31ONE ) || ( p_ptCtx->uDtQuantShift > 31u ) ||
+		( ( NULL == p_ptCtx->ptCoeffCache ) && ( 0u != p_ptCtx->uCacheLen ) ) ||
+		( ( NULL != p_ptCtx->ptCoeffCache ) &&
+		  ( ( 0u == p_ptCtx->uCacheLen ) || ( 0u != ( p_ptCtx->uCacheLen & ( p_ptCtx->uCacheLen - 1u ) ) ) ) ) ||
+		( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) &&
+		  ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) ) )
 	{
 		l_eRes = false;
 	}
@@ -168,6 +473,73 @@ static bool_t eDSP_FOLPASSFILTER_IsStatusStillCoherent(t_eDSP_FOLPASSFILTER_Ctx*
     return l_eRes;
 }
 
+static e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_InsertValueCore(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx,
+                                                                   const int64_t p_iValue,
+                                                                   const uint32_t p_uCoeffQ31,
+                                                                   int64_t* const p_pFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_FOLPASSFILTER_RES l_eRes;
+	e_eDSP_MAXCHECK_RES l_eMaxRes;
+
+	/* Local variable for calculation */
+	int64_t l_iDiff;
+
+	/* To calculate the First order Low pass filter we will use an RC circuit.
+
+		-----/\/\/\----------
+						|
+			Vin		   ___    Vout
+					   ___
+						|
+		---------------------
+		The equantion of the circuit is:
+		Vin(ti) - Vout(ti) = Vr(ti)
+		Vin(ti) - Vout(ti) = R * Ir(ti)
+		Vin(ti) - Vout(ti) = R *  ( C * ( dVout(ti) / dT ) )
+		Vin(ti) - Vout(ti) = RC * ( dVout(ti) / dT )
+		and using discrete time we have:
+		Vin(ti) - Vout(ti) = RC * (    ( Vout(i) - Vout(i-1) )    /    ( t(i) - t(i-1) )    )
+		Vout(ti) = Vin(ti) - RC * (    ( Vout(i) - Vout(i-1) )    /    ( t(i) - t(i-1) )    )
+		... More calc ...
+		Vout(ti) = ( ( t(i)-t(i-1) ) / ( RC + ( t(i)-t(i-1) ) ) * Vin(ti) +
+				   ( RC / ( RC + ( t(i)-t(i-1) ) )              * Vout(ti-1)
+		Doing other math in the frequency domains we found out that the cutoff frequency is
+		Fc = 1 / ( 2 pi RC ) and so the value of RC = 1 / ( 2 pi Fc )
+	*/
+
+	if( false == p_ptCtx->bHasPrevValue )
+	{
+		/* The first value is used as starting point of the output */
+		p_ptCtx->iPrevOutValue = p_iValue;
+		p_ptCtx->bHasPrevValue = true;
+		l_eRes = e_eDSP_FOLPASSFILTER_RES_NEEDSMOREVALUE;
+	}
+	else
+	{
+		/* Vout(i) = Vout(i-1) + alpha * ( Vin(i) - Vout(i-1) ), the result is always between Vout(i-1) and Vin(i) */
+		if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+		{
+			/* A clamped difference keep the same sign, so the output is still between Vout(i-1) and Vin(i) */
+			l_iDiff = eDSP_SATARITH_SubI64(p_iValue, p_ptCtx->iPrevOutValue, &p_ptCtx->uSatCnt);
+			l_eRes = e_eDSP_FOLPASSFILTER_RES_OK;
+		}
+		else
+		{
+			l_eMaxRes = eDSP_MAXCHECK_SubI64(p_iValue, p_ptCtx->iPrevOutValue, &l_iDiff);
+			l_eRes = eDSP_FOLPASSFILTER_MaxCheckResToFOLPF(l_eMaxRes);
+		}
+
+		if( e_eDSP_FOLPASSFILTER_RES_OK == l_eRes )
+		{
+			p_ptCtx->iPrevOutValue += eDSP_Q31ARITH_MulI64(l_iDiff, p_uCoeffQ31);
+			*p_pFilteredVal = p_ptCtx->iPrevOutValue;
+		}
+	}
+
+	return l_eRes;
+}
+
 static e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_MaxCheckResToFOLPF(const e_eDSP_MAXCHECK_RES p_tMaxRet)
 {
 	e_eDSP_FOLPASSFILTER_RES l_eRet;
@@ -183,3 +555,62 @@ static e_eDSP_FOLPASSFILTER_RES eDSP_FOLPASSFILTER_MaxCheckResToFOLPF(const e_eD
 
 	return l_eRet;
 }
+
+static uint32_t eDSP_FOLPASSFILTER_GetCoeffForDt(t_eDSP_FOLPASSFILTER_Ctx* const p_ptCtx, const uint32_t p_uTimeUs)
+{
+	/* Local variable */
+	uint32_t l_uCoeffQ31;
+	uint32_t l_uDtKey;
+	uint32_t l_uIdx;
+	uint64_t l_uTimeUs;
+
+	/* Quantize the elapsed time to the nearest step, zero is reserved for the empty entry */
+	l_uDtKey = (uint32_t) ( ( ( (uint64_t) p_uTimeUs ) + ( ( ( (uint64_t) 1u ) << p_ptCtx->uDtQuantShift ) >> 1u ) ) >>
+	                        p_ptCtx->uDtQuantShift );
+
+	if( 0u == l_uDtKey )
+	{
+		l_uDtKey = 1u;
+	}
+
+	l_uTimeUs = ( (uint64_t) l_uDtKey ) << p_ptCtx->uDtQuantShift;
+
+	if( NULL == p_ptCtx->ptCoeffCache )
+	{
+		/* No cache, always calculate */
+		l_uCoeffQ31 = eDSP_Q31ARITH_CalcAlpha(p_ptCtx->uCutFreqMilHz, l_uTimeUs);
+
+		if( p_ptCtx->uCacheMiss < MAX_UINT32VAL )
+		{
+			p_ptCtx->uCacheMiss++;
+		}
+	}
+	else
+	{
+		/* Direct mapped cache, the len is a power of two */
+		l_uIdx = l_uDtKey & ( p_ptCtx->uCacheLen - 1u );
+
+		if( l_uDtKey == p_ptCtx->ptCoeffCache[l_uIdx].uDtKey )
+		{
+			l_uCoeffQ31 = p_ptCtx->ptCoeffCache[l_uIdx].uCoeffQ31;
+
+			if( p_ptCtx->uCacheHit < MAX_UINT32VAL )
+			{
+				p_ptCtx->uCacheHit++;
+			}
+		}
+		else
+		{
+			l_uCoeffQ31 = eDSP_Q31ARITH_CalcAlpha(p_ptCtx->uCutFreqMilHz, l_uTimeUs);
+			p_ptCtx->ptCoeffCache[l_uIdx].uDtKey = l_uDtKey;
+			p_ptCtx->ptCoeffCache[l_uIdx].uCoeffQ31 = l_uCoeffQ31;
+
+			if( p_ptCtx->uCacheMiss < MAX_UINT32VAL )
+			{
+				p_ptCtx->uCacheMiss++;
+			}
+		}
+	}
+
+	return l_uCoeffQ31;
+}
@@ -0,0 +1,607 @@
+/**
+ * @file       eDSP_MCFOHPASSFILTER.c
+ *
+ * @brief      Multi channel first order High pass filter implementation
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_MCFOHPASSFILTER.h"
+#include "eDSP_SATARITH.h"
+#include "eDSP_Q31ARITH.h"
+
+#ifdef EDSP_CONFIG_X86SIMD
+    #include <immintrin.h>
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE DEFINE
+ **********************************************************************************************************************/
+/* Unitary value of a Q31 coefficient */
+#define EDSP_MCFOHPASSFILTER_Q31ONE                                                        ( ( uint32_t ) 0x80000000u )
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eDSP_MCFOHPASSFILTER_IsStatusStillCoherent(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx);
+static e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_InsertValuesCore(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx,
+                                                                        const int64_t* p_piValues,
+                                                                        int64_t* const p_piFilteredVal);
+#ifdef EDSP_CONFIG_X86SIMD
+static uint32_t eDSP_MCFOHPASSFILTER_CheckSimd(const int64_t* p_piValues, const int64_t* p_piPrevIn,
+                                               const int64_t* p_piPrevOut, const uint32_t p_uNChannels,
+                                               uint64_t* const p_puOverflow);
+static uint32_t eDSP_MCFOHPASSFILTER_UpdateSimd(const int64_t* p_piValues, int64_t* const p_piPrevIn,
+                                                int64_t* const p_piPrevOut, int64_t* const p_piFilteredVal,
+                                                const uint32_t p_uNChannels, const uint32_t p_uBetaQ31);
+static uint32_t eDSP_MCFOHPASSFILTER_CheckAvx2(const int64_t* p_piValues, const int64_t* p_piPrevIn,
+                                               const int64_t* p_piPrevOut, const uint32_t p_uNChannels,
+                                               uint64_t* const p_puOverflow);
+static uint32_t eDSP_MCFOHPASSFILTER_UpdateAvx2(const int64_t* p_piValues, int64_t* const p_piPrevIn,
+                                                int64_t* const p_piPrevOut, int64_t* const p_piFilteredVal,
+                                                const uint32_t p_uNChannels, const uint32_t p_uBetaQ31);
+static __m256i eDSP_MCFOHPASSFILTER_MulQ31Avx2(const __m256i p_tValue, const __m256i p_tCoeffQ31);
+static uint32_t eDSP_MCFOHPASSFILTER_CheckAvx512(const int64_t* p_piValues, const int64_t* p_piPrevIn,
+                                                 const int64_t* p_piPrevOut, const uint32_t p_uNChannels,
+                                                 uint64_t* const p_puOverflow);
+static uint32_t eDSP_MCFOHPASSFILTER_UpdateAvx512(const int64_t* p_piValues, int64_t* const p_piPrevIn,
+                                                  int64_t* const p_piPrevOut, int64_t* const p_piFilteredVal,
+                                                  const uint32_t p_uNChannels, const uint32_t p_uBetaQ31);
+static __m512i eDSP_MCFOHPASSFILTER_MulQ31Avx512(const __m512i p_tValue, const __m512i p_tCoeffQ31);
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_InitCtx(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx,
+                                                        int64_t* p_piPrevInBuffer, int64_t* p_piPrevOutBuffer,
+                                                        uint32_t p_uNChannels, uint64_t p_uCutFreqMilHz,
+                                                        uint32_t p_uSamplePeriodUs)
+{
+	/* Local variable */
+	e_eDSP_MCFOHPASSFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piPrevInBuffer ) || ( NULL == p_piPrevOutBuffer ) )
+	{
+		l_eRes = e_eDSP_MCFOHPASSFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check data validity */
+		if( ( 0u == p_uNChannels ) || ( 0u == p_uCutFreqMilHz ) || ( 0u == p_uSamplePeriodUs ) )
+		{
+			l_eRes = e_eDSP_MCFOHPASSFILTER_RES_BADPARAM;
+		}
+		else
+		{
+			/* Initialize internal status */
+			p_ptCtx->bIsInit = true;
+			p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+			p_ptCtx->uSatCnt = 0u;
+			p_ptCtx->bHasPrevValue = false;
+			p_ptCtx->uNChannels = p_uNChannels;
+			p_ptCtx->uCutFreqMilHz = p_uCutFreqMilHz;
+			p_ptCtx->uSamplePeriodUs = p_uSamplePeriodUs;
+			p_ptCtx->uBetaQ31 = EDSP_MCFOHPASSFILTER_Q31ONE -
+			                    eDSP_Q31ARITH_CalcAlpha(p_uCutFreqMilHz, p_uSamplePeriodUs);
+			p_ptCtx->piPrevInValue = p_piPrevInBuffer;
+			p_ptCtx->piPrevOutValue = p_piPrevOutBuffer;
+			memset(p_piPrevInBuffer, 0, sizeof(int64_t) * p_uNChannels);
+			memset(p_piPrevOutBuffer, 0, sizeof(int64_t) * p_uNChannels);
+
+			/* All OK */
+			l_eRes = e_eDSP_MCFOHPASSFILTER_RES_OK;
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_IsInit(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eDSP_MCFOHPASSFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eDSP_MCFOHPASSFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eDSP_MCFOHPASSFILTER_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_InsertValuesAndCalculate(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx,
+                                                                         const int64_t* p_piValues,
+                                                                         int64_t* const p_piFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_MCFOHPASSFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_piFilteredVal ) )
+	{
+		l_eRes = e_eDSP_MCFOHPASSFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MCFOHPASSFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MCFOHPASSFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MCFOHPASSFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				l_eRes = eDSP_MCFOHPASSFILTER_InsertValuesCore(p_ptCtx, p_piValues, p_piFilteredVal);
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_SetOvfMode(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx,
+                                                           e_eDSP_TYPE_OVFMODE p_eOvfMode)
+{
+	/* Local variable */
+	e_eDSP_MCFOHPASSFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_MCFOHPASSFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MCFOHPASSFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MCFOHPASSFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MCFOHPASSFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
+				{
+					l_eRes = e_eDSP_MCFOHPASSFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					l_eRes = e_eDSP_MCFOHPASSFILTER_RES_OK;
+				}
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_GetSatCnt(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx,
+                                                          uint32_t* const p_puSatCnt)
+{
+	/* Local variable */
+	e_eDSP_MCFOHPASSFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
+	{
+		l_eRes = e_eDSP_MCFOHPASSFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MCFOHPASSFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MCFOHPASSFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MCFOHPASSFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puSatCnt = p_ptCtx->uSatCnt;
+				l_eRes = e_eDSP_MCFOHPASSFILTER_RES_OK;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eDSP_MCFOHPASSFILTER_IsStatusStillCoherent(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+    bool_t l_eRes;
+
+	/* Check data validity */
+	if( ( NULL == p_ptCtx->piPrevInValue ) || ( NULL == p_ptCtx->piPrevOutValue ) || ( 0u == p_ptCtx->uNChannels ) ||
+		( 0u == p_ptCtx->uCutFreqMilHz ) || ( 0u == p_ptCtx->uSamplePeriodUs ) ||
+		( p_ptCtx->uBetaQ31 > EDSP_MCFOHPASSFILTER_Q31ONE ) ||
+		( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) &&
+		  ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) ) )
+	{
+		l_eRes = false;
+	}
+    else
+    {
+		l_eRes = true;
+    }
+
+    return l_eRes;
+}
+
+static e_eDSP_MCFOHPASSFILTER_RES eDSP_MCFOHPASSFILTER_InsertValuesCore(t_eDSP_MCFOHPASSFILTER_Ctx* const p_ptCtx,
+                                                                        const int64_t* p_piValues,
+                                                                        int64_t* const p_piFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_MCFOHPASSFILTER_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCh;
+	uint64_t l_uIn;
+	uint64_t l_uPrevIn;
+	uint64_t l_uPrevOut;
+	uint64_t l_uDiff;
+	uint64_t l_uSum;
+	uint64_t l_uOverflow;
+	int64_t  l_iSum;
+	int64_t* l_piPrevIn;
+	int64_t* l_piPrevOut;
+
+	l_piPrevIn = p_ptCtx->piPrevInValue;
+	l_piPrevOut = p_ptCtx->piPrevOutValue;
+
+	if( false == p_ptCtx->bHasPrevValue )
+	{
+		/* The first values are used as reference for the next ones */
+		for( l_uCh = 0u; l_uCh < p_ptCtx->uNChannels; l_uCh++ )
+		{
+			l_piPrevIn[l_uCh] = p_piValues[l_uCh];
+			l_piPrevOut[l_uCh] = 0;
+		}
+
+		p_ptCtx->bHasPrevValue = true;
+		l_eRes = e_eDSP_MCFOHPASSFILTER_RES_NEEDSMOREVALUE;
+	}
+	else
+	{
+		/* Check both Vin(i) - Vin(i-1) and Vout(i-1) + ( Vin(i) - Vin(i-1) ) using the sign of operands and
+		   results. The check is done on every channel without branch, so that the loop can be vectorized */
+		l_uOverflow = 0u;
+		l_uCh = 0u;
+
+#ifdef EDSP_CONFIG_X86SIMD
+		l_uCh = eDSP_MCFOHPASSFILTER_CheckSimd(p_piValues, l_piPrevIn, l_piPrevOut, p_ptCtx->uNChannels, &l_uOverflow);
+#endif
+
+		for( ; l_uCh < p_ptCtx->uNChannels; l_uCh++ )
+		{
+			l_uIn = (uint64_t) p_piValues[l_uCh];
+			l_uPrevIn = (uint64_t) l_piPrevIn[l_uCh];
+			l_uPrevOut = (uint64_t) l_piPrevOut[l_uCh];
+			l_uDiff = l_uIn - l_uPrevIn;
+			l_uSum = l_uPrevOut + l_uDiff;
+			l_uOverflow |= ( ( l_uIn ^ l_uPrevIn ) & ( l_uIn ^ l_uDiff ) ) |
+			               ( ( l_uPrevOut ^ l_uSum ) & ( l_uDiff ^ l_uSum ) );
+		}
+
+		if( 0u == ( l_uOverflow >> 63u ) )
+		{
+			/* Vout(i) = beta * ( Vout(i-1) + Vin(i) - Vin(i-1) ) */
+			l_uCh = 0u;
+
+#ifdef EDSP_CONFIG_X86SIMD
+			l_uCh = eDSP_MCFOHPASSFILTER_UpdateSimd(p_piValues, l_piPrevIn, l_piPrevOut, p_piFilteredVal,
+			                                        p_ptCtx->uNChannels, p_ptCtx->uBetaQ31);
+#endif
+
+			for( ; l_uCh < p_ptCtx->uNChannels; l_uCh++ )
+			{
+				l_piPrevOut[l_uCh] = eDSP_Q31ARITH_MulI64(l_piPrevOut[l_uCh] +
+				                                          ( p_piValues[l_uCh] - l_piPrevIn[l_uCh] ),
+				                                          p_ptCtx->uBetaQ31);
+				l_piPrevIn[l_uCh] = p_piValues[l_uCh];
+				p_piFilteredVal[l_uCh] = l_piPrevOut[l_uCh];
+			}
+
+			l_eRes = e_eDSP_MCFOHPASSFILTER_RES_OK;
+		}
+		else if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+		{
+			/* Only a tick with an overflow use the portable saturating loop, beta is never greater than one so the
+			   last step can't overflow */
+			for( l_uCh = 0u; l_uCh < p_ptCtx->uNChannels; l_uCh++ )
+			{
+				l_iSum = eDSP_SATARITH_SubI64(p_piValues[l_uCh], l_piPrevIn[l_uCh], &p_ptCtx->uSatCnt);
+				l_iSum = eDSP_SATARITH_AddI64(l_piPrevOut[l_uCh], l_iSum, &p_ptCtx->uSatCnt);
+				l_piPrevOut[l_uCh] = eDSP_Q31ARITH_MulI64(l_iSum, p_ptCtx->uBetaQ31);
+				l_piPrevIn[l_uCh] = p_piValues[l_uCh];
+				p_piFilteredVal[l_uCh] = l_piPrevOut[l_uCh];
+			}
+
+			l_eRes = e_eDSP_MCFOHPASSFILTER_RES_OK;
+		}
+		else
+		{
+			l_eRes = e_eDSP_MCFOHPASSFILTER_RES_OVERFLOW;
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+#ifdef EDSP_CONFIG_X86SIMD
+static uint32_t eDSP_MCFOHPASSFILTER_CheckSimd(const int64_t* p_piValues, const int64_t* p_piPrevIn,
+                                               const int64_t* p_piPrevOut, const uint32_t p_uNChannels,
+                                               uint64_t* const p_puOverflow)
+{
+	/* Local variable */
+	uint32_t l_uDone;
+
+	/* Use the widest kernel supported by the running CPU, the remaining channels are done by the portable loop */
+	if( __builtin_cpu_supports("avx512f") )
+	{
+		l_uDone = eDSP_MCFOHPASSFILTER_CheckAvx512(p_piValues, p_piPrevIn, p_piPrevOut, p_uNChannels, p_puOverflow);
+	}
+	else if( __builtin_cpu_supports("avx2") )
+	{
+		l_uDone = eDSP_MCFOHPASSFILTER_CheckAvx2(p_piValues, p_piPrevIn, p_piPrevOut, p_uNChannels, p_puOverflow);
+	}
+	else
+	{
+		l_uDone = 0u;
+	}
+
+	return l_uDone;
+}
+
+static uint32_t eDSP_MCFOHPASSFILTER_UpdateSimd(const int64_t* p_piValues, int64_t* const p_piPrevIn,
+                                                int64_t* const p_piPrevOut, int64_t* const p_piFilteredVal,
+                                                const uint32_t p_uNChannels, const uint32_t p_uBetaQ31)
+{
+	/* Local variable */
+	uint32_t l_uDone;
+
+	if( __builtin_cpu_supports("avx512f") )
+	{
+		l_uDone = eDSP_MCFOHPASSFILTER_UpdateAvx512(p_piValues, p_piPrevIn, p_piPrevOut, p_piFilteredVal,
+		                                            p_uNChannels, p_uBetaQ31);
+	}
+	else if( __builtin_cpu_supports("avx2") )
+	{
+		l_uDone = eDSP_MCFOHPASSFILTER_UpdateAvx2(p_piValues, p_piPrevIn, p_piPrevOut, p_piFilteredVal,
+		                                          p_uNChannels, p_uBetaQ31);
+	}
+	else
+	{
+		l_uDone = 0u;
+	}
+
+	return l_uDone;
+}
+
+__attribute__((target("avx2")))
+static uint32_t eDSP_MCFOHPASSFILTER_CheckAvx2(const int64_t* p_piValues, const int64_t* p_piPrevIn,
+                                               const int64_t* p_piPrevOut, const uint32_t p_uNChannels,
+                                               uint64_t* const p_puOverflow)
+{
+	/* Local variable */
+	uint32_t l_uCh;
+	__m256i l_tIn;
+	__m256i l_tPrevIn;
+	__m256i l_tPrevOut;
+	__m256i l_tDiff;
+	__m256i l_tSum;
+	__m256i l_tOverflow;
+
+	l_tOverflow = _mm256_setzero_si256();
+
+	for( l_uCh = 0u; ( l_uCh + 4u ) <= p_uNChannels; l_uCh += 4u )
+	{
+		l_tIn = _mm256_loadu_si256( (const __m256i*) &p_piValues[l_uCh] );
+		l_tPrevIn = _mm256_loadu_si256( (const __m256i*) &p_piPrevIn[l_uCh] );
+		l_tPrevOut = _mm256_loadu_si256( (const __m256i*) &p_piPrevOut[l_uCh] );
+		l_tDiff = _mm256_sub_epi64(l_tIn, l_tPrevIn);
+		l_tSum = _mm256_add_epi64(l_tPrevOut, l_tDiff);
+		l_tOverflow = _mm256_or_si256(l_tOverflow, _mm256_and_si256(_mm256_xor_si256(l_tIn, l_tPrevIn),
+		                                                            _mm256_xor_si256(l_tIn, l_tDiff)));
+		l_tOverflow = _mm256_or_si256(l_tOverflow, _mm256_and_si256(_mm256_xor_si256(l_tPrevOut, l_tSum),
+		                                                            _mm256_xor_si256(l_tDiff, l_tSum)));
+	}
+
+	/* Only the sign bit of every lane is meaningful */
+	if( 0 != _mm256_movemask_pd(_mm256_castsi256_pd(l_tOverflow)) )
+	{
+		*p_puOverflow |= (uint64_t) MIN_INT64VAL;
+	}
+
+	return l_uCh;
+}
+
+__attribute__((target("avx2")))
+static uint32_t eDSP_MCFOHPASSFILTER_UpdateAvx2(const int64_t* p_piValues, int64_t* const p_piPrevIn,
+                                                int64_t* const p_piPrevOut, int64_t* const p_piFilteredVal,
+                                                const uint32_t p_uNChannels, const uint32_t p_uBetaQ31)
+{
+	/* Local variable */
+	uint32_t l_uCh;
+	__m256i l_tCoeff;
+	__m256i l_tIn;
+	__m256i l_tPrevIn;
+	__m256i l_tPrevOut;
+
+	l_tCoeff = _mm256_set1_epi64x( (int64_t) p_uBetaQ31 );
+
+	for( l_uCh = 0u; ( l_uCh + 4u ) <= p_uNChannels; l_uCh += 4u )
+	{
+		l_tIn = _mm256_loadu_si256( (const __m256i*) &p_piValues[l_uCh] );
+		l_tPrevIn = _mm256_loadu_si256( (const __m256i*) &p_piPrevIn[l_uCh] );
+		l_tPrevOut = _mm256_loadu_si256( (const __m256i*) &p_piPrevOut[l_uCh] );
+		l_tPrevOut = eDSP_MCFOHPASSFILTER_MulQ31Avx2(_mm256_add_epi64(l_tPrevOut, _mm256_sub_epi64(l_tIn, l_tPrevIn)),
+		                                                  l_tCoeff);
+		_mm256_storeu_si256( (__m256i*) &p_piPrevIn[l_uCh], l_tIn );
+		_mm256_storeu_si256( (__m256i*) &p_piPrevOut[l_uCh], l_tPrevOut );
+		_mm256_storeu_si256( (__m256i*) &p_piFilteredVal[l_uCh], l_tPrevOut );
+	}
+
+	return l_uCh;
+}
+
+__attribute__((target("avx2")))
+static __m256i eDSP_MCFOHPASSFILTER_MulQ31Avx2(const __m256i p_tValue, const __m256i p_tCoeffQ31)
+{
+	/* Local variable */
+	__m256i l_tLow;
+	__m256i l_tHigh;
+	__m256i l_tHighRes;
+	__m256i l_tLowRes;
+
+	/* Same split of eDSP_MCFOHPASSFILTER_MulQ31. AVX2 has no 64 bit arithmetic shift, so the high part is sign
+	   extended by hand, and has no 64 bit multiply, so high * coeff is built from two 32 x 32 bit products */
+	l_tLow = _mm256_and_si256(p_tValue, _mm256_set1_epi64x(0x7FFFFFFF));
+	l_tHigh = _mm256_or_si256(_mm256_srli_epi64(p_tValue, 31),
+	                          _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), p_tValue),
+	                                           _mm256_set1_epi64x( (int64_t) 0xFFFFFFFE00000000u )));
+	l_tHighRes = _mm256_add_epi64(_mm256_mul_epu32(l_tHigh, p_tCoeffQ31),
+	                              _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(l_tHigh, 32), p_tCoeffQ31), 32));
+
+	/* Low part is rounded to the nearest */
+	l_tLowRes = _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epu32(l_tLow, p_tCoeffQ31),
+	                                               _mm256_set1_epi64x(0x40000000)), 31);
+
+	return _mm256_add_epi64(l_tHighRes, l_tLowRes);
+}
+
+__attribute__((target("avx512f")))
+static uint32_t eDSP_MCFOHPASSFILTER_CheckAvx512(const int64_t* p_piValues, const int64_t* p_piPrevIn,
+                                                 const int64_t* p_piPrevOut, const uint32_t p_uNChannels,
+                                                 uint64_t* const p_puOverflow)
+{
+	/* Local variable */
+	uint32_t l_uCh;
+	__m512i l_tIn;
+	__m512i l_tPrevIn;
+	__m512i l_tPrevOut;
+	__m512i l_tDiff;
+	__m512i l_tSum;
+	__m512i l_tOverflow;
+
+	l_tOverflow = _mm512_setzero_si512();
+
+	for( l_uCh = 0u; ( l_uCh + 8u ) <= p_uNChannels; l_uCh += 8u )
+	{
+		l_tIn = _mm512_loadu_si512( (const void*) &p_piValues[l_uCh] );
+		l_tPrevIn = _mm512_loadu_si512( (const void*) &p_piPrevIn[l_uCh] );
+		l_tPrevOut = _mm512_loadu_si512( (const void*) &p_piPrevOut[l_uCh] );
+		l_tDiff = _mm512_sub_epi64(l_tIn, l_tPrevIn);
+		l_tSum = _mm512_add_epi64(l_tPrevOut, l_tDiff);
+		l_tOverflow = _mm512_or_si512(l_tOverflow, _mm512_and_si512(_mm512_xor_si512(l_tIn, l_tPrevIn),
+		                                                            _mm512_xor_si512(l_tIn, l_tDiff)));
+		l_tOverflow = _mm512_or_si512(l_tOverflow, _mm512_and_si512(_mm512_xor_si512(l_tPrevOut, l_tSum),
+		                                                            _mm512_xor_si512(l_tDiff, l_tSum)));
+	}
+
+	/* Only the sign bit of every lane is meaningful */
+	if( 0u != _mm512_cmplt_epi64_mask(l_tOverflow, _mm512_setzero_si512()) )
+	{
+		*p_puOverflow |= (uint64_t) MIN_INT64VAL;
+	}
+
+	return l_uCh;
+}
+
+__attribute__((target("avx512f")))
+static uint32_t eDSP_MCFOHPASSFILTER_UpdateAvx512(const int64_t* p_piValues, int64_t* const p_piPrevIn,
+                                                  int64_t* const p_piPrevOut, int64_t* const p_piFilteredVal,
+                                                  const uint32_t p_uNChannels, const uint32_t p_uBetaQ31)
+{
+	/* Local variable */
+	uint32_t l_uCh;
+	__m512i l_tCoeff;
+	__m512i l_tIn;
+	__m512i l_tPrevIn;
+	__m512i l_tPrevOut;
+
+	l_tCoeff = _mm512_set1_epi64( (int64_t) p_uBetaQ31 );
+
+	for( l_uCh = 0u; ( l_uCh + 8u ) <= p_uNChannels; l_uCh += 8u )
+	{
+		l_tIn = _mm512_loadu_si512( (const void*) &p_piValues[l_uCh] );
+		l_tPrevIn = _mm512_loadu_si512( (const void*) &p_piPrevIn[l_uCh] );
+		l_tPrevOut = _mm512_loadu_si512( (const void*) &p_piPrevOut[l_uCh] );
+		l_tPrevOut = eDSP_MCFOHPASSFILTER_MulQ31Avx512(_mm512_add_epi64(l_tPrevOut, _mm512_sub_epi64(l_tIn, l_tPrevIn)),
+		                                                  l_tCoeff);
+		_mm512_storeu_si512( (void*) &p_piPrevIn[l_uCh], l_tIn );
+		_mm512_storeu_si512( (void*) &p_piPrevOut[l_uCh], l_tPrevOut );
+		_mm512_storeu_si512( (void*) &p_piFilteredVal[l_uCh], l_tPrevOut );
+	}
+
+	return l_uCh;
+}
+
+__attribute__((target("avx512f")))
+static __m512i eDSP_MCFOHPASSFILTER_MulQ31Avx512(const __m512i p_tValue, const __m512i p_tCoeffQ31)
+{
+	/* Local variable */
+	__m512i l_tLow;
+	__m512i l_tHigh;
+	__m512i l_tHighRes;
+	__m512i l_tLowRes;
+
+	/* Same split of eDSP_MCFOHPASSFILTER_MulQ31, high * coeff is built from two 32 x 32 bit products */
+	l_tLow = _mm512_and_si512(p_tValue, _mm512_set1_epi64(0x7FFFFFFF));
+	l_tHigh = _mm512_srai_epi64(p_tValue, 31);
+	l_tHighRes = _mm512_add_epi64(_mm512_mul_epu32(l_tHigh, p_tCoeffQ31),
+	                              _mm512_slli_epi64(_mm512_mul_epu32(_mm512_srli_epi64(l_tHigh, 32), p_tCoeffQ31), 32));
+
+	/* Low part is rounded to the nearest */
+	l_tLowRes = _mm512_srli_epi64(_mm512_add_epi64(_mm512_mul_epu32(l_tLow, p_tCoeffQ31),
+	                                               _mm512_set1_epi64(0x40000000)), 31);
+
+	return _mm512_add_epi64(l_tHighRes, l_tLowRes);
+}
+#endif
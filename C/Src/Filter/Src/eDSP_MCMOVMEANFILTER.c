@@ -0,0 +1,481 @@
+/**
+ * @file       eDSP_MCMOVMEANFILTER.c
+ *
+ * @brief      Multi channel mean filter implementation
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_MCMOVMEANFILTER.h"
+#include "eDSP_SATARITH.h"
+
+#ifdef EDSP_CONFIG_X86SIMD
+    #include <immintrin.h>
+#endif
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eDSP_MCMOVMEANFILTER_IsStatusStillCoherent(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx);
+static void eDSP_MCMOVMEANFILTER_UpdateSums(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx, const int64_t* p_piValues);
+#ifdef EDSP_CONFIG_X86SIMD
+static uint32_t eDSP_MCMOVMEANFILTER_UpdateSumsAvx2(int64_t* const p_piRow, uint64_t* const p_puLow,
+                                                    int64_t* const p_piHigh, const int64_t* p_piValues,
+                                                    const uint32_t p_uNChannels);
+static uint32_t eDSP_MCMOVMEANFILTER_UpdateSumsAvx512(int64_t* const p_piRow, uint64_t* const p_puLow,
+                                                      int64_t* const p_piHigh, const int64_t* p_piValues,
+                                                      const uint32_t p_uNChannels);
+#endif
+static e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_CalcMeans(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx,
+                                                                 int64_t* const p_piFilteredVal);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_InitCtx(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx,
+                                                        int64_t* p_piWindowsBuffer, uint32_t p_uWindowsBuffLen,
+                                                        uint64_t* p_puSumLowBuffer, int64_t* p_piSumHighBuffer,
+                                                        uint32_t p_uNChannels, uint32_t p_uWindowsLen)
+{
+	/* Local variable */
+	e_eDSP_MCMOVMEANFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piWindowsBuffer ) || ( NULL == p_puSumLowBuffer ) ||
+		( NULL == p_piSumHighBuffer ) )
+	{
+		l_eRes = e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check data validity */
+		if( ( 0u == p_uNChannels ) || ( p_uWindowsLen <= 2u ) ||
+			( ( (uint64_t) p_uWindowsBuffLen ) != ( ( (uint64_t) p_uWindowsLen ) * ( (uint64_t) p_uNChannels ) ) ) )
+		{
+			l_eRes = e_eDSP_MCMOVMEANFILTER_RES_BADPARAM;
+		}
+		else
+		{
+			/* Initialize internal status */
+			p_ptCtx->bIsInit = true;
+			p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+			p_ptCtx->uSatCnt = 0u;
+			p_ptCtx->uNChannels = p_uNChannels;
+			p_ptCtx->uWindowsLen = p_uWindowsLen;
+			p_ptCtx->uFilledData = 0u;
+			p_ptCtx->uCurDataLocation = 0u;
+			p_ptCtx->piWindowsBuffer = p_piWindowsBuffer;
+			p_ptCtx->puWindowsSumLow = p_puSumLowBuffer;
+			p_ptCtx->piWindowsSumHigh = p_piSumHighBuffer;
+			memset(p_piWindowsBuffer, 0, sizeof(int64_t) * p_uWindowsBuffLen);
+			memset(p_puSumLowBuffer, 0, sizeof(uint64_t) * p_uNChannels);
+			memset(p_piSumHighBuffer, 0, sizeof(int64_t) * p_uNChannels);
+
+			/* All OK */
+			l_eRes = e_eDSP_MCMOVMEANFILTER_RES_OK;
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_IsInit(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eDSP_MCMOVMEANFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eDSP_MCMOVMEANFILTER_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_InsertValuesAndCalculate(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx,
+                                                                         const int64_t* p_piValues,
+                                                                         int64_t* const p_piFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_MCMOVMEANFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_piFilteredVal ) )
+	{
+		l_eRes = e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MCMOVMEANFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MCMOVMEANFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MCMOVMEANFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Insert the values of every channel and update the running sums */
+				eDSP_MCMOVMEANFILTER_UpdateSums(p_ptCtx, p_piValues);
+
+				if( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen )
+				{
+					/* Need more data */
+					l_eRes = e_eDSP_MCMOVMEANFILTER_RES_NEEDSMOREVALUE;
+				}
+				else
+				{
+					l_eRes = eDSP_MCMOVMEANFILTER_CalcMeans(p_ptCtx, p_piFilteredVal);
+				}
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_SetOvfMode(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx,
+                                                           e_eDSP_TYPE_OVFMODE p_eOvfMode)
+{
+	/* Local variable */
+	e_eDSP_MCMOVMEANFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MCMOVMEANFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MCMOVMEANFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MCMOVMEANFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
+				{
+					l_eRes = e_eDSP_MCMOVMEANFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					l_eRes = e_eDSP_MCMOVMEANFILTER_RES_OK;
+				}
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_GetSatCnt(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx,
+                                                          uint32_t* const p_puSatCnt)
+{
+	/* Local variable */
+	e_eDSP_MCMOVMEANFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
+	{
+		l_eRes = e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MCMOVMEANFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MCMOVMEANFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MCMOVMEANFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puSatCnt = p_ptCtx->uSatCnt;
+				l_eRes = e_eDSP_MCMOVMEANFILTER_RES_OK;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eDSP_MCMOVMEANFILTER_IsStatusStillCoherent(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+    bool_t l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx->piWindowsBuffer ) || ( NULL == p_ptCtx->puWindowsSumLow ) ||
+		( NULL == p_ptCtx->piWindowsSumHigh ) )
+	{
+		l_eRes = false;
+	}
+    else
+    {
+		/* Check data validity, the running sums are not checked to keep the cost independent of the channels */
+		if( ( 0u == p_ptCtx->uNChannels ) || ( p_ptCtx->uWindowsLen <= 2u ) ||
+			( p_ptCtx->uFilledData > p_ptCtx->uWindowsLen ) ||
+			( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen ) ||
+			( ( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen ) &&
+			  ( p_ptCtx->uCurDataLocation != p_ptCtx->uFilledData ) ) ||
+			( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) &&
+			  ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) ) )
+		{
+			l_eRes = false;
+		}
+		else
+		{
+			l_eRes = true;
+		}
+    }
+
+    return l_eRes;
+}
+
+static void eDSP_MCMOVMEANFILTER_UpdateSums(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx, const int64_t* p_piValues)
+{
+	/* Local variable for calculation */
+	uint32_t  l_uCh;
+	int64_t*  l_piRow;
+	uint64_t* l_puLow;
+	int64_t*  l_piHigh;
+	uint64_t  l_uPrevLow;
+	int64_t   l_iOld;
+
+	/* Row of the windows buffer that contains the value of every channel in the current position */
+	l_piRow = &p_ptCtx->piWindowsBuffer[( (uint64_t) p_ptCtx->uCurDataLocation ) * p_ptCtx->uNChannels];
+	l_puLow = p_ptCtx->puWindowsSumLow;
+	l_piHigh = p_ptCtx->piWindowsSumHigh;
+	l_uCh = 0u;
+
+#ifdef EDSP_CONFIG_X86SIMD
+	/* Use the widest kernel supported by the running CPU, the remaining channels are done by the portable loop */
+	if( __builtin_cpu_supports("avx512f") )
+	{
+		l_uCh = eDSP_MCMOVMEANFILTER_UpdateSumsAvx512(l_piRow, l_puLow, l_piHigh, p_piValues, p_ptCtx->uNChannels);
+	}
+	else if( __builtin_cpu_supports("avx2") )
+	{
+		l_uCh = eDSP_MCMOVMEANFILTER_UpdateSumsAvx2(l_piRow, l_puLow, l_piHigh, p_piValues, p_ptCtx->uNChannels);
+	}
+	else
+	{
+		/* Portable loop only */
+	}
+#endif
+
+	/* While the windows is not full the row contains zero, so removing it from the sums has no effect. The sums are
+	   stored as high * 2^64 + low like in eDSP_MOVMEANFILTER, carry and borrow are computed without branch so the
+	   loop can be vectorized */
+	for( ; l_uCh < p_ptCtx->uNChannels; l_uCh++ )
+	{
+		l_iOld = l_piRow[l_uCh];
+
+		/* Remove the value that exit from the windows */
+		l_uPrevLow = l_puLow[l_uCh];
+		l_puLow[l_uCh] = l_uPrevLow - ( (uint64_t) l_iOld );
+		l_piHigh[l_uCh] = l_piHigh[l_uCh] - ( (int64_t) ( l_puLow[l_uCh] > l_uPrevLow ) ) +
+		                  ( (int64_t) ( l_iOld < 0 ) );
+
+		/* Add the new one */
+		l_uPrevLow = l_puLow[l_uCh];
+		l_puLow[l_uCh] = l_uPrevLow + ( (uint64_t) p_piValues[l_uCh] );
+		l_piHigh[l_uCh] = l_piHigh[l_uCh] + ( (int64_t) ( l_puLow[l_uCh] < l_uPrevLow ) ) -
+		                  ( (int64_t) ( p_piValues[l_uCh] < 0 ) );
+
+		l_piRow[l_uCh] = p_piValues[l_uCh];
+	}
+
+	if( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen )
+	{
+		/* Increase filler counter */
+		p_ptCtx->uFilledData++;
+	}
+
+	p_ptCtx->uCurDataLocation++;
+
+	/* Manage rolback */
+	if( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )
+	{
+		p_ptCtx->uCurDataLocation = 0u;
+	}
+}
+
+static e_eDSP_MCMOVMEANFILTER_RES eDSP_MCMOVMEANFILTER_CalcMeans(t_eDSP_MCMOVMEANFILTER_Ctx* const p_ptCtx,
+                                                                 int64_t* const p_piFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_MCMOVMEANFILTER_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCh;
+	uint64_t l_uLow;
+	int64_t  l_iHigh;
+	int64_t  l_iLen;
+
+	l_eRes = e_eDSP_MCMOVMEANFILTER_RES_OK;
+	l_iLen = (int64_t) p_ptCtx->uWindowsLen;
+
+	for( l_uCh = 0u; l_uCh < p_ptCtx->uNChannels; l_uCh++ )
+	{
+		l_uLow = p_ptCtx->puWindowsSumLow[l_uCh];
+		l_iHigh = p_ptCtx->piWindowsSumHigh[l_uCh];
+
+		if( ( 0 == l_iHigh ) && ( l_uLow <= (uint64_t) MAX_INT64VAL ) )
+		{
+			/* Positive value */
+			p_piFilteredVal[l_uCh] = ( (int64_t) l_uLow ) / l_iLen;
+		}
+		else if( ( -1 == l_iHigh ) && ( l_uLow > (uint64_t) MAX_INT64VAL ) )
+		{
+			/* Negative value, ~low is the absolute value minus one and can always be stored in an int64_t */
+			p_piFilteredVal[l_uCh] = ( -( (int64_t) ( ~l_uLow ) ) - 1 ) / l_iLen;
+		}
+		else if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+		{
+			/* The mean of int64_t values always fit, divide directly the 128 bit running sum */
+			p_piFilteredVal[l_uCh] = eDSP_SATARITH_DivI128(l_iHigh, l_uLow, l_iLen, &p_ptCtx->uSatCnt);
+		}
+		else
+		{
+			/* Sum exceed the int64_t storage area, the filtered value of this channel is not updated */
+			l_eRes = e_eDSP_MCMOVMEANFILTER_RES_OVERFLOW;
+		}
+	}
+
+	return l_eRes;
+}
+
+#ifdef EDSP_CONFIG_X86SIMD
+__attribute__((target("avx2")))
+static uint32_t eDSP_MCMOVMEANFILTER_UpdateSumsAvx2(int64_t* const p_piRow, uint64_t* const p_puLow,
+                                                    int64_t* const p_piHigh, const int64_t* p_piValues,
+                                                    const uint32_t p_uNChannels)
+{
+	/* Local variable */
+	uint32_t l_uCh;
+	__m256i l_tBias;
+	__m256i l_tZero;
+	__m256i l_tOld;
+	__m256i l_tNew;
+	__m256i l_tLow;
+	__m256i l_tLowSub;
+	__m256i l_tLowAdd;
+	__m256i l_tHigh;
+
+	/* AVX2 has only signed compare, flip the sign bit to compare the low part as unsigned. A true compare is -1,
+	   so borrow and carry are applied adding or subtracting the compare mask */
+	l_tBias = _mm256_set1_epi64x(MIN_INT64VAL);
+	l_tZero = _mm256_setzero_si256();
+
+	for( l_uCh = 0u; ( l_uCh + 4u ) <= p_uNChannels; l_uCh += 4u )
+	{
+		l_tOld = _mm256_loadu_si256( (const __m256i*) &p_piRow[l_uCh] );
+		l_tNew = _mm256_loadu_si256( (const __m256i*) &p_piValues[l_uCh] );
+		l_tLow = _mm256_loadu_si256( (const __m256i*) &p_puLow[l_uCh] );
+		l_tHigh = _mm256_loadu_si256( (const __m256i*) &p_piHigh[l_uCh] );
+
+		/* Remove the value that exit from the windows */
+		l_tLowSub = _mm256_sub_epi64(l_tLow, l_tOld);
+		l_tHigh = _mm256_add_epi64(l_tHigh, _mm256_cmpgt_epi64(_mm256_xor_si256(l_tLowSub, l_tBias),
+		                                                        _mm256_xor_si256(l_tLow, l_tBias)));
+		l_tHigh = _mm256_sub_epi64(l_tHigh, _mm256_cmpgt_epi64(l_tZero, l_tOld));
+
+		/* Add the new one */
+		l_tLowAdd = _mm256_add_epi64(l_tLowSub, l_tNew);
+		l_tHigh = _mm256_sub_epi64(l_tHigh, _mm256_cmpgt_epi64(_mm256_xor_si256(l_tLowSub, l_tBias),
+		                                                        _mm256_xor_si256(l_tLowAdd, l_tBias)));
+		l_tHigh = _mm256_add_epi64(l_tHigh, _mm256_cmpgt_epi64(l_tZero, l_tNew));
+
+		_mm256_storeu_si256( (__m256i*) &p_piRow[l_uCh], l_tNew );
+		_mm256_storeu_si256( (__m256i*) &p_puLow[l_uCh], l_tLowAdd );
+		_mm256_storeu_si256( (__m256i*) &p_piHigh[l_uCh], l_tHigh );
+	}
+
+	return l_uCh;
+}
+
+__attribute__((target("avx512f")))
+static uint32_t eDSP_MCMOVMEANFILTER_UpdateSumsAvx512(int64_t* const p_piRow, uint64_t* const p_puLow,
+                                                      int64_t* const p_piHigh, const int64_t* p_piValues,
+                                                      const uint32_t p_uNChannels)
+{
+	/* Local variable */
+	uint32_t l_uCh;
+	__m512i l_tOne;
+	__m512i l_tZero;
+	__m512i l_tOld;
+	__m512i l_tNew;
+	__m512i l_tLow;
+	__m512i l_tLowSub;
+	__m512i l_tLowAdd;
+	__m512i l_tHigh;
+
+	l_tOne = _mm512_set1_epi64(1);
+	l_tZero = _mm512_setzero_si512();
+
+	for( l_uCh = 0u; ( l_uCh + 8u ) <= p_uNChannels; l_uCh += 8u )
+	{
+		l_tOld = _mm512_loadu_si512( (const void*) &p_piRow[l_uCh] );
+		l_tNew = _mm512_loadu_si512( (const void*) &p_piValues[l_uCh] );
+		l_tLow = _mm512_loadu_si512( (const void*) &p_puLow[l_uCh] );
+		l_tHigh = _mm512_loadu_si512( (const void*) &p_piHigh[l_uCh] );
+
+		/* Remove the value that exit from the windows, borrow and sign are applied only on the lanes that need it */
+		l_tLowSub = _mm512_sub_epi64(l_tLow, l_tOld);
+		l_tHigh = _mm512_mask_sub_epi64(l_tHigh, _mm512_cmpgt_epu64_mask(l_tLowSub, l_tLow), l_tHigh, l_tOne);
+		l_tHigh = _mm512_mask_add_epi64(l_tHigh, _mm512_cmplt_epi64_mask(l_tOld, l_tZero), l_tHigh, l_tOne);
+
+		/* Add the new one */
+		l_tLowAdd = _mm512_add_epi64(l_tLowSub, l_tNew);
+		l_tHigh = _mm512_mask_add_epi64(l_tHigh, _mm512_cmplt_epu64_mask(l_tLowAdd, l_tLowSub), l_tHigh, l_tOne);
+		l_tHigh = _mm512_mask_sub_epi64(l_tHigh, _mm512_cmplt_epi64_mask(l_tNew, l_tZero), l_tHigh, l_tOne);
+
+		_mm512_storeu_si512( (void*) &p_piRow[l_uCh], l_tNew );
+		_mm512_storeu_si512( (void*) &p_puLow[l_uCh], l_tLowAdd );
+		_mm512_storeu_si512( (void*) &p_piHigh[l_uCh], l_tHigh );
+	}
+
+	return l_uCh;
+}
+#endif
@@ -11,7 +11,8 @@
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eDSP_MOVMEANFILTER.h"
-#include "eDSP_MAXCHECK.h"
+#include "eDSP_SATARITH.h"
+#include "eDSP_BLOCKSCAN.h"
 
 
 
@@ -19,7 +20,14 @@
  *  PRIVATE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eDSP_MOVMEANFILTER_IsStatusStillCoherent(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx);
-static e_eDSP_MOVMEANFILTER_RES eDSP_MOVMEANFILTER_MaxCheckResToMED(const e_eDSP_MAXCHECK_RES p_tMaxRet);
+static e_eDSP_MOVMEANFILTER_RES eDSP_MOVMEANFILTER_InsertValueCore(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx,
+                                                                   const int64_t p_iValue, int64_t* const p_pFilteredVal);
+static void eDSP_MOVMEANFILTER_SumAdd(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx, const int64_t p_iValue);
+static void eDSP_MOVMEANFILTER_SumSubt(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx, const int64_t p_iValue);
+static bool_t eDSP_MOVMEANFILTER_SumToI64(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx, int64_t* const p_piSum);
+static void eDSP_MOVMEANFILTER_ProcessBlockNoOvf(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx, const int64_t* p_piValues,
+                                                 const uint32_t p_uNValues, const int64_t p_iSum,
+                                                 int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered);
 
 
 /***********************************************************************************************************************
@@ -47,10 +55,15 @@ e_eDSP_MOVMEANFILTER_RES eDSP_MOVMEANFILTER_InitCtx(t_eDSP_MOVMEANFILTER_Ctx* co
 		{
 			/* Initialize internal status */
 			p_ptCtx->bIsInit = true;
+			p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+			p_ptCtx->uSatCnt = 0u;
 			p_ptCtx->uWindowsLen = p_uWindowsBuffLen;
 			p_ptCtx->uFilledData = 0u;
 			p_ptCtx->uCurDataLocation = 0u;
-			memset(p_piWindowsBuffer, 0, sizeof(int64_t));
+			p_ptCtx->piWindowsBuffer = p_piWindowsBuffer;
+			p_ptCtx->uWindowsSumLow = 0u;
+			p_ptCtx->iWindowsSumHigh = 0;
+			memset(p_piWindowsBuffer, 0, sizeof(int64_t) * p_uWindowsBuffLen);
 
 			/* All OK */
 			l_eRes = e_eDSP_MOVMEANFILTER_RES_OK;
@@ -84,14 +97,55 @@ e_eDSP_MOVMEANFILTER_RES eDSP_MOVMEANFILTER_InsertValueAndCalculate(t_eDSP_MOVME
 {
 	/* Local variable for return */
 	e_eDSP_MOVMEANFILTER_RES l_eRes;
-	e_eDSP_MAXCHECK_RES l_eMaxRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pFilteredVal ) )
+	{
+		l_eRes = e_eDSP_MOVMEANFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MOVMEANFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MOVMEANFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MOVMEANFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				l_eRes = eDSP_MOVMEANFILTER_InsertValueCore(p_ptCtx, p_iValue, p_pFilteredVal);
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_MOVMEANFILTER_RES eDSP_MOVMEANFILTER_ProcessBlock(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx,
+                                                         const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                         int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                         uint32_t* const p_puNProcessed)
+{
+	/* Local variable for return */
+	e_eDSP_MOVMEANFILTER_RES l_eRes;
 
 	/* Local variable for calculation */
 	uint32_t l_uCnt;
+	uint32_t l_uNFiltered;
+	bool_t   l_bNoOvf;
+	int64_t  l_iMin;
+	int64_t  l_iMax;
 	int64_t  l_iSum;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_pFilteredVal ) )
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_piFilteredVal ) ||
+		( NULL == p_puNFiltered ) || ( NULL == p_puNProcessed ) )
 	{
 		l_eRes = e_eDSP_MOVMEANFILTER_RES_BADPOINTER;
 	}
@@ -111,49 +165,71 @@ e_eDSP_MOVMEANFILTER_RES eDSP_MOVMEANFILTER_InsertValueAndCalculate(t_eDSP_MOVME
             }
 			else
 			{
-				/* Insert data */
-				p_ptCtx->piWindowsBuffer[p_ptCtx->uCurDataLocation] = p_iValue;
-				p_ptCtx->uCurDataLocation++;
-
-				/* Manage rolback */
-				if( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )
-				{
-					p_ptCtx->uCurDataLocation = 0u;
-				}
-
-				if( p_ptCtx->uFilledData < ( p_ptCtx->uWindowsLen - 1u ) )
+				/* Check data validity */
+				if( 0u == p_uNValues )
 				{
-					/* Increase filler counter */
-					p_ptCtx->uFilledData++;
-
-					/* Need more data */
-					l_eRes = e_eDSP_MOVMEANFILTER_RES_NEEDSMOREVALUE;
+					l_eRes = e_eDSP_MOVMEANFILTER_RES_BADPARAM;
 				}
 				else
 				{
-					/* The window is full */
-					l_eRes = e_eDSP_MOVMEANFILTER_RES_OK;
+					/* Init variable */
 					l_uCnt = 0u;
-					l_iSum = 0u;
+					l_uNFiltered = 0u;
+					l_eRes = e_eDSP_MOVMEANFILTER_RES_NEEDSMOREVALUE;
+					l_bNoOvf = false;
+					l_iSum = 0;
 
-					/* Calculate the factibility of the sum for the means */
-					while( ( e_eDSP_MOVMEANFILTER_RES_OK == l_eRes ) && ( l_uCnt < p_ptCtx->uWindowsLen ) )
+					/* Pre-scan the window and the block, when no window sum can overflow the whole block is
+					   processed with plain int64_t arithmetic. Scanning the window cost as much as filtering it, so
+					   it is done only on blocks at least as long as the window */
+					if( p_uNValues >= p_ptCtx->uWindowsLen )
 					{
-						l_eMaxRes = eDSP_MAXCHECK_SUMI64Check(l_iSum, p_ptCtx->piWindowsBuffer[l_uCnt]);
-						l_eRes = eDSP_MOVMEANFILTER_MaxCheckResToMED(l_eMaxRes);
+						l_iMin = MAX_INT64VAL;
+						l_iMax = MIN_INT64VAL;
+						eDSP_BLOCKSCAN_MinMaxI64(p_ptCtx->piWindowsBuffer, p_ptCtx->uWindowsLen, &l_iMin, &l_iMax);
+						eDSP_BLOCKSCAN_MinMaxI64(p_piValues, p_uNValues, &l_iMin, &l_iMax);
+
+						if( ( true == eDSP_BLOCKSCAN_IsWindowSafe(l_iMin, l_iMax, p_ptCtx->uWindowsLen) ) &&
+							( true == eDSP_MOVMEANFILTER_SumToI64(p_ptCtx, &l_iSum) ) )
+						{
+							l_bNoOvf = true;
+						}
+					}
 
-						if( e_eDSP_MOVMEANFILTER_RES_OK == l_eRes )
+					if( true == l_bNoOvf )
+					{
+						eDSP_MOVMEANFILTER_ProcessBlockNoOvf(p_ptCtx, p_piValues, p_uNValues, l_iSum,
+						                                     p_piFilteredVal, &l_uNFiltered);
+						l_uCnt = p_uNValues;
+					}
+					else
+					{
+						/* Context is checked only once, every value of the block is processed without other
+						   check */
+						while( ( l_uCnt < p_uNValues ) && ( ( e_eDSP_MOVMEANFILTER_RES_OK == l_eRes ) ||
+							   ( e_eDSP_MOVMEANFILTER_RES_NEEDSMOREVALUE == l_eRes ) ) )
 						{
+							l_eRes = eDSP_MOVMEANFILTER_InsertValueCore(p_ptCtx, p_piValues[l_uCnt],
+							                                            &p_piFilteredVal[l_uNFiltered]);
+
+							if( e_eDSP_MOVMEANFILTER_RES_OK == l_eRes )
+							{
+								l_uNFiltered++;
+							}
+
+							/* Increase counter */
 							l_uCnt++;
-							l_iSum += p_ptCtx->piWindowsBuffer[l_uCnt];
 						}
 					}
 
-					if( e_eDSP_MOVMEANFILTER_RES_OK == l_eRes )
+					/* Some value are filtered and the last one doesn't generate any error */
+					if( ( e_eDSP_MOVMEANFILTER_RES_NEEDSMOREVALUE == l_eRes ) && ( l_uNFiltered > 0u ) )
 					{
-						/* Calculate and return the mean */
-						*p_pFilteredVal = l_iSum / p_ptCtx->uWindowsLen;
+						l_eRes = e_eDSP_MOVMEANFILTER_RES_OK;
 					}
+
+					*p_puNFiltered = l_uNFiltered;
+					*p_puNProcessed = l_uCnt;
 				}
 			}
 		}
@@ -162,6 +238,87 @@ e_eDSP_MOVMEANFILTER_RES eDSP_MOVMEANFILTER_InsertValueAndCalculate(t_eDSP_MOVME
 	return l_eRes;
 }
 
+e_eDSP_MOVMEANFILTER_RES eDSP_MOVMEANFILTER_SetOvfMode(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx,
+                                                       e_eDSP_TYPE_OVFMODE p_eOvfMode)
+{
+	/* Local variable */
+	e_eDSP_MOVMEANFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_MOVMEANFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MOVMEANFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MOVMEANFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MOVMEANFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
+				{
+					l_eRes = e_eDSP_MOVMEANFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					l_eRes = e_eDSP_MOVMEANFILTER_RES_OK;
+				}
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MOVMEANFILTER_RES eDSP_MOVMEANFILTER_GetSatCnt(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx,
+                                                      uint32_t* const p_puSatCnt)
+{
+	/* Local variable */
+	e_eDSP_MOVMEANFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
+	{
+		l_eRes = e_eDSP_MOVMEANFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MOVMEANFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MOVMEANFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MOVMEANFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puSatCnt = p_ptCtx->uSatCnt;
+				l_eRes = e_eDSP_MOVMEANFILTER_RES_OK;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
 
 
 /***********************************************************************************************************************
@@ -181,14 +338,19 @@ static bool_t eDSP_MOVMEANFILTER_IsStatusStillCoherent(t_eDSP_MOVMEANFILTER_Ctx*
     {
 		/* Check data validity */
 		if( ( p_ptCtx->uWindowsLen <= 2u ) || ( p_ptCtx->uFilledData > p_ptCtx->uWindowsLen ) ||
-			( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )  )
+			( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen ) ||
+			( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) &&
+			  ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) ) )
 		{
 			l_eRes = false;
 		}
 		else
 		{
-			/* Check data validity */
-			if( ( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen ) && ( p_ptCtx->uCurDataLocation >= p_ptCtx->uFilledData ) )
+			/* Check data validity, every value inserted can move the high part of the sum by one at most */
+			if( ( ( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen ) &&
+				  ( p_ptCtx->uCurDataLocation != p_ptCtx->uFilledData ) ) ||
+				( p_ptCtx->iWindowsSumHigh > ( (int64_t) p_ptCtx->uFilledData ) ) ||
+				( p_ptCtx->iWindowsSumHigh < -( (int64_t) p_ptCtx->uFilledData ) ) )
 			{
 				l_eRes = false;
 			}
@@ -202,18 +364,185 @@ static bool_t eDSP_MOVMEANFILTER_IsStatusStillCoherent(t_eDSP_MOVMEANFILTER_Ctx*
     return l_eRes;
 }
 
-static e_eDSP_MOVMEANFILTER_RES eDSP_MOVMEANFILTER_MaxCheckResToMED(const e_eDSP_MAXCHECK_RES p_tMaxRet)
+static e_eDSP_MOVMEANFILTER_RES eDSP_MOVMEANFILTER_InsertValueCore(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx,
+                                                                   const int64_t p_iValue, int64_t* const p_pFilteredVal)
 {
-	e_eDSP_MOVMEANFILTER_RES l_eRet;
+	/* Local variable for return */
+	e_eDSP_MOVMEANFILTER_RES l_eRes;
 
-	if( e_eDSP_MAXCHECK_RES_OK == p_tMaxRet )
+	/* Local variable for calculation */
+	int64_t  l_iSum;
+
+	/* When the windows is full the value we are going to overwrite exit from the windows, remove it
+	   from the running sum */
+	if( p_ptCtx->uFilledData >= p_ptCtx->uWindowsLen )
 	{
-		l_eRet = e_eDSP_MOVMEANFILTER_RES_OK;
+		eDSP_MOVMEANFILTER_SumSubt(p_ptCtx, p_ptCtx->piWindowsBuffer[p_ptCtx->uCurDataLocation]);
 	}
 	else
 	{
-		l_eRet = e_eDSP_MOVMEANFILTER_RES_OVERFLOW;
+		/* Increase filler counter */
+		p_ptCtx->uFilledData++;
+	}
+
+	/* Insert data */
+	p_ptCtx->piWindowsBuffer[p_ptCtx->uCurDataLocation] = p_iValue;
+	eDSP_MOVMEANFILTER_SumAdd(p_ptCtx, p_iValue);
+	p_ptCtx->uCurDataLocation++;
+
+	/* Manage rolback */
+	if( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )
+	{
+		p_ptCtx->uCurDataLocation = 0u;
+	}
+
+	if( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen )
+	{
+		/* Need more data */
+		l_eRes = e_eDSP_MOVMEANFILTER_RES_NEEDSMOREVALUE;
+	}
+	else if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+	{
+		/* The mean of int64_t values always fit, divide directly the 128 bit running sum */
+		*p_pFilteredVal = eDSP_SATARITH_DivI128(p_ptCtx->iWindowsSumHigh, p_ptCtx->uWindowsSumLow,
+		                                        (int64_t) p_ptCtx->uWindowsLen, &p_ptCtx->uSatCnt);
+		l_eRes = e_eDSP_MOVMEANFILTER_RES_OK;
+	}
+	else
+	{
+		/* The window is full, the running sum is exact so we only need to check if it can be stored
+		   in an int64_t before calculating the mean */
+		if( false == eDSP_MOVMEANFILTER_SumToI64(p_ptCtx, &l_iSum) )
+		{
+			l_eRes = e_eDSP_MOVMEANFILTER_RES_OVERFLOW;
+		}
+		else
+		{
+			/* Calculate and return the mean */
+			*p_pFilteredVal = l_iSum / ( (int64_t) p_ptCtx->uWindowsLen );
+			l_eRes = e_eDSP_MOVMEANFILTER_RES_OK;
+		}
+	}
+
+	return l_eRes;
+}
+
+static void eDSP_MOVMEANFILTER_SumAdd(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx, const int64_t p_iValue)
+{
+	/* Local variable for calculation */
+	uint64_t l_uPrevLow;
+
+	/* The running sum is stored in two part, high * 2^64 + low. Using the two complement representation of the value
+	   we can add it to the low part, and correct the high part with the carry and the sign of the value. In this
+	   way the sum is always exact, even when it can't be stored in an int64_t */
+	l_uPrevLow = p_ptCtx->uWindowsSumLow;
+	p_ptCtx->uWindowsSumLow += (uint64_t) p_iValue;
+
+	if( p_ptCtx->uWindowsSumLow < l_uPrevLow )
+	{
+		/* Carry */
+		p_ptCtx->iWindowsSumHigh++;
+	}
+
+	if( p_iValue < 0 )
+	{
+		/* Sign extension of the value */
+		p_ptCtx->iWindowsSumHigh--;
+	}
+}
+
+static void eDSP_MOVMEANFILTER_SumSubt(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx, const int64_t p_iValue)
+{
+	/* Local variable for calculation */
+	uint64_t l_uPrevLow;
+
+	/* Same as the addition, but with borrow */
+	l_uPrevLow = p_ptCtx->uWindowsSumLow;
+	p_ptCtx->uWindowsSumLow -= (uint64_t) p_iValue;
+
+	if( p_ptCtx->uWindowsSumLow > l_uPrevLow )
+	{
+		/* Borrow */
+		p_ptCtx->iWindowsSumHigh--;
+	}
+
+	if( p_iValue < 0 )
+	{
+		/* Sign extension of the value */
+		p_ptCtx->iWindowsSumHigh++;
+	}
+}
+
+static bool_t eDSP_MOVMEANFILTER_SumToI64(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx, int64_t* const p_piSum)
+{
+    /* Return local var */
+    bool_t l_bRes;
+
+	if( ( 0 == p_ptCtx->iWindowsSumHigh ) && ( p_ptCtx->uWindowsSumLow <= (uint64_t) MAX_INT64VAL ) )
+	{
+		/* Positive value */
+		*p_piSum = (int64_t) p_ptCtx->uWindowsSumLow;
+		l_bRes = true;
+	}
+	else if( ( -1 == p_ptCtx->iWindowsSumHigh ) && ( p_ptCtx->uWindowsSumLow > (uint64_t) MAX_INT64VAL ) )
+	{
+		/* Negative value, ~low is the absolute value minus one and can always be stored in an int64_t */
+		*p_piSum = -( (int64_t) ( ~p_ptCtx->uWindowsSumLow ) ) - 1;
+		l_bRes = true;
+	}
+	else
+	{
+		/* Sum exceed the int64_t storage area */
+		l_bRes = false;
+	}
+
+	return l_bRes;
+}
+
+static void eDSP_MOVMEANFILTER_ProcessBlockNoOvf(t_eDSP_MOVMEANFILTER_Ctx* const p_ptCtx, const int64_t* p_piValues,
+                                                 const uint32_t p_uNValues, const int64_t p_iSum,
+                                                 int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered)
+{
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uNFiltered;
+	int64_t  l_iSum;
+
+	/* Same steps of eDSP_MOVMEANFILTER_InsertValueCore, but the block was proven safe: the running sum and every
+	   partial sum fit an int64_t, so no carry and no check is needed */
+	l_iSum = p_iSum;
+	l_uNFiltered = 0u;
+
+	for( l_uCnt = 0u; l_uCnt < p_uNValues; l_uCnt++ )
+	{
+		if( p_ptCtx->uFilledData >= p_ptCtx->uWindowsLen )
+		{
+			l_iSum -= p_ptCtx->piWindowsBuffer[p_ptCtx->uCurDataLocation];
+		}
+		else
+		{
+			p_ptCtx->uFilledData++;
+		}
+
+		p_ptCtx->piWindowsBuffer[p_ptCtx->uCurDataLocation] = p_piValues[l_uCnt];
+		l_iSum += p_piValues[l_uCnt];
+		p_ptCtx->uCurDataLocation++;
+
+		/* Manage rolback */
+		if( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )
+		{
+			p_ptCtx->uCurDataLocation = 0u;
+		}
+
+		if( p_ptCtx->uFilledData >= p_ptCtx->uWindowsLen )
+		{
+			p_piFilteredVal[l_uNFiltered] = l_iSum / ( (int64_t) p_ptCtx->uWindowsLen );
+			l_uNFiltered++;
+		}
 	}
 
-	return l_eRet;
+	/* Store back the running sum in its 128 bit form */
+	p_ptCtx->uWindowsSumLow = (uint64_t) l_iSum;
+	p_ptCtx->iWindowsSumHigh = -( (int64_t) ( l_iSum < 0 ) );
+	*p_puNFiltered = l_uNFiltered;
 }
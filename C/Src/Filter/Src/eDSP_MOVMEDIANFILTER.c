@@ -19,27 +19,44 @@
  *  PRIVATE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eDSP_MOVMEDIANFILTER_IsStatusStillCoherent(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx);
+static e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_InsertValueCore(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx,
+                                                                       const int64_t p_iValue, int64_t* const p_pFilteredVal);
 static e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_MaxCheckResToMED(const e_eDSP_MAXCHECK_RES p_tMaxRet);
+static int64_t eDSP_MOVMEDIANFILTER_MidPoint(const int64_t p_iFirst, const int64_t p_iSecond);
+static int64_t eDSP_MOVMEDIANFILTER_HeapVal(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, const int32_t p_iHeapPos);
+static bool_t eDSP_MOVMEDIANFILTER_HeapCmpSwap(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, const int32_t p_iPosLow,
+                                               const int32_t p_iPosHigh);
+static bool_t eDSP_MOVMEDIANFILTER_MinHeapUp(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, int32_t p_iHeapPos);
+static bool_t eDSP_MOVMEDIANFILTER_MaxHeapUp(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, int32_t p_iHeapPos);
+static void eDSP_MOVMEDIANFILTER_MinHeapDown(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, int32_t p_iHeapPos);
+static void eDSP_MOVMEDIANFILTER_MaxHeapDown(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, int32_t p_iHeapPos);
+static void eDSP_MOVMEDIANFILTER_HeapUpdate(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, const uint32_t p_uSlot,
+                                            const int64_t p_iOldVal, const bool_t p_bIsNew);
 
 
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
  **********************************************************************************************************************/
 e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_InitCtx(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, int64_t* p_piWindowsBuffer,
-                                                  uint32_t p_uWindowsBuffLen)
+                                                  uint32_t p_uWindowsBuffLen, uint32_t* p_puHeapBuffer,
+                                                  uint32_t p_uHeapBuffLen)
 {
 	/* Local variable */
 	e_eDSP_MOVMEDIANFILTER_RES l_eRes;
+	uint32_t l_uSlot;
+	uint32_t l_uCenter;
+	uint32_t l_uHeapIdx;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_piWindowsBuffer ) )
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piWindowsBuffer ) || ( NULL == p_puHeapBuffer ) )
 	{
 		l_eRes = e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER;
 	}
 	else
 	{
 		/* Check data validity */
-		if( p_uWindowsBuffLen <= 2u )
+		if( ( p_uWindowsBuffLen <= 2u ) || ( p_uWindowsBuffLen > ( ( (uint32_t) MAX_INT32VAL ) / 2u ) ) ||
+			( p_uHeapBuffLen != ( 2u * p_uWindowsBuffLen ) ) )
 		{
 			l_eRes = e_eDSP_MOVMEDIANFILTER_RES_BADPARAM;
 		}
@@ -47,10 +64,36 @@ e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_InitCtx(t_eDSP_MOVMEDIANFILTER_C
 		{
 			/* Initialize internal status */
 			p_ptCtx->bIsInit = true;
+			p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+			p_ptCtx->uSatCnt = 0u;
 			p_ptCtx->uWindowsLen = p_uWindowsBuffLen;
 			p_ptCtx->uFilledData = 0u;
 			p_ptCtx->uCurDataLocation = 0u;
-			memset(p_piWindowsBuffer, 0, sizeof(int64_t));
+			p_ptCtx->piWindowsBuffer = p_piWindowsBuffer;
+			p_ptCtx->puHeapBuffer = p_puHeapBuffer;
+			memset(p_piWindowsBuffer, 0, sizeof(int64_t) * p_uWindowsBuffLen);
+
+			/* The first half of the heap buffer contains the slot of the windows buffer stored in every heap
+			   position, the second half contains the heap position of every slot of the windows buffer.
+			   The median is placed in the center of the heap, the max heap grows toward lower position and the
+			   min heap toward higher position. Slot are assigned alternating the two heap, so during the fill
+			   phase the two heap are always balanced */
+			l_uCenter = p_uWindowsBuffLen / 2u;
+
+			for( l_uSlot = 0u; l_uSlot < p_uWindowsBuffLen; l_uSlot++ )
+			{
+				if( 0u == ( l_uSlot & 1u ) )
+				{
+					l_uHeapIdx = l_uCenter + ( ( l_uSlot + 1u ) / 2u );
+				}
+				else
+				{
+					l_uHeapIdx = l_uCenter - ( ( l_uSlot + 1u ) / 2u );
+				}
+
+				p_puHeapBuffer[l_uHeapIdx] = l_uSlot;
+				p_puHeapBuffer[p_uWindowsBuffLen + l_uSlot] = l_uHeapIdx;
+			}
 
 			/* All OK */
 			l_eRes = e_eDSP_MOVMEDIANFILTER_RES_OK;
@@ -84,15 +127,6 @@ e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(t_eDSP_M
 {
 	/* Local variable for return */
 	e_eDSP_MOVMEDIANFILTER_RES l_eRes;
-	e_eDSP_MAXCHECK_RES l_eMaxRes;
-
-	/* Local variable for calculation */
-	uint32_t l_uCnt;
-	int64_t l_iSum;
-	int64_t l_iMean;
-	int64_t l_iNearest;
-	int64_t l_iNearestDiff;
-	int64_t l_iCurrDiff;
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_pFilteredVal ) )
@@ -115,97 +149,169 @@ e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(t_eDSP_M
             }
 			else
 			{
-				/* Insert data */
-				p_ptCtx->piWindowsBuffer[p_ptCtx->uCurDataLocation] = p_iValue;
-				p_ptCtx->uCurDataLocation++;
+				l_eRes = eDSP_MOVMEDIANFILTER_InsertValueCore(p_ptCtx, p_iValue, p_pFilteredVal);
+			}
+		}
+    }
 
-				/* Manage rolback */
-				if( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )
-				{
-					p_ptCtx->uCurDataLocation = 0u;
-				}
+	return l_eRes;
+}
 
-				if( p_ptCtx->uFilledData < ( p_ptCtx->uWindowsLen - 1u ) )
-				{
-					/* Increase filler counter */
-					p_ptCtx->uFilledData++;
+e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_ProcessBlock(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx,
+                                                             const int64_t* p_piValues, const uint32_t p_uNValues,
+                                                             int64_t* const p_piFilteredVal, uint32_t* const p_puNFiltered,
+                                                             uint32_t* const p_puNProcessed)
+{
+	/* Local variable for return */
+	e_eDSP_MOVMEDIANFILTER_RES l_eRes;
 
-					/* Need more data */
-					l_eRes = e_eDSP_MOVMEDIANFILTER_RES_NEEDSMOREVALUE;
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uNFiltered;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_piFilteredVal ) ||
+		( NULL == p_puNFiltered ) || ( NULL == p_puNProcessed ) )
+	{
+		l_eRes = e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MOVMEDIANFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MOVMEDIANFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MOVMEDIANFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( 0u == p_uNValues )
+				{
+					l_eRes = e_eDSP_MOVMEDIANFILTER_RES_BADPARAM;
 				}
 				else
 				{
-					/* The window is full */
-					l_eRes = e_eDSP_MOVMEDIANFILTER_RES_OK;
+					/* Init variable */
 					l_uCnt = 0u;
-					l_iSum = 0u;
+					l_uNFiltered = 0u;
+					l_eRes = e_eDSP_MOVMEDIANFILTER_RES_NEEDSMOREVALUE;
 
-					/* Calculate the factibility of the sum for the means */
-					while( ( e_eDSP_MOVMEDIANFILTER_RES_OK == l_eRes ) && ( l_uCnt < p_ptCtx->uWindowsLen ) )
+					/* Context is checked only once, every value of the block is processed without other check */
+					while( ( l_uCnt < p_uNValues ) && ( ( e_eDSP_MOVMEDIANFILTER_RES_OK == l_eRes ) ||
+						   ( e_eDSP_MOVMEDIANFILTER_RES_NEEDSMOREVALUE == l_eRes ) ) )
 					{
-						l_eMaxRes = eDSP_MAXCHECK_SUMI64Check(l_iSum, p_ptCtx->piWindowsBuffer[l_uCnt]);
-						l_eRes = eDSP_MOVMEDIANFILTER_MaxCheckResToMED(l_eMaxRes);
+						l_eRes = eDSP_MOVMEDIANFILTER_InsertValueCore(p_ptCtx, p_piValues[l_uCnt],
+						                                              &p_piFilteredVal[l_uNFiltered]);
 
 						if( e_eDSP_MOVMEDIANFILTER_RES_OK == l_eRes )
 						{
-							l_uCnt++;
-							l_iSum += p_ptCtx->piWindowsBuffer[l_uCnt];
+							l_uNFiltered++;
 						}
+
+						/* Increase counter */
+						l_uCnt++;
 					}
 
-					if( e_eDSP_MOVMEDIANFILTER_RES_OK == l_eRes )
+					/* Some value are filtered and the last one doesn't generate any error */
+					if( ( e_eDSP_MOVMEDIANFILTER_RES_NEEDSMOREVALUE == l_eRes ) && ( l_uNFiltered > 0u ) )
 					{
-						/* Calculate the mean */
-						l_iMean = l_iSum / p_ptCtx->uWindowsLen;
+						l_eRes = e_eDSP_MOVMEDIANFILTER_RES_OK;
+					}
 
-						/* re-init counter */
-						l_uCnt = 0u;
+					*p_puNFiltered = l_uNFiltered;
+					*p_puNProcessed = l_uCnt;
+				}
+			}
+		}
+    }
 
-						/* search for the nearest one */
-						while( ( e_eDSP_MOVMEDIANFILTER_RES_OK == l_eRes ) && ( l_uCnt < p_ptCtx->uWindowsLen ) )
-						{
-							l_eMaxRes = eDSP_MAXCHECK_SUBTI64Check(l_iMean, p_ptCtx->piWindowsBuffer[l_uCnt]);
-							l_eRes = eDSP_MOVMEDIANFILTER_MaxCheckResToMED(l_eMaxRes);
-
-							if( e_eDSP_MOVMEDIANFILTER_RES_OK == l_eRes )
-							{
-								/* Calc diff */
-								l_iCurrDiff = l_iMean - p_ptCtx->piWindowsBuffer[l_uCnt];
-
-								/* abs of the difference */
-								if( l_iCurrDiff < 0u )
-								{
-									l_iCurrDiff = -l_iCurrDiff;
-								}
-
-								/* On first round init default variable */
-								if( 0u == l_uCnt )
-								{
-									/* On first round init default variable */
-									l_iNearest = p_ptCtx->piWindowsBuffer[l_uCnt];
-									l_iNearestDiff = l_iCurrDiff;
-								}
-								else
-								{
-									/* Compare with the alredy founded */
-									if( l_iCurrDiff < l_iNearestDiff )
-									{
-										l_iNearestDiff = p_ptCtx->piWindowsBuffer[l_uCnt];
-									}
-								}
-							}
-						}
+	return l_eRes;
+}
 
-						/* if all ok return value */
-						if( e_eDSP_MOVMEDIANFILTER_RES_OK == l_eRes )
-						{
-							*p_pFilteredVal = l_iNearest;
-						}
-					}
+e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_SetOvfMode(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx,
+                                                           e_eDSP_TYPE_OVFMODE p_eOvfMode)
+{
+	/* Local variable */
+	e_eDSP_MOVMEDIANFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MOVMEDIANFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MOVMEDIANFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MOVMEDIANFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
+				{
+					l_eRes = e_eDSP_MOVMEDIANFILTER_RES_BADPARAM;
+				}
+				else
+				{
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					l_eRes = e_eDSP_MOVMEDIANFILTER_RES_OK;
 				}
 			}
 		}
-    }
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_GetSatCnt(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx,
+                                                          uint32_t* const p_puSatCnt)
+{
+	/* Local variable */
+	e_eDSP_MOVMEDIANFILTER_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
+	{
+		l_eRes = e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_MOVMEDIANFILTER_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_MOVMEDIANFILTER_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_MOVMEDIANFILTER_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puSatCnt = p_ptCtx->uSatCnt;
+				l_eRes = e_eDSP_MOVMEDIANFILTER_RES_OK;
+			}
+		}
+	}
 
 	return l_eRes;
 }
@@ -221,22 +327,25 @@ static bool_t eDSP_MOVMEDIANFILTER_IsStatusStillCoherent(t_eDSP_MOVMEDIANFILTER_
     bool_t l_eRes;
 
 	/* Check pointer validity */
-	if( NULL == p_ptCtx->piWindowsBuffer )
+	if( ( NULL == p_ptCtx->piWindowsBuffer ) || ( NULL == p_ptCtx->puHeapBuffer ) )
 	{
 		l_eRes = false;
 	}
     else
     {
 		/* Check data validity */
-		if( ( p_ptCtx->uWindowsLen <= 2u ) || ( p_ptCtx->uFilledData > p_ptCtx->uWindowsLen ) ||
-			( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )  )
+		if( ( p_ptCtx->uWindowsLen <= 2u ) || ( p_ptCtx->uWindowsLen > ( ( (uint32_t) MAX_INT32VAL ) / 2u ) ) ||
+			( p_ptCtx->uFilledData > p_ptCtx->uWindowsLen ) ||
+			( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen ) ||
+			( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) &&
+			  ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) ) )
 		{
 			l_eRes = false;
 		}
 		else
 		{
 			/* Check data validity */
-			if( ( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen ) && ( p_ptCtx->uCurDataLocation >= p_ptCtx->uFilledData ) )
+			if( ( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen ) && ( p_ptCtx->uCurDataLocation != p_ptCtx->uFilledData ) )
 			{
 				l_eRes = false;
 			}
@@ -250,6 +359,89 @@ static bool_t eDSP_MOVMEDIANFILTER_IsStatusStillCoherent(t_eDSP_MOVMEDIANFILTER_
     return l_eRes;
 }
 
+static e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_InsertValueCore(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx,
+                                                                       const int64_t p_iValue, int64_t* const p_pFilteredVal)
+{
+	/* Local variable for return */
+	e_eDSP_MOVMEDIANFILTER_RES l_eRes;
+	e_eDSP_MAXCHECK_RES l_eMaxRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uSlot;
+	int64_t l_iOldVal;
+	int64_t l_iMedian;
+	int64_t l_iMedianLow;
+	int64_t l_iMedianSum;
+	bool_t l_bIsNew;
+
+	/* Insert data, overwriting the oldest one when the windows is full */
+	l_uSlot = p_ptCtx->uCurDataLocation;
+	l_iOldVal = p_ptCtx->piWindowsBuffer[l_uSlot];
+	p_ptCtx->piWindowsBuffer[l_uSlot] = p_iValue;
+	p_ptCtx->uCurDataLocation++;
+
+	/* Manage rolback */
+	if( p_ptCtx->uCurDataLocation >= p_ptCtx->uWindowsLen )
+	{
+		p_ptCtx->uCurDataLocation = 0u;
+	}
+
+	if( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen )
+	{
+		/* Increase filler counter */
+		p_ptCtx->uFilledData++;
+		l_bIsNew = true;
+	}
+	else
+	{
+		l_bIsNew = false;
+	}
+
+	/* Restore the heap property moving only the slot that has changed */
+	eDSP_MOVMEDIANFILTER_HeapUpdate(p_ptCtx, l_uSlot, l_iOldVal, l_bIsNew);
+
+	if( p_ptCtx->uFilledData < p_ptCtx->uWindowsLen )
+	{
+		/* Need more data */
+		l_eRes = e_eDSP_MOVMEDIANFILTER_RES_NEEDSMOREVALUE;
+	}
+	else
+	{
+		/* The window is full, the median is in the center of the heap */
+		l_iMedian = eDSP_MOVMEDIANFILTER_HeapVal(p_ptCtx, 0);
+
+		if( 0u != ( p_ptCtx->uWindowsLen & 1u ) )
+		{
+			*p_pFilteredVal = l_iMedian;
+			l_eRes = e_eDSP_MOVMEDIANFILTER_RES_OK;
+		}
+		else
+		{
+			/* Even windows, the other central value is the top of the max heap */
+			l_iMedianLow = eDSP_MOVMEDIANFILTER_HeapVal(p_ptCtx, -1);
+
+			if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+			{
+				/* The average of two int64_t always fit, so nothing is clamped */
+				*p_pFilteredVal = eDSP_MOVMEDIANFILTER_MidPoint(l_iMedian, l_iMedianLow);
+				l_eRes = e_eDSP_MOVMEDIANFILTER_RES_OK;
+			}
+			else
+			{
+				l_eMaxRes = eDSP_MAXCHECK_AddI64(l_iMedian, l_iMedianLow, &l_iMedianSum);
+				l_eRes = eDSP_MOVMEDIANFILTER_MaxCheckResToMED(l_eMaxRes);
+
+				if( e_eDSP_MOVMEDIANFILTER_RES_OK == l_eRes )
+				{
+					*p_pFilteredVal = l_iMedianSum / 2;
+				}
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
 static e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_MaxCheckResToMED(const e_eDSP_MAXCHECK_RES p_tMaxRet)
 {
 	e_eDSP_MOVMEDIANFILTER_RES l_eRet;
@@ -265,3 +457,206 @@ static e_eDSP_MOVMEDIANFILTER_RES eDSP_MOVMEDIANFILTER_MaxCheckResToMED(const e_
 
 	return l_eRet;
 }
+
+static int64_t eDSP_MOVMEDIANFILTER_HeapVal(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, const int32_t p_iHeapPos)
+{
+	/* Local variable for calculation */
+	uint32_t l_uHeapIdx;
+
+	/* Heap position are relative to the center of the heap */
+	l_uHeapIdx = (uint32_t) ( ( (int32_t) ( p_ptCtx->uWindowsLen / 2u ) ) + p_iHeapPos );
+
+	return p_ptCtx->piWindowsBuffer[p_ptCtx->puHeapBuffer[l_uHeapIdx]];
+}
+
+static bool_t eDSP_MOVMEDIANFILTER_HeapCmpSwap(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, const int32_t p_iPosLow,
+                                               const int32_t p_iPosHigh)
+{
+	/* Return local var */
+	bool_t l_bSwapped;
+
+	/* Local variable for calculation */
+	uint32_t* l_puHeap;
+	uint32_t* l_puPos;
+	uint32_t l_uIdxLow;
+	uint32_t l_uIdxHigh;
+	uint32_t l_uSlot;
+
+	/* Value in p_iPosLow must be lower or equal than the value in p_iPosHigh, if not swap them */
+	if( eDSP_MOVMEDIANFILTER_HeapVal(p_ptCtx, p_iPosHigh) < eDSP_MOVMEDIANFILTER_HeapVal(p_ptCtx, p_iPosLow) )
+	{
+		l_puHeap = p_ptCtx->puHeapBuffer;
+		l_puPos = &p_ptCtx->puHeapBuffer[p_ptCtx->uWindowsLen];
+		l_uIdxLow = (uint32_t) ( ( (int32_t) ( p_ptCtx->uWindowsLen / 2u ) ) + p_iPosLow );
+		l_uIdxHigh = (uint32_t) ( ( (int32_t) ( p_ptCtx->uWindowsLen / 2u ) ) + p_iPosHigh );
+
+		l_uSlot = l_puHeap[l_uIdxLow];
+		l_puHeap[l_uIdxLow] = l_puHeap[l_uIdxHigh];
+		l_puHeap[l_uIdxHigh] = l_uSlot;
+		l_puPos[l_puHeap[l_uIdxLow]] = l_uIdxLow;
+		l_puPos[l_puHeap[l_uIdxHigh]] = l_uIdxHigh;
+
+		l_bSwapped = true;
+	}
+	else
+	{
+		l_bSwapped = false;
+	}
+
+	return l_bSwapped;
+}
+
+static bool_t eDSP_MOVMEDIANFILTER_MinHeapUp(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, int32_t p_iHeapPos)
+{
+	/* Move the value toward the center until it is greater than its parent, return true if it reached the center */
+	while( ( p_iHeapPos > 0 ) && ( true == eDSP_MOVMEDIANFILTER_HeapCmpSwap(p_ptCtx, p_iHeapPos / 2, p_iHeapPos) ) )
+	{
+		p_iHeapPos = p_iHeapPos / 2;
+	}
+
+	return ( 0 == p_iHeapPos );
+}
+
+static bool_t eDSP_MOVMEDIANFILTER_MaxHeapUp(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, int32_t p_iHeapPos)
+{
+	/* Move the value toward the center until it is lower than its parent, return true if it reached the center */
+	while( ( p_iHeapPos < 0 ) && ( true == eDSP_MOVMEDIANFILTER_HeapCmpSwap(p_ptCtx, p_iHeapPos, p_iHeapPos / 2) ) )
+	{
+		p_iHeapPos = p_iHeapPos / 2;
+	}
+
+	return ( 0 == p_iHeapPos );
+}
+
+static void eDSP_MOVMEDIANFILTER_MinHeapDown(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, int32_t p_iHeapPos)
+{
+	/* Local variable for calculation */
+	int32_t l_iMinCount;
+	bool_t l_bSwapped;
+
+	/* Numbers of element in the min heap, the center is not counted */
+	l_iMinCount = (int32_t) ( ( p_ptCtx->uFilledData - 1u ) / 2u );
+	l_bSwapped = true;
+
+	/* p_iHeapPos is the first child to check, move down the parent until it is lower than its child */
+	while( ( p_iHeapPos <= l_iMinCount ) && ( true == l_bSwapped ) )
+	{
+		/* Select the lower of the two child */
+		if( ( p_iHeapPos > 1 ) && ( p_iHeapPos < l_iMinCount ) &&
+			( eDSP_MOVMEDIANFILTER_HeapVal(p_ptCtx, p_iHeapPos + 1) < eDSP_MOVMEDIANFILTER_HeapVal(p_ptCtx, p_iHeapPos) ) )
+		{
+			p_iHeapPos++;
+		}
+
+		l_bSwapped = eDSP_MOVMEDIANFILTER_HeapCmpSwap(p_ptCtx, p_iHeapPos / 2, p_iHeapPos);
+		p_iHeapPos = p_iHeapPos * 2;
+	}
+}
+
+static void eDSP_MOVMEDIANFILTER_MaxHeapDown(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, int32_t p_iHeapPos)
+{
+	/* Local variable for calculation */
+	int32_t l_iMaxCount;
+	bool_t l_bSwapped;
+
+	/* Numbers of element in the max heap, the center is not counted */
+	l_iMaxCount = (int32_t) ( p_ptCtx->uFilledData / 2u );
+	l_bSwapped = true;
+
+	/* p_iHeapPos is the first child to check, move down the parent until it is greater than its child */
+	while( ( p_iHeapPos >= -l_iMaxCount ) && ( true == l_bSwapped ) )
+	{
+		/* Select the greater of the two child */
+		if( ( p_iHeapPos < -1 ) && ( p_iHeapPos > -l_iMaxCount ) &&
+			( eDSP_MOVMEDIANFILTER_HeapVal(p_ptCtx, p_iHeapPos) < eDSP_MOVMEDIANFILTER_HeapVal(p_ptCtx, p_iHeapPos - 1) ) )
+		{
+			p_iHeapPos--;
+		}
+
+		l_bSwapped = eDSP_MOVMEDIANFILTER_HeapCmpSwap(p_ptCtx, p_iHeapPos, p_iHeapPos / 2);
+		p_iHeapPos = p_iHeapPos * 2;
+	}
+}
+
+static void eDSP_MOVMEDIANFILTER_HeapUpdate(t_eDSP_MOVMEDIANFILTER_Ctx* const p_ptCtx, const uint32_t p_uSlot,
+                                            const int64_t p_iOldVal, const bool_t p_bIsNew)
+{
+	/* Local variable for calculation */
+	int32_t l_iHeapPos;
+	int64_t l_iNewVal;
+
+	/* Retrive where the changed slot is placed in the heap */
+	l_iHeapPos = ( (int32_t) p_ptCtx->puHeapBuffer[p_ptCtx->uWindowsLen + p_uSlot] ) -
+				 ( (int32_t) ( p_ptCtx->uWindowsLen / 2u ) );
+	l_iNewVal = p_ptCtx->piWindowsBuffer[p_uSlot];
+
+	if( l_iHeapPos > 0 )
+	{
+		/* Value is in the min heap */
+		if( ( false == p_bIsNew ) && ( p_iOldVal < l_iNewVal ) )
+		{
+			/* Value increased, can only go down */
+			eDSP_MOVMEDIANFILTER_MinHeapDown(p_ptCtx, l_iHeapPos * 2);
+		}
+		else if( true == eDSP_MOVMEDIANFILTER_MinHeapUp(p_ptCtx, l_iHeapPos) )
+		{
+			/* Reached the center, the old median could need to go in the max heap */
+			eDSP_MOVMEDIANFILTER_MaxHeapDown(p_ptCtx, -1);
+		}
+		else
+		{
+			/* Heap already ordered */
+		}
+	}
+	else if( l_iHeapPos < 0 )
+	{
+		/* Value is in the max heap */
+		if( ( false == p_bIsNew ) && ( l_iNewVal < p_iOldVal ) )
+		{
+			/* Value decreased, can only go down */
+			eDSP_MOVMEDIANFILTER_MaxHeapDown(p_ptCtx, l_iHeapPos * 2);
+		}
+		else if( true == eDSP_MOVMEDIANFILTER_MaxHeapUp(p_ptCtx, l_iHeapPos) )
+		{
+			/* Reached the center, the old median could need to go in the min heap */
+			eDSP_MOVMEDIANFILTER_MinHeapDown(p_ptCtx, 1);
+		}
+		else
+		{
+			/* Heap already ordered */
+		}
+	}
+	else
+	{
+		/* Value is the median, could need to go in one of the two heap */
+		eDSP_MOVMEDIANFILTER_MaxHeapDown(p_ptCtx, -1);
+		eDSP_MOVMEDIANFILTER_MinHeapDown(p_ptCtx, 1);
+	}
+}
+
+static int64_t eDSP_MOVMEDIANFILTER_MidPoint(const int64_t p_iFirst, const int64_t p_iSecond)
+{
+	/* Local variable for calculation */
+	int64_t l_iHalf;
+	int64_t l_iRem;
+
+	/* ( p_iFirst + p_iSecond ) / 2 without calculating the sum: add the halves and then correct with the
+	   remainders, so the result is truncated toward zero like the division */
+	l_iHalf = ( p_iFirst / 2 ) + ( p_iSecond / 2 );
+	l_iRem = ( p_iFirst % 2 ) + ( p_iSecond % 2 );
+
+	if( ( 2 == l_iRem ) || ( ( 1 == l_iRem ) && ( l_iHalf < 0 ) ) )
+	{
+		l_iHalf++;
+	}
+	else if( ( -2 == l_iRem ) || ( ( -1 == l_iRem ) && ( l_iHalf > 0 ) ) )
+	{
+		l_iHalf--;
+	}
+	else
+	{
+		/* Nothing to correct */
+	}
+
+	return l_iHalf;
+}
@@ -25,6 +25,14 @@ extern "C" {
 
 
 
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Numbers of points of the widest stencil */
+#define EDSP_DERIVATIVE_MAXPOINTS                                                                   ( ( uint32_t ) 7u )
+
+
+
 /***********************************************************************************************************************
  *      TYPEDEFS
  **********************************************************************************************************************/
@@ -39,14 +47,24 @@ typedef enum
     e_eDSP_DERIVATIVE_RES_NOINITLIB
 }e_eDSP_DERIVATIVE_RES;
 
+typedef enum
+{
+    e_eDSP_DERIVATIVE_STENCIL_BACKWARD = 0,
+    e_eDSP_DERIVATIVE_STENCIL_CENTRAL,
+    e_eDSP_DERIVATIVE_STENCIL_FIVEPOINT,
+    e_eDSP_DERIVATIVE_STENCIL_SAVGOL
+}e_eDSP_DERIVATIVE_STENCIL;
+
 typedef struct
 {
     bool_t   bIsInit;
-    bool_t   bHasPrev;
-    bool_t   bHasCurrent;
-    int64_t  uPreviousVal;
-    int64_t  uCurrentVal;
-    uint32_t uTimeElapsedFromCurToPre;
+    e_eDSP_DERIVATIVE_STENCIL eStencil;
+    uint32_t uNPoints;
+    uint32_t uFilledData;
+    int64_t  aiValues[EDSP_DERIVATIVE_MAXPOINTS];
+    uint32_t auTimeFromLast[EDSP_DERIVATIVE_MAXPOINTS];
+    uint32_t uSatCnt;
+    e_eDSP_TYPE_OVFMODE eOvfMode;
 }t_eDSP_DERIVATIVE_Ctx;
 
 
@@ -55,14 +73,26 @@ typedef struct
  * GLOBAL PROTOTYPES
  **********************************************************************************************************************/
 /**
- * @brief       Initialize the derivate function
+ * @brief       Initialize the derivate function with the stencil used to estimate it from the last inserted values:
+ *              e_eDSP_DERIVATIVE_STENCIL_BACKWARD  - 2 points, ( f(x) - f(x-h) ) / h
+ *              e_eDSP_DERIVATIVE_STENCIL_CENTRAL   - 3 points, ( f(x+h) - f(x-h) ) / 2h
+ *              e_eDSP_DERIVATIVE_STENCIL_FIVEPOINT - 5 points, ( f(x-2h) - 8f(x-h) + 8f(x+h) - f(x+2h) ) / 12h
+ *              e_eDSP_DERIVATIVE_STENCIL_SAVGOL    - 7 points, Savitzky-Golay derivative of a quadratic fit,
+ *                                                    ( -3, -2, -1, 0, 1, 2, 3 ) / 28h, smooth the noise in the
+ *                                                    same pass
+ *              The central stencils estimate the derivate in the middle of the window, so the returned value refer
+ *              to the value inserted ( points - 1 ) / 2 insertion before. h is the mean time between the values of
+ *              the window. The coefficients are integer, the weighted sum is done on 128 bit and divided only once.
  *
  * @param[in]   p_ptCtx       - Derivate context
+ * @param[in]   p_eStencil    - Stencil to use
  *
  * @return      e_eDSP_DERIVATIVE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_DERIVATIVE_RES_BADPARAM       - In case of an invalid parameter passed to the function
  *              e_eDSP_DERIVATIVE_RES_OK             - Derivate initialized successfully
  */
-e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InitCtx(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx);
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InitCtx(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx,
+                                              const e_eDSP_DERIVATIVE_STENCIL p_eStencil);
 
 /**
  * @brief       Check if the lib is initialized
@@ -77,8 +107,8 @@ e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_IsInit(t_eDSP_DERIVATIVE_Ctx* const p_ptCt
 
 /**
  * @brief       Insert the a value of data that we will use to calculate the derivate from the previously inserted
- *              value. p_timeFromLast cannot be zero. After adding the data, if enough sample are present,
- *              the derivate value is returned.
+ *              value. p_timeFromLast cannot be zero. After adding the data, if enough sample are present to fill the
+ *              window of the stencil, the derivate value is returned.
  *
  * @param[in]   p_ptCtx         - Derivate context
  * @param[in]   p_iValue         - Current value that we want to derivate
@@ -89,6 +119,8 @@ e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_IsInit(t_eDSP_DERIVATIVE_Ctx* const p_ptCt
  *		        e_eDSP_DERIVATIVE_RES_BADPARAM       - In case of an invalid parameter passed to the function.
  *		        e_eDSP_DERIVATIVE_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
  *		        e_eDSP_DERIVATIVE_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_DERIVATIVE_RES_OVERFLOW       - The derivate exceed the int64_t storage area, the value is
+ *                                                     inserted anyway
  *              e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE - Need to add more value to be able to calculate the derivate
  *              e_eDSP_DERIVATIVE_RES_OK             - Operation ended correctly
  */
@@ -96,6 +128,105 @@ e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InsertValueAndGetDerivate(t_eDSP_DERIVATIV
                                                                 const int64_t p_iValue, const uint32_t p_timeFromLast, 
                                                                 int64_t* const p_piDerivate);
 
+/**
+ * @brief       Insert a block of values, with the time elapsed from the previous one, and calculate the derivate after
+ *              every value. The context is validated only once for the whole block. Values are processed in order,
+ *              and every calculated derivate is stored sequentially in p_piDerivate. Processing stop at the first
+ *              value that generate an error. The block is pre-scanned for the range of the values and of the time:
+ *              when no time is zero and no weighted sum can overflow, the windows inside the block are calculated
+ *              directly from p_piValues with plain int64_t arithmetic and the same result.
+ *
+ * @param[in]   p_ptCtx          - Derivate context
+ * @param[in]   p_piValues       - Pointer to the values that we want to derivate
+ * @param[in]   p_puTimeFromLast - Pointer to the time elapsed from the previous value, one for every value
+ * @param[in]   p_uNValues       - Numbers of values in p_piValues and p_puTimeFromLast, cannot be zero
+ * @param[out]  p_piDerivate     - Pointer to a buffer of at least p_uNValues int64_t where the derivates will be
+ *                                 placed
+ * @param[out]  p_puNDerivate    - Pointer to an uint32_t where the numbers of calculated derivates will be placed
+ * @param[out]  p_puNProcessed   - Pointer to an uint32_t where the numbers of values taken from p_piValues will be
+ *                                 placed, the value that generated an error is counted too
+ *
+ * @return      e_eDSP_DERIVATIVE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_DERIVATIVE_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eDSP_DERIVATIVE_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_DERIVATIVE_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_DERIVATIVE_RES_OVERFLOW       - The last processed value generate an overflow
+ *              e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE - All value inserted but no derivate is available
+ *              e_eDSP_DERIVATIVE_RES_OK             - Operation ended correctly
+ */
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_ProcessBlock(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, const int64_t* p_piValues,
+                                                   const uint32_t* p_puTimeFromLast, const uint32_t p_uNValues,
+                                                   int64_t* const p_piDerivate, uint32_t* const p_puNDerivate,
+                                                   uint32_t* const p_puNProcessed);
+
+/**
+ * @brief       Select how the arithmetic overflow are managed. With e_eDSP_TYPE_OVFMODE_ERROR, the default after
+ *              the init, an overflow is reported as e_eDSP_DERIVATIVE_RES_OVERFLOW.
+ *              With e_eDSP_TYPE_OVFMODE_SATURATE every operation is clamped to the int64_t storage area and counted,
+ *              so no value is discarded. Setting the mode restart the count of the saturated operations.
+ *
+ * @param[in]   p_ptCtx         - Derivate context
+ * @param[in]   p_eOvfMode      - Overflow mode to use
+ *
+ * @return      e_eDSP_DERIVATIVE_RES_BADPOINTER          - In case of bad pointer passed to the function
+ *		        e_eDSP_DERIVATIVE_RES_NOINITLIB           - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_DERIVATIVE_RES_CORRUPTCTX          - In case of an corrupted context
+ *		        e_eDSP_DERIVATIVE_RES_BADPARAM            - In case of an invalid parameter passed to the function
+ *              e_eDSP_DERIVATIVE_RES_OK                  - Operation ended correctly
+ */
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_SetOvfMode(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, e_eDSP_TYPE_OVFMODE p_eOvfMode);
+
+/**
+ * @brief       Get the numbers of operation clamped since the overflow mode was set. The counter is sticky, it
+ *              never wrap around.
+ *
+ * @param[in]   p_ptCtx         - Derivate context
+ * @param[out]  p_puSatCnt      - Pointer to an uint32_t where the numbers of saturated operation will be placed
+ *
+ * @return      e_eDSP_DERIVATIVE_RES_BADPOINTER          - In case of bad pointer passed to the function
+ *		        e_eDSP_DERIVATIVE_RES_NOINITLIB           - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_DERIVATIVE_RES_CORRUPTCTX          - In case of an corrupted context
+ *              e_eDSP_DERIVATIVE_RES_OK                  - Operation ended correctly
+ */
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_GetSatCnt(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, uint32_t* const p_puSatCnt);
+
+/**
+ * @brief       Same of eDSP_DERIVATIVE_InsertValueAndGetDerivate, but the pointers, the init and the coherence of the
+ *              context are not checked. It is meant for the modules that embed a derivate context and validate it
+ *              together with their own, so the derivate is not validated again on every value.
+ *
+ * @param[in]   p_ptCtx         - Derivate context, already initialized and validated by the caller
+ * @param[in]   p_iValue        - Current value that we want to derive
+ * @param[in]   p_timeFromLast  - Time elapsed from the previously inserted value, cannot be zero
+ * @param[out]  p_piDerivate    - Pointer to an int64_t where the value of the calculated derivate will be placed.
+ *
+ * @return      e_eDSP_DERIVATIVE_RES_BADPARAM         - In case of an invalid parameter passed to the function.
+ *		        e_eDSP_DERIVATIVE_RES_OVERFLOW         - The derivate exceed the int64_t storage area, the value is
+ *                                                       inserted anyway
+ *              e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE   - Need to add more value to be able to calculate the derivate
+ *              e_eDSP_DERIVATIVE_RES_OK               - Operation ended correctly
+ */
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InsertValueCore(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, const int64_t p_iValue,
+                                                      const uint32_t p_timeFromLast, int64_t* const p_piDerivate);
+
+/**
+ * @brief       Insert a value in the window without calculating the derivate, for the modules that use the window
+ *              of the derivate context but calculate their own derivate. Nothing can overflow and no operation is
+ *              clamped. Like eDSP_DERIVATIVE_InsertValueCore the context is not checked.
+ *
+ * @param[in]   p_ptCtx         - Derivate context, already initialized and validated by the caller
+ * @param[in]   p_iValue        - Current value that we want to insert
+ * @param[in]   p_timeFromLast  - Time elapsed from the previously inserted value, cannot be zero
+ *
+ * @return      e_eDSP_DERIVATIVE_RES_BADPARAM         - In case of an invalid parameter passed to the function.
+ *              e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE   - The window is not full yet, a derivate can't be calculated
+ *              e_eDSP_DERIVATIVE_RES_OK               - The window is full, a derivate can be calculated
+ */
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InsertValueOnlyCore(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, const int64_t p_iValue,
+                                                          const uint32_t p_timeFromLast);
+
 
 
 #ifdef __cplusplus
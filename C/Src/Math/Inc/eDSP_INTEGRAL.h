@@ -39,15 +39,29 @@ typedef enum
     e_eDSP_INTEGRAL_RES_NOINITLIB
 }e_eDSP_INTEGRAL_RES;
 
+typedef enum
+{
+    e_eDSP_INTEGRAL_RULE_LEFT = 0,
+    e_eDSP_INTEGRAL_RULE_RIGHT,
+    e_eDSP_INTEGRAL_RULE_TRAPEZOID,
+    e_eDSP_INTEGRAL_RULE_SIMPSON
+}e_eDSP_INTEGRAL_RULE;
+
 typedef struct
 {
     bool_t   bIsInit;
     bool_t   bHasPrev;
     bool_t   bHasCurrent;
+    bool_t   bIsPairOpen;
+    e_eDSP_INTEGRAL_RULE eRule;
     int64_t  uPreviousVal;
     int64_t  uCurrentVal;
     int64_t  uIntegral;
+    uint64_t uAccLow;
+    int64_t  iAccHigh;
     uint32_t uTimeElapsFromCurToPre;
+    uint32_t uSatCnt;
+    e_eDSP_TYPE_OVFMODE eOvfMode;
 }t_eDSP_INTEGRAL_Ctx;
 
 
@@ -56,14 +70,24 @@ typedef struct
  * GLOBAL PROTOTYPES
  **********************************************************************************************************************/
 /**
- * @brief       Initialize the integral function
+ * @brief       Initialize the integral function with the rule used to integrate every interval between two values:
+ *              e_eDSP_INTEGRAL_RULE_LEFT      - previous value * time
+ *              e_eDSP_INTEGRAL_RULE_RIGHT     - current value * time
+ *              e_eDSP_INTEGRAL_RULE_TRAPEZOID - ( previous value + current value ) * time / 2
+ *              e_eDSP_INTEGRAL_RULE_SIMPSON   - Simpson 1/3 on every pair of intervals with the same time, the pairs
+ *                                               with two different times and the open half of the last pair use the
+ *                                               trapezoid rule
+ *              The integral is accumulated on 128 bit as a multiple of 1/2 ( trapezoid ) or 1/6 ( Simpson ), so no
+ *              fraction is lost between the steps; the returned value is truncated toward zero only at the end.
  *
  * @param[in]   p_ptCtx       - Integral context
+ * @param[in]   p_eRule       - Integration rule to use
  *
  * @return      e_eDSP_INTEGRAL_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_INTEGRAL_RES_BADPARAM       - In case of an invalid parameter passed to the function
  *              e_eDSP_INTEGRAL_RES_OK             - Integral initialized successfully
  */
-e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_InitCtx(t_eDSP_INTEGRAL_Ctx* const p_ptCtx);
+e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_InitCtx(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, const e_eDSP_INTEGRAL_RULE p_eRule);
 
 /**
  * @brief       Check if the lib is initialized
@@ -89,12 +113,110 @@ e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_IsInit(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, boo
  *		        e_eDSP_INTEGRAL_RES_BADPARAM     - In case of an invalid parameter passed to the function.
  *		        e_eDSP_INTEGRAL_RES_NOINITLIB    - Need to init the data stuffer context before taking some action
  *		        e_eDSP_INTEGRAL_RES_CORRUPTCTX   - In case of an corrupted context
+ *		        e_eDSP_INTEGRAL_RES_OVERFLOW     - The integral exceed the int64_t storage area, the value is
+ *                                                 inserted anyway
  *              e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE   - Need to add more value to be able to calculate the integral
  *              e_eDSP_INTEGRAL_RES_OK           - Operation ended correctly
  */
 e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_InsertValueAndCalcIntegral(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, const int64_t p_iValue,
                                                              const uint32_t p_timeFromLast, int64_t* const p_piIntegral);
 
+/**
+ * @brief       Insert a block of values, with the time elapsed from the previous one, and calculate the integral after
+ *              every value. The context is validated only once for the whole block. Values are processed in order,
+ *              and every calculated integral is stored sequentially in p_piIntegral. Processing stop at the first
+ *              value that generate an error. The block is pre-scanned for the range of the values and of the time:
+ *              when no time is zero and no partial integral can overflow, all the increments are calculated
+ *              independently and the integral is their prefix sum, with the same result and no check per value.
+ *              The Simpson rule alternate the two halves of a pair, so it is always processed value by value.
+ *
+ * @param[in]   p_ptCtx          - Integral context
+ * @param[in]   p_piValues       - Pointer to the values that we want to integrate
+ * @param[in]   p_puTimeFromLast - Pointer to the time elapsed from the previous value, one for every value
+ * @param[in]   p_uNValues       - Numbers of values in p_piValues and p_puTimeFromLast, cannot be zero
+ * @param[out]  p_piIntegral     - Pointer to a buffer of at least p_uNValues int64_t where the integrals will be
+ *                                 placed
+ * @param[out]  p_puNIntegral    - Pointer to an uint32_t where the numbers of calculated integrals will be placed
+ * @param[out]  p_puNProcessed   - Pointer to an uint32_t where the numbers of values taken from p_piValues will be
+ *                                 placed, the value that generated an error is counted too
+ *
+ * @return      e_eDSP_INTEGRAL_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eDSP_INTEGRAL_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eDSP_INTEGRAL_RES_NOINITLIB      - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_INTEGRAL_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eDSP_INTEGRAL_RES_OVERFLOW       - The last processed value generate an overflow
+ *              e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE - All value inserted but no integral is available
+ *              e_eDSP_INTEGRAL_RES_OK             - Operation ended correctly
+ */
+e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_ProcessBlock(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, const int64_t* p_piValues,
+                                               const uint32_t* p_puTimeFromLast, const uint32_t p_uNValues,
+                                               int64_t* const p_piIntegral, uint32_t* const p_puNIntegral,
+                                               uint32_t* const p_puNProcessed);
+
+/**
+ * @brief       Select how the arithmetic overflow are managed. With e_eDSP_TYPE_OVFMODE_ERROR, the default after
+ *              the init, an overflow is reported as e_eDSP_INTEGRAL_RES_OVERFLOW.
+ *              With e_eDSP_TYPE_OVFMODE_SATURATE every operation is clamped to the int64_t storage area and counted,
+ *              so no value is discarded. Setting the mode restart the count of the saturated operations.
+ *
+ * @param[in]   p_ptCtx         - Integral context
+ * @param[in]   p_eOvfMode      - Overflow mode to use
+ *
+ * @return      e_eDSP_INTEGRAL_RES_BADPOINTER            - In case of bad pointer passed to the function
+ *		        e_eDSP_INTEGRAL_RES_NOINITLIB             - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_INTEGRAL_RES_CORRUPTCTX            - In case of an corrupted context
+ *		        e_eDSP_INTEGRAL_RES_BADPARAM              - In case of an invalid parameter passed to the function
+ *              e_eDSP_INTEGRAL_RES_OK                    - Operation ended correctly
+ */
+e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_SetOvfMode(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, e_eDSP_TYPE_OVFMODE p_eOvfMode);
+
+/**
+ * @brief       Get the numbers of operation clamped since the overflow mode was set. The counter is sticky, it
+ *              never wrap around.
+ *
+ * @param[in]   p_ptCtx         - Integral context
+ * @param[out]  p_puSatCnt      - Pointer to an uint32_t where the numbers of saturated operation will be placed
+ *
+ * @return      e_eDSP_INTEGRAL_RES_BADPOINTER            - In case of bad pointer passed to the function
+ *		        e_eDSP_INTEGRAL_RES_NOINITLIB             - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_INTEGRAL_RES_CORRUPTCTX            - In case of an corrupted context
+ *              e_eDSP_INTEGRAL_RES_OK                    - Operation ended correctly
+ */
+e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_GetSatCnt(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, uint32_t* const p_puSatCnt);
+
+/**
+ * @brief       Same of eDSP_INTEGRAL_InsertValueAndCalcIntegral, but the pointers, the init and the coherence of the
+ *              context are not checked. It is meant for the modules that embed an integral context and validate
+ *              it together with their own, so the integral is not validated again on every value.
+ *
+ * @param[in]   p_ptCtx         - Integral context, already initialized and validated by the caller
+ * @param[in]   p_iValue        - Current value that we want to integrate
+ * @param[in]   p_timeFromLast  - Time elapsed from the previously inserted value, cannot be zero
+ * @param[out]  p_piIntegral    - Pointer to an int64_t where the value of the calculated integral will be placed.
+ *
+ * @return      e_eDSP_INTEGRAL_RES_BADPARAM         - In case of an invalid parameter passed to the function.
+ *		        e_eDSP_INTEGRAL_RES_OVERFLOW         - The integral exceed the int64_t storage area, the value is
+ *                                                     inserted anyway
+ *              e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE   - Need to add more value to be able to calculate the integral
+ *              e_eDSP_INTEGRAL_RES_OK               - Operation ended correctly
+ */
+e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_InsertValueCore(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, const int64_t p_iValue,
+                                                  const uint32_t p_timeFromLast, int64_t* const p_piIntegral);
+
+/**
+ * @brief       Clamp the integral between p_iMin and p_iMax, so the following values are integrated from the limit
+ *              and the integral can't wind up. Like eDSP_INTEGRAL_InsertValueCore the context is not checked.
+ *
+ * @param[in]   p_ptCtx         - Integral context, already initialized and validated by the caller
+ * @param[in]   p_iMin          - Minimum value of the integral, cannot be greater than p_iMax
+ * @param[in]   p_iMax          - Maximum value of the integral
+ * @param[out]  p_piIntegral    - Pointer to an int64_t where the clamped integral will be placed.
+ */
+void eDSP_INTEGRAL_ClampCore(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, const int64_t p_iMin, const int64_t p_iMax,
+                             int64_t* const p_piIntegral);
+
 
 
 #ifdef __cplusplus
@@ -44,10 +44,39 @@ typedef struct
     t_eDSP_TYPE_2DPI64* ptPointArray;
 }t_eDSP_M2DPI64LINEAR_PointSeries;
 
+typedef struct
+{
+    int64_t iSlopeQ32;
+    int64_t iIntercept;
+    bool_t  bIsValid;
+}t_eDSP_M2DPI64LINEAR_Segment;
+
+typedef enum
+{
+    e_eDSP_M2DPI64LINEAR_GRID_NONE = 0,
+    e_eDSP_M2DPI64LINEAR_GRID_SHIFT,
+    e_eDSP_M2DPI64LINEAR_GRID_RECIP,
+    e_eDSP_M2DPI64LINEAR_GRID_DIV
+}e_eDSP_M2DPI64LINEAR_GRID;
+
+typedef struct
+{
+    e_eDSP_M2DPI64LINEAR_GRID eType;
+    uint64_t uStep;
+    uint64_t uRecip;
+    uint32_t uShift;
+}t_eDSP_M2DPI64LINEAR_Grid;
+
 typedef struct
 {
     bool_t bIsInit;
     t_eDSP_M2DPI64LINEAR_PointSeries tPoinSeries;
+    t_eDSP_M2DPI64LINEAR_Segment* ptSegTable;
+    t_eDSP_M2DPI64LINEAR_Grid tGrid;
+    uint32_t uLastSegment;
+    uint64_t uSeriesChecksum;
+    uint32_t uSatCnt;
+    e_eDSP_TYPE_OVFMODE eOvfMode;
 }t_eDSP_M2DPI64LINEAR_Ctx;
 
 
@@ -56,7 +85,13 @@ typedef struct
  * GLOBAL PROTOTYPES
  **********************************************************************************************************************/
 /**
- * @brief       Initialize the multiple point linearizer using a series of point
+ * @brief       Initialize the multiple point linearizer using a series of point. The series is fully validated only
+ *              here, and a checksum of it is stored in the context. The series is not copied, so it must not be
+ *              modified until a new init; use eDSP_M2DPI64LINEAR_Verify to check it when needed.
+ *              When all the point of the series have the same distance on X the series is a uniform grid, and the
+ *              segment of an X is calculated directly: with a shift when the distance is a power of two, with a
+ *              multiply by the reciprocal of the distance when the whole series is narrower than 2^32, and with a
+ *              division otherwise. Any other series use the binary search.
  *
  * @param[in]   p_ptCtx       - Multiple point linearizer context
  * @param[in]   p_tSeries     - Struct containing the series of point
@@ -83,7 +118,9 @@ e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_IsInit(t_eDSP_M2DPI64LINEAR_Ctx* con
 
 /**
  * @brief       Given the series of point used during the init phase, calculate the Y value of the line passing in
- *              nearest two point of the series, given an X value
+ *              nearest two point of the series, given an X value. The two point are found with a binary search on the
+ *              ordered series, so the cost grow with log2 of the numbers of point, or in a constant time when the
+ *              series is a uniform grid.
  *
  * @param[in]   p_ptCtx         - Multiple point linearizer context
  * @param[in]   p_uX            - X value to use during the calculation of the Y value
@@ -97,6 +134,143 @@ e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_IsInit(t_eDSP_M2DPI64LINEAR_Ctx* con
 e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_Linearize(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx, const int64_t p_uX,
                                                       int64_t* const p_puY);
 
+/**
+ * @brief       Linearize a block of X values, like calling eDSP_M2DPI64LINEAR_Linearize on every one of them. The
+ *              context is validated only once for the whole block. The segment of the last value is kept in the
+ *              context, and the segment of the next value is searched starting from it: first the same segment,
+ *              then with steps that double on every iteration, so a value in the same or in a near segment is found
+ *              in a constant time also when the series is not a uniform grid. The last segment is kept between two
+ *              calls, so a stream can be linearized one block after the other. Values are processed in order, and
+ *              the processing stop at the first value that generate an error.
+ *              When the library is built for x86 with EDSP_CONFIG_X86SIMD defined and no slope table is used, the
+ *              block is processed by AVX2 or AVX-512 kernels selected at run time, 4 or 8 values at once: the
+ *              segments are searched and gathered on every lane, and the calculation is done in double only where it
+ *              is proven to give the same integer of the exact calculation. The other values are calculated by the
+ *              scalar function, so the result is always the same of eDSP_M2DPI64LINEAR_Linearize.
+ *
+ * @param[in]   p_ptCtx         - Multiple point linearizer context
+ * @param[in]   p_piX           - Pointer to the X values to linearize
+ * @param[in]   p_uNValues      - Numbers of values in p_piX, cannot be zero
+ * @param[out]  p_piY           - Pointer to a buffer of at least p_uNValues int64_t where the calculated Y will be
+ *                                placed
+ * @param[out]  p_puNLinearized - Pointer to an uint32_t where the numbers of calculated Y will be placed
+ *
+ * @return      e_eDSP_M2DPI64LINEAR_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eDSP_M2DPI64LINEAR_RES_NOINITLIB    - Need to init the data stuffer context before taking some action
+ *		        e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX   - In case of an corrupted context
+ *		        e_eDSP_M2DPI64LINEAR_RES_BADPARAM     - In case of an invalid parameter passed to the function
+ *		        e_eDSP_M2DPI64LINEAR_RES_OVERFLOW     - The last processed value generate an overflow
+ *              e_eDSP_M2DPI64LINEAR_RES_OK           - Operation ended correctly
+ */
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_LinearizeBatch(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx,
+                                                           const int64_t* p_piX, const uint32_t p_uNValues,
+                                                           int64_t* const p_piY,
+                                                           uint32_t* const p_puNLinearized);
+
+/**
+ * @brief       Select how the arithmetic overflow are managed. With e_eDSP_TYPE_OVFMODE_ERROR, the default after
+ *              the init, an overflow is reported as e_eDSP_M2DPI64LINEAR_RES_OVERFLOW.
+ *              With e_eDSP_TYPE_OVFMODE_SATURATE every operation is clamped to the int64_t storage area and counted,
+ *              so no value is discarded. Setting the mode restart the count of the saturated operations.
+ *
+ * @param[in]   p_ptCtx         - Multiple point linearizer context
+ * @param[in]   p_eOvfMode      - Overflow mode to use
+ *
+ * @return      e_eDSP_M2DPI64LINEAR_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eDSP_M2DPI64LINEAR_RES_NOINITLIB        - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX       - In case of an corrupted context
+ *		        e_eDSP_M2DPI64LINEAR_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *              e_eDSP_M2DPI64LINEAR_RES_OK               - Operation ended correctly
+ */
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_SetOvfMode(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx,
+                                                       e_eDSP_TYPE_OVFMODE p_eOvfMode);
+
+/**
+ * @brief       Get the numbers of operation clamped since the overflow mode was set. The counter is sticky, it
+ *              never wrap around.
+ *
+ * @param[in]   p_ptCtx         - Multiple point linearizer context
+ * @param[out]  p_puSatCnt      - Pointer to an uint32_t where the numbers of saturated operation will be placed
+ *
+ * @return      e_eDSP_M2DPI64LINEAR_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eDSP_M2DPI64LINEAR_RES_NOINITLIB        - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX       - In case of an corrupted context
+ *              e_eDSP_M2DPI64LINEAR_RES_OK               - Operation ended correctly
+ */
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_GetSatCnt(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx,
+                                                      uint32_t* const p_puSatCnt);
+
+/**
+ * @brief       Precompute, for every segment of the series, the slope in Q32.32 and the intercept at the first X of
+ *              the segment. After this call eDSP_M2DPI64LINEAR_Linearize evaluate an X inside the series with one
+ *              multiply, one shift and one add, without any division. The result is rounded to the nearest, so it
+ *              can differ by up to two from the truncated result of the exact calculation. A segment wider than
+ *              2^32, a segment that can't be evaluated in Q32.32 without overflow, and any X outside the series, are
+ *              still calculated with the exact calculation.
+ *
+ * @param[in]   p_ptCtx         - Multiple point linearizer context
+ * @param[in]   p_ptSegBuffer   - Buffer of p_uSegBuffLen segment where the precomputed values will be placed. The
+ *                                buffer is not copied and must not be modified after this call.
+ * @param[in]   p_uSegBuffLen   - Numbers of element of p_ptSegBuffer, must be the numbers of point minus one
+ *
+ * @return      e_eDSP_M2DPI64LINEAR_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eDSP_M2DPI64LINEAR_RES_NOINITLIB        - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX       - In case of an corrupted context
+ *		        e_eDSP_M2DPI64LINEAR_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *              e_eDSP_M2DPI64LINEAR_RES_OK               - Operation ended correctly
+ */
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_SetSlopeTable(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx,
+                                                          t_eDSP_M2DPI64LINEAR_Segment* p_ptSegBuffer,
+                                                          const uint32_t p_uSegBuffLen);
+
+/**
+ * @brief       Check the integrity of the series of point used during the init phase. The other functions check
+ *              only the context, and not the whole series, so that their cost doesn't depend on the numbers of point.
+ *              This function check again the order of the series and compare its checksum with the one calculated
+ *              during the init, so its cost grow with the numbers of point. Call it periodically or when the memory
+ *              of the series can be corrupted. When a slope table is used, every precomputed segment is checked too.
+ *
+ * @param[in]   p_ptCtx         - Multiple point linearizer context
+ *
+ * @return      e_eDSP_M2DPI64LINEAR_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eDSP_M2DPI64LINEAR_RES_NOINITLIB        - Need to init the data stuffer context before taking some
+ *                                                          action
+ *		        e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX       - In case of an corrupted context or series of point
+ *              e_eDSP_M2DPI64LINEAR_RES_OK               - The series is the same validated during the init
+ */
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_Verify(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Convert a series of point in a uniform grid, that can be linearized in a constant time. The distance
+ *              of the grid is the greatest power of two that keep the linearization of the new series inside
+ *              p_uMaxError from the linearization of p_tSeries. The error is measured on every point of p_tSeries,
+ *              that together with the point of the grid are the only point where the difference of the two
+ *              linearization can change slope, so between p_tSeries first and last X only the truncation of the
+ *              integer calculation is added. The grid start from the first X of p_tSeries and end at or after the
+ *              last one; outside of them the two series are extrapolated differently.
+ *
+ * @param[in]   p_tSeries       - Struct containing the series of point to convert
+ * @param[in]   p_uMaxError     - Max absolute difference allowed between the Y of the two series
+ * @param[out]  p_ptOutBuffer   - Buffer of p_uOutBuffLen point where the uniform grid will be placed. It is used as
+ *                                working area, so it is modified even when the function fails.
+ * @param[in]   p_uOutBuffLen   - Numbers of element of p_ptOutBuffer, must be at least 3
+ * @param[out]  p_puNOutPoint   - Pointer to an uint32_t where the numbers of point of the grid will be placed
+ *
+ * @return      e_eDSP_M2DPI64LINEAR_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eDSP_M2DPI64LINEAR_RES_BADPARAM         - In case of an invalid parameter passed to the function,
+ *                                                          or when no grid that fit p_ptOutBuffer has an error lower
+ *                                                          than p_uMaxError
+ *              e_eDSP_M2DPI64LINEAR_RES_OK               - Operation ended correctly
+ */
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_ResampleUniform(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                                            const uint64_t p_uMaxError,
+                                                            t_eDSP_TYPE_2DPI64* const p_ptOutBuffer,
+                                                            const uint32_t p_uOutBuffLen,
+                                                            uint32_t* const p_puNOutPoint);
+
 
 
 #ifdef __cplusplus
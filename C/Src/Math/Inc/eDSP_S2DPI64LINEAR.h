@@ -42,7 +42,8 @@ typedef enum
  * GLOBAL PROTOTYPES
  **********************************************************************************************************************/
 /**
- * @brief       Given two point, calculate the Y value of the line passing in the provided two point, given an X value
+ * @brief       Given two point, calculate the Y value of the line passing in the provided two point, given an X value.
+ *              The slope product is kept on 128 bit before the division, so the result is truncated only once.
  *
  * @param[in]   p_tP1           - First point
  * @param[in]   p_tP2           - Second point
@@ -60,6 +61,27 @@ typedef enum
 e_eDSP_S2DPI64LINEAR_RES eDSP_S2DPI64LINEAR_Linearize(const t_eDSP_TYPE_2DPI64 p_tP1, const t_eDSP_TYPE_2DPI64 p_tP2,
                                                       const int64_t p_iX, int64_t* const p_piY);
 
+/**
+ * @brief       Same as eDSP_S2DPI64LINEAR_Linearize, but every internal operation is clamped to the int64_t storage
+ *              area instead of generating an overflow. Every clamped operation increment the saturation counter,
+ *              the counter itself never wrap around.
+ *
+ * @param[in]   p_tP1           - First point
+ * @param[in]   p_tP2           - Second point
+ * @param[in]   p_iX            - X value to use during the calculation of the Y value
+ * @param[out]  p_piY           - Pointer to an int64_t where the value of the calculated Y will be placed.
+ * @param[out]  p_puSatCnt      - Pointer to the saturation counter to increment when an operation is clamped
+ *
+ * @return      e_eDSP_S2DPI64LINEAR_RES_BADPOINTER   - In case of bad pointer passed to the function
+ *		        e_eDSP_S2DPI64LINEAR_RES_BADPARAM     - In case of an invalid parameter passed to the function.
+ *                                                    - so when the two point are the same or when the line as and angle
+ *                                                    - of +-90 degree
+ *              e_eDSP_S2DPI64LINEAR_RES_OK           - Operation ended correctly
+ */
+e_eDSP_S2DPI64LINEAR_RES eDSP_S2DPI64LINEAR_LinearizeSat(const t_eDSP_TYPE_2DPI64 p_tP1, const t_eDSP_TYPE_2DPI64 p_tP2,
+                                                         const int64_t p_iX, int64_t* const p_piY,
+                                                         uint32_t* const p_puSatCnt);
+
 
 
 #ifdef __cplusplus
@@ -12,6 +12,33 @@
  **********************************************************************************************************************/
 #include "eDSP_DERIVATIVE.h"
 #include "eDSP_MAXCHECK.h"
+#include "eDSP_SATARITH.h"
+#include "eDSP_BLOCKSCAN.h"
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE DEFINE
+ **********************************************************************************************************************/
+/* Numbers of stencil available */
+#define EDSP_DERIVATIVE_NSTENCIL                                                                    ( ( uint32_t ) 4u )
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE VARIABLE
+ **********************************************************************************************************************/
+/* Precomputed integer coefficients of every stencil, from the oldest to the newest value of the window, with their
+   denominator in unit of the time between two values */
+static const uint32_t eDSP_DERIVATIVE_auNPoints[EDSP_DERIVATIVE_NSTENCIL] = { 2u, 3u, 5u, 7u };
+static const int64_t eDSP_DERIVATIVE_aiNorm[EDSP_DERIVATIVE_NSTENCIL] = { 1, 2, 12, 28 };
+static const int64_t eDSP_DERIVATIVE_aaiWeight[EDSP_DERIVATIVE_NSTENCIL][EDSP_DERIVATIVE_MAXPOINTS] =
+{
+	{ -1,  1,  0,  0,  0,  0,  0 },
+	{ -1,  0,  1,  0,  0,  0,  0 },
+	{  1, -8,  0,  8, -1,  0,  0 },
+	{ -3, -2, -1,  0,  1,  2,  3 }
+};
 
 
 
@@ -20,16 +47,25 @@
  **********************************************************************************************************************/
 static bool_t eDSP_DERIVATIVE_IsStatusStillCoherent(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx);
 static e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_MaxCheckResToDERIVATE(const e_eDSP_MAXCHECK_RES p_tMaxRet);
+static uint32_t eDSP_DERIVATIVE_GetNPoints(const e_eDSP_DERIVATIVE_STENCIL p_eStencil);
+static bool_t eDSP_DERIVATIVE_SumToI64(const int64_t p_iSumHigh, const uint64_t p_uSumLow, int64_t* const p_piSum);
+static bool_t eDSP_DERIVATIVE_IsBlockSafe(const int64_t p_iMin, const int64_t p_iMax,
+                                          const e_eDSP_DERIVATIVE_STENCIL p_eStencil);
+static void eDSP_DERIVATIVE_ProcessBlockNoOvf(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, const int64_t* p_piValues,
+                                              const uint32_t* p_puTimeFromLast, const uint32_t p_uNValues,
+                                              int64_t* const p_piDerivate, uint32_t* const p_puNDerivate);
 
 
 
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
  **********************************************************************************************************************/
-e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InitCtx(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx)
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InitCtx(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx,
+                                              const e_eDSP_DERIVATIVE_STENCIL p_eStencil)
 {
 	/* Local variable */
 	e_eDSP_DERIVATIVE_RES l_eRes;
+	uint32_t l_uCnt;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -38,16 +74,30 @@ e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InitCtx(t_eDSP_DERIVATIVE_Ctx* const p_ptC
 	}
 	else
 	{
-        /* Initialize internal status */
-        p_ptCtx->bIsInit = true;
-        p_ptCtx->bHasPrev = false;
-		p_ptCtx->bHasCurrent = false;
-		p_ptCtx->uPreviousVal = 0;
-		p_ptCtx->uCurrentVal = 0;
-		p_ptCtx->uTimeElapsedFromCurToPre = 0u;
+		/* Check data validity */
+		if( 0u == eDSP_DERIVATIVE_GetNPoints(p_eStencil) )
+		{
+			l_eRes = e_eDSP_DERIVATIVE_RES_BADPARAM;
+		}
+		else
+		{
+			/* Initialize internal status */
+			p_ptCtx->bIsInit = true;
+			p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+			p_ptCtx->uSatCnt = 0u;
+			p_ptCtx->eStencil = p_eStencil;
+			p_ptCtx->uNPoints = eDSP_DERIVATIVE_GetNPoints(p_eStencil);
+			p_ptCtx->uFilledData = 0u;
 
-		/* All OK */
-        l_eRes = e_eDSP_DERIVATIVE_RES_OK;
+			for( l_uCnt = 0u; l_uCnt < EDSP_DERIVATIVE_MAXPOINTS; l_uCnt++ )
+			{
+				p_ptCtx->aiValues[l_uCnt] = 0;
+				p_ptCtx->auTimeFromLast[l_uCnt] = 0u;
+			}
+
+			/* All OK */
+			l_eRes = e_eDSP_DERIVATIVE_RES_OK;
+		}
 	}
 
 	return l_eRes;
@@ -78,7 +128,6 @@ e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InsertValueAndGetDerivate(t_eDSP_DERIVATIV
 {
 	/* Local variable for return */
 	e_eDSP_DERIVATIVE_RES l_eRes;
-	e_eDSP_MAXCHECK_RES l_eMaxRes;
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_piDerivate ) )
@@ -101,55 +150,111 @@ e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InsertValueAndGetDerivate(t_eDSP_DERIVATIV
             }
 			else
 			{
-                /* Check data validity */
-				if( 0u == p_timeFromLast )
+				l_eRes = eDSP_DERIVATIVE_InsertValueCore(p_ptCtx, p_iValue, p_timeFromLast, p_piDerivate);
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_ProcessBlock(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, const int64_t* p_piValues,
+                                                   const uint32_t* p_puTimeFromLast, const uint32_t p_uNValues,
+                                                   int64_t* const p_piDerivate, uint32_t* const p_puNDerivate,
+                                                   uint32_t* const p_puNProcessed)
+{
+	/* Local variable for return */
+	e_eDSP_DERIVATIVE_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uNDerivate;
+	int64_t  l_iMin;
+	int64_t  l_iMax;
+	uint32_t l_uMinTime;
+	uint32_t l_uMaxTime;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_puTimeFromLast ) || ( NULL == p_piDerivate ) ||
+		( NULL == p_puNDerivate ) || ( NULL == p_puNProcessed ) )
+	{
+		l_eRes = e_eDSP_DERIVATIVE_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_DERIVATIVE_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_DERIVATIVE_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_DERIVATIVE_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( 0u == p_uNValues )
 				{
 					l_eRes = e_eDSP_DERIVATIVE_RES_BADPARAM;
 				}
 				else
 				{
-					/* All ok */
-					l_eRes = e_eDSP_DERIVATIVE_RES_OK;
+					/* Init variable */
+					l_uCnt = 0u;
+					l_uNDerivate = 0u;
+					l_eRes = e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE;
 
-					/* Insert data */
-					p_ptCtx->uPreviousVal = p_ptCtx->uCurrentVal;
-					p_ptCtx->uCurrentVal = p_iValue;
-					p_ptCtx->uTimeElapsedFromCurToPre = p_timeFromLast;
+					/* Pre-scan the block, when no time is zero and no weighted sum can overflow the whole block is
+					   derived with plain int64_t arithmetic. The first windows include the values of the context, so
+					   they are part of the range too */
+					l_iMin = MAX_INT64VAL;
+					l_iMax = MIN_INT64VAL;
+					l_uMinTime = MAX_UINT32VAL;
+					l_uMaxTime = MIN_UINT32VAL;
+					eDSP_BLOCKSCAN_MinMaxI64(p_ptCtx->aiValues, p_ptCtx->uNPoints, &l_iMin, &l_iMax);
+					eDSP_BLOCKSCAN_MinMaxI64(p_piValues, p_uNValues, &l_iMin, &l_iMax);
+					eDSP_BLOCKSCAN_MinMaxU32(p_puTimeFromLast, p_uNValues, &l_uMinTime, &l_uMaxTime);
 
-					if( false == p_ptCtx->bHasCurrent )
+					if( ( 0u != l_uMinTime ) &&
+						( true == eDSP_DERIVATIVE_IsBlockSafe(l_iMin, l_iMax, p_ptCtx->eStencil) ) )
 					{
-						/* first entry */
-						p_ptCtx->bHasCurrent = true;
+						eDSP_DERIVATIVE_ProcessBlockNoOvf(p_ptCtx, p_piValues, p_puTimeFromLast, p_uNValues,
+						                                  p_piDerivate, &l_uNDerivate);
+						l_uCnt = p_uNValues;
 					}
 					else
 					{
-						if( false == p_ptCtx->bHasPrev )
+						/* Context is checked only once, every value of the block is processed without other
+						   check */
+						while( ( l_uCnt < p_uNValues ) && ( ( e_eDSP_DERIVATIVE_RES_OK == l_eRes ) ||
+							   ( e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE == l_eRes ) ) )
 						{
-							/* First time adding data */
-							p_ptCtx->bHasPrev = true;
+							l_eRes = eDSP_DERIVATIVE_InsertValueCore(p_ptCtx, p_piValues[l_uCnt],
+							                                         p_puTimeFromLast[l_uCnt],
+							                                         &p_piDerivate[l_uNDerivate]);
+
+							if( e_eDSP_DERIVATIVE_RES_OK == l_eRes )
+							{
+								l_uNDerivate++;
+							}
+
+							/* Increase counter */
+							l_uCnt++;
 						}
 					}
 
-					/* Check if we can proceed with calculation */
-					if( false == p_ptCtx->bHasPrev )
+					/* Some value are derived and the last one doesn't generate any error */
+					if( ( e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE == l_eRes ) && ( l_uNDerivate > 0u ) )
 					{
-						l_eRes = e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE;
+						l_eRes = e_eDSP_DERIVATIVE_RES_OK;
 					}
-					else
-					{
-						/* the derivate operation is defined as follow:
-						* lim of h -> 0 of the function: ( ( f(x0+h) - f(x0) ) / h ) wich is in ours function:
-						currentvalue - previousvalue / timeelapsed from values */
-						l_eMaxRes = eDSP_MAXCHECK_SUBTI64Check(p_ptCtx->uCurrentVal, p_ptCtx->uPreviousVal);
-						l_eRes = eDSP_DERIVATIVE_MaxCheckResToDERIVATE(l_eMaxRes);
 
-						if( e_eDSP_DERIVATIVE_RES_OK == l_eRes )
-						{
-							/* calculate */
-							*p_piDerivate = ( p_ptCtx->uCurrentVal - p_ptCtx->uPreviousVal ) /
-											p_ptCtx->uTimeElapsedFromCurToPre;
-						}
-					}
+					*p_puNDerivate = l_uNDerivate;
+					*p_puNProcessed = l_uCnt;
 				}
 			}
 		}
@@ -158,54 +263,260 @@ e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InsertValueAndGetDerivate(t_eDSP_DERIVATIV
 	return l_eRes;
 }
 
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_SetOvfMode(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, e_eDSP_TYPE_OVFMODE p_eOvfMode)
+{
+	/* Local variable */
+	e_eDSP_DERIVATIVE_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_DERIVATIVE_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_DERIVATIVE_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_DERIVATIVE_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_DERIVATIVE_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
+				{
+					l_eRes = e_eDSP_DERIVATIVE_RES_BADPARAM;
+				}
+				else
+				{
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					l_eRes = e_eDSP_DERIVATIVE_RES_OK;
+				}
+			}
+		}
+	}
 
+	return l_eRes;
+}
 
-/***********************************************************************************************************************
- *  PRIVATE FUNCTION
- **********************************************************************************************************************/
-static bool_t eDSP_DERIVATIVE_IsStatusStillCoherent(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx)
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_GetSatCnt(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, uint32_t* const p_puSatCnt)
 {
-    /* Return local var */
-    bool_t l_eRes;
+	/* Local variable */
+	e_eDSP_DERIVATIVE_RES l_eRes;
 
-	if( false == p_ptCtx->bHasCurrent )
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
 	{
-		/* No current value, no data present in the system */
-		if( ( true == p_ptCtx->bHasPrev ) || ( 0 != p_ptCtx->uPreviousVal ) || ( 0 != p_ptCtx->uCurrentVal ) ||
-			( 0 != p_ptCtx->uTimeElapsedFromCurToPre ) )
+		l_eRes = e_eDSP_DERIVATIVE_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
 		{
-			l_eRes = false;
+			l_eRes = e_eDSP_DERIVATIVE_RES_NOINITLIB;
 		}
 		else
 		{
-			l_eRes = true;
+            /* Check data coherence */
+            if( false == eDSP_DERIVATIVE_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_DERIVATIVE_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puSatCnt = p_ptCtx->uSatCnt;
+				l_eRes = e_eDSP_DERIVATIVE_RES_OK;
+			}
 		}
 	}
-	else
+
+	return l_eRes;
+}
+
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InsertValueCore(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, const int64_t p_iValue,
+                                                      const uint32_t p_timeFromLast, int64_t* const p_piDerivate)
+{
+	/* Local variable for return */
+	e_eDSP_DERIVATIVE_RES l_eRes;
+	e_eDSP_MAXCHECK_RES l_eMaxRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	int64_t  l_iScale;
+	int64_t  l_iSumHigh;
+	uint64_t l_uSumLow;
+	int64_t  l_iSum;
+	uint64_t l_uTime;
+	int64_t  l_iDen;
+	int64_t  l_iDerivate;
+
+	/* Insert data */
+	l_eRes = eDSP_DERIVATIVE_InsertValueOnlyCore(p_ptCtx, p_iValue, p_timeFromLast);
+
+	if( e_eDSP_DERIVATIVE_RES_OK == l_eRes )
 	{
-		/* has current value */
-		if( false == p_ptCtx->bHasPrev )
+		/* the derivate operation is defined as follow:
+		* lim of h -> 0 of the function: ( ( f(x0+h) - f(x0) ) / h ), and with more points the error of the
+		* approximation is lower: SUM[ w(k) * f(x0 + k * h) ] / ( norm * h ). In ours function h is the mean time
+		* of the window, so the derivate is SUM[ w(k) * ( points - 1 ) * value(k) ] / ( norm * timeofwindow ).
+		* The sum is done on 128 bit, it can't overflow, and the only rounding is the final division */
+		l_iScale = (int64_t) ( p_ptCtx->uNPoints - 1u );
+		l_iSumHigh = 0;
+		l_uSumLow = 0u;
+		l_uTime = 0u;
+		l_iDerivate = 0;
+		l_eMaxRes = e_eDSP_MAXCHECK_RES_OK;
+
+		for( l_uCnt = 0u; ( l_uCnt < p_ptCtx->uNPoints ) && ( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes ); l_uCnt++ )
+		{
+			l_eMaxRes = eDSP_MAXCHECK_MulAddI128(p_ptCtx->aiValues[l_uCnt],
+			                                     eDSP_DERIVATIVE_aaiWeight[p_ptCtx->eStencil][l_uCnt] * l_iScale,
+			                                     &l_iSumHigh, &l_uSumLow);
+		}
+
+		/* The time of the oldest value is from a value that is not in the window anymore */
+		for( l_uCnt = 1u; l_uCnt < p_ptCtx->uNPoints; l_uCnt++ )
 		{
-			/* No previous value */
-			if( ( 0 != p_ptCtx->uPreviousVal ) || ( 0 != p_ptCtx->uTimeElapsedFromCurToPre ) )
+			l_uTime += p_ptCtx->auTimeFromLast[l_uCnt];
+		}
+
+		l_iDen = eDSP_DERIVATIVE_aiNorm[p_ptCtx->eStencil] * ( (int64_t) l_uTime );
+
+		if( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes )
+		{
+			/* Most of the time the sum fit an int64_t and the slow 128 bit division is not needed, both
+			   truncate toward zero */
+			if( true == eDSP_DERIVATIVE_SumToI64(l_iSumHigh, l_uSumLow, &l_iSum) )
 			{
-				l_eRes = false;
+				l_iDerivate = l_iSum / l_iDen;
 			}
 			else
 			{
-				l_eRes = true;
+				l_eMaxRes = eDSP_MAXCHECK_DivI128(l_iSumHigh, l_uSumLow, l_iDen, &l_iDerivate);
 			}
 		}
+
+		if( ( e_eDSP_MAXCHECK_RES_OK != l_eMaxRes ) && ( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode ) )
+		{
+			/* Only the final value can exceed the int64_t storage area, clamp it */
+			l_iDerivate = eDSP_SATARITH_DivI128(l_iSumHigh, l_uSumLow, l_iDen, &p_ptCtx->uSatCnt);
+			l_eMaxRes = e_eDSP_MAXCHECK_RES_OK;
+		}
+
+		if( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes )
+		{
+			*p_piDerivate = l_iDerivate;
+		}
+
+		l_eRes = eDSP_DERIVATIVE_MaxCheckResToDERIVATE(l_eMaxRes);
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_InsertValueOnlyCore(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, const int64_t p_iValue,
+                                                          const uint32_t p_timeFromLast)
+{
+	/* Local variable for return */
+	e_eDSP_DERIVATIVE_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uLast;
+
+	/* Check data validity */
+	if( 0u == p_timeFromLast )
+	{
+		l_eRes = e_eDSP_DERIVATIVE_RES_BADPARAM;
+	}
+	else
+	{
+		/* Insert data, the window is shifted so the newest value is always the last one */
+		l_uLast = p_ptCtx->uNPoints - 1u;
+
+		for( l_uCnt = 0u; l_uCnt < l_uLast; l_uCnt++ )
+		{
+			p_ptCtx->aiValues[l_uCnt] = p_ptCtx->aiValues[l_uCnt + 1u];
+			p_ptCtx->auTimeFromLast[l_uCnt] = p_ptCtx->auTimeFromLast[l_uCnt + 1u];
+		}
+
+		p_ptCtx->aiValues[l_uLast] = p_iValue;
+		p_ptCtx->auTimeFromLast[l_uLast] = p_timeFromLast;
+
+		if( p_ptCtx->uFilledData < p_ptCtx->uNPoints )
+		{
+			p_ptCtx->uFilledData++;
+		}
+
+		/* Check if the window is full and a derivate can be calculated */
+		if( p_ptCtx->uFilledData < p_ptCtx->uNPoints )
+		{
+			l_eRes = e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE;
+		}
 		else
 		{
-			/* Has even a previous value */
-			if( 0 != p_ptCtx->uTimeElapsedFromCurToPre )
+			l_eRes = e_eDSP_DERIVATIVE_RES_OK;
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eDSP_DERIVATIVE_IsStatusStillCoherent(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+    bool_t l_eRes;
+
+    /* Local variable for calculation */
+    uint32_t l_uNPoints;
+    uint32_t l_uCnt;
+
+	l_uNPoints = eDSP_DERIVATIVE_GetNPoints(p_ptCtx->eStencil);
+
+	/* Check data validity */
+	if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) )
+	{
+		l_eRes = false;
+	}
+	else if( ( 0u == l_uNPoints ) || ( l_uNPoints != p_ptCtx->uNPoints ) || ( p_ptCtx->uFilledData > l_uNPoints ) )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+		/* The window is filled from the end: the positions not filled yet are zero, and the time of every inserted
+		   value was checked on insertion and is never zero */
+		l_eRes = true;
+
+		for( l_uCnt = 0u; l_uCnt < l_uNPoints; l_uCnt++ )
+		{
+			if( l_uCnt < ( l_uNPoints - p_ptCtx->uFilledData ) )
 			{
-				l_eRes = false;
+				if( ( 0 != p_ptCtx->aiValues[l_uCnt] ) || ( 0u != p_ptCtx->auTimeFromLast[l_uCnt] ) )
+				{
+					l_eRes = false;
+				}
 			}
 			else
 			{
-				l_eRes = true;
+				if( 0u == p_ptCtx->auTimeFromLast[l_uCnt] )
+				{
+					l_eRes = false;
+				}
 			}
 		}
 	}
@@ -228,4 +539,169 @@ static e_eDSP_DERIVATIVE_RES eDSP_DERIVATIVE_MaxCheckResToDERIVATE(const e_eDSP_
 	}
 
 	return l_eRet;
+}
+
+static uint32_t eDSP_DERIVATIVE_GetNPoints(const e_eDSP_DERIVATIVE_STENCIL p_eStencil)
+{
+	/* Local variable for return */
+	uint32_t l_uNPoints;
+
+	/* Zero when the stencil is not valid */
+	if( ( (uint32_t) p_eStencil ) < EDSP_DERIVATIVE_NSTENCIL )
+	{
+		l_uNPoints = eDSP_DERIVATIVE_auNPoints[p_eStencil];
+	}
+	else
+	{
+		l_uNPoints = 0u;
+	}
+
+	return l_uNPoints;
+}
+
+static bool_t eDSP_DERIVATIVE_SumToI64(const int64_t p_iSumHigh, const uint64_t p_uSumLow, int64_t* const p_piSum)
+{
+    /* Return local var */
+    bool_t l_bRes;
+
+	if( ( 0 == p_iSumHigh ) && ( p_uSumLow <= (uint64_t) MAX_INT64VAL ) )
+	{
+		/* Positive value */
+		*p_piSum = (int64_t) p_uSumLow;
+		l_bRes = true;
+	}
+	else if( ( -1 == p_iSumHigh ) && ( p_uSumLow > (uint64_t) MAX_INT64VAL ) )
+	{
+		/* Negative value, ~low is the absolute value minus one and can always be stored in an int64_t */
+		*p_piSum = -( (int64_t) ( ~p_uSumLow ) ) - 1;
+		l_bRes = true;
+	}
+	else
+	{
+		/* Sum exceed the int64_t storage area */
+		l_bRes = false;
+	}
+
+	return l_bRes;
+}
+
+static bool_t eDSP_DERIVATIVE_IsBlockSafe(const int64_t p_iMin, const int64_t p_iMax,
+                                          const e_eDSP_DERIVATIVE_STENCIL p_eStencil)
+{
+    /* Return local var */
+	bool_t l_bRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uNPoints;
+	int64_t  l_iWeight;
+	int64_t  l_iAbsSum;
+	int64_t  l_iDummy;
+
+	/* Every weighted sum, and every partial sum, is at most the sum of the absolute value of the scaled weight times
+	   the greatest absolute value of the range, so it is enough to check the two extremes */
+	l_uNPoints = eDSP_DERIVATIVE_auNPoints[p_eStencil];
+	l_iAbsSum = 0;
+
+	for( l_uCnt = 0u; l_uCnt < l_uNPoints; l_uCnt++ )
+	{
+		l_iWeight = eDSP_DERIVATIVE_aaiWeight[p_eStencil][l_uCnt];
+
+		if( l_iWeight < 0 )
+		{
+			l_iWeight = -l_iWeight;
+		}
+
+		l_iAbsSum += l_iWeight * ( (int64_t) ( l_uNPoints - 1u ) );
+	}
+
+	if( p_iMin > p_iMax )
+	{
+		/* Empty range, nothing was scanned */
+		l_bRes = false;
+	}
+	else if( ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_MulI64(p_iMin, l_iAbsSum, &l_iDummy) ) ||
+			 ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_MulI64(p_iMax, l_iAbsSum, &l_iDummy) ) )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+		l_bRes = true;
+	}
+
+	return l_bRes;
+}
+
+static void eDSP_DERIVATIVE_ProcessBlockNoOvf(t_eDSP_DERIVATIVE_Ctx* const p_ptCtx, const int64_t* p_piValues,
+                                              const uint32_t* p_puTimeFromLast, const uint32_t p_uNValues,
+                                              int64_t* const p_piDerivate, uint32_t* const p_puNDerivate)
+{
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uPoint;
+	uint32_t l_uLast;
+	uint32_t l_uNDerivate;
+	const int64_t* l_piWeight;
+	int64_t  l_iScale;
+	int64_t  l_iNorm;
+	int64_t  l_iSum;
+	uint64_t l_uTime;
+
+	/* Same steps of eDSP_DERIVATIVE_InsertValueCore, but the block was proven safe: every weighted sum fit an
+	   int64_t, so no check is needed and the saturation can't happen */
+	l_uLast = p_ptCtx->uNPoints - 1u;
+	l_uNDerivate = 0u;
+
+	/* The first values complete the window of the context, they are at most six and use the single step, that
+	   can't fail here */
+	for( l_uCnt = 0u; ( l_uCnt < p_uNValues ) && ( l_uCnt < l_uLast ); l_uCnt++ )
+	{
+		if( e_eDSP_DERIVATIVE_RES_OK == eDSP_DERIVATIVE_InsertValueCore(p_ptCtx, p_piValues[l_uCnt],
+		                                                                p_puTimeFromLast[l_uCnt],
+		                                                                &p_piDerivate[l_uNDerivate]) )
+		{
+			l_uNDerivate++;
+		}
+	}
+
+	if( p_uNValues > l_uLast )
+	{
+		/* From here every window is inside the block, the time of the window is kept as a running sum */
+		l_piWeight = eDSP_DERIVATIVE_aaiWeight[p_ptCtx->eStencil];
+		l_iScale = (int64_t) l_uLast;
+		l_iNorm = eDSP_DERIVATIVE_aiNorm[p_ptCtx->eStencil];
+		l_uTime = 0u;
+
+		for( l_uPoint = 1u; l_uPoint < l_uLast; l_uPoint++ )
+		{
+			l_uTime += p_puTimeFromLast[l_uPoint];
+		}
+
+		for( l_uCnt = l_uLast; l_uCnt < p_uNValues; l_uCnt++ )
+		{
+			l_uTime += p_puTimeFromLast[l_uCnt];
+			l_iSum = 0;
+
+			for( l_uPoint = 0u; l_uPoint <= l_uLast; l_uPoint++ )
+			{
+				l_iSum += ( l_piWeight[l_uPoint] * l_iScale ) * p_piValues[l_uCnt - l_uLast + l_uPoint];
+			}
+
+			p_piDerivate[l_uNDerivate] = l_iSum / ( l_iNorm * ( (int64_t) l_uTime ) );
+			l_uNDerivate++;
+			l_uTime -= p_puTimeFromLast[l_uCnt - l_uLast + 1u];
+		}
+
+		/* Leave the context as after the insertion of the last value */
+		for( l_uPoint = 0u; l_uPoint <= l_uLast; l_uPoint++ )
+		{
+			p_ptCtx->aiValues[l_uPoint] = p_piValues[p_uNValues - 1u - l_uLast + l_uPoint];
+			p_ptCtx->auTimeFromLast[l_uPoint] = p_puTimeFromLast[p_uNValues - 1u - l_uLast + l_uPoint];
+		}
+
+		p_ptCtx->uFilledData = p_ptCtx->uNPoints;
+	}
+
+	*p_puNDerivate = l_uNDerivate;
 }
\ No newline at end of file
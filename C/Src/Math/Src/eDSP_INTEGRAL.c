@@ -12,6 +12,8 @@
  **********************************************************************************************************************/
 #include "eDSP_INTEGRAL.h"
 #include "eDSP_MAXCHECK.h"
+#include "eDSP_SATARITH.h"
+#include "eDSP_BLOCKSCAN.h"
 
 
 
@@ -20,13 +22,26 @@
  **********************************************************************************************************************/
 static bool_t eDSP_INTEGRAL_IsStatusStillCoherent(t_eDSP_INTEGRAL_Ctx* const p_ptCtx);
 static e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_MaxCheckResToINTEGRAL(const e_eDSP_MAXCHECK_RES p_tMaxRet);
+static int64_t eDSP_INTEGRAL_RuleUnit(const e_eDSP_INTEGRAL_RULE p_eRule);
+static e_eDSP_MAXCHECK_RES eDSP_INTEGRAL_AddIncrement(const t_eDSP_INTEGRAL_Ctx* const p_ptCtx,
+                                                      const int64_t p_iPairStart, const uint32_t p_uPairTime,
+                                                      int64_t* const p_piAccHigh, uint64_t* const p_puAccLow);
+static bool_t eDSP_INTEGRAL_AccToI64(const int64_t p_iAccHigh, const uint64_t p_uAccLow, int64_t* const p_piAcc);
+static e_eDSP_MAXCHECK_RES eDSP_INTEGRAL_AccToIntegral(const int64_t p_iAccHigh, const uint64_t p_uAccLow,
+                                                       const int64_t p_iUnit, int64_t* const p_piIntegral);
+static bool_t eDSP_INTEGRAL_IsBlockSafe(const int64_t p_iAcc, const int64_t p_iMin, const int64_t p_iMax,
+                                        const uint32_t p_uMaxTime, const uint32_t p_uNValues, const int64_t p_iUnit);
+static void eDSP_INTEGRAL_ProcessBlockNoOvf(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, const int64_t p_iAcc,
+                                            const int64_t* p_piValues, const uint32_t* p_puTimeFromLast,
+                                            const uint32_t p_uNValues, int64_t* const p_piIntegral,
+                                            uint32_t* const p_puNIntegral);
 
 
 
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
  **********************************************************************************************************************/
-e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_InitCtx(t_eDSP_INTEGRAL_Ctx* const p_ptCtx)
+e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_InitCtx(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, const e_eDSP_INTEGRAL_RULE p_eRule)
 {
 	/* Local variable */
 	e_eDSP_INTEGRAL_RES l_eRes;
@@ -38,17 +53,31 @@ e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_InitCtx(t_eDSP_INTEGRAL_Ctx* const p_ptCtx)
 	}
 	else
 	{
-        /* Initialize internal status */
-        p_ptCtx->bIsInit = true;
-        p_ptCtx->bHasPrev = false;
-		p_ptCtx->bHasCurrent = false;
-		p_ptCtx->uPreviousVal = 0;
-		p_ptCtx->uCurrentVal = 0;
-		p_ptCtx->uIntegral   = 0;
-		p_ptCtx->uTimeElapsFromCurToPre = 0u;
+		/* Check data validity */
+		if( 0 == eDSP_INTEGRAL_RuleUnit(p_eRule) )
+		{
+			l_eRes = e_eDSP_INTEGRAL_RES_BADPARAM;
+		}
+		else
+		{
+			/* Initialize internal status */
+			p_ptCtx->bIsInit = true;
+			p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+			p_ptCtx->uSatCnt = 0u;
+			p_ptCtx->eRule = p_eRule;
+			p_ptCtx->bHasPrev = false;
+			p_ptCtx->bHasCurrent = false;
+			p_ptCtx->bIsPairOpen = false;
+			p_ptCtx->uPreviousVal = 0;
+			p_ptCtx->uCurrentVal = 0;
+			p_ptCtx->uIntegral   = 0;
+			p_ptCtx->uAccLow = 0u;
+			p_ptCtx->iAccHigh = 0;
+			p_ptCtx->uTimeElapsFromCurToPre = 0u;
 
-		/* All OK */
-        l_eRes = e_eDSP_INTEGRAL_RES_OK;
+			/* All OK */
+			l_eRes = e_eDSP_INTEGRAL_RES_OK;
+		}
 	}
 
 	return l_eRes;
@@ -78,10 +107,6 @@ e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_InsertValueAndCalcIntegral(t_eDSP_INTEGRAL_Ctx
 {
 	/* Local variable for return */
 	e_eDSP_INTEGRAL_RES l_eRes;
-	e_eDSP_MAXCHECK_RES l_eMaxRes;
-
-	/* Local Variable for calculation */
-	int64_t l_uDeltaIncr;
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_piIntegral ) )
@@ -104,68 +129,133 @@ e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_InsertValueAndCalcIntegral(t_eDSP_INTEGRAL_Ctx
             }
 			else
 			{
-                /* Check data validity */
-				if( 0u == p_timeFromLast )
+				l_eRes = eDSP_INTEGRAL_InsertValueCore(p_ptCtx, p_iValue, p_timeFromLast, p_piIntegral);
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_ProcessBlock(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, const int64_t* p_piValues,
+                                               const uint32_t* p_puTimeFromLast, const uint32_t p_uNValues,
+                                               int64_t* const p_piIntegral, uint32_t* const p_puNIntegral,
+                                               uint32_t* const p_puNProcessed)
+{
+	/* Local variable for return */
+	e_eDSP_INTEGRAL_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uNIntegral;
+	int64_t  l_iMin;
+	int64_t  l_iMax;
+	uint32_t l_uMinTime;
+	uint32_t l_uMaxTime;
+	int64_t  l_iAcc;
+	bool_t   l_bNoOvf;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piValues ) || ( NULL == p_puTimeFromLast ) || ( NULL == p_piIntegral ) ||
+		( NULL == p_puNIntegral ) || ( NULL == p_puNProcessed ) )
+	{
+		l_eRes = e_eDSP_INTEGRAL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_INTEGRAL_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_INTEGRAL_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_INTEGRAL_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( 0u == p_uNValues )
 				{
 					l_eRes = e_eDSP_INTEGRAL_RES_BADPARAM;
 				}
 				else
 				{
-					/* Insert data */
-					p_ptCtx->uPreviousVal = p_ptCtx->uCurrentVal;
-					p_ptCtx->uCurrentVal = p_iValue;
-					p_ptCtx->uTimeElapsFromCurToPre = p_timeFromLast;
+					/* Init variable */
+					l_uCnt = 0u;
+					l_uNIntegral = 0u;
+					l_eRes = e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE;
 
-					if( false == p_ptCtx->bHasCurrent )
-					{
-						/* first entry */
-						p_ptCtx->bHasCurrent = true;
-					}
-					else
+					l_bNoOvf = false;
+
+					if( e_eDSP_INTEGRAL_RULE_SIMPSON != p_ptCtx->eRule )
 					{
-						if( false == p_ptCtx->bHasPrev )
+						/* Pre-scan the block, when no time is zero and no partial integral can overflow the whole
+						   block is integrated with plain int64_t arithmetic. The first interval start from the
+						   current value of the context, so it is part of the range too */
+						if( true == p_ptCtx->bHasCurrent )
+						{
+							l_iMin = p_ptCtx->uCurrentVal;
+							l_iMax = p_ptCtx->uCurrentVal;
+						}
+						else
+						{
+							l_iMin = MAX_INT64VAL;
+							l_iMax = MIN_INT64VAL;
+						}
+
+						l_uMinTime = MAX_UINT32VAL;
+						l_uMaxTime = MIN_UINT32VAL;
+						eDSP_BLOCKSCAN_MinMaxI64(p_piValues, p_uNValues, &l_iMin, &l_iMax);
+						eDSP_BLOCKSCAN_MinMaxU32(p_puTimeFromLast, p_uNValues, &l_uMinTime, &l_uMaxTime);
+
+						if( ( 0u != l_uMinTime ) &&
+							( true == eDSP_INTEGRAL_AccToI64(p_ptCtx->iAccHigh, p_ptCtx->uAccLow, &l_iAcc) ) &&
+							( true == eDSP_INTEGRAL_IsBlockSafe(l_iAcc, l_iMin, l_iMax, l_uMaxTime, p_uNValues,
+							                                    eDSP_INTEGRAL_RuleUnit(p_ptCtx->eRule)) ) )
 						{
-							/* First time adding data */
-							p_ptCtx->bHasPrev = true;
+							l_bNoOvf = true;
 						}
 					}
 
-					/* Check if we can proceed with calculation */
-					if( false == p_ptCtx->bHasPrev )
+					if( true == l_bNoOvf )
 					{
-						/* Request more data */
-						l_eRes = e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE;
+						eDSP_INTEGRAL_ProcessBlockNoOvf(p_ptCtx, l_iAcc, p_piValues, p_puTimeFromLast, p_uNValues,
+						                                p_piIntegral, &l_uNIntegral);
+						l_uCnt = p_uNValues;
 					}
 					else
 					{
-						/* the integral operation is defined as follow:
-						* Sx   -> lim of h -> 0 of the function: SUM[ f(x)  * ( xh - x) ]
-						* Dx   -> lim of h -> 0 of the function: SUM[ f(xh) * ( xh - x) ]
-						* Mean -> lim of h -> 0 of the function: SUM[ ( (f(xh) - f(x))/2 ) * ( xh - x) ]
-						* when h is pretty small we can have a good aproximation
-						* --> our fun [vSx]:   Integral = Integral + previousvalue * timeelapsed
-						* --> our fun [vDx]:   Integral = Integral + currentvalue  * timeelapsed
-						* --> our fun [vMean]: Integral = Integral + ((currentvalue + previousvalue)/2) * timeelapsed
-						* */
-
-						l_eMaxRes = eDSP_MAXCHECK_MOLTIPI64Check(p_ptCtx->uCurrentVal, p_ptCtx->uTimeElapsFromCurToPre);
-						l_eRes = eDSP_INTEGRAL_MaxCheckResToINTEGRAL(l_eMaxRes);
-
-						if( e_eDSP_INTEGRAL_RES_OK == l_eRes )
+						/* Context is checked only once, every value of the block is processed without other
+						   check */
+						while( ( l_uCnt < p_uNValues ) && ( ( e_eDSP_INTEGRAL_RES_OK == l_eRes ) ||
+							   ( e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE == l_eRes ) ) )
 						{
-							l_uDeltaIncr = p_ptCtx->uCurrentVal * p_ptCtx->uTimeElapsFromCurToPre;
-
-							l_eMaxRes = eDSP_MAXCHECK_SUMI64Check(p_ptCtx->uIntegral, l_uDeltaIncr);
-							l_eRes = eDSP_INTEGRAL_MaxCheckResToINTEGRAL(l_eMaxRes);
+							l_eRes = eDSP_INTEGRAL_InsertValueCore(p_ptCtx, p_piValues[l_uCnt],
+							                                       p_puTimeFromLast[l_uCnt],
+							                                       &p_piIntegral[l_uNIntegral]);
 
 							if( e_eDSP_INTEGRAL_RES_OK == l_eRes )
 							{
-								/* calculate */
-								p_ptCtx->uIntegral = p_ptCtx->uIntegral + l_uDeltaIncr;
-								*p_piIntegral = p_ptCtx->uIntegral;
+								l_uNIntegral++;
 							}
+
+							/* Increase counter */
+							l_uCnt++;
 						}
 					}
+
+					/* Some value are integrated and the last one doesn't generate any error */
+					if( ( e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE == l_eRes ) && ( l_uNIntegral > 0u ) )
+					{
+						l_eRes = e_eDSP_INTEGRAL_RES_OK;
+					}
+
+					*p_puNIntegral = l_uNIntegral;
+					*p_puNProcessed = l_uCnt;
 				}
 			}
 		}
@@ -174,55 +264,300 @@ e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_InsertValueAndCalcIntegral(t_eDSP_INTEGRAL_Ctx
 	return l_eRes;
 }
 
+e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_SetOvfMode(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, e_eDSP_TYPE_OVFMODE p_eOvfMode)
+{
+	/* Local variable */
+	e_eDSP_INTEGRAL_RES l_eRes;
 
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_INTEGRAL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_INTEGRAL_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_INTEGRAL_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_INTEGRAL_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
+				{
+					l_eRes = e_eDSP_INTEGRAL_RES_BADPARAM;
+				}
+				else
+				{
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					l_eRes = e_eDSP_INTEGRAL_RES_OK;
+				}
+			}
+		}
+	}
 
-/***********************************************************************************************************************
- *  PRIVATE FUNCTION
- **********************************************************************************************************************/
-static bool_t eDSP_INTEGRAL_IsStatusStillCoherent(t_eDSP_INTEGRAL_Ctx* const p_ptCtx)
+	return l_eRes;
+}
+
+e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_GetSatCnt(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, uint32_t* const p_puSatCnt)
 {
-    /* Return local var */
-    bool_t l_eRes;
+	/* Local variable */
+	e_eDSP_INTEGRAL_RES l_eRes;
 
-	if( false == p_ptCtx->bHasCurrent )
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
 	{
-		/* No current value, no data present in the system */
-		if( ( true == p_ptCtx->bHasPrev ) || ( 0 != p_ptCtx->uPreviousVal ) || ( 0 != p_ptCtx->uCurrentVal ) ||
-			( 0u != p_ptCtx->uTimeElapsFromCurToPre ) || ( 0 != p_ptCtx->uIntegral ) )
+		l_eRes = e_eDSP_INTEGRAL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
 		{
-			l_eRes = false;
+			l_eRes = e_eDSP_INTEGRAL_RES_NOINITLIB;
 		}
 		else
 		{
-			l_eRes = true;
+            /* Check data coherence */
+            if( false == eDSP_INTEGRAL_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_INTEGRAL_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puSatCnt = p_ptCtx->uSatCnt;
+				l_eRes = e_eDSP_INTEGRAL_RES_OK;
+			}
 		}
 	}
+
+	return l_eRes;
+}
+
+e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_InsertValueCore(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, const int64_t p_iValue,
+                                                  const uint32_t p_timeFromLast, int64_t* const p_piIntegral)
+{
+	/* Local variable for return */
+	e_eDSP_INTEGRAL_RES l_eRes;
+	e_eDSP_MAXCHECK_RES l_eMaxRes;
+
+	/* Local Variable for calculation */
+	int64_t  l_iPairStart;
+	uint32_t l_uPairTime;
+	int64_t  l_iUnit;
+	int64_t  l_iAccHigh;
+	uint64_t l_uAccLow;
+	int64_t  l_iIntegral;
+
+	/* Check data validity */
+	if( 0u == p_timeFromLast )
+	{
+		l_eRes = e_eDSP_INTEGRAL_RES_BADPARAM;
+	}
 	else
 	{
-		/* has current value */
+		/* Value and time of the first interval of a Simpson pair, lost after the insertion */
+		l_iPairStart = p_ptCtx->uPreviousVal;
+		l_uPairTime = p_ptCtx->uTimeElapsFromCurToPre;
+
+		/* Insert data */
+		p_ptCtx->uPreviousVal = p_ptCtx->uCurrentVal;
+		p_ptCtx->uCurrentVal = p_iValue;
+		p_ptCtx->uTimeElapsFromCurToPre = p_timeFromLast;
+
+		if( false == p_ptCtx->bHasCurrent )
+		{
+			/* first entry */
+			p_ptCtx->bHasCurrent = true;
+		}
+		else
+		{
+			if( false == p_ptCtx->bHasPrev )
+			{
+				/* First time adding data */
+				p_ptCtx->bHasPrev = true;
+			}
+		}
+
+		/* Check if we can proceed with calculation */
 		if( false == p_ptCtx->bHasPrev )
 		{
-			/* No previous value */
-			if( ( 0 != p_ptCtx->uPreviousVal ) || ( 0u != p_ptCtx->uTimeElapsFromCurToPre ) )
+			/* Request more data */
+			l_eRes = e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE;
+		}
+		else
+		{
+			/* the integral operation is defined as follow:
+			* Sx   -> lim of h -> 0 of the function: SUM[ f(x)  * ( xh - x) ]
+			* Dx   -> lim of h -> 0 of the function: SUM[ f(xh) * ( xh - x) ]
+			* Mean -> lim of h -> 0 of the function: SUM[ ( (f(xh) + f(x))/2 ) * ( xh - x) ]
+			* when h is pretty small we can have a good aproximation
+			* --> our fun [vSx]:   Integral = Integral + previousvalue * timeelapsed
+			* --> our fun [vDx]:   Integral = Integral + currentvalue  * timeelapsed
+			* --> our fun [vMean]: Integral = Integral + ((currentvalue + previousvalue)/2) * timeelapsed
+			* Simpson fit a parabola on two interval with the same time h, and the pair is integrated as
+			* ( h / 3 ) * ( f(x) + 4 * f(xh) + f(x2h) ).
+			* The accumulator hold the integral multiplied by the unit of the rule ( 2 for the mean, 6 for Simpson ),
+			* so every step is exact and only the returned integral is divided.
+			* */
+			l_iUnit = eDSP_INTEGRAL_RuleUnit(p_ptCtx->eRule);
+			l_iAccHigh = p_ptCtx->iAccHigh;
+			l_uAccLow = p_ptCtx->uAccLow;
+			l_iIntegral = 0;
+
+			l_eMaxRes = eDSP_INTEGRAL_AddIncrement(p_ptCtx, l_iPairStart, l_uPairTime, &l_iAccHigh, &l_uAccLow);
+
+			if( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes )
 			{
-				l_eRes = false;
+				l_eMaxRes = eDSP_INTEGRAL_AccToIntegral(l_iAccHigh, l_uAccLow, l_iUnit, &l_iIntegral);
 			}
-			else
+
+			if( ( e_eDSP_MAXCHECK_RES_OK != l_eMaxRes ) && ( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode ) )
 			{
-				if( p_ptCtx->uCurrentVal != p_ptCtx->uIntegral )
+				/* Clamp the integral and the accumulator, the integral stay at the limit instead of stopping */
+				l_iIntegral = eDSP_SATARITH_DivI128(l_iAccHigh, l_uAccLow, l_iUnit, &p_ptCtx->uSatCnt);
+				l_iAccHigh = 0;
+				l_uAccLow = 0u;
+				l_eMaxRes = eDSP_MAXCHECK_MulAddI128(l_iIntegral, l_iUnit, &l_iAccHigh, &l_uAccLow);
+			}
+
+			if( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes )
+			{
+				/* The first interval of a Simpson pair is only a partial result, the pair is accumulated when the
+				   second one arrive */
+				if( ( e_eDSP_INTEGRAL_RULE_SIMPSON != p_ptCtx->eRule ) || ( true == p_ptCtx->bIsPairOpen ) )
 				{
-					l_eRes = false;
+					p_ptCtx->iAccHigh = l_iAccHigh;
+					p_ptCtx->uAccLow = l_uAccLow;
+				}
+
+				p_ptCtx->uIntegral = l_iIntegral;
+				*p_piIntegral = l_iIntegral;
+			}
+
+			l_eRes = eDSP_INTEGRAL_MaxCheckResToINTEGRAL(l_eMaxRes);
+
+			/* The value is inserted even when the integral overflow, so the pair advance anyway */
+			if( e_eDSP_INTEGRAL_RULE_SIMPSON == p_ptCtx->eRule )
+			{
+				if( true == p_ptCtx->bIsPairOpen )
+				{
+					p_ptCtx->bIsPairOpen = false;
 				}
 				else
 				{
-					l_eRes = true;
+					p_ptCtx->bIsPairOpen = true;
 				}
 			}
 		}
+	}
+
+	return l_eRes;
+}
+
+void eDSP_INTEGRAL_ClampCore(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, const int64_t p_iMin, const int64_t p_iMax,
+                             int64_t* const p_piIntegral)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eMaxRes;
+
+	/* Local Variable for calculation */
+	int64_t  l_iUnit;
+	int64_t  l_iBoundHigh;
+	uint64_t l_uBoundLow;
+
+	/* The integral is the accumulator divided by the unit of the rule and truncated toward zero, so when it is
+	   strictly inside the limits the accumulator is inside the limits multiplied by the unit too, and nothing need
+	   to be clamped */
+	if( ( p_ptCtx->uIntegral <= p_iMin ) || ( p_ptCtx->uIntegral >= p_iMax ) )
+	{
+		l_iUnit = eDSP_INTEGRAL_RuleUnit(p_ptCtx->eRule);
+
+		/* Clamp the integral */
+		if( p_ptCtx->uIntegral < p_iMin )
+		{
+			p_ptCtx->uIntegral = p_iMin;
+		}
+		else if( p_ptCtx->uIntegral > p_iMax )
+		{
+			p_ptCtx->uIntegral = p_iMax;
+		}
 		else
 		{
-			/* Has even a previous value */
-			if( 0u != p_ptCtx->uTimeElapsFromCurToPre )
+			/* On the limit, only the fraction in the accumulator can exceed it */
+		}
+
+		/* Clamp the accumulator to the limits multiplied by the unit of the rule, the product of two int64_t
+		   always fit in 128 bit so the bounds never overflow. With an open Simpson pair the accumulator hold only
+		   the closed pairs */
+		l_iBoundHigh = 0;
+		l_uBoundLow = 0u;
+		l_eMaxRes = eDSP_MAXCHECK_MulAddI128(p_iMin, l_iUnit, &l_iBoundHigh, &l_uBoundLow);
+
+		if( ( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes ) && ( ( p_ptCtx->iAccHigh < l_iBoundHigh ) ||
+			( ( p_ptCtx->iAccHigh == l_iBoundHigh ) && ( p_ptCtx->uAccLow < l_uBoundLow ) ) ) )
+		{
+			p_ptCtx->iAccHigh = l_iBoundHigh;
+			p_ptCtx->uAccLow = l_uBoundLow;
+		}
+
+		l_iBoundHigh = 0;
+		l_uBoundLow = 0u;
+		l_eMaxRes = eDSP_MAXCHECK_MulAddI128(p_iMax, l_iUnit, &l_iBoundHigh, &l_uBoundLow);
+
+		if( ( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes ) && ( ( p_ptCtx->iAccHigh > l_iBoundHigh ) ||
+			( ( p_ptCtx->iAccHigh == l_iBoundHigh ) && ( p_ptCtx->uAccLow > l_uBoundLow ) ) ) )
+		{
+			p_ptCtx->iAccHigh = l_iBoundHigh;
+			p_ptCtx->uAccLow = l_uBoundLow;
+		}
+	}
+
+	*p_piIntegral = p_ptCtx->uIntegral;
+}
+
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eDSP_INTEGRAL_IsStatusStillCoherent(t_eDSP_INTEGRAL_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+    bool_t l_eRes;
+
+    /* Local variable for calculation */
+    int64_t l_iUnit;
+
+	l_iUnit = eDSP_INTEGRAL_RuleUnit(p_ptCtx->eRule);
+
+	/* Check data validity */
+	if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) )
+	{
+		l_eRes = false;
+	}
+	else if( 0 == l_iUnit )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+		if( false == p_ptCtx->bHasCurrent )
+		{
+			/* No current value, no data present in the system */
+			if( ( true == p_ptCtx->bHasPrev ) || ( 0 != p_ptCtx->uPreviousVal ) || ( 0 != p_ptCtx->uCurrentVal ) ||
+				( 0u != p_ptCtx->uTimeElapsFromCurToPre ) || ( 0 != p_ptCtx->uIntegral ) ||
+				( true == p_ptCtx->bIsPairOpen ) || ( 0u != p_ptCtx->uAccLow ) || ( 0 != p_ptCtx->iAccHigh ) )
 			{
 				l_eRes = false;
 			}
@@ -231,6 +566,41 @@ static bool_t eDSP_INTEGRAL_IsStatusStillCoherent(t_eDSP_INTEGRAL_Ctx* const p_p
 				l_eRes = true;
 			}
 		}
+		else
+		{
+			/* has current value, its time was checked on insertion and is never zero */
+			if( 0u == p_ptCtx->uTimeElapsFromCurToPre )
+			{
+				l_eRes = false;
+			}
+			else if( false == p_ptCtx->bHasPrev )
+			{
+				/* No previous value, so nothing is integrated yet */
+				if( ( 0 != p_ptCtx->uPreviousVal ) || ( 0 != p_ptCtx->uIntegral ) ||
+					( true == p_ptCtx->bIsPairOpen ) || ( 0u != p_ptCtx->uAccLow ) || ( 0 != p_ptCtx->iAccHigh ) )
+				{
+					l_eRes = false;
+				}
+				else
+				{
+					l_eRes = true;
+				}
+			}
+			else
+			{
+				/* Has even a previous value. The accumulator is kept between l_iUnit times the int64_t limits, and
+				   only the Simpson rule leave a pair open */
+				if( ( p_ptCtx->iAccHigh > l_iUnit ) || ( p_ptCtx->iAccHigh < -l_iUnit ) ||
+					( ( true == p_ptCtx->bIsPairOpen ) && ( e_eDSP_INTEGRAL_RULE_SIMPSON != p_ptCtx->eRule ) ) )
+				{
+					l_eRes = false;
+				}
+				else
+				{
+					l_eRes = true;
+				}
+			}
+		}
 	}
 
     return l_eRes;
@@ -251,3 +621,336 @@ static e_eDSP_INTEGRAL_RES eDSP_INTEGRAL_MaxCheckResToINTEGRAL(const e_eDSP_MAXC
 
 	return l_eRet;
 }
+
+static int64_t eDSP_INTEGRAL_RuleUnit(const e_eDSP_INTEGRAL_RULE p_eRule)
+{
+	/* Local variable for return */
+	int64_t l_iUnit;
+
+	/* Denominator of the rule, zero when the rule is not valid */
+	switch( p_eRule )
+	{
+		case e_eDSP_INTEGRAL_RULE_LEFT:
+		case e_eDSP_INTEGRAL_RULE_RIGHT:
+		{
+			l_iUnit = 1;
+			break;
+		}
+
+		case e_eDSP_INTEGRAL_RULE_TRAPEZOID:
+		{
+			l_iUnit = 2;
+			break;
+		}
+
+		case e_eDSP_INTEGRAL_RULE_SIMPSON:
+		{
+			l_iUnit = 6;
+			break;
+		}
+
+		default:
+		{
+			l_iUnit = 0;
+			break;
+		}
+	}
+
+	return l_iUnit;
+}
+
+static e_eDSP_MAXCHECK_RES eDSP_INTEGRAL_AddIncrement(const t_eDSP_INTEGRAL_Ctx* const p_ptCtx,
+                                                      const int64_t p_iPairStart, const uint32_t p_uPairTime,
+                                                      int64_t* const p_piAccHigh, uint64_t* const p_puAccLow)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
+
+	/* Local variable for calculation */
+	int64_t l_iTime;
+	int64_t l_iPairTime;
+
+	/* Add the last interval to the accumulator, in unit of the rule. The accumulator is at most 6 times an int64_t
+	   and a single step add less than 2^100, so the 128 bit can't overflow; the check is kept anyway */
+	l_iTime = (int64_t) p_ptCtx->uTimeElapsFromCurToPre;
+	l_iPairTime = (int64_t) p_uPairTime;
+
+	switch( p_ptCtx->eRule )
+	{
+		case e_eDSP_INTEGRAL_RULE_LEFT:
+		{
+			l_eRes = eDSP_MAXCHECK_MulAddI128(p_ptCtx->uPreviousVal, l_iTime, p_piAccHigh, p_puAccLow);
+			break;
+		}
+
+		case e_eDSP_INTEGRAL_RULE_RIGHT:
+		{
+			l_eRes = eDSP_MAXCHECK_MulAddI128(p_ptCtx->uCurrentVal, l_iTime, p_piAccHigh, p_puAccLow);
+			break;
+		}
+
+		case e_eDSP_INTEGRAL_RULE_TRAPEZOID:
+		{
+			/* ( previous + current ) * time, in half */
+			l_eRes = eDSP_MAXCHECK_MulAddI128(p_ptCtx->uPreviousVal, l_iTime, p_piAccHigh, p_puAccLow);
+
+			if( e_eDSP_MAXCHECK_RES_OK == l_eRes )
+			{
+				l_eRes = eDSP_MAXCHECK_MulAddI128(p_ptCtx->uCurrentVal, l_iTime, p_piAccHigh, p_puAccLow);
+			}
+			break;
+		}
+
+		default:
+		{
+			if( false == p_ptCtx->bIsPairOpen )
+			{
+				/* First interval of the pair, trapezoid in sixth: 3 * time * ( previous + current ) */
+				l_eRes = eDSP_MAXCHECK_MulAddI128(p_ptCtx->uPreviousVal, 3 * l_iTime, p_piAccHigh, p_puAccLow);
+
+				if( e_eDSP_MAXCHECK_RES_OK == l_eRes )
+				{
+					l_eRes = eDSP_MAXCHECK_MulAddI128(p_ptCtx->uCurrentVal, 3 * l_iTime, p_piAccHigh, p_puAccLow);
+				}
+			}
+			else if( l_iPairTime == l_iTime )
+			{
+				/* Simpson in sixth: 2 * time * ( start + 4 * middle + end ) */
+				l_eRes = eDSP_MAXCHECK_MulAddI128(p_iPairStart, 2 * l_iTime, p_piAccHigh, p_puAccLow);
+
+				if( e_eDSP_MAXCHECK_RES_OK == l_eRes )
+				{
+					l_eRes = eDSP_MAXCHECK_MulAddI128(p_ptCtx->uPreviousVal, 8 * l_iTime, p_piAccHigh, p_puAccLow);
+				}
+
+				if( e_eDSP_MAXCHECK_RES_OK == l_eRes )
+				{
+					l_eRes = eDSP_MAXCHECK_MulAddI128(p_ptCtx->uCurrentVal, 2 * l_iTime, p_piAccHigh, p_puAccLow);
+				}
+			}
+			else
+			{
+				/* No parabola with two different times, trapezoid in sixth on both intervals */
+				l_eRes = eDSP_MAXCHECK_MulAddI128(p_iPairStart, 3 * l_iPairTime, p_piAccHigh, p_puAccLow);
+
+				if( e_eDSP_MAXCHECK_RES_OK == l_eRes )
+				{
+					l_eRes = eDSP_MAXCHECK_MulAddI128(p_ptCtx->uPreviousVal, 3 * ( l_iPairTime + l_iTime ),
+					                                  p_piAccHigh, p_puAccLow);
+				}
+
+				if( e_eDSP_MAXCHECK_RES_OK == l_eRes )
+				{
+					l_eRes = eDSP_MAXCHECK_MulAddI128(p_ptCtx->uCurrentVal, 3 * l_iTime, p_piAccHigh, p_puAccLow);
+				}
+			}
+			break;
+		}
+	}
+
+	return l_eRes;
+}
+
+static bool_t eDSP_INTEGRAL_AccToI64(const int64_t p_iAccHigh, const uint64_t p_uAccLow, int64_t* const p_piAcc)
+{
+    /* Return local var */
+    bool_t l_bRes;
+
+	if( ( 0 == p_iAccHigh ) && ( p_uAccLow <= (uint64_t) MAX_INT64VAL ) )
+	{
+		/* Positive value */
+		*p_piAcc = (int64_t) p_uAccLow;
+		l_bRes = true;
+	}
+	else if( ( -1 == p_iAccHigh ) && ( p_uAccLow > (uint64_t) MAX_INT64VAL ) )
+	{
+		/* Negative value, ~low is the absolute value minus one and can always be stored in an int64_t */
+		*p_piAcc = -( (int64_t) ( ~p_uAccLow ) ) - 1;
+		l_bRes = true;
+	}
+	else
+	{
+		/* Accumulator exceed the int64_t storage area */
+		l_bRes = false;
+	}
+
+	return l_bRes;
+}
+
+static e_eDSP_MAXCHECK_RES eDSP_INTEGRAL_AccToIntegral(const int64_t p_iAccHigh, const uint64_t p_uAccLow,
+                                                       const int64_t p_iUnit, int64_t* const p_piIntegral)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
+
+	/* Local variable for calculation */
+	int64_t l_iAcc;
+
+	/* Most of the time the accumulator fit an int64_t and the slow 128 bit division is not needed, both truncate
+	   toward zero */
+	if( true == eDSP_INTEGRAL_AccToI64(p_iAccHigh, p_uAccLow, &l_iAcc) )
+	{
+		*p_piIntegral = l_iAcc / p_iUnit;
+		l_eRes = e_eDSP_MAXCHECK_RES_OK;
+	}
+	else
+	{
+		l_eRes = eDSP_MAXCHECK_DivI128(p_iAccHigh, p_uAccLow, p_iUnit, p_piIntegral);
+	}
+
+	return l_eRes;
+}
+
+static bool_t eDSP_INTEGRAL_IsBlockSafe(const int64_t p_iAcc, const int64_t p_iMin, const int64_t p_iMax,
+                                        const uint32_t p_uMaxTime, const uint32_t p_uNValues, const int64_t p_iUnit)
+{
+    /* Return local var */
+	bool_t l_bRes;
+
+	/* Local variable for calculation */
+	int64_t l_iLow;
+	int64_t l_iHigh;
+	int64_t l_iDummy;
+
+	/* Every time is between 1 and p_uMaxTime, and every increment is the sum of up to p_iUnit values, so it is
+	   between min( p_iMin, 0 ) * p_iUnit * p_uMaxTime and max( p_iMax, 0 ) * p_iUnit * p_uMaxTime. A partial sum of
+	   up to p_uNValues increment is between p_uNValues times these bounds, so it is enough to check the two extremes
+	   of the accumulator */
+	l_iLow = p_iMin;
+	l_iHigh = p_iMax;
+
+	if( l_iLow > 0 )
+	{
+		l_iLow = 0;
+	}
+
+	if( l_iHigh < 0 )
+	{
+		l_iHigh = 0;
+	}
+
+	if( p_iMin > p_iMax )
+	{
+		/* Empty range, nothing was scanned */
+		l_bRes = false;
+	}
+	else if( ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_MulI64(l_iLow, p_iUnit, &l_iLow) ) ||
+			 ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_MulI64(l_iHigh, p_iUnit, &l_iHigh) ) ||
+			 ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_MulI64(l_iLow, (int64_t) p_uMaxTime, &l_iLow) ) ||
+			 ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_MulI64(l_iHigh, (int64_t) p_uMaxTime, &l_iHigh) ) ||
+			 ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_MulI64(l_iLow, (int64_t) p_uNValues, &l_iLow) ) ||
+			 ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_MulI64(l_iHigh, (int64_t) p_uNValues, &l_iHigh) ) ||
+			 ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_AddI64(p_iAcc, l_iLow, &l_iDummy) ) ||
+			 ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_AddI64(p_iAcc, l_iHigh, &l_iDummy) ) )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+		l_bRes = true;
+	}
+
+	return l_bRes;
+}
+
+static void eDSP_INTEGRAL_ProcessBlockNoOvf(t_eDSP_INTEGRAL_Ctx* const p_ptCtx, const int64_t p_iAcc,
+                                            const int64_t* p_piValues, const uint32_t* p_puTimeFromLast,
+                                            const uint32_t p_uNValues, int64_t* const p_piIntegral,
+                                            uint32_t* const p_puNIntegral)
+{
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uFirst;
+	uint32_t l_uNIntegral;
+	int64_t  l_iAcc;
+	int64_t  l_iWPrev;
+	int64_t  l_iWCur;
+	int64_t  l_iUnit;
+
+	/* Same steps of eDSP_INTEGRAL_InsertValueCore, but the block was proven safe: every increment and every partial
+	   accumulator fit an int64_t, so no check is needed and the saturation can't happen */
+	l_uFirst = 0u;
+
+	if( false == p_ptCtx->bHasCurrent )
+	{
+		/* The first value of all only start the integration */
+		p_ptCtx->uPreviousVal = p_ptCtx->uCurrentVal;
+		p_ptCtx->uCurrentVal = p_piValues[0u];
+		p_ptCtx->uTimeElapsFromCurToPre = p_puTimeFromLast[0u];
+		p_ptCtx->bHasCurrent = true;
+		l_uFirst = 1u;
+	}
+
+	l_uNIntegral = p_uNValues - l_uFirst;
+
+	if( l_uNIntegral > 0u )
+	{
+		/* Weight of the previous and of the current value of every interval, the unit of the rule is their sum */
+		l_iWPrev = 1;
+		l_iWCur = 1;
+
+		if( e_eDSP_INTEGRAL_RULE_RIGHT == p_ptCtx->eRule )
+		{
+			l_iWPrev = 0;
+		}
+		else if( e_eDSP_INTEGRAL_RULE_LEFT == p_ptCtx->eRule )
+		{
+			l_iWCur = 0;
+		}
+		else
+		{
+			/* Trapezoid, both values */
+		}
+
+		l_iUnit = l_iWPrev + l_iWCur;
+
+		/* The first interval start from the current value of the context, the others are independent so this loop
+		   can be vectorized */
+		p_piIntegral[0u] = ( ( l_iWPrev * p_ptCtx->uCurrentVal ) + ( l_iWCur * p_piValues[l_uFirst] ) ) *
+		                   ( (int64_t) p_puTimeFromLast[l_uFirst] );
+
+		for( l_uCnt = 1u; l_uCnt < l_uNIntegral; l_uCnt++ )
+		{
+			p_piIntegral[l_uCnt] = ( ( l_iWPrev * p_piValues[l_uFirst + l_uCnt - 1u] ) +
+			                         ( l_iWCur * p_piValues[l_uFirst + l_uCnt] ) ) *
+			                       ( (int64_t) p_puTimeFromLast[l_uFirst + l_uCnt] );
+		}
+
+		/* Prefix sum of the increments, starting from the accumulator */
+		l_iAcc = p_iAcc;
+
+		for( l_uCnt = 0u; l_uCnt < l_uNIntegral; l_uCnt++ )
+		{
+			l_iAcc += p_piIntegral[l_uCnt];
+			p_piIntegral[l_uCnt] = l_iAcc;
+		}
+
+		if( 1 != l_iUnit )
+		{
+			/* The trapezoid accumulate the double of the integral */
+			for( l_uCnt = 0u; l_uCnt < l_uNIntegral; l_uCnt++ )
+			{
+				p_piIntegral[l_uCnt] = p_piIntegral[l_uCnt] / 2;
+			}
+		}
+
+		/* Leave the context as after the insertion of the last value */
+		if( p_uNValues >= 2u )
+		{
+			p_ptCtx->uPreviousVal = p_piValues[p_uNValues - 2u];
+		}
+		else
+		{
+			p_ptCtx->uPreviousVal = p_ptCtx->uCurrentVal;
+		}
+
+		p_ptCtx->uCurrentVal = p_piValues[p_uNValues - 1u];
+		p_ptCtx->uTimeElapsFromCurToPre = p_puTimeFromLast[p_uNValues - 1u];
+		p_ptCtx->uIntegral = p_piIntegral[l_uNIntegral - 1u];
+		p_ptCtx->uAccLow = (uint64_t) l_iAcc;
+		p_ptCtx->iAccHigh = -( (int64_t) ( l_iAcc < 0 ) );
+		p_ptCtx->bHasPrev = true;
+	}
+
+	*p_puNIntegral = l_uNIntegral;
+}
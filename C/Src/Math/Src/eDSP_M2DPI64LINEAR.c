@@ -14,6 +14,28 @@
 #include "eDSP_S2DPI64LINEAR.h"
 #include "eDSP_MAXCHECK.h"
 
+#ifdef EDSP_CONFIG_X86SIMD
+    #include <immintrin.h>
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE DEFINE
+ **********************************************************************************************************************/
+/* FNV-1a 64 bit parameters, used for the checksum of the series of point */
+#define EDSP_M2DPI64LINEAR_CHKOFFSET                                               ( ( uint64_t ) 0xCBF29CE484222325u )
+#define EDSP_M2DPI64LINEAR_CHKPRIME                                                ( ( uint64_t ) 0x00000100000001B3u )
+
+#ifdef EDSP_CONFIG_X86SIMD
+    /* Limits of the exact double calculation of the SIMD kernels, and bits of 2^52 used to convert an integer lower
+       than 2^52 to double and back */
+    #define EDSP_M2DPI64LINEAR_EXACTLIM                                              ( ( int64_t ) 0x0010000000000000 )
+    #define EDSP_M2DPI64LINEAR_DBLBITS                                               ( ( int64_t ) 0x4330000000000000 )
+    #define EDSP_M2DPI64LINEAR_DBLMAGIC                                                          ( 4503599627370496.0 )
+    #define EDSP_M2DPI64LINEAR_PRODLIM                                                           ( 9007199254740992.0 )
+#endif
+
 
 
 /***********************************************************************************************************************
@@ -22,6 +44,45 @@
 static bool_t eDSP_M2DPI64LINEAR_IsStatusStillCoherent(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx);
 static e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_S2DPTResToM2DP(const e_eDSP_S2DPI64LINEAR_RES p_eRet);
 static bool_t eDSP_M2DPI64LINEAR_IsListValid(const t_eDSP_M2DPI64LINEAR_PointSeries p_tListCheck);
+static uint32_t eDSP_M2DPI64LINEAR_FindSegment(const t_eDSP_TYPE_2DPI64* p_ptPoints, const uint32_t p_uNumPoint,
+                                               const int64_t p_iX);
+static uint64_t eDSP_M2DPI64LINEAR_CalcChecksum(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries);
+static void eDSP_M2DPI64LINEAR_CalcSegment(const t_eDSP_TYPE_2DPI64 p_tP1, const t_eDSP_TYPE_2DPI64 p_tP2,
+                                           t_eDSP_M2DPI64LINEAR_Segment* const p_ptSeg);
+static int64_t eDSP_M2DPI64LINEAR_EvalSegment(const t_eDSP_M2DPI64LINEAR_Segment* p_ptSeg, const int64_t p_iX1,
+                                              const int64_t p_iX);
+static bool_t eDSP_M2DPI64LINEAR_IsSegTableValid(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx);
+static void eDSP_M2DPI64LINEAR_CalcGrid(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                        t_eDSP_M2DPI64LINEAR_Grid* const p_ptGrid);
+static bool_t eDSP_M2DPI64LINEAR_IsGridValid(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx);
+static uint32_t eDSP_M2DPI64LINEAR_GetSegment(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                              const t_eDSP_M2DPI64LINEAR_Grid* p_ptGrid, const int64_t p_iX);
+static e_eDSP_S2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_LinearizeSeries(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                                                   const t_eDSP_M2DPI64LINEAR_Grid* p_ptGrid,
+                                                                   const int64_t p_iX, int64_t* const p_piY);
+static uint32_t eDSP_M2DPI64LINEAR_FingerSegment(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                                 const uint32_t p_uFinger, const int64_t p_iX);
+static e_eDSP_S2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_LinearizeSegment(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx,
+                                                                    const uint32_t p_uIndx, const int64_t p_iX,
+                                                                    int64_t* const p_piY);
+static bool_t eDSP_M2DPI64LINEAR_ResampleStep(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                              const uint32_t p_uShift, const uint32_t p_uNOutPoint,
+                                              const uint64_t p_uMaxError, t_eDSP_TYPE_2DPI64* const p_ptOutBuffer);
+#ifdef EDSP_CONFIG_X86SIMD
+static uint32_t eDSP_M2DPI64LINEAR_BatchSimd(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx, const int64_t* p_piX,
+                                             const uint32_t p_uNValues, int64_t* const p_piY,
+                                             uint32_t* const p_puIndx, e_eDSP_S2DPI64LINEAR_RES* const p_peRes);
+static uint32_t eDSP_M2DPI64LINEAR_BatchLanes(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx, const int64_t* p_piX,
+                                              int64_t* const p_piY, const int64_t* p_piIndx, const uint32_t p_uOkMask,
+                                              const uint32_t p_uNLanes, uint32_t* const p_puIndx,
+                                              e_eDSP_S2DPI64LINEAR_RES* const p_peRes);
+static uint32_t eDSP_M2DPI64LINEAR_BatchAvx2(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx, const int64_t* p_piX,
+                                             const uint32_t p_uNValues, int64_t* const p_piY,
+                                             uint32_t* const p_puIndx, e_eDSP_S2DPI64LINEAR_RES* const p_peRes);
+static uint32_t eDSP_M2DPI64LINEAR_BatchAvx512(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx, const int64_t* p_piX,
+                                               const uint32_t p_uNValues, int64_t* const p_piY,
+                                               uint32_t* const p_puIndx, e_eDSP_S2DPI64LINEAR_RES* const p_peRes);
+#endif
 
 
 
@@ -53,7 +114,13 @@ e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_InitCtx(t_eDSP_M2DPI64LINEAR_Ctx* co
         {
             /* Initialize internal status */
             p_ptCtx->bIsInit = true;
+            p_ptCtx->eOvfMode = e_eDSP_TYPE_OVFMODE_ERROR;
+            p_ptCtx->uSatCnt = 0u;
             p_ptCtx->tPoinSeries = p_tSeries;
+            p_ptCtx->ptSegTable = NULL;
+            eDSP_M2DPI64LINEAR_CalcGrid(p_tSeries, &p_ptCtx->tGrid);
+            p_ptCtx->uLastSegment = 0u;
+            p_ptCtx->uSeriesChecksum = eDSP_M2DPI64LINEAR_CalcChecksum(p_tSeries);
 
 			/* All OK */
             l_eRes = e_eDSP_M2DPI64LINEAR_RES_OK;
@@ -90,10 +157,7 @@ e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_Linearize(t_eDSP_M2DPI64LINEAR_Ctx*
 	e_eDSP_S2DPI64LINEAR_RES l_eSingleRes;
 
 	/* Local variable for calculation */
-	t_eDSP_TYPE_2DPI64 l_tPFirst;
-	t_eDSP_TYPE_2DPI64 l_tPSecond;
 	uint32_t l_uIndx;
-	bool_t l_bFound;
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_puY ) )
@@ -116,46 +180,103 @@ e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_Linearize(t_eDSP_M2DPI64LINEAR_Ctx*
             }
 			else
 			{
-				/* Init vaiable */
-				l_uIndx = 0u;
-
 				/* Find the two point where linearize */
-				if( p_uX <= p_ptCtx->tPoinSeries.ptPointArray[0u].uX )
-				{
-					/* point request is pre data  */
-					l_tPFirst = p_ptCtx->tPoinSeries.ptPointArray[0u];
-					l_tPSecond = p_ptCtx->tPoinSeries.ptPointArray[1u];
-				}
-				else if( p_uX >= p_ptCtx->tPoinSeries.ptPointArray[ ( p_ptCtx->tPoinSeries.uNumPoint - 1u ) ].uX )
+				l_uIndx = eDSP_M2DPI64LINEAR_GetSegment(p_ptCtx->tPoinSeries, &p_ptCtx->tGrid, p_uX);
+
+				/* Linearize */
+				l_eSingleRes = eDSP_M2DPI64LINEAR_LinearizeSegment(p_ptCtx, l_uIndx, p_uX, p_puY);
+				l_eRes = eDSP_M2DPI64LINEAR_S2DPTResToM2DP(l_eSingleRes);
+			}
+		}
+    }
+
+	return l_eRes;
+}
+
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_LinearizeBatch(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx,
+                                                           const int64_t* p_piX, const uint32_t p_uNValues,
+                                                           int64_t* const p_piY,
+                                                           uint32_t* const p_puNLinearized)
+{
+	/* Local variable for return */
+	e_eDSP_M2DPI64LINEAR_RES l_eRes;
+	e_eDSP_S2DPI64LINEAR_RES l_eSingleRes;
+
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uIndx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_piX ) || ( NULL == p_piY ) || ( NULL == p_puNLinearized ) )
+	{
+		l_eRes = e_eDSP_M2DPI64LINEAR_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_M2DPI64LINEAR_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_M2DPI64LINEAR_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( 0u == p_uNValues )
 				{
-					/* point request is post data  */
-					l_tPFirst = p_ptCtx->tPoinSeries.ptPointArray[( p_ptCtx->tPoinSeries.uNumPoint - 2u )];
-					l_tPSecond = p_ptCtx->tPoinSeries.ptPointArray[( p_ptCtx->tPoinSeries.uNumPoint - 1u )];
+					l_eRes = e_eDSP_M2DPI64LINEAR_RES_BADPARAM;
 				}
 				else
 				{
-					/* Init */
-					l_bFound = false;
+					/* Init variable */
+					l_uCnt = 0u;
+					l_uIndx = p_ptCtx->uLastSegment;
+					l_eSingleRes = e_eDSP_S2DPI64LINEAR_RES_OK;
+
+#ifdef EDSP_CONFIG_X86SIMD
+					/* The kernels give the same result of the exact calculation, not of the slope table */
+					if( NULL == p_ptCtx->ptSegTable )
+					{
+						l_uCnt = eDSP_M2DPI64LINEAR_BatchSimd(p_ptCtx, p_piX, p_uNValues, p_piY, &l_uIndx,
+						                                      &l_eSingleRes);
+					}
+#endif
 
-					/* point request is inside data  */
-					while( ( l_uIndx < p_ptCtx->tPoinSeries.uNumPoint ) && ( false == l_bFound ) )
+					/* Context is checked only once, every value of the block is processed without other check */
+					while( ( l_uCnt < p_uNValues ) && ( e_eDSP_S2DPI64LINEAR_RES_OK == l_eSingleRes ) )
 					{
-						if( ( p_uX >= p_ptCtx->tPoinSeries.ptPointArray[l_uIndx].uX ) &&
-						    ( p_uX <= p_ptCtx->tPoinSeries.ptPointArray[l_uIndx + 1u].uX ) )
+						/* A uniform grid doesn't need the last segment */
+						if( e_eDSP_M2DPI64LINEAR_GRID_NONE == p_ptCtx->tGrid.eType )
+						{
+							l_uIndx = eDSP_M2DPI64LINEAR_FingerSegment(p_ptCtx->tPoinSeries, l_uIndx,
+							                                           p_piX[l_uCnt]);
+						}
+						else
 						{
-							l_tPFirst = p_ptCtx->tPoinSeries.ptPointArray[l_uIndx];
-							l_tPSecond = p_ptCtx->tPoinSeries.ptPointArray[l_uIndx + 1u];
-							l_bFound = true;
+							l_uIndx = eDSP_M2DPI64LINEAR_GetSegment(p_ptCtx->tPoinSeries, &p_ptCtx->tGrid,
+							                                        p_piX[l_uCnt]);
 						}
 
-						/* Increase counter */
-						l_uIndx++;
+						l_eSingleRes = eDSP_M2DPI64LINEAR_LinearizeSegment(p_ptCtx, l_uIndx, p_piX[l_uCnt],
+						                                                   &p_piY[l_uCnt]);
+
+						if( e_eDSP_S2DPI64LINEAR_RES_OK == l_eSingleRes )
+						{
+							/* Increase counter */
+							l_uCnt++;
+						}
 					}
-				}
 
-				/* Linearize */
-				l_eSingleRes = eDSP_S2DPI64LINEAR_Linearize(l_tPFirst, l_tPSecond, p_uX, p_puY);
-				l_eRes = eDSP_M2DPI64LINEAR_S2DPTResToM2DP(l_eSingleRes);
+					p_ptCtx->uLastSegment = l_uIndx;
+					*p_puNLinearized = l_uCnt;
+					l_eRes = eDSP_M2DPI64LINEAR_S2DPTResToM2DP(l_eSingleRes);
+				}
 			}
 		}
     }
@@ -163,102 +284,1223 @@ e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_Linearize(t_eDSP_M2DPI64LINEAR_Ctx*
 	return l_eRes;
 }
 
-
-
-/***********************************************************************************************************************
- *  PRIVATE FUNCTION
- **********************************************************************************************************************/
-static bool_t eDSP_M2DPI64LINEAR_IsStatusStillCoherent(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx)
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_SetOvfMode(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx,
+                                                       e_eDSP_TYPE_OVFMODE p_eOvfMode)
 {
-    /* Return local var */
-    bool_t l_eRes;
+	/* Local variable */
+	e_eDSP_M2DPI64LINEAR_RES l_eRes;
 
-	/* We must check only the coherence of the point array */
-	l_eRes = eDSP_M2DPI64LINEAR_IsListValid(p_ptCtx->tPoinSeries);
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_M2DPI64LINEAR_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eDSP_M2DPI64LINEAR_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence */
+            if( false == eDSP_M2DPI64LINEAR_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_eOvfMode ) )
+				{
+					l_eRes = e_eDSP_M2DPI64LINEAR_RES_BADPARAM;
+				}
+				else
+				{
+					p_ptCtx->eOvfMode = p_eOvfMode;
+					p_ptCtx->uSatCnt = 0u;
+					l_eRes = e_eDSP_M2DPI64LINEAR_RES_OK;
+				}
+			}
+		}
+	}
 
-    return l_eRes;
+	return l_eRes;
 }
 
-static e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_S2DPTResToM2DP(const e_eDSP_S2DPI64LINEAR_RES p_eRet)
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_GetSatCnt(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx,
+                                                      uint32_t* const p_puSatCnt)
 {
-    /* Return local var */
-	e_eDSP_M2DPI64LINEAR_RES l_eRet;
+	/* Local variable */
+	e_eDSP_M2DPI64LINEAR_RES l_eRes;
 
-	switch( p_eRet )
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSatCnt ) )
 	{
-		case e_eDSP_S2DPI64LINEAR_RES_OK:
+		l_eRes = e_eDSP_M2DPI64LINEAR_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
 		{
-			l_eRet = e_eDSP_M2DPI64LINEAR_RES_OK;
-			break;
+			l_eRes = e_eDSP_M2DPI64LINEAR_RES_NOINITLIB;
 		}
-
-		case e_eDSP_S2DPI64LINEAR_RES_BADPOINTER:
+		else
 		{
-			l_eRet = e_eDSP_M2DPI64LINEAR_RES_BADPOINTER;
-			break;
+            /* Check data coherence */
+            if( false == eDSP_M2DPI64LINEAR_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX;
+            }
+			else
+			{
+				*p_puSatCnt = p_ptCtx->uSatCnt;
+				l_eRes = e_eDSP_M2DPI64LINEAR_RES_OK;
+			}
 		}
+	}
 
-		case e_eDSP_S2DPI64LINEAR_RES_BADPARAM:
+	return l_eRes;
+}
+
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_SetSlopeTable(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx,
+                                                          t_eDSP_M2DPI64LINEAR_Segment* p_ptSegBuffer,
+                                                          const uint32_t p_uSegBuffLen)
+{
+	/* Local variable */
+	e_eDSP_M2DPI64LINEAR_RES l_eRes;
+	uint32_t l_uIndx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptSegBuffer ) )
+	{
+		l_eRes = e_eDSP_M2DPI64LINEAR_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
 		{
-			l_eRet = e_eDSP_M2DPI64LINEAR_RES_BADPARAM;
-			break;
+			l_eRes = e_eDSP_M2DPI64LINEAR_RES_NOINITLIB;
 		}
-
-		case e_eDSP_S2DPI64LINEAR_RES_OVERFLOW:
+		else
 		{
-			l_eRet = e_eDSP_M2DPI64LINEAR_RES_OVERFLOW;
-			break;
+            /* Check data coherence */
+            if( false == eDSP_M2DPI64LINEAR_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX;
+            }
+			else
+			{
+				/* Check data validity */
+				if( ( p_ptCtx->tPoinSeries.uNumPoint - 1u ) != p_uSegBuffLen )
+				{
+					l_eRes = e_eDSP_M2DPI64LINEAR_RES_BADPARAM;
+				}
+				else
+				{
+					for( l_uIndx = 0u; l_uIndx < p_uSegBuffLen; l_uIndx++ )
+					{
+						eDSP_M2DPI64LINEAR_CalcSegment(p_ptCtx->tPoinSeries.ptPointArray[l_uIndx],
+						                               p_ptCtx->tPoinSeries.ptPointArray[l_uIndx + 1u],
+						                               &p_ptSegBuffer[l_uIndx]);
+					}
+
+					p_ptCtx->ptSegTable = p_ptSegBuffer;
+					l_eRes = e_eDSP_M2DPI64LINEAR_RES_OK;
+				}
+			}
 		}
+	}
 
-		default:
+	return l_eRes;
+}
+
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_Verify(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eDSP_M2DPI64LINEAR_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eDSP_M2DPI64LINEAR_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
 		{
-			l_eRet = e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX;
+			l_eRes = e_eDSP_M2DPI64LINEAR_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check data coherence, then the whole series */
+            if( ( false == eDSP_M2DPI64LINEAR_IsStatusStillCoherent(p_ptCtx) ) ||
+                ( false == eDSP_M2DPI64LINEAR_IsListValid(p_ptCtx->tPoinSeries) ) ||
+                ( p_ptCtx->uSeriesChecksum != eDSP_M2DPI64LINEAR_CalcChecksum(p_ptCtx->tPoinSeries) ) ||
+                ( false == eDSP_M2DPI64LINEAR_IsGridValid(p_ptCtx) ) ||
+                ( false == eDSP_M2DPI64LINEAR_IsSegTableValid(p_ptCtx) ) )
+            {
+                l_eRes = e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX;
+            }
+			else
+			{
+				l_eRes = e_eDSP_M2DPI64LINEAR_RES_OK;
+			}
 		}
 	}
 
-
-	return l_eRet;
+	return l_eRes;
 }
-
-static bool_t eDSP_M2DPI64LINEAR_IsListValid(const t_eDSP_M2DPI64LINEAR_PointSeries p_tListCheck)
+e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_ResampleUniform(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                                            const uint64_t p_uMaxError,
+                                                            t_eDSP_TYPE_2DPI64* const p_ptOutBuffer,
+                                                            const uint32_t p_uOutBuffLen,
+                                                            uint32_t* const p_puNOutPoint)
 {
-    /* Return local var */
-	bool_t l_bRet;
+	/* Local variable */
+	e_eDSP_M2DPI64LINEAR_RES l_eRes;
+	bool_t l_bFound;
 
 	/* Local variable for calculation */
-	uint32_t l_uIndx;
+	uint64_t l_uSpan;
+	uint64_t l_uNStep;
+	uint32_t l_uShift;
 
-	/* Check NULL pointer */
-	if( NULL == p_tListCheck.ptPointArray )
+	/* Check pointer validity */
+	if( ( NULL == p_tSeries.ptPointArray ) || ( NULL == p_ptOutBuffer ) || ( NULL == p_puNOutPoint ) )
 	{
-		l_bRet = false;
+		l_eRes = e_eDSP_M2DPI64LINEAR_RES_BADPOINTER;
 	}
 	else
 	{
-		/* We need al least three point to linearize, in case of two point use the single point function */
-		if( p_tListCheck.uNumPoint < 3u )
+		/* Check data validity */
+		if( ( false == eDSP_M2DPI64LINEAR_IsListValid(p_tSeries) ) || ( p_uOutBuffLen < 3u ) )
 		{
-			l_bRet = false;
+			l_eRes = e_eDSP_M2DPI64LINEAR_RES_BADPARAM;
 		}
 		else
 		{
-			/* Init vaiable */
-			l_uIndx = 0u;
-			l_bRet = true;
+			/* The series is ordered, so the span is positive and fit an uint64_t even when the int64_t overflow */
+			l_uSpan = ( (uint64_t) p_tSeries.ptPointArray[p_tSeries.uNumPoint - 1u].uX ) -
+			          ( (uint64_t) p_tSeries.ptPointArray[0u].uX );
+			l_bFound = false;
+			l_uShift = 63u;
 
-			/* Needs to check that the list is in order and that two point dosen't have any commonx x values */
-			while( ( l_uIndx < ( p_tListCheck.uNumPoint - 1u ) ) && ( true == l_bRet )  )
+			/* Try from the widest step, every halving of the step double the numbers of point of the grid, so stop
+			   when they don't fit the buffer anymore. A grid of N point cover ( N - 1 ) step and must reach the last
+			   X of the series, so N = ceil( span / step ) + 1 */
+			do
 			{
-				if( p_tListCheck.ptPointArray[l_uIndx].uX >= p_tListCheck.ptPointArray[l_uIndx + 1u].uX )
+				l_uShift--;
+				l_uNStep = ( l_uSpan - 1u ) >> l_uShift;
+
+				if( ( l_uNStep >= 1u ) && ( l_uNStep <= ( (uint64_t) p_uOutBuffLen - 2u ) ) )
 				{
-					l_bRet = false;
+					l_bFound = eDSP_M2DPI64LINEAR_ResampleStep(p_tSeries, l_uShift, (uint32_t) ( l_uNStep + 2u ),
+					                                           p_uMaxError, p_ptOutBuffer);
 				}
+			}
+			while( ( false == l_bFound ) && ( l_uShift > 0u ) && ( l_uNStep <= ( (uint64_t) p_uOutBuffLen - 2u ) ) );
 
-				/* Increase counter */
-				l_uIndx++;
+			if( false == l_bFound )
+			{
+				l_eRes = e_eDSP_M2DPI64LINEAR_RES_BADPARAM;
+			}
+			else
+			{
+				*p_puNOutPoint = (uint32_t) ( l_uNStep + 2u );
+				l_eRes = e_eDSP_M2DPI64LINEAR_RES_OK;
 			}
 		}
 	}
 
-	return l_bRet;
-}
\ No newline at end of file
+	return l_eRes;
+}
+
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eDSP_M2DPI64LINEAR_IsStatusStillCoherent(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+    bool_t l_eRes;
+
+	/* Check data validity. The series was validated during the init and is checked again only by
+	   eDSP_M2DPI64LINEAR_Verify, here only its size is checked. The segment search never read outside the series,
+	   so a corrupted series can give a wrong value but not a wrong memory access */
+	if( ( e_eDSP_TYPE_OVFMODE_ERROR != p_ptCtx->eOvfMode ) && ( e_eDSP_TYPE_OVFMODE_SATURATE != p_ptCtx->eOvfMode ) )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+		if( ( NULL == p_ptCtx->tPoinSeries.ptPointArray ) || ( p_ptCtx->tPoinSeries.uNumPoint < 3u ) ||
+			( p_ptCtx->uLastSegment > ( p_ptCtx->tPoinSeries.uNumPoint - 2u ) ) )
+		{
+			l_eRes = false;
+		}
+		else
+		{
+			switch( p_ptCtx->tGrid.eType )
+			{
+				case e_eDSP_M2DPI64LINEAR_GRID_NONE:
+				{
+					l_eRes = true;
+					break;
+				}
+
+				case e_eDSP_M2DPI64LINEAR_GRID_SHIFT:
+				{
+					l_eRes = ( p_ptCtx->tGrid.uShift < 64u );
+					break;
+				}
+
+				case e_eDSP_M2DPI64LINEAR_GRID_RECIP:
+				case e_eDSP_M2DPI64LINEAR_GRID_DIV:
+				{
+					l_eRes = ( 0u != p_ptCtx->tGrid.uStep );
+					break;
+				}
+
+				default:
+				{
+					l_eRes = false;
+				}
+			}
+		}
+	}
+
+    return l_eRes;
+}
+
+static e_eDSP_M2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_S2DPTResToM2DP(const e_eDSP_S2DPI64LINEAR_RES p_eRet)
+{
+    /* Return local var */
+	e_eDSP_M2DPI64LINEAR_RES l_eRet;
+
+	switch( p_eRet )
+	{
+		case e_eDSP_S2DPI64LINEAR_RES_OK:
+		{
+			l_eRet = e_eDSP_M2DPI64LINEAR_RES_OK;
+			break;
+		}
+
+		case e_eDSP_S2DPI64LINEAR_RES_BADPOINTER:
+		{
+			l_eRet = e_eDSP_M2DPI64LINEAR_RES_BADPOINTER;
+			break;
+		}
+
+		case e_eDSP_S2DPI64LINEAR_RES_BADPARAM:
+		{
+			l_eRet = e_eDSP_M2DPI64LINEAR_RES_BADPARAM;
+			break;
+		}
+
+		case e_eDSP_S2DPI64LINEAR_RES_OVERFLOW:
+		{
+			l_eRet = e_eDSP_M2DPI64LINEAR_RES_OVERFLOW;
+			break;
+		}
+
+		default:
+		{
+			l_eRet = e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX;
+		}
+	}
+
+
+	return l_eRet;
+}
+
+static bool_t eDSP_M2DPI64LINEAR_IsListValid(const t_eDSP_M2DPI64LINEAR_PointSeries p_tListCheck)
+{
+    /* Return local var */
+	bool_t l_bRet;
+
+	/* Local variable for calculation */
+	uint32_t l_uIndx;
+
+	/* Check NULL pointer */
+	if( NULL == p_tListCheck.ptPointArray )
+	{
+		l_bRet = false;
+	}
+	else
+	{
+		/* We need al least three point to linearize, in case of two point use the single point function */
+		if( p_tListCheck.uNumPoint < 3u )
+		{
+			l_bRet = false;
+		}
+		else
+		{
+			/* Init vaiable */
+			l_uIndx = 0u;
+			l_bRet = true;
+
+			/* Needs to check that the list is in order and that two point dosen't have any commonx x values */
+			while( ( l_uIndx < ( p_tListCheck.uNumPoint - 1u ) ) && ( true == l_bRet )  )
+			{
+				if( p_tListCheck.ptPointArray[l_uIndx].uX >= p_tListCheck.ptPointArray[l_uIndx + 1u].uX )
+				{
+					l_bRet = false;
+				}
+
+				/* Increase counter */
+				l_uIndx++;
+			}
+		}
+	}
+
+	return l_bRet;
+}
+
+static uint32_t eDSP_M2DPI64LINEAR_FindSegment(const t_eDSP_TYPE_2DPI64* p_ptPoints, const uint32_t p_uNumPoint,
+                                               const int64_t p_iX)
+{
+	/* Local variable for calculation */
+	uint32_t l_uBase;
+	uint32_t l_uLen;
+	uint32_t l_uHalf;
+	uint32_t l_uMask;
+
+	/* Here the first X is lower than p_iX and the last one is greater, search the last point with an X lower than
+	   p_iX, so p_iX is in ( X[i], X[i + 1] ] like with a linear scan. The list is ordered by IsListValid, so a binary
+	   search on [ 0, p_uNumPoint - 1 ) is enough. The step is selected with a mask instead of a branch, so the loop
+	   has always log2( p_uNumPoint ) iteration and no misprediction */
+	l_uBase = 0u;
+	l_uLen = p_uNumPoint - 1u;
+
+	while( l_uLen > 1u )
+	{
+		l_uHalf = l_uLen / 2u;
+		l_uMask = 0u - ( (uint32_t) ( p_ptPoints[l_uBase + l_uHalf].uX < p_iX ) );
+		l_uBase += l_uHalf & l_uMask;
+		l_uLen -= l_uHalf;
+	}
+
+	return l_uBase;
+}
+
+static uint64_t eDSP_M2DPI64LINEAR_CalcChecksum(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries)
+{
+	/* Local variable for calculation */
+	uint64_t l_uChecksum;
+	uint32_t l_uIndx;
+
+	/* FNV-1a on 64 bit words instead of bytes, every coordinate is mixed in the checksum together with the numbers
+	   of point */
+	l_uChecksum = ( EDSP_M2DPI64LINEAR_CHKOFFSET ^ ( (uint64_t) p_tSeries.uNumPoint ) ) * EDSP_M2DPI64LINEAR_CHKPRIME;
+
+	for( l_uIndx = 0u; l_uIndx < p_tSeries.uNumPoint; l_uIndx++ )
+	{
+		l_uChecksum = ( l_uChecksum ^ ( (uint64_t) p_tSeries.ptPointArray[l_uIndx].uX ) ) * EDSP_M2DPI64LINEAR_CHKPRIME;
+		l_uChecksum = ( l_uChecksum ^ ( (uint64_t) p_tSeries.ptPointArray[l_uIndx].uY ) ) * EDSP_M2DPI64LINEAR_CHKPRIME;
+	}
+
+	return l_uChecksum;
+}
+
+static void eDSP_M2DPI64LINEAR_CalcSegment(const t_eDSP_TYPE_2DPI64 p_tP1, const t_eDSP_TYPE_2DPI64 p_tP2,
+                                           t_eDSP_M2DPI64LINEAR_Segment* const p_ptSeg)
+{
+	/* Local variable */
+	e_eDSP_MAXCHECK_RES l_eMaxRes;
+
+	/* Local variable for calculation */
+	int64_t  l_iDx;
+	int64_t  l_iDy;
+	int64_t  l_iSlope;
+	int64_t  l_iProd;
+	int64_t  l_iEnd;
+	uint64_t l_uDelta;
+
+	/* Slope in Q32.32 -> m = ( ( Yp2 - Yp1 ) * 2^32 ) / ( Xp2 - Xp1 ), the intercept is Yp1 so that the segment is
+	   evaluated from its first X, and the distance from it is never greater than Xp2 - Xp1. The truncation of the
+	   slope is multiplied by the distance, so only segment narrower than 2^32 are kept inside one unit of error */
+	p_ptSeg->iSlopeQ32 = 0;
+	p_ptSeg->iIntercept = p_tP1.uY;
+	p_ptSeg->bIsValid = false;
+
+	l_eMaxRes = eDSP_MAXCHECK_SubI64(p_tP2.uX, p_tP1.uX, &l_iDx);
+
+	if( ( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes ) && ( l_iDx > ( (int64_t) MAX_UINT32VAL ) ) )
+	{
+		l_eMaxRes = e_eDSP_MAXCHECK_OVERFLOW;
+	}
+
+	if( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes )
+	{
+		l_eMaxRes = eDSP_MAXCHECK_SubI64(p_tP2.uY, p_tP1.uY, &l_iDy);
+	}
+
+	if( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes )
+	{
+		l_eMaxRes = eDSP_MAXCHECK_MulDivI64(l_iDy, ( (int64_t) 1 ) << 32u, l_iDx, &l_iSlope);
+	}
+
+	if( ( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes ) && ( MIN_INT64VAL != l_iSlope ) )
+	{
+		/* The product of EvalSegment is calculated on the absolute value of the slope, and grow with the distance
+		   from the first X, so it is enough to check it at the end of the segment */
+		if( l_iSlope < 0 )
+		{
+			l_iSlope = -l_iSlope;
+		}
+
+		l_eMaxRes = eDSP_MAXCHECK_MulI64(l_iSlope, l_iDx, &l_iProd);
+
+		if( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes )
+		{
+			/* The rounded result at the end of the segment must fit too */
+			l_uDelta = ( ( (uint64_t) l_iProd ) + 0x80000000u ) >> 32u;
+
+			if( p_tP2.uY < p_tP1.uY )
+			{
+				l_eMaxRes = eDSP_MAXCHECK_SubI64(p_tP1.uY, (int64_t) l_uDelta, &l_iEnd);
+			}
+			else
+			{
+				l_eMaxRes = eDSP_MAXCHECK_AddI64(p_tP1.uY, (int64_t) l_uDelta, &l_iEnd);
+			}
+
+			if( e_eDSP_MAXCHECK_RES_OK == l_eMaxRes )
+			{
+				p_ptSeg->iSlopeQ32 = l_iSlope;
+
+				if( p_tP2.uY < p_tP1.uY )
+				{
+					p_ptSeg->iSlopeQ32 = -l_iSlope;
+				}
+
+				p_ptSeg->bIsValid = true;
+			}
+		}
+	}
+}
+
+static int64_t eDSP_M2DPI64LINEAR_EvalSegment(const t_eDSP_M2DPI64LINEAR_Segment* p_ptSeg, const int64_t p_iX1,
+                                              const int64_t p_iX)
+{
+	/* Local variable for calculation */
+	uint64_t l_uDist;
+	uint64_t l_uSlope;
+	uint64_t l_uDelta;
+	int64_t  l_iRes;
+
+	/* Here p_iX1 < p_iX <= Xp2, so the distance and the product were checked by CalcSegment. The product is done on
+	   the absolute value of the slope, so the shift does not depend on the sign, and it is rounded to the nearest */
+	l_uDist = ( (uint64_t) p_iX ) - ( (uint64_t) p_iX1 );
+
+	if( p_ptSeg->iSlopeQ32 < 0 )
+	{
+		l_uSlope = ( (uint64_t) 0u ) - ( (uint64_t) p_ptSeg->iSlopeQ32 );
+		l_uDelta = ( ( l_uSlope * l_uDist ) + 0x80000000u ) >> 32u;
+		l_iRes = p_ptSeg->iIntercept - ( (int64_t) l_uDelta );
+	}
+	else
+	{
+		l_uSlope = (uint64_t) p_ptSeg->iSlopeQ32;
+		l_uDelta = ( ( l_uSlope * l_uDist ) + 0x80000000u ) >> 32u;
+		l_iRes = p_ptSeg->iIntercept + ( (int64_t) l_uDelta );
+	}
+
+	return l_iRes;
+}
+
+static bool_t eDSP_M2DPI64LINEAR_IsSegTableValid(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+	bool_t l_bRet;
+
+	/* Local variable for calculation */
+	uint32_t l_uIndx;
+	t_eDSP_M2DPI64LINEAR_Segment l_tSeg;
+
+	/* Init vaiable */
+	l_bRet = true;
+	l_uIndx = 0u;
+
+	/* Every segment must be the same calculated from the series, no table is always valid */
+	while( ( NULL != p_ptCtx->ptSegTable ) && ( l_uIndx < ( p_ptCtx->tPoinSeries.uNumPoint - 1u ) ) &&
+		   ( true == l_bRet ) )
+	{
+		eDSP_M2DPI64LINEAR_CalcSegment(p_ptCtx->tPoinSeries.ptPointArray[l_uIndx],
+		                               p_ptCtx->tPoinSeries.ptPointArray[l_uIndx + 1u], &l_tSeg);
+
+		if( ( l_tSeg.iSlopeQ32 != p_ptCtx->ptSegTable[l_uIndx].iSlopeQ32 ) ||
+			( l_tSeg.iIntercept != p_ptCtx->ptSegTable[l_uIndx].iIntercept ) ||
+			( l_tSeg.bIsValid != p_ptCtx->ptSegTable[l_uIndx].bIsValid ) )
+		{
+			l_bRet = false;
+		}
+
+		/* Increase counter */
+		l_uIndx++;
+	}
+
+	return l_bRet;
+}
+
+static void eDSP_M2DPI64LINEAR_CalcGrid(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                        t_eDSP_M2DPI64LINEAR_Grid* const p_ptGrid)
+{
+	/* Local variable for calculation */
+	uint64_t l_uStep;
+	uint64_t l_uSpan;
+	uint32_t l_uIndx;
+	bool_t   l_bIsUniform;
+
+	/* The series is ordered, so every distance is positive and fit an uint64_t even when the int64_t overflow */
+	l_uStep = ( (uint64_t) p_tSeries.ptPointArray[1u].uX ) - ( (uint64_t) p_tSeries.ptPointArray[0u].uX );
+	l_uSpan = ( (uint64_t) p_tSeries.ptPointArray[p_tSeries.uNumPoint - 1u].uX ) -
+	          ( (uint64_t) p_tSeries.ptPointArray[0u].uX );
+	l_bIsUniform = true;
+	l_uIndx = 1u;
+
+	while( ( l_uIndx < ( p_tSeries.uNumPoint - 1u ) ) && ( true == l_bIsUniform ) )
+	{
+		if( l_uStep != ( ( (uint64_t) p_tSeries.ptPointArray[l_uIndx + 1u].uX ) -
+		                 ( (uint64_t) p_tSeries.ptPointArray[l_uIndx].uX ) ) )
+		{
+			l_bIsUniform = false;
+		}
+
+		/* Increase counter */
+		l_uIndx++;
+	}
+
+	p_ptGrid->eType = e_eDSP_M2DPI64LINEAR_GRID_NONE;
+	p_ptGrid->uStep = l_uStep;
+	p_ptGrid->uRecip = 0u;
+	p_ptGrid->uShift = 0u;
+
+	if( true == l_bIsUniform )
+	{
+		if( 0u == ( l_uStep & ( l_uStep - 1u ) ) )
+		{
+			p_ptGrid->eType = e_eDSP_M2DPI64LINEAR_GRID_SHIFT;
+
+			while( ( ( (uint64_t) 1u ) << p_ptGrid->uShift ) != l_uStep )
+			{
+				p_ptGrid->uShift++;
+			}
+		}
+		else if( l_uSpan <= ( (uint64_t) MAX_UINT32VAL ) )
+		{
+			/* ceil( 2^64 / step ), exact for every dividend and divisor of 32 bit, see GetSegment */
+			p_ptGrid->eType = e_eDSP_M2DPI64LINEAR_GRID_RECIP;
+			p_ptGrid->uRecip = ( MAX_UINT64VAL / l_uStep ) + 1u;
+		}
+		else
+		{
+			p_ptGrid->eType = e_eDSP_M2DPI64LINEAR_GRID_DIV;
+		}
+	}
+}
+
+static bool_t eDSP_M2DPI64LINEAR_IsGridValid(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+	bool_t l_bRet;
+
+	/* Local variable for calculation */
+	t_eDSP_M2DPI64LINEAR_Grid l_tGrid;
+
+	/* The grid must be the same calculated from the series */
+	eDSP_M2DPI64LINEAR_CalcGrid(p_ptCtx->tPoinSeries, &l_tGrid);
+
+	if( ( l_tGrid.eType != p_ptCtx->tGrid.eType ) || ( l_tGrid.uStep != p_ptCtx->tGrid.uStep ) ||
+		( l_tGrid.uRecip != p_ptCtx->tGrid.uRecip ) || ( l_tGrid.uShift != p_ptCtx->tGrid.uShift ) )
+	{
+		l_bRet = false;
+	}
+	else
+	{
+		l_bRet = true;
+	}
+
+	return l_bRet;
+}
+
+static uint32_t eDSP_M2DPI64LINEAR_GetSegment(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                              const t_eDSP_M2DPI64LINEAR_Grid* p_ptGrid, const int64_t p_iX)
+{
+	/* Local variable for calculation */
+	uint32_t l_uIndx;
+	uint64_t l_uDist;
+	uint64_t l_uQuot;
+
+	if( p_iX <= p_tSeries.ptPointArray[0u].uX )
+	{
+		/* point request is pre data  */
+		l_uIndx = 0u;
+	}
+	else if( p_iX >= p_tSeries.ptPointArray[p_tSeries.uNumPoint - 1u].uX )
+	{
+		/* point request is post data  */
+		l_uIndx = p_tSeries.uNumPoint - 2u;
+	}
+	else if( e_eDSP_M2DPI64LINEAR_GRID_NONE == p_ptGrid->eType )
+	{
+		/* point request is inside data  */
+		l_uIndx = eDSP_M2DPI64LINEAR_FindSegment(p_tSeries.ptPointArray, p_tSeries.uNumPoint, p_iX);
+	}
+	else
+	{
+		/* point request is inside a uniform grid, X[i] = X[0] + i * step, so p_iX is in ( X[i], X[i + 1] ] when
+		   i = ( p_iX - X[0] - 1 ) / step, the same segment selected by FindSegment */
+		l_uDist = ( (uint64_t) p_iX ) - ( (uint64_t) p_tSeries.ptPointArray[0u].uX ) - 1u;
+
+		if( e_eDSP_M2DPI64LINEAR_GRID_SHIFT == p_ptGrid->eType )
+		{
+			l_uQuot = l_uDist >> p_ptGrid->uShift;
+		}
+		else if( e_eDSP_M2DPI64LINEAR_GRID_RECIP == p_ptGrid->eType )
+		{
+			/* Here l_uDist is lower than 2^32, so the quotient is the high 64 bit of the 96 bit product with the
+			   reciprocal, calculated with two product of 32 bit */
+			l_uQuot = ( ( ( p_ptGrid->uRecip >> 32u ) * l_uDist ) +
+			            ( ( ( p_ptGrid->uRecip & MAX_UINT32VAL ) * l_uDist ) >> 32u ) ) >> 32u;
+		}
+		else
+		{
+			l_uQuot = l_uDist / p_ptGrid->uStep;
+		}
+
+		/* A series modified after the init can't move the index outside the series */
+		if( l_uQuot > ( (uint64_t) p_tSeries.uNumPoint - 2u ) )
+		{
+			l_uQuot = (uint64_t) p_tSeries.uNumPoint - 2u;
+		}
+
+		l_uIndx = (uint32_t) l_uQuot;
+	}
+
+	return l_uIndx;
+}
+
+static e_eDSP_S2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_LinearizeSeries(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                                                   const t_eDSP_M2DPI64LINEAR_Grid* p_ptGrid,
+                                                                   const int64_t p_iX, int64_t* const p_piY)
+{
+	/* Local variable for calculation */
+	uint32_t l_uIndx;
+
+	l_uIndx = eDSP_M2DPI64LINEAR_GetSegment(p_tSeries, p_ptGrid, p_iX);
+
+	return eDSP_S2DPI64LINEAR_Linearize(p_tSeries.ptPointArray[l_uIndx], p_tSeries.ptPointArray[l_uIndx + 1u], p_iX,
+	                                    p_piY);
+}
+
+static uint32_t eDSP_M2DPI64LINEAR_FingerSegment(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                                 const uint32_t p_uFinger, const int64_t p_iX)
+{
+	/* Local variable for calculation */
+	uint32_t l_uIndx;
+	uint32_t l_uLow;
+	uint32_t l_uHigh;
+	uint32_t l_uStep;
+	uint32_t l_uLast;
+
+	l_uLast = p_tSeries.uNumPoint - 1u;
+
+	if( p_iX <= p_tSeries.ptPointArray[0u].uX )
+	{
+		/* point request is pre data  */
+		l_uIndx = 0u;
+	}
+	else if( p_iX >= p_tSeries.ptPointArray[l_uLast].uX )
+	{
+		/* point request is post data  */
+		l_uIndx = l_uLast - 1u;
+	}
+	else if( ( p_iX > p_tSeries.ptPointArray[p_uFinger].uX ) && ( p_iX <= p_tSeries.ptPointArray[p_uFinger + 1u].uX ) )
+	{
+		/* point request is in the same segment of the last one */
+		l_uIndx = p_uFinger;
+	}
+	else
+	{
+		/* Gallop from the last segment with a step that double every time, until X[l_uLow] < p_iX <= X[l_uHigh],
+		   then search the segment only between them. Here X[0] < p_iX < X[last], so the gallop can stop at the
+		   first and at the last point of the series */
+		l_uStep = 1u;
+
+		if( p_iX > p_tSeries.ptPointArray[p_uFinger + 1u].uX )
+		{
+			l_uLow = p_uFinger + 1u;
+			l_uHigh = l_uLow + 1u;
+
+			while( ( l_uHigh < l_uLast ) && ( p_tSeries.ptPointArray[l_uHigh].uX < p_iX ) )
+			{
+				l_uLow = l_uHigh;
+				l_uStep = l_uStep * 2u;
+
+				if( l_uStep < ( l_uLast - l_uLow ) )
+				{
+					l_uHigh = l_uLow + l_uStep;
+				}
+				else
+				{
+					l_uHigh = l_uLast;
+				}
+			}
+		}
+		else
+		{
+			l_uHigh = p_uFinger;
+			l_uLow = l_uHigh - 1u;
+
+			while( ( l_uLow > 0u ) && ( p_tSeries.ptPointArray[l_uLow].uX >= p_iX ) )
+			{
+				l_uHigh = l_uLow;
+				l_uStep = l_uStep * 2u;
+
+				if( l_uStep < l_uHigh )
+				{
+					l_uLow = l_uHigh - l_uStep;
+				}
+				else
+				{
+					l_uLow = 0u;
+				}
+			}
+		}
+
+		l_uIndx = l_uLow + eDSP_M2DPI64LINEAR_FindSegment(&p_tSeries.ptPointArray[l_uLow], ( l_uHigh - l_uLow ) + 1u,
+		                                                  p_iX);
+	}
+
+	return l_uIndx;
+}
+
+static e_eDSP_S2DPI64LINEAR_RES eDSP_M2DPI64LINEAR_LinearizeSegment(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx,
+                                                                    const uint32_t p_uIndx, const int64_t p_iX,
+                                                                    int64_t* const p_piY)
+{
+	/* Local variable for return */
+	e_eDSP_S2DPI64LINEAR_RES l_eSingleRes;
+
+	/* Local variable for calculation */
+	t_eDSP_TYPE_2DPI64 l_tPFirst;
+	t_eDSP_TYPE_2DPI64 l_tPSecond;
+	bool_t l_bUseTable;
+
+	l_tPFirst = p_ptCtx->tPoinSeries.ptPointArray[p_uIndx];
+	l_tPSecond = p_ptCtx->tPoinSeries.ptPointArray[p_uIndx + 1u];
+
+	/* The precomputed segment can be used only for a point request inside data */
+	l_bUseTable = false;
+
+	if( ( NULL != p_ptCtx->ptSegTable ) && ( p_iX > l_tPFirst.uX ) && ( p_iX <= l_tPSecond.uX ) )
+	{
+		l_bUseTable = p_ptCtx->ptSegTable[p_uIndx].bIsValid;
+	}
+
+	if( true == l_bUseTable )
+	{
+		/* Precomputed segment, proven to never overflow when it was calculated */
+		*p_piY = eDSP_M2DPI64LINEAR_EvalSegment(&p_ptCtx->ptSegTable[p_uIndx], l_tPFirst.uX, p_iX);
+		l_eSingleRes = e_eDSP_S2DPI64LINEAR_RES_OK;
+	}
+	else if( e_eDSP_TYPE_OVFMODE_SATURATE == p_ptCtx->eOvfMode )
+	{
+		l_eSingleRes = eDSP_S2DPI64LINEAR_LinearizeSat(l_tPFirst, l_tPSecond, p_iX, p_piY, &p_ptCtx->uSatCnt);
+	}
+	else
+	{
+		l_eSingleRes = eDSP_S2DPI64LINEAR_Linearize(l_tPFirst, l_tPSecond, p_iX, p_piY);
+	}
+
+	return l_eSingleRes;
+}
+
+static bool_t eDSP_M2DPI64LINEAR_ResampleStep(const t_eDSP_M2DPI64LINEAR_PointSeries p_tSeries,
+                                              const uint32_t p_uShift, const uint32_t p_uNOutPoint,
+                                              const uint64_t p_uMaxError, t_eDSP_TYPE_2DPI64* const p_ptOutBuffer)
+{
+    /* Return local var */
+	bool_t l_bRet;
+
+	/* Local variable for calculation */
+	t_eDSP_M2DPI64LINEAR_Grid l_tSrcGrid;
+	t_eDSP_M2DPI64LINEAR_Grid l_tOutGrid;
+	t_eDSP_M2DPI64LINEAR_PointSeries l_tOutSeries;
+	uint64_t l_uStep;
+	uint64_t l_uLimit;
+	uint64_t l_uErr;
+	uint32_t l_uIndx;
+	int64_t  l_iY;
+
+	l_uStep = ( (uint64_t) 1u ) << p_uShift;
+
+	l_tSrcGrid.eType = e_eDSP_M2DPI64LINEAR_GRID_NONE;
+	l_tSrcGrid.uStep = 0u;
+	l_tSrcGrid.uRecip = 0u;
+	l_tSrcGrid.uShift = 0u;
+
+	l_tOutGrid.eType = e_eDSP_M2DPI64LINEAR_GRID_SHIFT;
+	l_tOutGrid.uStep = l_uStep;
+	l_tOutGrid.uRecip = 0u;
+	l_tOutGrid.uShift = p_uShift;
+
+	l_tOutSeries.uNumPoint = p_uNOutPoint;
+	l_tOutSeries.ptPointArray = p_ptOutBuffer;
+
+	/* The last point of the grid must fit the int64_t storage area, the others are before the last X of the series */
+	l_uLimit = ( (uint64_t) MAX_INT64VAL ) - ( (uint64_t) p_tSeries.ptPointArray[0u].uX );
+	l_bRet = ( l_uStep <= l_uLimit ) && ( ( ( (uint64_t) p_uNOutPoint - 2u ) << p_uShift ) <= ( l_uLimit - l_uStep ) );
+	l_uIndx = 0u;
+
+	/* Sample the series on the grid */
+	while( ( l_uIndx < p_uNOutPoint ) && ( true == l_bRet ) )
+	{
+		p_ptOutBuffer[l_uIndx].uX = (int64_t) ( ( (uint64_t) p_tSeries.ptPointArray[0u].uX ) +
+		                                        ( ( (uint64_t) l_uIndx ) << p_uShift ) );
+
+		if( e_eDSP_S2DPI64LINEAR_RES_OK != eDSP_M2DPI64LINEAR_LinearizeSeries(p_tSeries, &l_tSrcGrid,
+		                                                                      p_ptOutBuffer[l_uIndx].uX,
+		                                                                      &p_ptOutBuffer[l_uIndx].uY) )
+		{
+			l_bRet = false;
+		}
+
+		/* Increase counter */
+		l_uIndx++;
+	}
+
+	/* Measure the error on every point of the series */
+	l_uIndx = 0u;
+
+	while( ( l_uIndx < p_tSeries.uNumPoint ) && ( true == l_bRet ) )
+	{
+		if( e_eDSP_S2DPI64LINEAR_RES_OK != eDSP_M2DPI64LINEAR_LinearizeSeries(l_tOutSeries, &l_tOutGrid,
+		                                                                      p_tSeries.ptPointArray[l_uIndx].uX,
+		                                                                      &l_iY) )
+		{
+			l_bRet = false;
+		}
+		else
+		{
+			/* Absolute difference, calculated on uint64_t so it can't overflow */
+			if( l_iY < p_tSeries.ptPointArray[l_uIndx].uY )
+			{
+				l_uErr = ( (uint64_t) p_tSeries.ptPointArray[l_uIndx].uY ) - ( (uint64_t) l_iY );
+			}
+			else
+			{
+				l_uErr = ( (uint64_t) l_iY ) - ( (uint64_t) p_tSeries.ptPointArray[l_uIndx].uY );
+			}
+
+			if( l_uErr > p_uMaxError )
+			{
+				l_bRet = false;
+			}
+		}
+
+		/* Increase counter */
+		l_uIndx++;
+	}
+
+	return l_bRet;
+}
+
+#ifdef EDSP_CONFIG_X86SIMD
+static uint32_t eDSP_M2DPI64LINEAR_BatchSimd(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx, const int64_t* p_piX,
+                                             const uint32_t p_uNValues, int64_t* const p_piY,
+                                             uint32_t* const p_puIndx, e_eDSP_S2DPI64LINEAR_RES* const p_peRes)
+{
+	/* Local variable */
+	uint32_t l_uDone;
+
+	/* Use the widest kernel supported by the running CPU, the remaining values are done by the portable loop */
+	if( __builtin_cpu_supports("avx512f") )
+	{
+		l_uDone = eDSP_M2DPI64LINEAR_BatchAvx512(p_ptCtx, p_piX, p_uNValues, p_piY, p_puIndx, p_peRes);
+	}
+	else if( __builtin_cpu_supports("avx2") )
+	{
+		l_uDone = eDSP_M2DPI64LINEAR_BatchAvx2(p_ptCtx, p_piX, p_uNValues, p_piY, p_puIndx, p_peRes);
+	}
+	else
+	{
+		*p_peRes = e_eDSP_S2DPI64LINEAR_RES_OK;
+		l_uDone = 0u;
+	}
+
+	return l_uDone;
+}
+
+static uint32_t eDSP_M2DPI64LINEAR_BatchLanes(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx, const int64_t* p_piX,
+                                              int64_t* const p_piY, const int64_t* p_piIndx, const uint32_t p_uOkMask,
+                                              const uint32_t p_uNLanes, uint32_t* const p_puIndx,
+                                              e_eDSP_S2DPI64LINEAR_RES* const p_peRes)
+{
+	/* Local variable */
+	uint32_t l_uLane;
+
+	l_uLane = 0u;
+	*p_peRes = e_eDSP_S2DPI64LINEAR_RES_OK;
+
+	/* The lanes that the kernel could not prove exact are calculated again with the scalar function, in order, so
+	   errors and saturation are reported like in the portable loop */
+	while( ( l_uLane < p_uNLanes ) && ( e_eDSP_S2DPI64LINEAR_RES_OK == *p_peRes ) )
+	{
+		*p_puIndx = (uint32_t) p_piIndx[l_uLane];
+
+		if( 0u == ( p_uOkMask & ( 1u << l_uLane ) ) )
+		{
+			*p_peRes = eDSP_M2DPI64LINEAR_LinearizeSegment(p_ptCtx, *p_puIndx, p_piX[l_uLane], &p_piY[l_uLane]);
+		}
+
+		if( e_eDSP_S2DPI64LINEAR_RES_OK == *p_peRes )
+		{
+			/* Increase counter */
+			l_uLane++;
+		}
+	}
+
+	return l_uLane;
+}
+
+__attribute__((target("avx2")))
+static uint32_t eDSP_M2DPI64LINEAR_BatchAvx2(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx, const int64_t* p_piX,
+                                             const uint32_t p_uNValues, int64_t* const p_piY,
+                                             uint32_t* const p_puIndx, e_eDSP_S2DPI64LINEAR_RES* const p_peRes)
+{
+	/* Local variable */
+	const long long* l_piPoints;
+	uint32_t l_uCnt;
+	uint32_t l_uDone;
+	uint32_t l_uLen;
+	uint32_t l_uHalf;
+	uint32_t l_uOkMask;
+	int64_t  l_aiIndx[4u];
+	__m256i  l_tX;
+	__m256i  l_tBase;
+	__m256i  l_tIdx;
+	__m256i  l_tX1;
+	__m256i  l_tY1;
+	__m256i  l_tX2;
+	__m256i  l_tY2;
+	__m256i  l_tA;
+	__m256i  l_tB;
+	__m256i  l_tC;
+	__m256i  l_tSign;
+	__m256i  l_tQ;
+	__m256i  l_tY;
+	__m256i  l_tOk;
+	__m256d  l_tDA;
+	__m256d  l_tDB;
+	__m256d  l_tDC;
+	__m256d  l_tQuot;
+
+	/* The series is an array of { X, Y } int64_t, so the X of the point i is at 2 * i and the Y at 2 * i + 1 */
+	l_piPoints = (const long long*) p_ptCtx->tPoinSeries.ptPointArray;
+	l_uCnt = 0u;
+	l_uDone = 4u;
+	*p_peRes = e_eDSP_S2DPI64LINEAR_RES_OK;
+
+	while( ( ( l_uCnt + 4u ) <= p_uNValues ) && ( 4u == l_uDone ) )
+	{
+		l_tX = _mm256_loadu_si256( (const __m256i*) &p_piX[l_uCnt] );
+
+		/* Same search of FindSegment on every lane, the numbers of iteration depend only on the series. On the
+		   first and on the last segment it give the same result of GetSegment for X outside the series too */
+		l_tBase = _mm256_setzero_si256();
+		l_uLen = p_ptCtx->tPoinSeries.uNumPoint - 1u;
+
+		while( l_uLen > 1u )
+		{
+			l_uHalf = l_uLen / 2u;
+			l_tIdx = _mm256_add_epi64(l_tBase, _mm256_set1_epi64x( (long long) l_uHalf ));
+			l_tX1 = _mm256_i64gather_epi64(l_piPoints, _mm256_slli_epi64(l_tIdx, 1), 8);
+			l_tBase = _mm256_add_epi64(l_tBase, _mm256_and_si256(_mm256_set1_epi64x( (long long) l_uHalf ),
+			                                                     _mm256_cmpgt_epi64(l_tX, l_tX1)));
+			l_uLen -= l_uHalf;
+		}
+
+		l_tIdx = _mm256_slli_epi64(l_tBase, 1);
+		l_tX1 = _mm256_i64gather_epi64(l_piPoints, l_tIdx, 8);
+		l_tY1 = _mm256_i64gather_epi64(&l_piPoints[1u], l_tIdx, 8);
+		l_tX2 = _mm256_i64gather_epi64(&l_piPoints[2u], l_tIdx, 8);
+		l_tY2 = _mm256_i64gather_epi64(&l_piPoints[3u], l_tIdx, 8);
+
+		/* A lane is exact when X is inside the segment, A = Yp2 - Yp1 doesn't overflow, and |A|, B and C are lower
+		   than 2^52, so they are exact in a double. When |A| * B is lower than 2^53 the product is exact too, and
+		   the floor of a correctly rounded division of two integer lower than 2^53 is the integer division */
+		l_tC = _mm256_sub_epi64(l_tX2, l_tX1);
+		l_tB = _mm256_sub_epi64(l_tX, l_tX1);
+		l_tA = _mm256_sub_epi64(l_tY2, l_tY1);
+
+		l_tOk = _mm256_or_si256(_mm256_cmpgt_epi64(l_tX1, l_tX), _mm256_cmpgt_epi64(l_tX, l_tX2));
+		l_tOk = _mm256_or_si256(l_tOk, _mm256_cmpgt_epi64(_mm256_setzero_si256(),
+		                                                  _mm256_and_si256(_mm256_xor_si256(l_tY2, l_tY1),
+		                                                                   _mm256_xor_si256(l_tY2, l_tA))));
+		l_tOk = _mm256_andnot_si256(l_tOk, _mm256_cmpgt_epi64(l_tC, _mm256_setzero_si256()));
+
+		l_tSign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), l_tA);
+		l_tA = _mm256_sub_epi64(_mm256_xor_si256(l_tA, l_tSign), l_tSign);
+		l_tOk = _mm256_and_si256(l_tOk, _mm256_cmpgt_epi64(_mm256_set1_epi64x(EDSP_M2DPI64LINEAR_EXACTLIM), l_tC));
+		l_tOk = _mm256_and_si256(l_tOk, _mm256_cmpgt_epi64(_mm256_set1_epi64x(EDSP_M2DPI64LINEAR_EXACTLIM), l_tA));
+		l_tOk = _mm256_and_si256(l_tOk, _mm256_cmpgt_epi64(l_tA, _mm256_set1_epi64x(-1)));
+
+		/* Convert to double adding the bits of 2^52, the lanes that are not exact are calculated on zero */
+		l_tDA = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(l_tA, l_tOk),
+		                                                          _mm256_set1_epi64x(EDSP_M2DPI64LINEAR_DBLBITS))),
+		                      _mm256_set1_pd(EDSP_M2DPI64LINEAR_DBLMAGIC));
+		l_tDB = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(l_tB, l_tOk),
+		                                                          _mm256_set1_epi64x(EDSP_M2DPI64LINEAR_DBLBITS))),
+		                      _mm256_set1_pd(EDSP_M2DPI64LINEAR_DBLMAGIC));
+		l_tDC = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(l_tC, l_tOk),
+		                                                          _mm256_set1_epi64x(EDSP_M2DPI64LINEAR_DBLBITS))),
+		                      _mm256_set1_pd(EDSP_M2DPI64LINEAR_DBLMAGIC));
+		l_tDC = _mm256_blendv_pd(_mm256_set1_pd(1.0), l_tDC, _mm256_castsi256_pd(l_tOk));
+
+		l_tDA = _mm256_mul_pd(l_tDA, l_tDB);
+		l_tOk = _mm256_and_si256(l_tOk, _mm256_castpd_si256(_mm256_cmp_pd(l_tDA,
+		                                                                  _mm256_set1_pd(EDSP_M2DPI64LINEAR_PRODLIM),
+		                                                                  _CMP_LT_OQ)));
+		l_tQuot = _mm256_floor_pd(_mm256_div_pd(l_tDA, l_tDC));
+
+		/* Back to integer, the quotient is not greater than |A|, then restore the sign of A and add Yp1 */
+		l_tQuot = _mm256_add_pd(l_tQuot, _mm256_set1_pd(EDSP_M2DPI64LINEAR_DBLMAGIC));
+		l_tQ = _mm256_xor_si256(_mm256_castpd_si256(l_tQuot), _mm256_set1_epi64x(EDSP_M2DPI64LINEAR_DBLBITS));
+		l_tQ = _mm256_sub_epi64(_mm256_xor_si256(l_tQ, l_tSign), l_tSign);
+		l_tY = _mm256_add_epi64(l_tY1, l_tQ);
+		l_tOk = _mm256_andnot_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(),
+		                                               _mm256_and_si256(_mm256_xor_si256(l_tY1, l_tY),
+		                                                                _mm256_xor_si256(l_tQ, l_tY))), l_tOk);
+
+		_mm256_storeu_si256( (__m256i*) &p_piY[l_uCnt], l_tY );
+		_mm256_storeu_si256( (__m256i*) l_aiIndx, l_tBase );
+		l_uOkMask = (uint32_t) _mm256_movemask_pd(_mm256_castsi256_pd(l_tOk));
+
+		l_uDone = eDSP_M2DPI64LINEAR_BatchLanes(p_ptCtx, &p_piX[l_uCnt], &p_piY[l_uCnt], l_aiIndx, l_uOkMask, 4u,
+		                                        p_puIndx, p_peRes);
+		l_uCnt += l_uDone;
+	}
+
+	return l_uCnt;
+}
+
+__attribute__((target("avx512f")))
+static uint32_t eDSP_M2DPI64LINEAR_BatchAvx512(t_eDSP_M2DPI64LINEAR_Ctx* const p_ptCtx, const int64_t* p_piX,
+                                               const uint32_t p_uNValues, int64_t* const p_piY,
+                                               uint32_t* const p_puIndx, e_eDSP_S2DPI64LINEAR_RES* const p_peRes)
+{
+	/* Local variable */
+	const long long* l_piPoints;
+	uint32_t l_uCnt;
+	uint32_t l_uDone;
+	uint32_t l_uLen;
+	uint32_t l_uHalf;
+	uint32_t l_uOkMask;
+	int64_t  l_aiIndx[8u];
+	__m512i  l_tX;
+	__m512i  l_tBase;
+	__m512i  l_tIdx;
+	__m512i  l_tX1;
+	__m512i  l_tY1;
+	__m512i  l_tX2;
+	__m512i  l_tY2;
+	__m512i  l_tA;
+	__m512i  l_tB;
+	__m512i  l_tC;
+	__m512i  l_tSign;
+	__m512i  l_tQ;
+	__m512i  l_tY;
+	__m512d  l_tDA;
+	__m512d  l_tDB;
+	__m512d  l_tDC;
+	__m512d  l_tQuot;
+
+	/* Same calculation of the AVX2 kernel, on 8 lanes and with mask registers */
+	l_piPoints = (const long long*) p_ptCtx->tPoinSeries.ptPointArray;
+	l_uCnt = 0u;
+	l_uDone = 8u;
+	*p_peRes = e_eDSP_S2DPI64LINEAR_RES_OK;
+
+	while( ( ( l_uCnt + 8u ) <= p_uNValues ) && ( 8u == l_uDone ) )
+	{
+		l_tX = _mm512_loadu_si512( (const void*) &p_piX[l_uCnt] );
+
+		l_tBase = _mm512_setzero_si512();
+		l_uLen = p_ptCtx->tPoinSeries.uNumPoint - 1u;
+
+		while( l_uLen > 1u )
+		{
+			l_uHalf = l_uLen / 2u;
+			l_tIdx = _mm512_add_epi64(l_tBase, _mm512_set1_epi64( (long long) l_uHalf ));
+			l_tX1 = _mm512_i64gather_epi64(_mm512_slli_epi64(l_tIdx, 1u), l_piPoints, 8);
+			l_tBase = _mm512_mask_mov_epi64(l_tBase, _mm512_cmpgt_epi64_mask(l_tX, l_tX1), l_tIdx);
+			l_uLen -= l_uHalf;
+		}
+
+		l_tIdx = _mm512_slli_epi64(l_tBase, 1u);
+		l_tX1 = _mm512_i64gather_epi64(l_tIdx, l_piPoints, 8);
+		l_tY1 = _mm512_i64gather_epi64(l_tIdx, &l_piPoints[1u], 8);
+		l_tX2 = _mm512_i64gather_epi64(l_tIdx, &l_piPoints[2u], 8);
+		l_tY2 = _mm512_i64gather_epi64(l_tIdx, &l_piPoints[3u], 8);
+
+		l_tC = _mm512_sub_epi64(l_tX2, l_tX1);
+		l_tB = _mm512_sub_epi64(l_tX, l_tX1);
+		l_tA = _mm512_sub_epi64(l_tY2, l_tY1);
+
+		l_uOkMask = (uint32_t) _mm512_cmple_epi64_mask(l_tX1, l_tX);
+		l_uOkMask &= (uint32_t) _mm512_cmple_epi64_mask(l_tX, l_tX2);
+		l_uOkMask &= (uint32_t) _mm512_cmpge_epi64_mask(_mm512_and_si512(_mm512_xor_si512(l_tY2, l_tY1),
+		                                                                  _mm512_xor_si512(l_tY2, l_tA)),
+		                                                 _mm512_setzero_si512());
+		l_uOkMask &= (uint32_t) _mm512_cmpgt_epi64_mask(l_tC, _mm512_setzero_si512());
+		l_uOkMask &= (uint32_t) _mm512_cmplt_epi64_mask(l_tC, _mm512_set1_epi64(EDSP_M2DPI64LINEAR_EXACTLIM));
+
+		l_tSign = _mm512_srai_epi64(l_tA, 63u);
+		l_tA = _mm512_abs_epi64(l_tA);
+		l_uOkMask &= (uint32_t) _mm512_cmplt_epi64_mask(l_tA, _mm512_set1_epi64(EDSP_M2DPI64LINEAR_EXACTLIM));
+		l_uOkMask &= (uint32_t) _mm512_cmpge_epi64_mask(l_tA, _mm512_setzero_si512());
+
+		l_tDA = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(_mm512_maskz_mov_epi64( (__mmask8) l_uOkMask, l_tA ),
+		                                                          _mm512_set1_epi64(EDSP_M2DPI64LINEAR_DBLBITS))),
+		                      _mm512_set1_pd(EDSP_M2DPI64LINEAR_DBLMAGIC));
+		l_tDB = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(_mm512_maskz_mov_epi64( (__mmask8) l_uOkMask, l_tB ),
+		                                                          _mm512_set1_epi64(EDSP_M2DPI64LINEAR_DBLBITS))),
+		                      _mm512_set1_pd(EDSP_M2DPI64LINEAR_DBLMAGIC));
+		l_tDC = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(_mm512_mask_mov_epi64(_mm512_set1_epi64(1),
+		                                                                                (__mmask8) l_uOkMask, l_tC),
+		                                                          _mm512_set1_epi64(EDSP_M2DPI64LINEAR_DBLBITS))),
+		                      _mm512_set1_pd(EDSP_M2DPI64LINEAR_DBLMAGIC));
+
+		l_tDA = _mm512_mul_pd(l_tDA, l_tDB);
+		l_uOkMask &= (uint32_t) _mm512_cmp_pd_mask(l_tDA, _mm512_set1_pd(EDSP_M2DPI64LINEAR_PRODLIM), _CMP_LT_OQ);
+		l_tQuot = _mm512_roundscale_pd(_mm512_div_pd(l_tDA, l_tDC), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+
+		l_tQuot = _mm512_add_pd(l_tQuot, _mm512_set1_pd(EDSP_M2DPI64LINEAR_DBLMAGIC));
+		l_tQ = _mm512_xor_si512(_mm512_castpd_si512(l_tQuot), _mm512_set1_epi64(EDSP_M2DPI64LINEAR_DBLBITS));
+		l_tQ = _mm512_sub_epi64(_mm512_xor_si512(l_tQ, l_tSign), l_tSign);
+		l_tY = _mm512_add_epi64(l_tY1, l_tQ);
+		l_uOkMask &= (uint32_t) _mm512_cmpge_epi64_mask(_mm512_and_si512(_mm512_xor_si512(l_tY1, l_tY),
+		                                                                  _mm512_xor_si512(l_tQ, l_tY)),
+		                                                 _mm512_setzero_si512());
+
+		_mm512_storeu_si512( (void*) &p_piY[l_uCnt], l_tY );
+		_mm512_storeu_si512( (void*) l_aiIndx, l_tBase );
+
+		l_uDone = eDSP_M2DPI64LINEAR_BatchLanes(p_ptCtx, &p_piX[l_uCnt], &p_piY[l_uCnt], l_aiIndx, l_uOkMask, 8u,
+		                                        p_puIndx, p_peRes);
+		l_uCnt += l_uDone;
+	}
+
+	return l_uCnt;
+}
+#endif
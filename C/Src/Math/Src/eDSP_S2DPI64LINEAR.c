@@ -12,6 +12,7 @@
  **********************************************************************************************************************/
 #include "eDSP_S2DPI64LINEAR.h"
 #include "eDSP_MAXCHECK.h"
+#include "eDSP_SATARITH.h"
 
 
 
@@ -36,7 +37,6 @@ e_eDSP_S2DPI64LINEAR_RES eDSP_S2DPI64LINEAR_Linearize(const t_eDSP_TYPE_2DPI64 p
 	int64_t l_iA;
 	int64_t l_iB;
 	int64_t l_iC;
-	int64_t l_iAB;
 	int64_t l_iABC;
 
 	/* Check pointer validity */
@@ -83,43 +83,31 @@ e_eDSP_S2DPI64LINEAR_RES eDSP_S2DPI64LINEAR_Linearize(const t_eDSP_TYPE_2DPI64 p
 				   Note: we need to be carefull because we are not using floating point, and we must retain as much
 				         precision as possible */
 
-				/* Calculate single addend */
-				l_eMaxRes = eDSP_MAXCHECK_SUBTI64Check(p_tP2.uY, p_tP1.uY);
+				/* Calculate single addend, every operation is done only once together with its overflow check */
+				l_eMaxRes = eDSP_MAXCHECK_SubI64(p_tP2.uY, p_tP1.uY, &l_iA);
 				l_eRes = eDSP_S2DPI64LINEAR_MaxCheckResToS2DP(l_eMaxRes);
 
 				if( e_eDSP_S2DPI64LINEAR_RES_OK == l_eRes )
 				{
-					l_iA = p_tP2.uY - p_tP1.uY;
-
-					l_eMaxRes = eDSP_MAXCHECK_SUBTI64Check(p_iX, p_tP1.uX);
+					l_eMaxRes = eDSP_MAXCHECK_SubI64(p_iX, p_tP1.uX, &l_iB);
 					l_eRes = eDSP_S2DPI64LINEAR_MaxCheckResToS2DP(l_eMaxRes);
 
 					if( e_eDSP_S2DPI64LINEAR_RES_OK == l_eRes )
 					{
-						l_iB = p_iX - p_tP1.uX;
-
-						l_eMaxRes = eDSP_MAXCHECK_SUBTI64Check(p_tP2.uX , p_tP1.uX);
+						l_eMaxRes = eDSP_MAXCHECK_SubI64(p_tP2.uX, p_tP1.uX, &l_iC);
 						l_eRes = eDSP_S2DPI64LINEAR_MaxCheckResToS2DP(l_eMaxRes);
 
 						if( e_eDSP_S2DPI64LINEAR_RES_OK == l_eRes )
 						{
-							l_iC = p_tP2.uX - p_tP1.uX;
-
-							l_eMaxRes = eDSP_MAXCHECK_MOLTIPI64Check(l_iA, l_iB);
+							/* A * B is kept on 128 bit before the division, so only ( A * B ) / C must fit in an
+							   int64_t, and C is never zero here */
+							l_eMaxRes = eDSP_MAXCHECK_MulDivI64(l_iA, l_iB, l_iC, &l_iABC);
 							l_eRes = eDSP_S2DPI64LINEAR_MaxCheckResToS2DP(l_eMaxRes);
 
 							if( e_eDSP_S2DPI64LINEAR_RES_OK == l_eRes )
 							{
-								l_iAB = l_iA * l_iB;
-								l_iABC = l_iAB / l_iC;
-
-								l_eMaxRes = eDSP_MAXCHECK_SUMI64Check(l_iABC, p_tP1.uY);
+								l_eMaxRes = eDSP_MAXCHECK_AddI64(l_iABC, p_tP1.uY, p_piY);
 								l_eRes = eDSP_S2DPI64LINEAR_MaxCheckResToS2DP(l_eMaxRes);
-
-								if( e_eDSP_S2DPI64LINEAR_RES_OK == l_eRes )
-								{
-									*p_piY = l_iABC + p_tP1.uY;
-								}
 							}
 						}
 					}
@@ -131,6 +119,49 @@ e_eDSP_S2DPI64LINEAR_RES eDSP_S2DPI64LINEAR_Linearize(const t_eDSP_TYPE_2DPI64 p
 	return l_eRes;
 }
 
+e_eDSP_S2DPI64LINEAR_RES eDSP_S2DPI64LINEAR_LinearizeSat(const t_eDSP_TYPE_2DPI64 p_tP1, const t_eDSP_TYPE_2DPI64 p_tP2,
+                                                         const int64_t p_iX, int64_t* const p_piY,
+                                                         uint32_t* const p_puSatCnt)
+{
+	/* Local variable for return */
+	e_eDSP_S2DPI64LINEAR_RES l_eRes;
+
+	/* Local variable for calculation */
+	int64_t l_iA;
+	int64_t l_iB;
+	int64_t l_iC;
+	int64_t l_iABC;
+
+	/* Check pointer validity */
+	if( ( NULL == p_piY ) || ( NULL == p_puSatCnt ) )
+	{
+		l_eRes = e_eDSP_S2DPI64LINEAR_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check param, same rules of eDSP_S2DPI64LINEAR_Linearize */
+		if( p_tP1.uX == p_tP2.uX )
+		{
+			l_eRes = e_eDSP_S2DPI64LINEAR_RES_BADPARAM;
+		}
+		else
+		{
+			/* Same calculation of eDSP_S2DPI64LINEAR_Linearize, every step is clamped instead of failing. C is
+			   clamped only toward its own sign, so it is never zero here */
+			l_iA = eDSP_SATARITH_SubI64(p_tP2.uY, p_tP1.uY, p_puSatCnt);
+			l_iB = eDSP_SATARITH_SubI64(p_iX, p_tP1.uX, p_puSatCnt);
+			l_iC = eDSP_SATARITH_SubI64(p_tP2.uX, p_tP1.uX, p_puSatCnt);
+			l_iABC = eDSP_SATARITH_MulDivI64(l_iA, l_iB, l_iC, p_puSatCnt);
+			*p_piY = eDSP_SATARITH_AddI64(l_iABC, p_tP1.uY, p_puSatCnt);
+
+			/* All ok */
+			l_eRes = e_eDSP_S2DPI64LINEAR_RES_OK;
+		}
+    }
+
+	return l_eRes;
+}
+
 
 
 /***********************************************************************************************************************
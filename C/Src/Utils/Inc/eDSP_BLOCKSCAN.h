@@ -0,0 +1,77 @@
+/**
+ * @file       eDSP_BLOCKSCAN.h
+ *
+ * @brief      Scan a block of int64_t values to prove that an operation on it can't overflow
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_BLOCKSCAN_H
+#define EDSP_BLOCKSCAN_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Find the minimum and the maximum value of a block. The extremes found are merged with the values
+ *              already present in p_piMin and p_piMax, so more buffers can be scanned one after the other; init them
+ *              with MAX_INT64VAL and MIN_INT64VAL before the first scan. When the library is built for x86 with
+ *              EDSP_CONFIG_X86SIMD defined, the block is scanned by AVX2 or AVX-512 kernels selected at run time.
+ * @param[in]   p_piValues         - Pointer to the values to scan, can be NULL only when p_uNValues is zero
+ * @param[in]   p_uNValues         - Numbers of values in p_piValues
+ * @param[out]  p_piMin            - Pointer to the minimum value, updated in place
+ * @param[out]  p_piMax            - Pointer to the maximum value, updated in place
+ */
+void eDSP_BLOCKSCAN_MinMaxI64(const int64_t* p_piValues, const uint32_t p_uNValues, int64_t* const p_piMin,
+                              int64_t* const p_piMax);
+
+/**
+ * @brief       Find the minimum and the maximum value of a block of uint32_t, like eDSP_BLOCKSCAN_MinMaxI64. Init
+ *              p_puMin and p_puMax with MAX_UINT32VAL and MIN_UINT32VAL before the first scan. 32 bit compare are
+ *              available on every SIMD instruction set, so the plain loop is left to the compiler.
+ * @param[in]   p_puValues         - Pointer to the values to scan, can be NULL only when p_uNValues is zero
+ * @param[in]   p_uNValues         - Numbers of values in p_puValues
+ * @param[out]  p_puMin            - Pointer to the minimum value, updated in place
+ * @param[out]  p_puMax            - Pointer to the maximum value, updated in place
+ */
+void eDSP_BLOCKSCAN_MinMaxU32(const uint32_t* p_puValues, const uint32_t p_uNValues, uint32_t* const p_puMin,
+                              uint32_t* const p_puMax);
+
+/**
+ * @brief       Given the range of a set of values, check if a window of p_uWindowsLen of them can be processed with
+ *              unchecked arithmetic: every sum of up to p_uWindowsLen values, and every difference between two values
+ *              of the range, fit the int64_t storage area. The mean of the window is inside the range too, so its
+ *              distance from any value of the window fit as well.
+ * @param[in]   p_iMin             - Minimum value of the set
+ * @param[in]   p_iMax             - Maximum value of the set
+ * @param[in]   p_uWindowsLen      - Numbers of values of the window
+ *
+ * @return      true when no overflow is possible, false when the values must be processed with checked operations
+ */
+bool_t eDSP_BLOCKSCAN_IsWindowSafe(const int64_t p_iMin, const int64_t p_iMax, const uint32_t p_uWindowsLen);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_BLOCKSCAN_H */
\ No newline at end of file
@@ -31,9 +31,16 @@ extern "C" {
 typedef enum
 {
     e_eDSP_MAXCHECK_RES_OK = 0,
-    e_eDSP_MAXCHECK_OVERFLOW
+    e_eDSP_MAXCHECK_OVERFLOW,
+    e_eDSP_MAXCHECK_BADPARAM
 }e_eDSP_MAXCHECK_RES;
 
+#if defined(__SIZEOF_INT128__)
+/* __int128 is a compiler extension, declared once with __extension__ so a pedantic ISO C build doesn't warn */
+__extension__ typedef __int128 t_eDSP_MAXCHECK_I128;
+__extension__ typedef unsigned __int128 t_eDSP_MAXCHECK_U128;
+#endif
+
 
 
 /***********************************************************************************************************************
@@ -69,6 +76,97 @@ e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_SUBTI64Check(const int64_t p_iFirst, const int
  */
 e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_MOLTIPI64Check(const int64_t p_iFirst, const int64_t p_iSecond);
 
+/**
+ * @brief       Given two value calculate the sum ( p_iFirst + p_iSecond ) and check if it exceed the int64_t storage
+ *              area, in a single operation. When the library is built with EDSP_CONFIG_BUILTINOVERFLOW defined the
+ *              compiler builtin __builtin_add_overflow is used, and the compiler must support it.
+ * @param[in]   p_iFirst           - First operator
+ * @param[in]   p_iSecond          - Second operator
+ * @param[out]  p_piRes            - Pointer to an int64_t where the result will be placed, only if no overflow occour
+ *
+ * @return      e_eDSP_MAXCHECK_OVERFLOW         - Operation exceed limits
+ *              e_eDSP_MAXCHECK_RES_OK           - Operation dosen't exceed limits
+ */
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_AddI64(const int64_t p_iFirst, const int64_t p_iSecond, int64_t* const p_piRes);
+
+/**
+ * @brief       Given two value calculate the subtration ( p_iFirst - p_iSecond ) and check if it exceed the int64_t
+ *              storage area, in a single operation. When the library is built with EDSP_CONFIG_BUILTINOVERFLOW
+ *              defined the compiler builtin __builtin_sub_overflow is used, and the compiler must support it.
+ * @param[in]   p_iFirst           - First operator
+ * @param[in]   p_iSecond          - Second operator
+ * @param[out]  p_piRes            - Pointer to an int64_t where the result will be placed, only if no overflow occour
+ *
+ * @return      e_eDSP_MAXCHECK_OVERFLOW         - Operation exceed limits
+ *              e_eDSP_MAXCHECK_RES_OK           - Operation dosen't exceed limits
+ */
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_SubI64(const int64_t p_iFirst, const int64_t p_iSecond, int64_t* const p_piRes);
+
+/**
+ * @brief       Given two value calculate the moltiplication ( p_iFirst * p_iSecond ) and check if it exceed the
+ *              int64_t storage area, in a single operation. No division is used. When the library is built with
+ *              EDSP_CONFIG_BUILTINOVERFLOW defined the compiler builtin __builtin_mul_overflow is used, and the
+ *              compiler must support it.
+ * @param[in]   p_iFirst           - First operator
+ * @param[in]   p_iSecond          - Second operator
+ * @param[out]  p_piRes            - Pointer to an int64_t where the result will be placed, only if no overflow occour
+ *
+ * @return      e_eDSP_MAXCHECK_OVERFLOW         - Operation exceed limits
+ *              e_eDSP_MAXCHECK_RES_OK           - Operation dosen't exceed limits
+ */
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_MulI64(const int64_t p_iFirst, const int64_t p_iSecond, int64_t* const p_piRes);
+
+/**
+ * @brief       Given three value calculate ( p_iFirst * p_iSecond ) / p_iDivisor and check if it exceed the int64_t
+ *              storage area. The moltiplication is done on 128 bit, so only the final result must fit in an
+ *              int64_t, and the precision is the same of a single division. The result is truncated toward zero,
+ *              like the C division. When the product fit in 64 bit a single native division is used, otherwise a
+ *              long division on 32 bit digits, or the compiler 128 bit division when the library is built with
+ *              EDSP_CONFIG_BUILTINOVERFLOW defined and the compiler support unsigned __int128.
+ * @param[in]   p_iFirst           - First operator
+ * @param[in]   p_iSecond          - Second operator
+ * @param[in]   p_iDivisor         - Divisor, cannot be zero
+ * @param[out]  p_piRes            - Pointer to an int64_t where the result will be placed, only if no error occour
+ *
+ * @return      e_eDSP_MAXCHECK_BADPARAM         - The divisor is zero
+ *              e_eDSP_MAXCHECK_OVERFLOW         - Operation exceed limits
+ *              e_eDSP_MAXCHECK_RES_OK           - Operation dosen't exceed limits
+ */
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_MulDivI64(const int64_t p_iFirst, const int64_t p_iSecond, const int64_t p_iDivisor,
+                                            int64_t* const p_piRes);
+
+/**
+ * @brief       Divide a 128 bit value, stored as a signed high part and an unsigned low part, by an int64_t divisor
+ *              and check if the quotient exceed the int64_t storage area. The result is truncated toward zero, like
+ *              the C division. The division is done like in eDSP_MAXCHECK_MulDivI64, with a single native division
+ *              when the absolute value of the dividend fit in 64 bit.
+ * @param[in]   p_iHigh            - High 64 bit of the dividend, with the sign
+ * @param[in]   p_uLow             - Low 64 bit of the dividend
+ * @param[in]   p_iDivisor         - Divisor, cannot be zero
+ * @param[out]  p_piRes            - Pointer to an int64_t where the result will be placed, only if no error occour
+ *
+ * @return      e_eDSP_MAXCHECK_BADPARAM         - The divisor is zero
+ *              e_eDSP_MAXCHECK_OVERFLOW         - Operation exceed limits
+ *              e_eDSP_MAXCHECK_RES_OK           - Operation dosen't exceed limits
+ */
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_DivI128(const int64_t p_iHigh, const uint64_t p_uLow, const int64_t p_iDivisor,
+                                          int64_t* const p_piRes);
+
+/**
+ * @brief       Add the product ( p_iFirst * p_iSecond ) to a 128 bit value, stored as a signed high part and an
+ *              unsigned low part, and check if the sum exceed the 128 bit storage area. The moltiplication is exact,
+ *              so a sum of many products can be kept without losing any bit.
+ * @param[in]   p_iFirst           - First operator
+ * @param[in]   p_iSecond          - Second operator
+ * @param[out]  p_piHigh           - Pointer to the high 64 bit of the sum, updated only if no overflow occour
+ * @param[out]  p_puLow            - Pointer to the low 64 bit of the sum, updated only if no overflow occour
+ *
+ * @return      e_eDSP_MAXCHECK_OVERFLOW         - Operation exceed limits
+ *              e_eDSP_MAXCHECK_RES_OK           - Operation dosen't exceed limits
+ */
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_MulAddI128(const int64_t p_iFirst, const int64_t p_iSecond, int64_t* const p_piHigh,
+                                             uint64_t* const p_puLow);
+
 
 
 #ifdef __cplusplus
@@ -0,0 +1,61 @@
+/**
+ * @file       eDSP_Q31ARITH.h
+ *
+ * @brief      Q31 coefficient arithmetic shared by the first order filters
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_Q31ARITH_H
+#define EDSP_Q31ARITH_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Calculate the alpha of a first order RC filter, alpha = dt / ( RC + dt ), in Q31. The result is
+ *              rounded to the nearest and is never greater than one, when RC is negligible compared to dt alpha is
+ *              one.
+ * @param[in]   p_uCutFreqMilHz    - Cutoff frequency of the filter in milli Hertz
+ * @param[in]   p_uTimeUs          - Time elapsed in micro seconds, cannot be zero
+ *
+ * @return      Alpha in Q31, between 0 and 2^31
+ */
+uint32_t eDSP_Q31ARITH_CalcAlpha(const uint64_t p_uCutFreqMilHz, const uint64_t p_uTimeUs);
+
+/**
+ * @brief       Given a value and a Q31 coefficient calculate p_iValue * p_uCoeffQ31 / 2^31, rounded to the nearest.
+ *              The product is split so it is done on 64 bit and never overflow when the coefficient is not greater
+ *              than one.
+ * @param[in]   p_iValue           - Value to scale
+ * @param[in]   p_uCoeffQ31        - Coefficient in Q31, cannot be greater than 2^31
+ *
+ * @return      The scaled value
+ */
+int64_t eDSP_Q31ARITH_MulI64(const int64_t p_iValue, const uint32_t p_uCoeffQ31);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_Q31ARITH_H */
\ No newline at end of file
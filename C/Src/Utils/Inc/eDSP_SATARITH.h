@@ -0,0 +1,104 @@
+/**
+ * @file       eDSP_SATARITH.h
+ *
+ * @brief      Saturating arithmetic on int64_t values
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_SATARITH_H
+#define EDSP_SATARITH_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Given two value calculate p_iFirst + p_iSecond clamped to the int64_t storage area. When the result is
+ *              clamped the saturation counter is incremented, the counter itself never wrap around.
+ * @param[in]   p_iFirst           - First operator
+ * @param[in]   p_iSecond          - Second operator
+ * @param[out]  p_puSatCnt         - Pointer to the saturation counter to increment when the result is clamped
+ *
+ * @return      The clamped result
+ */
+int64_t eDSP_SATARITH_AddI64(const int64_t p_iFirst, const int64_t p_iSecond, uint32_t* const p_puSatCnt);
+
+/**
+ * @brief       Given two value calculate p_iFirst - p_iSecond clamped to the int64_t storage area. When the result is
+ *              clamped the saturation counter is incremented, the counter itself never wrap around.
+ * @param[in]   p_iFirst           - First operator
+ * @param[in]   p_iSecond          - Second operator
+ * @param[out]  p_puSatCnt         - Pointer to the saturation counter to increment when the result is clamped
+ *
+ * @return      The clamped result
+ */
+int64_t eDSP_SATARITH_SubI64(const int64_t p_iFirst, const int64_t p_iSecond, uint32_t* const p_puSatCnt);
+
+/**
+ * @brief       Given two value calculate p_iFirst * p_iSecond clamped to the int64_t storage area. When the result is
+ *              clamped the saturation counter is incremented, the counter itself never wrap around.
+ * @param[in]   p_iFirst           - First operator
+ * @param[in]   p_iSecond          - Second operator
+ * @param[out]  p_puSatCnt         - Pointer to the saturation counter to increment when the result is clamped
+ *
+ * @return      The clamped result
+ */
+int64_t eDSP_SATARITH_MulI64(const int64_t p_iFirst, const int64_t p_iSecond, uint32_t* const p_puSatCnt);
+
+/**
+ * @brief       Given three value calculate ( p_iFirst * p_iSecond ) / p_iDivisor clamped to the int64_t storage area.
+ *              The product is kept on 128 bit and divided like eDSP_MAXCHECK_MulDivI64, with a single native
+ *              division when it fit in 64 bit; only that choice depend on the operators, the clamp is branch-free.
+ *              A zero divisor saturate to the sign of the product, and a zero product is always zero. When the result
+ *              is clamped the saturation counter is incremented, the counter itself never wrap around.
+ * @param[in]   p_iFirst           - First operator
+ * @param[in]   p_iSecond          - Second operator
+ * @param[in]   p_iDivisor         - Divisor
+ * @param[out]  p_puSatCnt         - Pointer to the saturation counter to increment when the result is clamped
+ *
+ * @return      The clamped result
+ */
+int64_t eDSP_SATARITH_MulDivI64(const int64_t p_iFirst, const int64_t p_iSecond, const int64_t p_iDivisor,
+                                uint32_t* const p_puSatCnt);
+
+/**
+ * @brief       Divide a 128 bit value, stored as a signed high part and an unsigned low part, by an int64_t divisor
+ *              and clamp the quotient to the int64_t storage area. The division is the one of eDSP_MAXCHECK_DivI128,
+ *              native when the dividend fit in 64 bit. A zero divisor saturate to the sign of the dividend, and a
+ *              zero dividend is always zero. When the result is clamped the saturation counter is
+ *              incremented, the counter itself never wrap around.
+ * @param[in]   p_iHigh            - High 64 bit of the dividend, with the sign
+ * @param[in]   p_uLow             - Low 64 bit of the dividend
+ * @param[in]   p_iDivisor         - Divisor
+ * @param[out]  p_puSatCnt         - Pointer to the saturation counter to increment when the result is clamped
+ *
+ * @return      The clamped result
+ */
+int64_t eDSP_SATARITH_DivI128(const int64_t p_iHigh, const uint64_t p_uLow, const int64_t p_iDivisor,
+                              uint32_t* const p_puSatCnt);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_SATARITH_H */
\ No newline at end of file
@@ -0,0 +1,229 @@
+/**
+ * @file       eDSP_BLOCKSCAN.c
+ *
+ * @brief      Scan a block of int64_t values to prove that an operation on it can't overflow
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_BLOCKSCAN.h"
+#include "eDSP_MAXCHECK.h"
+
+#ifdef EDSP_CONFIG_X86SIMD
+    #include <immintrin.h>
+#endif
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+#ifdef EDSP_CONFIG_X86SIMD
+static uint32_t eDSP_BLOCKSCAN_MinMaxSimd(const int64_t* p_piValues, const uint32_t p_uNValues,
+                                          int64_t* const p_piMin, int64_t* const p_piMax);
+static uint32_t eDSP_BLOCKSCAN_MinMaxAvx2(const int64_t* p_piValues, const uint32_t p_uNValues,
+                                          int64_t* const p_piMin, int64_t* const p_piMax);
+static uint32_t eDSP_BLOCKSCAN_MinMaxAvx512(const int64_t* p_piValues, const uint32_t p_uNValues,
+                                            int64_t* const p_piMin, int64_t* const p_piMax);
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_BLOCKSCAN_MinMaxI64(const int64_t* p_piValues, const uint32_t p_uNValues, int64_t* const p_piMin,
+                              int64_t* const p_piMax)
+{
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	int64_t  l_iMin;
+	int64_t  l_iMax;
+
+	l_iMin = *p_piMin;
+	l_iMax = *p_piMax;
+	l_uCnt = 0u;
+
+#ifdef EDSP_CONFIG_X86SIMD
+	l_uCnt = eDSP_BLOCKSCAN_MinMaxSimd(p_piValues, p_uNValues, &l_iMin, &l_iMax);
+#endif
+
+	/* Remaining values, or the whole block when no kernel is available */
+	for( ; l_uCnt < p_uNValues; l_uCnt++ )
+	{
+		if( p_piValues[l_uCnt] < l_iMin )
+		{
+			l_iMin = p_piValues[l_uCnt];
+		}
+
+		if( p_piValues[l_uCnt] > l_iMax )
+		{
+			l_iMax = p_piValues[l_uCnt];
+		}
+	}
+
+	*p_piMin = l_iMin;
+	*p_piMax = l_iMax;
+}
+
+void eDSP_BLOCKSCAN_MinMaxU32(const uint32_t* p_puValues, const uint32_t p_uNValues, uint32_t* const p_puMin,
+                              uint32_t* const p_puMax)
+{
+	/* Local variable for calculation */
+	uint32_t l_uCnt;
+	uint32_t l_uMin;
+	uint32_t l_uMax;
+
+	l_uMin = *p_puMin;
+	l_uMax = *p_puMax;
+
+	for( l_uCnt = 0u; l_uCnt < p_uNValues; l_uCnt++ )
+	{
+		if( p_puValues[l_uCnt] < l_uMin )
+		{
+			l_uMin = p_puValues[l_uCnt];
+		}
+
+		if( p_puValues[l_uCnt] > l_uMax )
+		{
+			l_uMax = p_puValues[l_uCnt];
+		}
+	}
+
+	*p_puMin = l_uMin;
+	*p_puMax = l_uMax;
+}
+
+bool_t eDSP_BLOCKSCAN_IsWindowSafe(const int64_t p_iMin, const int64_t p_iMax, const uint32_t p_uWindowsLen)
+{
+	/* Local variable for return */
+	bool_t l_bRes;
+
+	/* Local variable for calculation */
+	int64_t l_iDummy;
+
+	/* A partial sum of n <= p_uWindowsLen values is between n * p_iMin and n * p_iMax, so it is enough to check the
+	   two full window bounds. When p_iMin is positive the lower bound is zero and can't overflow, same for p_iMax */
+	if( p_iMin > p_iMax )
+	{
+		/* Empty range, nothing was scanned */
+		l_bRes = false;
+	}
+	else if( ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_MulI64(p_iMin, (int64_t) p_uWindowsLen, &l_iDummy) ) ||
+			 ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_MulI64(p_iMax, (int64_t) p_uWindowsLen, &l_iDummy) ) ||
+			 ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_SubI64(p_iMax, p_iMin, &l_iDummy) ) )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+		l_bRes = true;
+	}
+
+	return l_bRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+#ifdef EDSP_CONFIG_X86SIMD
+static uint32_t eDSP_BLOCKSCAN_MinMaxSimd(const int64_t* p_piValues, const uint32_t p_uNValues,
+                                          int64_t* const p_piMin, int64_t* const p_piMax)
+{
+	/* Local variable */
+	uint32_t l_uDone;
+
+	/* Use the widest kernel supported by the running CPU, the remaining values are done by the portable loop */
+	if( __builtin_cpu_supports("avx512f") )
+	{
+		l_uDone = eDSP_BLOCKSCAN_MinMaxAvx512(p_piValues, p_uNValues, p_piMin, p_piMax);
+	}
+	else if( __builtin_cpu_supports("avx2") )
+	{
+		l_uDone = eDSP_BLOCKSCAN_MinMaxAvx2(p_piValues, p_uNValues, p_piMin, p_piMax);
+	}
+	else
+	{
+		l_uDone = 0u;
+	}
+
+	return l_uDone;
+}
+
+__attribute__((target("avx2")))
+static uint32_t eDSP_BLOCKSCAN_MinMaxAvx2(const int64_t* p_piValues, const uint32_t p_uNValues,
+                                          int64_t* const p_piMin, int64_t* const p_piMax)
+{
+	/* Local variable */
+	uint32_t l_uCnt;
+	uint32_t l_uLane;
+	__m256i l_tIn;
+	__m256i l_tMin;
+	__m256i l_tMax;
+	int64_t l_aiMin[4u];
+	int64_t l_aiMax[4u];
+
+	l_tMin = _mm256_set1_epi64x(*p_piMin);
+	l_tMax = _mm256_set1_epi64x(*p_piMax);
+
+	/* AVX2 has no 64 bit min and max, select the lanes with the signed compare */
+	for( l_uCnt = 0u; ( l_uCnt + 4u ) <= p_uNValues; l_uCnt += 4u )
+	{
+		l_tIn = _mm256_loadu_si256( (const __m256i*) &p_piValues[l_uCnt] );
+		l_tMin = _mm256_blendv_epi8(l_tMin, l_tIn, _mm256_cmpgt_epi64(l_tMin, l_tIn));
+		l_tMax = _mm256_blendv_epi8(l_tMax, l_tIn, _mm256_cmpgt_epi64(l_tIn, l_tMax));
+	}
+
+	/* Reduce the lanes */
+	_mm256_storeu_si256( (__m256i*) l_aiMin, l_tMin );
+	_mm256_storeu_si256( (__m256i*) l_aiMax, l_tMax );
+
+	for( l_uLane = 0u; l_uLane < 4u; l_uLane++ )
+	{
+		if( l_aiMin[l_uLane] < *p_piMin )
+		{
+			*p_piMin = l_aiMin[l_uLane];
+		}
+
+		if( l_aiMax[l_uLane] > *p_piMax )
+		{
+			*p_piMax = l_aiMax[l_uLane];
+		}
+	}
+
+	return l_uCnt;
+}
+
+__attribute__((target("avx512f")))
+static uint32_t eDSP_BLOCKSCAN_MinMaxAvx512(const int64_t* p_piValues, const uint32_t p_uNValues,
+                                            int64_t* const p_piMin, int64_t* const p_piMax)
+{
+	/* Local variable */
+	uint32_t l_uCnt;
+	__m512i l_tIn;
+	__m512i l_tMin;
+	__m512i l_tMax;
+
+	l_tMin = _mm512_set1_epi64(*p_piMin);
+	l_tMax = _mm512_set1_epi64(*p_piMax);
+
+	for( l_uCnt = 0u; ( l_uCnt + 8u ) <= p_uNValues; l_uCnt += 8u )
+	{
+		l_tIn = _mm512_loadu_si512( (const void*) &p_piValues[l_uCnt] );
+		l_tMin = _mm512_min_epi64(l_tMin, l_tIn);
+		l_tMax = _mm512_max_epi64(l_tMax, l_tIn);
+	}
+
+	/* Reduce the lanes */
+	*p_piMin = _mm512_reduce_min_epi64(l_tMin);
+	*p_piMax = _mm512_reduce_max_epi64(l_tMax);
+
+	return l_uCnt;
+}
+#endif
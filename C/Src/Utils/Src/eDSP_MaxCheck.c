@@ -14,6 +14,24 @@
 
 
 
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_MAXCHECK_MulU64(const uint64_t p_uFirst, const uint64_t p_uSecond, uint64_t* const p_puHigh,
+                                 uint64_t* const p_puLow);
+static uint64_t eDSP_MAXCHECK_DivU128(const uint64_t p_uHigh, const uint64_t p_uLow, const uint64_t p_uDivisor);
+#if !( defined(EDSP_CONFIG_BUILTINOVERFLOW) && defined(__SIZEOF_INT128__) )
+static uint32_t eDSP_MAXCHECK_CountLeadZero(const uint64_t p_uValue);
+static uint64_t eDSP_MAXCHECK_DivDigit(const uint64_t p_uNum, const uint64_t p_uNextDigit, const uint64_t p_uDivHigh,
+                                       const uint64_t p_uDivLow);
+#endif
+static uint64_t eDSP_MAXCHECK_AbsI64(const int64_t p_iValue);
+static e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_DivAbs(const uint64_t p_uHigh, const uint64_t p_uLow,
+                                                const uint64_t p_uDivisorAbs, const bool_t p_bIsNeg,
+                                                int64_t* const p_piRes);
+
+
+
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
  **********************************************************************************************************************/
@@ -22,108 +40,558 @@ e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_SUMI64Check(const int64_t p_iFirst, const int6
 	/* Local variable for return */
 	e_eDSP_MAXCHECK_RES l_eRes;
 
-	/* overflow can occour only if both addendd are both positive or negative and not equals to zero */
-	if( ( p_iFirst > 0 ) && ( p_iSecond > 0 ) )
+	/* Local variable for calculation */
+	int64_t l_iRes;
+
+	/* Same check of the fused operation, the result is discarded */
+	l_eRes = eDSP_MAXCHECK_AddI64(p_iFirst, p_iSecond, &l_iRes);
+
+	return l_eRes;
+}
+
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_SUBTI64Check(const int64_t p_iFirst, const int64_t p_iSecond)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
+
+	/* Local variable for calculation */
+	int64_t l_iRes;
+
+	/* Same check of the fused operation, the result is discarded */
+	l_eRes = eDSP_MAXCHECK_SubI64(p_iFirst, p_iSecond, &l_iRes);
+
+	return l_eRes;
+}
+
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_MOLTIPI64Check(const int64_t p_iFirst, const int64_t p_iSecond)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
+
+	/* Local variable for calculation */
+	int64_t l_iRes;
+
+	/* Same check of the fused operation, the result is discarded */
+	l_eRes = eDSP_MAXCHECK_MulI64(p_iFirst, p_iSecond, &l_iRes);
+
+	return l_eRes;
+}
+
+#ifdef EDSP_CONFIG_BUILTINOVERFLOW
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_AddI64(const int64_t p_iFirst, const int64_t p_iSecond, int64_t* const p_piRes)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
+
+	/* Local variable for calculation */
+	int64_t l_iRes;
+
+	/* The compiler use the overflow flag of the addition */
+	if( __builtin_add_overflow(p_iFirst, p_iSecond, &l_iRes) )
 	{
-		if( p_iFirst > ( MAX_INT64VAL - p_iSecond ) )
-		{
-			l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
-		}
-		else
-		{
-			l_eRes = e_eDSP_MAXCHECK_RES_OK;
-		}
+		l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
 	}
-	else if( ( p_iFirst < 0 ) && ( p_iSecond < 0 ) )
+	else
 	{
-		if( p_iFirst < ( MIN_INT64VAL + p_iSecond ) )
-		{
-			l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
-		}
-		else
-		{
-			l_eRes = e_eDSP_MAXCHECK_RES_OK;
-		}
+		*p_piRes = l_iRes;
+		l_eRes = e_eDSP_MAXCHECK_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_SubI64(const int64_t p_iFirst, const int64_t p_iSecond, int64_t* const p_piRes)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
+
+	/* Local variable for calculation */
+	int64_t l_iRes;
+
+	/* The compiler use the overflow flag of the subtration */
+	if( __builtin_sub_overflow(p_iFirst, p_iSecond, &l_iRes) )
+	{
+		l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
 	}
 	else
 	{
-		/* No needs for other check */
+		*p_piRes = l_iRes;
 		l_eRes = e_eDSP_MAXCHECK_RES_OK;
 	}
 
 	return l_eRes;
 }
 
-e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_SUBTI64Check(const int64_t p_iFirst, const int64_t p_iSecond)
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_MulI64(const int64_t p_iFirst, const int64_t p_iSecond, int64_t* const p_piRes)
 {
 	/* Local variable for return */
 	e_eDSP_MAXCHECK_RES l_eRes;
 
-	/* No need to redo the checks, use the SUM but negated */
-	l_eRes = eDSP_MAXCHECK_SUMI64Check( p_iFirst, (int64_t) -p_iSecond );
+	/* Local variable for calculation */
+	int64_t l_iRes;
+
+	/* The compiler use the overflow flag or the high part of the moltiplication, no division is done */
+	if( __builtin_mul_overflow(p_iFirst, p_iSecond, &l_iRes) )
+	{
+		l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
+	}
+	else
+	{
+		*p_piRes = l_iRes;
+		l_eRes = e_eDSP_MAXCHECK_RES_OK;
+	}
 
 	return l_eRes;
 }
+#else
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_AddI64(const int64_t p_iFirst, const int64_t p_iSecond, int64_t* const p_piRes)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
 
-e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_MOLTIPI64Check(const int64_t p_iFirst, const int64_t p_iSecond)
+	/* Local variable for calculation */
+	uint64_t l_uRes;
+
+	/* Calculate using wraparound arithmetic, overflow occour only when both addend have the same sign and the
+	   result has a different one */
+	l_uRes = ( (uint64_t) p_iFirst ) + ( (uint64_t) p_iSecond );
+
+	if( 0u != ( ( ( ( (uint64_t) p_iFirst ) ^ l_uRes ) & ( ( (uint64_t) p_iSecond ) ^ l_uRes ) ) >> 63u ) )
+	{
+		l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
+	}
+	else
+	{
+		*p_piRes = p_iFirst + p_iSecond;
+		l_eRes = e_eDSP_MAXCHECK_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_SubI64(const int64_t p_iFirst, const int64_t p_iSecond, int64_t* const p_piRes)
 {
 	/* Local variable for return */
 	e_eDSP_MAXCHECK_RES l_eRes;
 
-	/* Need to check every condition, because signess varies the result */
-	if( ( p_iFirst == 0 ) || ( p_iSecond == 0 ) )
+	/* Local variable for calculation */
+	uint64_t l_uRes;
+
+	/* Calculate using wraparound arithmetic, overflow occour only when the operators have different sign and the
+	   result has not the sign of the first one. MIN_INT64VAL is never negated */
+	l_uRes = ( (uint64_t) p_iFirst ) - ( (uint64_t) p_iSecond );
+
+	if( 0u != ( ( ( ( (uint64_t) p_iFirst ) ^ ( (uint64_t) p_iSecond ) ) & ( ( (uint64_t) p_iFirst ) ^ l_uRes ) ) >>
+	            63u ) )
+	{
+		l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
+	}
+	else
 	{
-		/* Always equals to zero, so no problem */
+		*p_piRes = p_iFirst - p_iSecond;
 		l_eRes = e_eDSP_MAXCHECK_RES_OK;
 	}
-	else if( ( p_iFirst > 0 ) && ( p_iSecond > 0 ) )
+
+	return l_eRes;
+}
+
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_MulI64(const int64_t p_iFirst, const int64_t p_iSecond, int64_t* const p_piRes)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint64_t l_uFirstAbs;
+	uint64_t l_uSecondAbs;
+	uint64_t l_uHigh;
+	uint64_t l_uLow;
+	uint64_t l_uMaxAbs;
+	bool_t   l_bIsNeg;
+
+	/* Moltiply the absolute values on 128 bit, the absolute value of MIN_INT64VAL is 2^63 and can be stored in an
+	   uint64_t. No division is needed to detect the overflow */
+	l_uFirstAbs = eDSP_MAXCHECK_AbsI64(p_iFirst);
+	l_uSecondAbs = eDSP_MAXCHECK_AbsI64(p_iSecond);
+	l_uMaxAbs = (uint64_t) MAX_INT64VAL;
+	l_bIsNeg = ( ( p_iFirst < 0 ) != ( p_iSecond < 0 ) );
+
+	if( true == l_bIsNeg )
+	{
+		/* A negative result can reach MIN_INT64VAL */
+		l_uMaxAbs++;
+	}
+
+	eDSP_MAXCHECK_MulU64(l_uFirstAbs, l_uSecondAbs, &l_uHigh, &l_uLow);
+
+	if( ( 0u != l_uHigh ) || ( l_uLow > l_uMaxAbs ) )
+	{
+		l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
+	}
+	else
 	{
-		/* Positive result */
-		if( p_iFirst > ( MAX_INT64VAL / p_iSecond ) )
+		if( ( true == l_bIsNeg ) && ( 0u != l_uLow ) )
 		{
-			l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
+			/* l_uLow - 1 always fit in an int64_t, even when the result is MIN_INT64VAL */
+			*p_piRes = -( (int64_t) ( l_uLow - 1u ) ) - 1;
 		}
 		else
 		{
-			l_eRes = e_eDSP_MAXCHECK_RES_OK;
+			*p_piRes = (int64_t) l_uLow;
 		}
+
+		l_eRes = e_eDSP_MAXCHECK_RES_OK;
 	}
-	else if( ( p_iFirst < 0 ) && ( p_iSecond < 0 ) )
+
+	return l_eRes;
+}
+#endif
+
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_MulDivI64(const int64_t p_iFirst, const int64_t p_iSecond, const int64_t p_iDivisor,
+                                            int64_t* const p_piRes)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint64_t l_uHigh;
+	uint64_t l_uLow;
+	bool_t   l_bIsNeg;
+
+	if( 0 == p_iDivisor )
 	{
-		/* Positive result */
-		if( p_iFirst < ( MAX_INT64VAL / p_iSecond ) )
+		l_eRes = e_eDSP_MAXCHECK_BADPARAM;
+	}
+	else
+	{
+		/* Work on the absolute values, the product is exact on 128 bit */
+		l_bIsNeg = ( ( ( p_iFirst < 0 ) != ( p_iSecond < 0 ) ) != ( p_iDivisor < 0 ) );
+		eDSP_MAXCHECK_MulU64(eDSP_MAXCHECK_AbsI64(p_iFirst), eDSP_MAXCHECK_AbsI64(p_iSecond), &l_uHigh, &l_uLow);
+
+		l_eRes = eDSP_MAXCHECK_DivAbs(l_uHigh, l_uLow, eDSP_MAXCHECK_AbsI64(p_iDivisor), l_bIsNeg, p_piRes);
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_DivI128(const int64_t p_iHigh, const uint64_t p_uLow, const int64_t p_iDivisor,
+                                          int64_t* const p_piRes)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint64_t l_uHigh;
+	uint64_t l_uLow;
+	bool_t   l_bIsNeg;
+
+	if( 0 == p_iDivisor )
+	{
+		l_eRes = e_eDSP_MAXCHECK_BADPARAM;
+	}
+	else
+	{
+		/* Absolute value of the dividend, the two's complement is done on the two parts with the carry */
+		l_uHigh = (uint64_t) p_iHigh;
+		l_uLow = p_uLow;
+
+		if( p_iHigh < 0 )
 		{
-			l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
+			l_uLow = 0u - p_uLow;
+			l_uHigh = ~l_uHigh;
+
+			if( 0u == p_uLow )
+			{
+				l_uHigh++;
+			}
+		}
+
+		l_bIsNeg = ( ( p_iHigh < 0 ) != ( p_iDivisor < 0 ) );
+
+		l_eRes = eDSP_MAXCHECK_DivAbs(l_uHigh, l_uLow, eDSP_MAXCHECK_AbsI64(p_iDivisor), l_bIsNeg, p_piRes);
+	}
+
+	return l_eRes;
+}
+
+e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_MulAddI128(const int64_t p_iFirst, const int64_t p_iSecond, int64_t* const p_piHigh,
+                                             uint64_t* const p_puLow)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint64_t l_uHigh;
+	uint64_t l_uLow;
+	uint64_t l_uSumHigh;
+	uint64_t l_uSumLow;
+
+	/* Product of the absolute values, at most 2^126 so its two's complement can be stored in 128 bit too */
+	eDSP_MAXCHECK_MulU64(eDSP_MAXCHECK_AbsI64(p_iFirst), eDSP_MAXCHECK_AbsI64(p_iSecond), &l_uHigh, &l_uLow);
+
+	if( ( p_iFirst < 0 ) != ( p_iSecond < 0 ) )
+	{
+		l_uHigh = ~l_uHigh;
+
+		if( 0u == l_uLow )
+		{
+			l_uHigh++;
+		}
+
+		l_uLow = 0u - l_uLow;
+	}
+
+	/* Sum with the carry from the low part */
+	l_uSumLow = *p_puLow + l_uLow;
+	l_uSumHigh = ( (uint64_t) *p_piHigh ) + l_uHigh;
+
+	if( l_uSumLow < l_uLow )
+	{
+		l_uSumHigh++;
+	}
+
+	/* Like on 64 bit, the sum overflow only when both operand have the same sign and the result have the other one */
+	if( ( 0u == ( ( ( (uint64_t) *p_piHigh ) ^ l_uHigh ) >> 63u ) ) &&
+		( 0u != ( ( l_uSumHigh ^ l_uHigh ) >> 63u ) ) )
+	{
+		l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
+	}
+	else
+	{
+		*p_puLow = l_uSumLow;
+
+		if( 0u != ( l_uSumHigh >> 63u ) )
+		{
+			/* Negative high part, converted without an implementation defined cast */
+			*p_piHigh = -( (int64_t) ( ~l_uSumHigh ) ) - 1;
 		}
 		else
 		{
-			l_eRes = e_eDSP_MAXCHECK_RES_OK;
+			*p_piHigh = (int64_t) l_uSumHigh;
 		}
+
+		l_eRes = e_eDSP_MAXCHECK_RES_OK;
 	}
-	else if( ( p_iFirst > 0 ) && ( p_iSecond < 0 ) )
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_MAXCHECK_MulU64(const uint64_t p_uFirst, const uint64_t p_uSecond, uint64_t* const p_puHigh,
+                                 uint64_t* const p_puLow)
+{
+#if defined(EDSP_CONFIG_BUILTINOVERFLOW) && defined(__SIZEOF_INT128__)
+	/* Local variable for calculation */
+	t_eDSP_MAXCHECK_U128 l_uProd;
+
+	/* The compiler use the native 64 x 64 bit moltiplication */
+	l_uProd = ( (t_eDSP_MAXCHECK_U128) p_uFirst ) * p_uSecond;
+
+	*p_puLow = (uint64_t) l_uProd;
+	*p_puHigh = (uint64_t) ( l_uProd >> 64u );
+#else
+	/* Local variable for calculation */
+	uint64_t l_uFL;
+	uint64_t l_uFH;
+	uint64_t l_uSL;
+	uint64_t l_uSH;
+	uint64_t l_uLL;
+	uint64_t l_uLH;
+	uint64_t l_uHL;
+	uint64_t l_uHH;
+	uint64_t l_uMid;
+
+	/* Schoolbook moltiplication on 32 bit halves, every partial product fit in 64 bit */
+	l_uFL = p_uFirst & MAX_UINT32VAL;
+	l_uFH = p_uFirst >> 32u;
+	l_uSL = p_uSecond & MAX_UINT32VAL;
+	l_uSH = p_uSecond >> 32u;
+
+	l_uLL = l_uFL * l_uSL;
+	l_uLH = l_uFL * l_uSH;
+	l_uHL = l_uFH * l_uSL;
+	l_uHH = l_uFH * l_uSH;
+
+	/* Sum of the middle terms and the carry from the low one, can't overflow */
+	l_uMid = ( l_uLL >> 32u ) + ( l_uLH & MAX_UINT32VAL ) + ( l_uHL & MAX_UINT32VAL );
+
+	*p_puLow = ( l_uMid << 32u ) | ( l_uLL & MAX_UINT32VAL );
+	*p_puHigh = l_uHH + ( l_uLH >> 32u ) + ( l_uHL >> 32u ) + ( l_uMid >> 32u );
+#endif
+}
+
+static uint64_t eDSP_MAXCHECK_DivU128(const uint64_t p_uHigh, const uint64_t p_uLow, const uint64_t p_uDivisor)
+{
+#if defined(EDSP_CONFIG_BUILTINOVERFLOW) && defined(__SIZEOF_INT128__)
+	/* The caller guarantee p_uHigh < p_uDivisor, so the quotient fit in 64 bit and the compiler can use its 128 bit
+	   division routine */
+	return (uint64_t) ( ( ( ( (t_eDSP_MAXCHECK_U128) p_uHigh ) << 64u ) | p_uLow ) / p_uDivisor );
+#else
+	/* Local variable for calculation */
+	uint64_t l_uDiv;
+	uint64_t l_uNumHigh;
+	uint64_t l_uNumLow;
+	uint64_t l_uQuotHigh;
+	uint64_t l_uQuotLow;
+	uint64_t l_uRem;
+	uint32_t l_uShift;
+
+	/* Long division on 32 bit digits (Knuth algorithm D). The divisor is normalized to have the top bit set, so
+	   every digit of the quotient is estimated with a native 64 bit division and corrected at most two times. The
+	   caller guarantee p_uHigh < p_uDivisor, so the quotient fit in 64 bit */
+	l_uShift = eDSP_MAXCHECK_CountLeadZero(p_uDivisor);
+	l_uDiv = p_uDivisor << l_uShift;
+	l_uNumHigh = p_uHigh << l_uShift;
+	l_uNumLow = p_uLow << l_uShift;
+
+	if( l_uShift > 0u )
+	{
+		l_uNumHigh |= p_uLow >> ( 64u - l_uShift );
+	}
+
+	/* High digit, then the remainder is lower than the divisor and is used for the low digit */
+	l_uQuotHigh = eDSP_MAXCHECK_DivDigit(l_uNumHigh, l_uNumLow >> 32u, l_uDiv >> 32u, l_uDiv & MAX_UINT32VAL);
+	l_uRem = ( ( l_uNumHigh << 32u ) | ( l_uNumLow >> 32u ) ) - ( l_uQuotHigh * l_uDiv );
+	l_uQuotLow = eDSP_MAXCHECK_DivDigit(l_uRem, l_uNumLow & MAX_UINT32VAL, l_uDiv >> 32u, l_uDiv & MAX_UINT32VAL);
+
+	return ( l_uQuotHigh << 32u ) | l_uQuotLow;
+#endif
+}
+
+#if !( defined(EDSP_CONFIG_BUILTINOVERFLOW) && defined(__SIZEOF_INT128__) )
+static uint32_t eDSP_MAXCHECK_CountLeadZero(const uint64_t p_uValue)
+{
+	/* Local variable for calculation */
+	uint64_t l_uValue;
+	uint32_t l_uCnt;
+	uint32_t l_uStep;
+
+	/* Binary search of the first bit set, the value is never zero */
+	l_uValue = p_uValue;
+	l_uCnt = 0u;
+
+	for( l_uStep = 32u; l_uStep > 0u; l_uStep = l_uStep >> 1u )
 	{
-		/* Negative result */
-		if( p_iFirst > ( MIN_INT64VAL / p_iSecond ) )
+		if( 0u == ( l_uValue >> ( 64u - l_uStep ) ) )
 		{
-			l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
+			l_uValue = l_uValue << l_uStep;
+			l_uCnt += l_uStep;
+		}
+	}
+
+	return l_uCnt;
+}
+
+static uint64_t eDSP_MAXCHECK_DivDigit(const uint64_t p_uNum, const uint64_t p_uNextDigit, const uint64_t p_uDivHigh,
+                                       const uint64_t p_uDivLow)
+{
+	/* Local variable for calculation */
+	uint64_t l_uQuot;
+	uint64_t l_uRem;
+	bool_t   l_bCorrect;
+
+	/* Estimate the digit ( p_uNum * 2^32 + p_uNextDigit ) / divisor using only the high half of the divisor. The
+	   estimate is never lower than the real digit, and the loop end after at most two corrections */
+	l_uQuot = p_uNum / p_uDivHigh;
+	l_uRem = p_uNum - ( l_uQuot * p_uDivHigh );
+	l_bCorrect = true;
+
+	while( true == l_bCorrect )
+	{
+		if( ( l_uQuot > MAX_UINT32VAL ) || ( ( l_uQuot * p_uDivLow ) > ( ( l_uRem << 32u ) | p_uNextDigit ) ) )
+		{
+			l_uQuot--;
+			l_uRem += p_uDivHigh;
+
+			/* With a remainder of more than 32 bit the check above can't be true anymore */
+			l_bCorrect = ( l_uRem <= MAX_UINT32VAL );
 		}
 		else
 		{
-			l_eRes = e_eDSP_MAXCHECK_RES_OK;
+			l_bCorrect = false;
 		}
 	}
+
+	return l_uQuot;
+}
+#endif
+
+static uint64_t eDSP_MAXCHECK_AbsI64(const int64_t p_iValue)
+{
+	/* Local variable for return */
+	uint64_t l_uRes;
+
+	/* The absolute value of MIN_INT64VAL is 2^63 and can be stored in an uint64_t */
+	if( p_iValue < 0 )
+	{
+		l_uRes = 0u - ( (uint64_t) p_iValue );
+	}
 	else
 	{
-		/* Negative result */
-		if( p_iFirst < ( MIN_INT64VAL / p_iSecond ) )
+		l_uRes = (uint64_t) p_iValue;
+	}
+
+	return l_uRes;
+}
+
+static e_eDSP_MAXCHECK_RES eDSP_MAXCHECK_DivAbs(const uint64_t p_uHigh, const uint64_t p_uLow,
+                                                const uint64_t p_uDivisorAbs, const bool_t p_bIsNeg,
+                                                int64_t* const p_piRes)
+{
+	/* Local variable for return */
+	e_eDSP_MAXCHECK_RES l_eRes;
+
+	/* Local variable for calculation */
+	uint64_t l_uQuot;
+	uint64_t l_uMaxAbs;
+
+	l_uMaxAbs = (uint64_t) MAX_INT64VAL;
+
+	if( true == p_bIsNeg )
+	{
+		/* A negative result can reach MIN_INT64VAL */
+		l_uMaxAbs++;
+	}
+
+	/* When the high part is not lower than the divisor the quotient can't be stored in 64 bit */
+	if( p_uHigh >= p_uDivisorAbs )
+	{
+		l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
+	}
+	else
+	{
+		if( 0u == p_uHigh )
+		{
+			/* Dividend of 64 bit, the native division is enough */
+			l_uQuot = p_uLow / p_uDivisorAbs;
+		}
+		else
+		{
+			l_uQuot = eDSP_MAXCHECK_DivU128(p_uHigh, p_uLow, p_uDivisorAbs);
+		}
+
+		if( l_uQuot > l_uMaxAbs )
 		{
 			l_eRes = e_eDSP_MAXCHECK_OVERFLOW;
 		}
 		else
 		{
+			if( ( true == p_bIsNeg ) && ( 0u != l_uQuot ) )
+			{
+				/* l_uQuot - 1 always fit in an int64_t, even when the result is MIN_INT64VAL */
+				*p_piRes = -( (int64_t) ( l_uQuot - 1u ) ) - 1;
+			}
+			else
+			{
+				*p_piRes = (int64_t) l_uQuot;
+			}
+
 			l_eRes = e_eDSP_MAXCHECK_RES_OK;
 		}
 	}
 
 	return l_eRes;
-}
\ No newline at end of file
+}
@@ -0,0 +1,80 @@
+/**
+ * @file       eDSP_Q31ARITH.c
+ *
+ * @brief      Q31 coefficient arithmetic shared by the first order filters
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_Q31ARITH.h"
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE DEFINE
+ **********************************************************************************************************************/
+/* RC of the filter in micro seconds multiplied by the cutoff frequency in milli Hertz: 10^9 / ( 2 pi ) */
+#define EDSP_Q31ARITH_RCUSMILHZ                                                            ( ( uint64_t ) 159154943u )
+
+/* Unitary value of a Q31 coefficient */
+#define EDSP_Q31ARITH_ONE                                                                  ( ( uint32_t ) 0x80000000u )
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+uint32_t eDSP_Q31ARITH_CalcAlpha(const uint64_t p_uCutFreqMilHz, const uint64_t p_uTimeUs)
+{
+	/* Local variable */
+	uint32_t l_uAlpha;
+	uint64_t l_uNum;
+	uint64_t l_uDen;
+
+	/* alpha = dt / ( RC + dt ) = ( Fc * dt ) / ( ( RC * Fc ) + ( Fc * dt ) ), with Fc in mHz and dt in us */
+	if( ( p_uCutFreqMilHz > ( MAX_UINT64VAL / p_uTimeUs ) ) ||
+		( ( p_uCutFreqMilHz * p_uTimeUs ) > ( MAX_UINT64VAL - EDSP_Q31ARITH_RCUSMILHZ ) ) )
+	{
+		/* RC is negligible compared to dt, alpha is one in Q31 */
+		l_uAlpha = EDSP_Q31ARITH_ONE;
+	}
+	else
+	{
+		l_uNum = p_uCutFreqMilHz * p_uTimeUs;
+		l_uDen = EDSP_Q31ARITH_RCUSMILHZ + l_uNum;
+
+		/* Scale down the fraction so that the numerator can be moved in Q31 without overflow */
+		while( l_uDen > MAX_UINT32VAL )
+		{
+			l_uNum = l_uNum >> 1u;
+			l_uDen = l_uDen >> 1u;
+		}
+
+		/* Round to the nearest, l_uNum <= l_uDen so the result is never greater than one */
+		l_uAlpha = (uint32_t) ( ( ( l_uNum << 31u ) + ( l_uDen >> 1u ) ) / l_uDen );
+	}
+
+	return l_uAlpha;
+}
+
+int64_t eDSP_Q31ARITH_MulI64(const int64_t p_iValue, const uint32_t p_uCoeffQ31)
+{
+	/* Local variable */
+	int64_t l_iHigh;
+	uint64_t l_uLow;
+	uint64_t l_uLowRes;
+
+	/* Split the value in p_iValue = l_iHigh * 2^31 + l_uLow, with l_uLow always positive, so that the products
+	 * fit in 64 bit when the coefficient is not greater than one */
+	l_uLow = ( (uint64_t) p_iValue ) & 0x7FFFFFFFu;
+	l_iHigh = ( p_iValue - ( (int64_t) l_uLow ) ) / ( (int64_t) EDSP_Q31ARITH_ONE );
+
+	/* Low part is rounded to the nearest */
+	l_uLowRes = ( ( l_uLow * p_uCoeffQ31 ) + 0x40000000u ) >> 31u;
+
+	return ( l_iHigh * ( (int64_t) p_uCoeffQ31 ) ) + ( (int64_t) l_uLowRes );
+}
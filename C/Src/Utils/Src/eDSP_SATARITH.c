@@ -0,0 +1,148 @@
+/**
+ * @file       eDSP_SATARITH.c
+ *
+ * @brief      Saturating arithmetic on int64_t values
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_SATARITH.h"
+#include "eDSP_MAXCHECK.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static int64_t eDSP_SATARITH_Select(const uint64_t p_uRes, const uint64_t p_uSat, const uint64_t p_uIsSat,
+                                    uint32_t* const p_puSatCnt);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+int64_t eDSP_SATARITH_AddI64(const int64_t p_iFirst, const int64_t p_iSecond, uint32_t* const p_puSatCnt)
+{
+	/* Local variable for calculation */
+	uint64_t l_uFirst;
+	uint64_t l_uSecond;
+	uint64_t l_uRes;
+	uint64_t l_uSat;
+	uint64_t l_uIsSat;
+
+	/* Calculate using wraparound arithmetic, overflow occour only when both addend have the same sign and the
+	   result has a different one. In that case the result is clamped to the side of the addends */
+	l_uFirst = (uint64_t) p_iFirst;
+	l_uSecond = (uint64_t) p_iSecond;
+	l_uRes = l_uFirst + l_uSecond;
+	l_uIsSat = ( ( l_uFirst ^ l_uRes ) & ( l_uSecond ^ l_uRes ) ) >> 63u;
+	l_uSat = ( l_uFirst >> 63u ) + ( (uint64_t) MAX_INT64VAL );
+
+	return eDSP_SATARITH_Select(l_uRes, l_uSat, l_uIsSat, p_puSatCnt);
+}
+
+int64_t eDSP_SATARITH_SubI64(const int64_t p_iFirst, const int64_t p_iSecond, uint32_t* const p_puSatCnt)
+{
+	/* Local variable for calculation */
+	uint64_t l_uFirst;
+	uint64_t l_uSecond;
+	uint64_t l_uRes;
+	uint64_t l_uSat;
+	uint64_t l_uIsSat;
+
+	/* Calculate using wraparound arithmetic, overflow occour only when the operators have different sign and the
+	   result has not the sign of the first one. In that case the result is clamped to the side of the first one */
+	l_uFirst = (uint64_t) p_iFirst;
+	l_uSecond = (uint64_t) p_iSecond;
+	l_uRes = l_uFirst - l_uSecond;
+	l_uIsSat = ( ( l_uFirst ^ l_uSecond ) & ( l_uFirst ^ l_uRes ) ) >> 63u;
+	l_uSat = ( l_uFirst >> 63u ) + ( (uint64_t) MAX_INT64VAL );
+
+	return eDSP_SATARITH_Select(l_uRes, l_uSat, l_uIsSat, p_puSatCnt);
+}
+
+int64_t eDSP_SATARITH_MulI64(const int64_t p_iFirst, const int64_t p_iSecond, uint32_t* const p_puSatCnt)
+{
+	/* Local variable for calculation */
+	int64_t  l_iRes;
+	uint64_t l_uSat;
+	uint64_t l_uIsSat;
+
+	/* The overflow is detected by the fused moltiplication, the result is clamped to the sign of the product */
+	l_iRes = 0;
+	l_uIsSat = (uint64_t) ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_MulI64(p_iFirst, p_iSecond, &l_iRes) );
+	l_uSat = ( ( ( (uint64_t) p_iFirst ) ^ ( (uint64_t) p_iSecond ) ) >> 63u ) + ( (uint64_t) MAX_INT64VAL );
+
+	return eDSP_SATARITH_Select( (uint64_t) l_iRes, l_uSat, l_uIsSat, p_puSatCnt );
+}
+
+int64_t eDSP_SATARITH_MulDivI64(const int64_t p_iFirst, const int64_t p_iSecond, const int64_t p_iDivisor,
+                                uint32_t* const p_puSatCnt)
+{
+	/* Local variable for calculation */
+	int64_t  l_iRes;
+	uint64_t l_uSat;
+	uint64_t l_uIsSat;
+	uint64_t l_uIsZero;
+
+	/* Overflow and zero divisor are both clamped to the sign of the result, a zero product stay zero. The division
+	   use the native one of eDSP_MAXCHECK when the product fit in 64 bit, the clamp is done without branch */
+	l_iRes = 0;
+	l_uIsZero = ( (uint64_t) ( 0 == p_iFirst ) ) | ( (uint64_t) ( 0 == p_iSecond ) );
+	l_uIsSat = (uint64_t) ( e_eDSP_MAXCHECK_RES_OK !=
+	                        eDSP_MAXCHECK_MulDivI64(p_iFirst, p_iSecond, p_iDivisor, &l_iRes) );
+	l_uIsSat &= ( l_uIsZero ^ 1u );
+	l_uSat = ( ( ( (uint64_t) p_iFirst ) ^ ( (uint64_t) p_iSecond ) ^ ( (uint64_t) p_iDivisor ) ) >> 63u ) +
+	         ( (uint64_t) MAX_INT64VAL );
+
+	return eDSP_SATARITH_Select( (uint64_t) l_iRes, l_uSat, l_uIsSat, p_puSatCnt );
+}
+
+int64_t eDSP_SATARITH_DivI128(const int64_t p_iHigh, const uint64_t p_uLow, const int64_t p_iDivisor,
+                              uint32_t* const p_puSatCnt)
+{
+	/* Local variable for calculation */
+	int64_t  l_iRes;
+	uint64_t l_uSat;
+	uint64_t l_uIsSat;
+	uint64_t l_uIsZero;
+
+	/* Overflow and zero divisor are both clamped to the sign of the result, a zero dividend stay zero. The division
+	   use the native one of eDSP_MAXCHECK when the dividend fit in 64 bit, the clamp is done without branch */
+	l_iRes = 0;
+	l_uIsZero = ( (uint64_t) ( 0 == p_iHigh ) ) & ( (uint64_t) ( 0u == p_uLow ) );
+	l_uIsSat = (uint64_t) ( e_eDSP_MAXCHECK_RES_OK != eDSP_MAXCHECK_DivI128(p_iHigh, p_uLow, p_iDivisor, &l_iRes) );
+	l_uIsSat &= ( l_uIsZero ^ 1u );
+	l_uSat = ( ( ( (uint64_t) p_iHigh ) ^ ( (uint64_t) p_iDivisor ) ) >> 63u ) + ( (uint64_t) MAX_INT64VAL );
+
+	return eDSP_SATARITH_Select( (uint64_t) l_iRes, l_uSat, l_uIsSat, p_puSatCnt );
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static int64_t eDSP_SATARITH_Select(const uint64_t p_uRes, const uint64_t p_uSat, const uint64_t p_uIsSat,
+                                    uint32_t* const p_puSatCnt)
+{
+	/* Local variable for calculation */
+	uint64_t l_uMask;
+	uint64_t l_uVal;
+
+	/* Select the result or the saturated value without branch, p_uIsSat is zero or one */
+	l_uMask = 0u - p_uIsSat;
+	l_uVal = ( p_uRes & ~l_uMask ) | ( p_uSat & l_uMask );
+
+	/* Sticky counter, stop at its max value instead of wrapping around */
+	*p_puSatCnt += (uint32_t) ( p_uIsSat & ( (uint64_t) ( MAX_UINT32VAL != *p_puSatCnt ) ) );
+
+	/* Convert back to int64_t without relying on the implementation defined cast of values over MAX_INT64VAL */
+	return ( (int64_t) ( l_uVal & ( (uint64_t) MAX_INT64VAL ) ) ) +
+	       ( MIN_INT64VAL & ( -( (int64_t) ( l_uVal >> 63u ) ) ) );
+}
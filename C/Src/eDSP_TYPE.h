@@ -25,6 +25,17 @@ extern "C" {
 
 
 
+/***********************************************************************************************************************
+ *      TYPEDEFS ENUM
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eDSP_TYPE_OVFMODE_ERROR = 0,
+    e_eDSP_TYPE_OVFMODE_SATURATE
+}e_eDSP_TYPE_OVFMODE;
+
+
+
 /***********************************************************************************************************************
  *      TYPEDEFS STRUCT
  **********************************************************************************************************************/
@@ -7,6 +7,26 @@
 #include "eDSP_BSTFTST.h"
 #include "eDSP_BUSTFTST.h"
 #include "eDSP_BSTFBUNSTFTST.h"
+#include "eDSP_MAXCHECKTST.h"
+#include "eDSP_SATARITHTST.h"
+#include "eDSP_Q31ARITHTST.h"
+#include "eDSP_BLOCKSCANTST.h"
+#include "eDSP_MOVMEANFILTERTST.h"
+#include "eDSP_MOVMEDIANFILTERTST.h"
+#include "eDSP_DECIMATIONFILTERTST.h"
+#include "eDSP_DOWNSAMPLETST.h"
+#include "eDSP_CICDECIMATORTST.h"
+#include "eDSP_FIRFILTERTST.h"
+#include "eDSP_BIQUADFILTERTST.h"
+#include "eDSP_FOLPASSFILTERTST.h"
+#include "eDSP_FOHPASSFILTERTST.h"
+#include "eDSP_MCMOVMEANFILTERTST.h"
+#include "eDSP_MCFOLPASSFILTERTST.h"
+#include "eDSP_MCFOHPASSFILTERTST.h"
+#include "eDSP_INTEGRALTST.h"
+#include "eDSP_DERIVATIVETST.h"
+#include "eDSP_M2DPI64LINEARTST.h"
+#include "eDSP_PIDTST.h"
 
 int main(void);
 
@@ -23,6 +43,26 @@ int main(void)
     eDSP_BSTFTST_ExeTest();
     eDSP_BUSTFTST_ExeTest();
     eDSP_BSTFBUNSTFTST_ExeTest();
+    eDSP_MAXCHECKTST_ExeTest();
+    eDSP_SATARITHTST_ExeTest();
+    eDSP_Q31ARITHTST_ExeTest();
+    eDSP_BLOCKSCANTST_ExeTest();
+    eDSP_MOVMEANFILTERTST_ExeTest();
+    eDSP_MOVMEDIANFILTERTST_ExeTest();
+    eDSP_DECIMATIONFILTERTST_ExeTest();
+    eDSP_DOWNSAMPLETST_ExeTest();
+    eDSP_CICDECIMATORTST_ExeTest();
+    eDSP_FIRFILTERTST_ExeTest();
+    eDSP_BIQUADFILTERTST_ExeTest();
+    eDSP_FOLPASSFILTERTST_ExeTest();
+    eDSP_FOHPASSFILTERTST_ExeTest();
+    eDSP_MCMOVMEANFILTERTST_ExeTest();
+    eDSP_MCFOLPASSFILTERTST_ExeTest();
+    eDSP_MCFOHPASSFILTERTST_ExeTest();
+    eDSP_INTEGRALTST_ExeTest();
+    eDSP_DERIVATIVETST_ExeTest();
+    eDSP_M2DPI64LINEARTST_ExeTest();
+    eDSP_PIDTST_ExeTest();
 
     return 0;
 }
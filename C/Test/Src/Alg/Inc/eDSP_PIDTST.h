@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_PIDTST.h
+ *
+ * @brief      PID test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_PIDTST_H
+#define EDSP_PIDTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the PID module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_PIDTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_PIDTST_H */
\ No newline at end of file
@@ -0,0 +1,772 @@
+/**
+ * @file       eDSP_PIDTST.c
+ *
+ * @brief      PID test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_PIDTST.h"
+#include "eDSP_PID.h"
+#include "eDSP_Q31ARITH.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE TYPEDEFS
+ **********************************************************************************************************************/
+typedef struct
+{
+    int64_t  iIntegral;
+    int64_t  iDerivate;
+    int64_t  iPrevMeasure;
+    bool_t   bHasPrev;
+}t_eDSP_PIDTST_Ref;
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_PIDTST_BadPointer(void);
+static void eDSP_PIDTST_BadInit(void);
+static void eDSP_PIDTST_BadParamEntr(void);
+static void eDSP_PIDTST_CorruptedContext(void);
+static void eDSP_PIDTST_Terms(void);
+static void eDSP_PIDTST_Reference(void);
+static void eDSP_PIDTST_Overflow(void);
+static void eDSP_PIDTST_Saturate(void);
+static void eDSP_PIDTST_BigMeasure(void);
+static int64_t eDSP_PIDTST_RefCalc(t_eDSP_PIDTST_Ref* const p_ptRef, const t_eDSP_PID_Param* const p_ptParam,
+                                   const int64_t p_iSetpoint, const int64_t p_iMeasure, const uint32_t p_uTime);
+static int64_t eDSP_PIDTST_Clamp(const int64_t p_iValue, const int64_t p_iMin, const int64_t p_iMax);
+static bool_t eDSP_PIDTST_CheckRef(const int64_t p_iLimit, const uint64_t p_uSeedInit);
+static void eDSP_PIDTST_SetParam(t_eDSP_PID_Param* const p_ptParam, const int32_t p_iKp, const int32_t p_iKi,
+                                 const int32_t p_iKd, const int64_t p_iLimit);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_PIDTST_ExeTest(void)
+{
+	(void)printf("\n\nPID TEST START \n\n");
+
+    eDSP_PIDTST_BadPointer();
+    eDSP_PIDTST_BadInit();
+    eDSP_PIDTST_BadParamEntr();
+    eDSP_PIDTST_CorruptedContext();
+    eDSP_PIDTST_Terms();
+    eDSP_PIDTST_Reference();
+    eDSP_PIDTST_Overflow();
+    eDSP_PIDTST_Saturate();
+    eDSP_PIDTST_BigMeasure();
+
+    (void)printf("\n\nPID TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_PIDTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_PID_Ctx l_tCtx;
+    t_eDSP_PID_Param l_tParam;
+    int64_t  l_iOut;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    eDSP_PIDTST_SetParam(&l_tParam, 65536, 0, 0, 100);
+
+    /* Function */
+    if( ( e_eDSP_PID_RES_BADPOINTER == eDSP_PID_InitCtx(NULL, &l_tParam) ) &&
+        ( e_eDSP_PID_RES_BADPOINTER == eDSP_PID_InitCtx(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_PIDTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_PID_RES_BADPOINTER == eDSP_PID_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_PID_RES_BADPOINTER == eDSP_PID_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_PIDTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_PID_RES_BADPOINTER == eDSP_PID_Calc(NULL, 1, 1, 1u, &l_iOut) ) &&
+        ( e_eDSP_PID_RES_BADPOINTER == eDSP_PID_Calc(&l_tCtx, 1, 1, 1u, NULL) ) )
+    {
+        (void)printf("eDSP_PIDTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_PID_RES_BADPOINTER == eDSP_PID_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_PID_RES_BADPOINTER == eDSP_PID_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_PID_RES_BADPOINTER == eDSP_PID_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_PIDTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadPointer 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_PIDTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_PID_Ctx l_tCtx;
+    t_eDSP_PID_Param l_tParam;
+    int64_t  l_iOut;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+    eDSP_PIDTST_SetParam(&l_tParam, 65536, 0, 0, 100);
+
+    /* Function */
+    if( ( e_eDSP_PID_RES_OK == eDSP_PID_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_PIDTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_PID_RES_NOINITLIB == eDSP_PID_Calc(&l_tCtx, 1, 1, 1u, &l_iOut) ) &&
+        ( e_eDSP_PID_RES_NOINITLIB == eDSP_PID_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_PID_RES_NOINITLIB == eDSP_PID_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_PIDTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_PID_RES_OK == eDSP_PID_InitCtx(&l_tCtx, &l_tParam) ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_IsInit(&l_tCtx, &l_bIsInit) ) && ( true == l_bIsInit ) )
+    {
+        (void)printf("eDSP_PIDTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadInit 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_PIDTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_PID_Ctx l_tCtx;
+    t_eDSP_PID_Param l_tParam;
+    int64_t  l_iOut;
+
+    /* Function */
+    eDSP_PIDTST_SetParam(&l_tParam, 65536, 0, 0, 100);
+    l_tParam.uGainQ = 32u;
+    if( e_eDSP_PID_RES_BADPARAM == eDSP_PID_InitCtx(&l_tCtx, &l_tParam) )
+    {
+        (void)printf("eDSP_PIDTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* Alpha of the derivate filter must be in ( 0, 1 ] */
+    eDSP_PIDTST_SetParam(&l_tParam, 65536, 0, 0, 100);
+    l_tParam.uDFiltAlphaQ31 = 0u;
+    if( e_eDSP_PID_RES_BADPARAM == eDSP_PID_InitCtx(&l_tCtx, &l_tParam) )
+    {
+        (void)printf("eDSP_PIDTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    l_tParam.uDFiltAlphaQ31 = 0x80000001u;
+    if( e_eDSP_PID_RES_BADPARAM == eDSP_PID_InitCtx(&l_tCtx, &l_tParam) )
+    {
+        (void)printf("eDSP_PIDTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    eDSP_PIDTST_SetParam(&l_tParam, 65536, 0, 0, 100);
+    l_tParam.iOutMin = 101;
+    if( e_eDSP_PID_RES_BADPARAM == eDSP_PID_InitCtx(&l_tCtx, &l_tParam) )
+    {
+        (void)printf("eDSP_PIDTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    eDSP_PIDTST_SetParam(&l_tParam, 65536, 0, 0, 100);
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    if( ( e_eDSP_PID_RES_BADPARAM == eDSP_PID_Calc(&l_tCtx, 1, 1, 0u, &l_iOut) ) &&
+        ( e_eDSP_PID_RES_BADPARAM == eDSP_PID_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) ) )
+    {
+        (void)printf("eDSP_PIDTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BadParamEntr 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_PIDTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_PID_Ctx l_tCtx;
+    t_eDSP_PID_Param l_tParam;
+    int64_t  l_iOut;
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    eDSP_PIDTST_SetParam(&l_tParam, 65536, 65536, 65536, 100);
+
+    /* Function */
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    l_tCtx.eOvfMode = (e_eDSP_TYPE_OVFMODE) 5;
+    if( e_eDSP_PID_RES_CORRUPTCTX == eDSP_PID_Calc(&l_tCtx, 1, 1, 1u, &l_iOut) )
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    l_tCtx.tParam.uGainQ = 40u;
+    if( e_eDSP_PID_RES_CORRUPTCTX == eDSP_PID_GetSatCnt(&l_tCtx, &l_uSatCnt) )
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    /* The anti windup limits are derived from the output limits */
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    l_tCtx.iIntegralMax++;
+    if( e_eDSP_PID_RES_CORRUPTCTX == eDSP_PID_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) )
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    l_tCtx.tIntegral.eRule = e_eDSP_INTEGRAL_RULE_LEFT;
+    if( e_eDSP_PID_RES_CORRUPTCTX == eDSP_PID_Calc(&l_tCtx, 1, 1, 1u, &l_iOut) )
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 4  -- FAIL \n");
+    }
+
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    l_tCtx.tDerivate.eStencil = e_eDSP_DERIVATIVE_STENCIL_CENTRAL;
+    if( e_eDSP_PID_RES_CORRUPTCTX == eDSP_PID_Calc(&l_tCtx, 1, 1, 1u, &l_iOut) )
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 5  -- FAIL \n");
+    }
+
+    /* The overflow mode of the embedded contexts follow the PID one */
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    l_tCtx.tIntegral.eOvfMode = e_eDSP_TYPE_OVFMODE_SATURATE;
+    if( e_eDSP_PID_RES_CORRUPTCTX == eDSP_PID_Calc(&l_tCtx, 1, 1, 1u, &l_iOut) )
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 6  -- FAIL \n");
+    }
+
+    /* Nothing can be derived before the second measure */
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    l_tCtx.iDerivateAcc = 3;
+    if( e_eDSP_PID_RES_CORRUPTCTX == eDSP_PID_Calc(&l_tCtx, 1, 1, 1u, &l_iOut) )
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_CorruptedContext 7  -- FAIL \n");
+    }
+}
+
+static void eDSP_PIDTST_Terms(void)
+{
+    /* Local variable */
+    t_eDSP_PID_Ctx l_tCtx;
+    t_eDSP_PID_Param l_tParam;
+    int64_t  l_iOut;
+    bool_t   l_bTestOk;
+
+    /* Function */
+    /* Proportional only, gain of one in Q16 */
+    eDSP_PIDTST_SetParam(&l_tParam, 65536, 0, 0, 100);
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    if( ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 50, 10, 1u, &l_iOut) ) && ( 40 == l_iOut ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 50, 200, 1u, &l_iOut) ) && ( -100 == l_iOut ) )
+    {
+        (void)printf("eDSP_PIDTST_Terms 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Terms 1  -- FAIL \n");
+    }
+
+    /* Integral only, it start from the second step and stop at the output limit */
+    eDSP_PIDTST_SetParam(&l_tParam, 0, 65536, 0, 100);
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    if( ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 50, 40, 1u, &l_iOut) ) && ( 0 == l_iOut ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 50, 40, 3u, &l_iOut) ) && ( 30 == l_iOut ) )
+    {
+        (void)printf("eDSP_PIDTST_Terms 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Terms 2  -- FAIL \n");
+    }
+
+    l_bTestOk = true;
+    for(uint32_t i = 0u; ( ( i < 10u ) && ( true == l_bTestOk ) ); i++)
+    {
+        if( e_eDSP_PID_RES_OK != eDSP_PID_Calc(&l_tCtx, 50, 40, 1u, &l_iOut) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    /* Without wind up the output leave the limit as soon as the error change sign */
+    if( ( true == l_bTestOk ) && ( 100 == l_iOut ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 50, 60, 1u, &l_iOut) ) && ( 90 == l_iOut ) )
+    {
+        (void)printf("eDSP_PIDTST_Terms 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Terms 3  -- FAIL \n");
+    }
+
+    /* Derivate only, on the measure: -( 30 - 10 ) / 2 */
+    eDSP_PIDTST_SetParam(&l_tParam, 0, 0, 65536, 1000);
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    if( ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 0, 10, 2u, &l_iOut) ) && ( 0 == l_iOut ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 0, 30, 2u, &l_iOut) ) && ( -10 == l_iOut ) )
+    {
+        (void)printf("eDSP_PIDTST_Terms 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Terms 4  -- FAIL \n");
+    }
+
+    /* A step of the setpoint doesn't kick the derivate */
+    if( ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 500, 30, 2u, &l_iOut) ) && ( 0 == l_iOut ) )
+    {
+        (void)printf("eDSP_PIDTST_Terms 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Terms 5  -- FAIL \n");
+    }
+
+    /* With alpha of one half the derivate reach the new value in half steps */
+    eDSP_PIDTST_SetParam(&l_tParam, 0, 0, 65536, 1000);
+    l_tParam.uDFiltAlphaQ31 = 0x40000000u;
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    if( ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 0, 0, 1u, &l_iOut) ) && ( 0 == l_iOut ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 0, -400, 1u, &l_iOut) ) && ( 200 == l_iOut ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 0, -800, 1u, &l_iOut) ) && ( 300 == l_iOut ) )
+    {
+        (void)printf("eDSP_PIDTST_Terms 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Terms 6  -- FAIL \n");
+    }
+}
+
+static void eDSP_PIDTST_Reference(void)
+{
+    /* Function */
+    if( ( true == eDSP_PIDTST_CheckRef(1000000, 0x243F6A8885A308D3u) ) &&
+        ( true == eDSP_PIDTST_CheckRef(1000000, 0x13198A2E03707344u) ) )
+    {
+        (void)printf("eDSP_PIDTST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Reference 1  -- FAIL \n");
+    }
+
+    /* Narrow limits keep the integral and the output clamped most of the time */
+    if( ( true == eDSP_PIDTST_CheckRef(1000, 0xA4093822299F31D0u) ) &&
+        ( true == eDSP_PIDTST_CheckRef(1000, 0x082EFA98EC4E6C89u) ) )
+    {
+        (void)printf("eDSP_PIDTST_Reference 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Reference 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_PIDTST_Overflow(void)
+{
+    /* Local variable */
+    t_eDSP_PID_Ctx l_tCtx;
+    t_eDSP_PID_Ctx l_tCtxRef;
+    t_eDSP_PID_Param l_tParam;
+    int64_t  l_iOut;
+    int64_t  l_iOutRef;
+
+    /* Init variable */
+    eDSP_PIDTST_SetParam(&l_tParam, 1, 1, 1048576, 1000000);
+
+    /* Function */
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    (void)eDSP_PID_InitCtx(&l_tCtxRef, &l_tParam);
+    (void)eDSP_PID_Calc(&l_tCtx, 10, 1, 1u, &l_iOut);
+    (void)eDSP_PID_Calc(&l_tCtxRef, 10, 1, 1u, &l_iOutRef);
+
+    /* -Kd * ( measure - prevmeasure ) doesn't fit an int64_t, after that the integral is already updated */
+    l_iOut = 7;
+    if( ( e_eDSP_PID_RES_OVERFLOW == eDSP_PID_Calc(&l_tCtx, 10, 1125899906842624, 1u, &l_iOut) ) && ( 7 == l_iOut ) )
+    {
+        (void)printf("eDSP_PIDTST_Overflow 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Overflow 1  -- FAIL \n");
+    }
+
+    /* The step in overflow is discarded as a whole */
+    if( ( l_tCtxRef.tIntegral.uIntegral == l_tCtx.tIntegral.uIntegral ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 10, 3, 2u, &l_iOut) ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtxRef, 10, 3, 2u, &l_iOutRef) ) && ( l_iOutRef == l_iOut ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 20, 5, 1u, &l_iOut) ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtxRef, 20, 5, 1u, &l_iOutRef) ) && ( l_iOutRef == l_iOut ) )
+    {
+        (void)printf("eDSP_PIDTST_Overflow 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Overflow 2  -- FAIL \n");
+    }
+
+    /* Error that doesn't fit an int64_t */
+    if( e_eDSP_PID_RES_OVERFLOW == eDSP_PID_Calc(&l_tCtx, MAX_INT64VAL, -1, 1u, &l_iOut) )
+    {
+        (void)printf("eDSP_PIDTST_Overflow 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Overflow 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_PIDTST_Saturate(void)
+{
+    /* Local variable */
+    t_eDSP_PID_Ctx l_tCtx;
+    t_eDSP_PID_Param l_tParam;
+    int64_t  l_iOut;
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    eDSP_PIDTST_SetParam(&l_tParam, 1, 1, 1048576, 1000000);
+
+    /* Function */
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    if( ( e_eDSP_PID_RES_OK == eDSP_PID_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) ) &&
+        ( e_eDSP_TYPE_OVFMODE_SATURATE == l_tCtx.tIntegral.eOvfMode ) &&
+        ( e_eDSP_TYPE_OVFMODE_SATURATE == l_tCtx.tDerivate.eOvfMode ) )
+    {
+        (void)printf("eDSP_PIDTST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Saturate 1  -- FAIL \n");
+    }
+
+    /* The step is not discarded and the output stay in its limits */
+    (void)eDSP_PID_Calc(&l_tCtx, 10, 1, 1u, &l_iOut);
+    if( ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, 10, 1125899906842624, 1u, &l_iOut) ) &&
+        ( -1000000 == l_iOut ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_Calc(&l_tCtx, MAX_INT64VAL, -1, 1u, &l_iOut) ) && ( 1000000 == l_iOut ) )
+    {
+        (void)printf("eDSP_PIDTST_Saturate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Saturate 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_PID_RES_OK == eDSP_PID_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( l_uSatCnt > 0u ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_PIDTST_Saturate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Saturate 3  -- FAIL \n");
+    }
+
+    /* A jump of the measure that doesn't fit an int64_t is clamped once, by the PID and not by the derivate */
+    eDSP_PIDTST_SetParam(&l_tParam, 0, 0, 0, 1000000);
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    (void)eDSP_PID_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE);
+    (void)eDSP_PID_Calc(&l_tCtx, 0, MIN_INT64VAL / 2, 1u, &l_iOut);
+    if( ( e_eDSP_PID_RES_OK ==
+          eDSP_PID_Calc(&l_tCtx, 0, ( MAX_INT64VAL / 2 ) + ( MAX_INT64VAL / 4 ), 1u, &l_iOut) ) && ( 0 == l_iOut ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 1u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_PIDTST_Saturate 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_Saturate 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_PIDTST_BigMeasure(void)
+{
+    /* Local variable */
+    t_eDSP_PID_Ctx l_tCtx;
+    t_eDSP_PID_Param l_tParam;
+    int64_t  l_iMeasure;
+    int64_t  l_iOut;
+    uint32_t l_uSatCnt;
+    bool_t   l_bTestOk;
+
+    /* Init variable */
+    eDSP_PIDTST_SetParam(&l_tParam, 0, 0, 65536, 1000000);
+
+    /* Function */
+    /* Kd * measure doesn't fit an int64_t but the derivate is small, only the difference is multiplied */
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    l_iMeasure = 1125899906842624;
+    l_bTestOk = true;
+
+    for(uint32_t i = 0u; i < 10u; i++)
+    {
+        if( ( e_eDSP_PID_RES_OK != eDSP_PID_Calc(&l_tCtx, l_iMeasure, l_iMeasure, 1u, &l_iOut) ) ||
+            ( ( i > 0u ) && ( -10 != l_iOut ) ) )
+        {
+            l_bTestOk = false;
+        }
+
+        l_iMeasure += 10;
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_PIDTST_BigMeasure 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BigMeasure 1  -- FAIL \n");
+    }
+
+    /* Same in saturate mode, nothing is clamped */
+    (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+    (void)eDSP_PID_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE);
+    l_iMeasure = 1125899906842624;
+    l_bTestOk = true;
+
+    for(uint32_t i = 0u; i < 10u; i++)
+    {
+        if( ( e_eDSP_PID_RES_OK != eDSP_PID_Calc(&l_tCtx, l_iMeasure, l_iMeasure, 1u, &l_iOut) ) ||
+            ( ( i > 0u ) && ( -10 != l_iOut ) ) )
+        {
+            l_bTestOk = false;
+        }
+
+        l_iMeasure += 10;
+    }
+
+    if( ( true == l_bTestOk ) &&
+        ( e_eDSP_PID_RES_OK == eDSP_PID_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_PIDTST_BigMeasure 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_PIDTST_BigMeasure 2  -- FAIL \n");
+    }
+}
+
+static int64_t eDSP_PIDTST_RefCalc(t_eDSP_PIDTST_Ref* const p_ptRef, const t_eDSP_PID_Param* const p_ptParam,
+                                   const int64_t p_iSetpoint, const int64_t p_iMeasure, const uint32_t p_uTime)
+{
+    /* Local variable */
+    int64_t l_iErr;
+    int64_t l_iDiff;
+    int64_t l_iOne;
+
+    /* Init variable */
+    l_iErr = p_iSetpoint - p_iMeasure;
+    l_iOne = ( (int64_t) 1 ) << p_ptParam->uGainQ;
+
+    /* Function */
+    /* Integral and derivate start from the second step */
+    if( true == p_ptRef->bHasPrev )
+    {
+        p_ptRef->iIntegral = eDSP_PIDTST_Clamp(p_ptRef->iIntegral + ( ( (int64_t) p_ptParam->iKi ) * l_iErr *
+                                                                      ( (int64_t) p_uTime ) ),
+                                               p_ptParam->iOutMin * l_iOne, p_ptParam->iOutMax * l_iOne);
+
+        l_iDiff = ( ( -( (int64_t) p_ptParam->iKd ) ) * ( p_iMeasure - p_ptRef->iPrevMeasure ) ) /
+                  ( (int64_t) p_uTime );
+        p_ptRef->iDerivate += eDSP_Q31ARITH_MulI64(l_iDiff - p_ptRef->iDerivate, p_ptParam->uDFiltAlphaQ31);
+    }
+
+    p_ptRef->iPrevMeasure = p_iMeasure;
+    p_ptRef->bHasPrev = true;
+
+    return eDSP_PIDTST_Clamp( ( ( ( (int64_t) p_ptParam->iKp ) * l_iErr ) + p_ptRef->iIntegral +
+                                p_ptRef->iDerivate ) / l_iOne, p_ptParam->iOutMin, p_ptParam->iOutMax);
+}
+
+static int64_t eDSP_PIDTST_Clamp(const int64_t p_iValue, const int64_t p_iMin, const int64_t p_iMax)
+{
+    /* Local variable */
+    int64_t l_iRes;
+
+    /* Function */
+    if( p_iValue < p_iMin )
+    {
+        l_iRes = p_iMin;
+    }
+    else if( p_iValue > p_iMax )
+    {
+        l_iRes = p_iMax;
+    }
+    else
+    {
+        l_iRes = p_iValue;
+    }
+
+    return l_iRes;
+}
+
+static bool_t eDSP_PIDTST_CheckRef(const int64_t p_iLimit, const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_PID_Ctx l_tCtx;
+    t_eDSP_PID_Param l_tParam;
+    t_eDSP_PIDTST_Ref l_tRef;
+    int64_t  l_iSetpoint;
+    int64_t  l_iMeasure;
+    int64_t  l_iOut;
+    uint32_t l_uTime;
+    uint64_t l_uSeed;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+
+    /* Function */
+    /* Small values keep every term of the reference inside an int64_t */
+    for(uint32_t i = 0u; ( ( i < 20u ) && ( true == l_bTestOk ) ); i++)
+    {
+        eDSP_PIDTST_SetParam(&l_tParam, ( (int32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 524289u ) ) - 262144,
+                             ( (int32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 524289u ) ) - 262144,
+                             ( (int32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 524289u ) ) - 262144, p_iLimit);
+        l_tParam.uDFiltAlphaQ31 = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 0x80000000u );
+        (void)eDSP_PID_InitCtx(&l_tCtx, &l_tParam);
+        l_tRef.iIntegral = 0;
+        l_tRef.iDerivate = 0;
+        l_tRef.iPrevMeasure = 0;
+        l_tRef.bHasPrev = false;
+        l_iSetpoint = 0;
+        l_iMeasure = 0;
+
+        for(uint32_t j = 0u; ( ( j < 200u ) && ( true == l_bTestOk ) ); j++)
+        {
+            /* A setpoint that change seldom and a measure that follow it with noise */
+            if( 0u == ( eDSP_TSTRAND_Rand(&l_uSeed) % 50u ) )
+            {
+                l_iSetpoint = ( (int64_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 200001u ) ) - 100000;
+            }
+
+            l_iMeasure += ( l_iSetpoint - l_iMeasure ) / 8;
+            l_iMeasure += ( (int64_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 2001u ) ) - 1000;
+            l_uTime = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 100u );
+
+            if( ( e_eDSP_PID_RES_OK != eDSP_PID_Calc(&l_tCtx, l_iSetpoint, l_iMeasure, l_uTime, &l_iOut) ) ||
+                ( eDSP_PIDTST_RefCalc(&l_tRef, &l_tParam, l_iSetpoint, l_iMeasure, l_uTime) != l_iOut ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+
+    return l_bTestOk;
+}
+
+static void eDSP_PIDTST_SetParam(t_eDSP_PID_Param* const p_ptParam, const int32_t p_iKp, const int32_t p_iKi,
+                                 const int32_t p_iKd, const int64_t p_iLimit)
+{
+    /* Gains in Q16 and no filter on the derivate */
+    p_ptParam->iKp = p_iKp;
+    p_ptParam->iKi = p_iKi;
+    p_ptParam->iKd = p_iKd;
+    p_ptParam->uGainQ = 16u;
+    p_ptParam->uDFiltAlphaQ31 = 0x80000000u;
+    p_ptParam->iOutMin = -p_iLimit;
+    p_ptParam->iOutMax = p_iLimit;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_BIQUADFILTERTST.h
+ *
+ * @brief      Biquad cascade test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_BIQUADFILTERTST_H
+#define EDSP_BIQUADFILTERTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the biquad cascade module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_BIQUADFILTERTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_BIQUADFILTERTST_H */
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_CICDECIMATORTST.h
+ *
+ * @brief      CIC decimator test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_CICDECIMATORTST_H
+#define EDSP_CICDECIMATORTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the CIC decimator module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_CICDECIMATORTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_CICDECIMATORTST_H */
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_DECIMATIONFILTERTST.h
+ *
+ * @brief      Decimator filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_DECIMATIONFILTERTST_H
+#define EDSP_DECIMATIONFILTERTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the decimator filter module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_DECIMATIONFILTERTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_DECIMATIONFILTERTST_H */
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_DOWNSAMPLETST.h
+ *
+ * @brief      Downsampler test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_DOWNSAMPLETST_H
+#define EDSP_DOWNSAMPLETST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the downsampler module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_DOWNSAMPLETST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_DOWNSAMPLETST_H */
\ No newline at end of file
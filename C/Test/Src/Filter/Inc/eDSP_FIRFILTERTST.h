@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_FIRFILTERTST.h
+ *
+ * @brief      FIR filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_FIRFILTERTST_H
+#define EDSP_FIRFILTERTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the FIR filter module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_FIRFILTERTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_FIRFILTERTST_H */
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_FOHPASSFILTERTST.h
+ *
+ * @brief      First Order High pass filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_FOHPASSFILTERTST_H
+#define EDSP_FOHPASSFILTERTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the first order High pass filter module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_FOHPASSFILTERTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_FOHPASSFILTERTST_H */
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_FOLPASSFILTERTST.h
+ *
+ * @brief      First Order Low pass filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_FOLPASSFILTERTST_H
+#define EDSP_FOLPASSFILTERTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the first order Low pass filter module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_FOLPASSFILTERTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_FOLPASSFILTERTST_H */
\ No newline at end of file
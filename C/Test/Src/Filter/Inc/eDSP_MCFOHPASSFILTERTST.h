@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_MCFOHPASSFILTERTST.h
+ *
+ * @brief      Multi channel first order high pass filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_MCFOHPASSFILTERTST_H
+#define EDSP_MCFOHPASSFILTERTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the multi channel first order high pass filter module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_MCFOHPASSFILTERTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_MCFOHPASSFILTERTST_H */
\ No newline at end of file
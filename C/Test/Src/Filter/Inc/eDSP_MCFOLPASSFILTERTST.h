@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_MCFOLPASSFILTERTST.h
+ *
+ * @brief      Multi channel first order low pass filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_MCFOLPASSFILTERTST_H
+#define EDSP_MCFOLPASSFILTERTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the multi channel first order low pass filter module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_MCFOLPASSFILTERTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_MCFOLPASSFILTERTST_H */
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_MCMOVMEANFILTERTST.h
+ *
+ * @brief      Multi channel moving mean filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_MCMOVMEANFILTERTST_H
+#define EDSP_MCMOVMEANFILTERTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the multi channel moving mean filter module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_MCMOVMEANFILTERTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_MCMOVMEANFILTERTST_H */
\ No newline at end of file
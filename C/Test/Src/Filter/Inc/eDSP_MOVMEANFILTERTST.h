@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_MOVMEANFILTERTST.h
+ *
+ * @brief      Moving mean filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_MOVMEANFILTERTST_H
+#define EDSP_MOVMEANFILTERTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the moving mean filter module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_MOVMEANFILTERTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_MOVMEANFILTERTST_H */
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_MOVMEDIANFILTERTST.h
+ *
+ * @brief      Moving median filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_MOVMEDIANFILTERTST_H
+#define EDSP_MOVMEDIANFILTERTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the moving median filter module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_MOVMEDIANFILTERTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_MOVMEDIANFILTERTST_H */
\ No newline at end of file
@@ -0,0 +1,574 @@
+/**
+ * @file       eDSP_BIQUADFILTERTST.c
+ *
+ * @brief      Biquad cascade test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_BIQUADFILTERTST.h"
+#include "eDSP_BIQUADFILTER.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_BIQUADFILTERTST_BadPointer(void);
+static void eDSP_BIQUADFILTERTST_BadInit(void);
+static void eDSP_BIQUADFILTERTST_BadParamEntr(void);
+static void eDSP_BIQUADFILTERTST_CorruptedContext(void);
+static void eDSP_BIQUADFILTERTST_Reference(void);
+static void eDSP_BIQUADFILTERTST_Overflow(void);
+static void eDSP_BIQUADFILTERTST_Saturate(void);
+static void eDSP_BIQUADFILTERTST_BlockVsSample(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_BIQUADFILTERTST_ExeTest(void)
+{
+	(void)printf("\n\nBIQUADFILTER TEST START \n\n");
+
+    eDSP_BIQUADFILTERTST_BadPointer();
+    eDSP_BIQUADFILTERTST_BadInit();
+    eDSP_BIQUADFILTERTST_BadParamEntr();
+    eDSP_BIQUADFILTERTST_CorruptedContext();
+    eDSP_BIQUADFILTERTST_Reference();
+    eDSP_BIQUADFILTERTST_Overflow();
+    eDSP_BIQUADFILTERTST_Saturate();
+    eDSP_BIQUADFILTERTST_BlockVsSample();
+
+    (void)printf("\n\nBIQUADFILTER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_BIQUADFILTERTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_BIQUADFILTER_Ctx l_tCtx;
+    t_eDSP_BIQUADFILTER_Coeff l_atCoeff[1u] = { { 1, 0, 0, 0, 0 } };
+    t_eDSP_BIQUADFILTER_State l_atState[1u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( ( e_eDSP_BIQUADFILTER_RES_BADPOINTER == eDSP_BIQUADFILTER_InitCtx(NULL, l_atCoeff, l_atState, 1u, 0u) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPOINTER == eDSP_BIQUADFILTER_InitCtx(&l_tCtx, NULL, l_atState, 1u, 0u) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPOINTER == eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, NULL, 1u, 0u) ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_BIQUADFILTER_RES_BADPOINTER == eDSP_BIQUADFILTER_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPOINTER == eDSP_BIQUADFILTER_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_BIQUADFILTER_RES_BADPOINTER == eDSP_BIQUADFILTER_InsertValueAndCalculate(NULL, 1, &l_iFiltered) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPOINTER == eDSP_BIQUADFILTER_InsertValueAndCalculate(&l_tCtx, 1, NULL) ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_BIQUADFILTER_RES_BADPOINTER ==
+          eDSP_BIQUADFILTER_ProcessBlock(NULL, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPOINTER ==
+          eDSP_BIQUADFILTER_ProcessBlock(&l_tCtx, NULL, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPOINTER ==
+          eDSP_BIQUADFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, NULL, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPOINTER ==
+          eDSP_BIQUADFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, NULL, &l_uNProcessed) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPOINTER ==
+          eDSP_BIQUADFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, NULL) ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_BIQUADFILTER_RES_BADPOINTER == eDSP_BIQUADFILTER_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPOINTER == eDSP_BIQUADFILTER_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPOINTER == eDSP_BIQUADFILTER_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadPointer 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_BIQUADFILTERTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_BIQUADFILTER_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_BIQUADFILTER_RES_OK == eDSP_BIQUADFILTER_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_BIQUADFILTER_RES_NOINITLIB == eDSP_BIQUADFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_NOINITLIB ==
+          eDSP_BIQUADFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_BIQUADFILTER_RES_NOINITLIB == eDSP_BIQUADFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_NOINITLIB == eDSP_BIQUADFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadInit 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_BIQUADFILTERTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_BIQUADFILTER_Ctx l_tCtx;
+    t_eDSP_BIQUADFILTER_Coeff l_atCoeff[1u] = { { 1, 0, 0, 0, 0 } };
+    t_eDSP_BIQUADFILTER_State l_atState[1u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Function */
+    if( ( e_eDSP_BIQUADFILTER_RES_BADPARAM == eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, l_atState, 0u, 0u) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPARAM == eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, l_atState, 1u, 32u) ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eDSP_BIQUADFILTER_RES_OK == eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, l_atState, 1u, 31u) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_BIQUADFILTER_RES_BADPARAM ==
+          eDSP_BIQUADFILTER_ProcessBlock(&l_tCtx, l_aiValues, 0u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_BADPARAM == eDSP_BIQUADFILTER_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BadParamEntr 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_BIQUADFILTERTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_BIQUADFILTER_Ctx l_tCtx;
+    t_eDSP_BIQUADFILTER_Coeff l_atCoeff[1u] = { { 1, 0, 0, 0, 0 } };
+    t_eDSP_BIQUADFILTER_State l_atState[1u];
+    int64_t  l_iFiltered;
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, l_atState, 1u, 0u);
+    l_tCtx.ptState = NULL;
+    if( e_eDSP_BIQUADFILTER_RES_CORRUPTCTX == eDSP_BIQUADFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, l_atState, 1u, 0u);
+    l_tCtx.uNSections = 0u;
+    if( e_eDSP_BIQUADFILTER_RES_CORRUPTCTX == eDSP_BIQUADFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    (void)eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, l_atState, 1u, 0u);
+    l_tCtx.uCoeffQ = 32u;
+    if( e_eDSP_BIQUADFILTER_RES_CORRUPTCTX == eDSP_BIQUADFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    (void)eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, l_atState, 1u, 0u);
+    l_tCtx.eOvfMode = (e_eDSP_TYPE_OVFMODE) 5;
+    if( e_eDSP_BIQUADFILTER_RES_CORRUPTCTX == eDSP_BIQUADFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_CorruptedContext 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_BIQUADFILTERTST_Reference(void)
+{
+    /* Local variable */
+    t_eDSP_BIQUADFILTER_Ctx l_tCtx;
+    t_eDSP_BIQUADFILTER_Coeff l_atCoeff[3u] =
+    {
+        /* Low pass sections and a high pass one, Q14 */
+        {  1012,  2024,  1012, -23450, 10380 },
+        {  4096,  8192,  4096, -12000,  4000 },
+        { 14000, -28000, 14000, -27000, 11500 }
+    };
+    t_eDSP_BIQUADFILTER_State l_atState[3u];
+    int64_t  l_aiRefX[3u][2u];
+    int64_t  l_aiRefY[3u][2u];
+    int64_t  l_iRefVal;
+    int64_t  l_iRefAcc;
+    int64_t  l_iValue;
+    int64_t  l_iFiltered;
+    uint64_t l_uSeed;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0x7137449123EF65CDu;
+
+    for(uint32_t s = 0u; s < 3u; s++)
+    {
+        l_aiRefX[s][0u] = 0;
+        l_aiRefX[s][1u] = 0;
+        l_aiRefY[s][0u] = 0;
+        l_aiRefY[s][1u] = 0;
+    }
+
+    /* Function */
+    (void)eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, l_atState, 3u, 14u);
+
+    /* Direct Form I done in the test, section by section, with the same truncation */
+    for(uint32_t i = 0u; ( ( i < 1000u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_iValue = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 34u;
+
+        l_iRefVal = l_iValue;
+
+        for(uint32_t s = 0u; s < 3u; s++)
+        {
+            l_iRefAcc = ( ( (int64_t) l_atCoeff[s].iB0 ) * l_iRefVal ) +
+                        ( ( (int64_t) l_atCoeff[s].iB1 ) * l_aiRefX[s][0u] ) +
+                        ( ( (int64_t) l_atCoeff[s].iB2 ) * l_aiRefX[s][1u] ) -
+                        ( ( (int64_t) l_atCoeff[s].iA1 ) * l_aiRefY[s][0u] ) -
+                        ( ( (int64_t) l_atCoeff[s].iA2 ) * l_aiRefY[s][1u] );
+
+            l_aiRefX[s][1u] = l_aiRefX[s][0u];
+            l_aiRefX[s][0u] = l_iRefVal;
+            l_iRefVal = l_iRefAcc / 16384;
+            l_aiRefY[s][1u] = l_aiRefY[s][0u];
+            l_aiRefY[s][0u] = l_iRefVal;
+        }
+
+        if( ( e_eDSP_BIQUADFILTER_RES_OK !=
+              eDSP_BIQUADFILTER_InsertValueAndCalculate(&l_tCtx, l_iValue, &l_iFiltered) ) ||
+            ( l_iRefVal != l_iFiltered ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Reference 1  -- FAIL \n");
+    }
+}
+
+static void eDSP_BIQUADFILTERTST_Overflow(void)
+{
+    /* Local variable */
+    t_eDSP_BIQUADFILTER_Ctx l_tCtx;
+    t_eDSP_BIQUADFILTER_Coeff l_atCoeff[2u] = { { 1, 0, 0, 0, 0 }, { 4, 0, 0, 0, 0 } };
+    t_eDSP_BIQUADFILTER_State l_atState[2u];
+    int64_t  l_aiValues[4u] = { 1, 2, MAX_INT64VAL / 2, 3 };
+    int64_t  l_aiFiltered[4u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Init variable */
+    l_iFiltered = 0;
+
+    /* Function */
+    (void)eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, l_atState, 2u, 0u);
+    if( ( e_eDSP_BIQUADFILTER_RES_OK == eDSP_BIQUADFILTER_InsertValueAndCalculate(&l_tCtx, 5, &l_iFiltered) ) &&
+        ( 20 == l_iFiltered ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Overflow 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Overflow 1  -- FAIL \n");
+    }
+
+    /* Only the second section overflow, but the first one is not advanced either */
+    if( ( e_eDSP_BIQUADFILTER_RES_OVERFLOW ==
+          eDSP_BIQUADFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL / 2, &l_iFiltered) ) &&
+        ( 5 == l_atState[0u].iX1 ) && ( 0 == l_atState[0u].iX2 ) && ( 5 == l_atState[0u].iY1 ) &&
+        ( 5 == l_atState[1u].iX1 ) && ( 20 == l_atState[1u].iY1 ) && ( 0 == l_atState[1u].iY2 ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Overflow 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Overflow 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_BIQUADFILTER_RES_OK == eDSP_BIQUADFILTER_InsertValueAndCalculate(&l_tCtx, -7, &l_iFiltered) ) &&
+        ( -28 == l_iFiltered ) && ( 5 == l_atState[0u].iX2 ) && ( 20 == l_atState[1u].iY2 ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Overflow 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Overflow 3  -- FAIL \n");
+    }
+
+    /* The block stop at the value that overflow, the filtered values before it are valid and the caller can resume
+       from the first value not processed */
+    (void)eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, l_atState, 2u, 0u);
+    if( ( e_eDSP_BIQUADFILTER_RES_OVERFLOW ==
+          eDSP_BIQUADFILTER_ProcessBlock(&l_tCtx, l_aiValues, 4u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( 2u == l_uNFiltered ) && ( 3u == l_uNProcessed ) && ( 4 == l_aiFiltered[0u] ) && ( 8 == l_aiFiltered[1u] ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Overflow 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Overflow 4  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_BIQUADFILTER_RES_OK ==
+          eDSP_BIQUADFILTER_ProcessBlock(&l_tCtx, &l_aiValues[l_uNProcessed], 4u - l_uNProcessed, l_aiFiltered,
+                                         &l_uNFiltered, &l_uNProcessed) ) &&
+        ( 1u == l_uNFiltered ) && ( 1u == l_uNProcessed ) && ( 12 == l_aiFiltered[0u] ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Overflow 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Overflow 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_BIQUADFILTERTST_Saturate(void)
+{
+    /* Local variable */
+    t_eDSP_BIQUADFILTER_Ctx l_tCtx;
+    t_eDSP_BIQUADFILTER_Coeff l_atCoeff[2u] = { { 1, 0, 0, 0, 0 }, { 4, 0, 0, 0, 0 } };
+    t_eDSP_BIQUADFILTER_State l_atState[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_iFiltered = 0;
+    l_uSatCnt = 0u;
+
+    /* Function */
+    (void)eDSP_BIQUADFILTER_InitCtx(&l_tCtx, l_atCoeff, l_atState, 2u, 0u);
+    if( e_eDSP_BIQUADFILTER_RES_OK == eDSP_BIQUADFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Saturate 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_BIQUADFILTER_RES_OK ==
+          eDSP_BIQUADFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL / 2, &l_iFiltered) ) &&
+        ( MIN_INT64VAL == l_iFiltered ) && ( MIN_INT64VAL == l_atState[1u].iY1 ) &&
+        ( e_eDSP_BIQUADFILTER_RES_OK == eDSP_BIQUADFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 1u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Saturate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Saturate 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_BIQUADFILTER_RES_OK == eDSP_BIQUADFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) ) &&
+        ( e_eDSP_BIQUADFILTER_RES_OK == eDSP_BIQUADFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Saturate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_Saturate 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_BIQUADFILTERTST_BlockVsSample(void)
+{
+    /* Local variable */
+    t_eDSP_BIQUADFILTER_Ctx l_tCtxBlock;
+    t_eDSP_BIQUADFILTER_Ctx l_tCtxSample;
+    t_eDSP_BIQUADFILTER_Coeff l_atCoeff[2u] =
+    {
+        { 1012, 2024, 1012, -23450, 10380 },
+        { 4096, 8192, 4096, -12000,  4000 }
+    };
+    t_eDSP_BIQUADFILTER_State l_atStateBlock[2u];
+    t_eDSP_BIQUADFILTER_State l_atStateSample[2u];
+    int64_t  l_aiValues[64u];
+    int64_t  l_aiFiltered[64u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uNBlock;
+    uint32_t l_uNSample;
+    uint32_t l_uNSampleProc;
+    uint64_t l_uSeed;
+    e_eDSP_BIQUADFILTER_RES l_eBlockRes;
+    e_eDSP_BIQUADFILTER_RES l_eSampleRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0xB5C0FBCFEC4D3B2Fu;
+
+    /* Function */
+    (void)eDSP_BIQUADFILTER_InitCtx(&l_tCtxBlock, l_atCoeff, l_atStateBlock, 2u, 14u);
+    (void)eDSP_BIQUADFILTER_InitCtx(&l_tCtxSample, l_atCoeff, l_atStateSample, 2u, 14u);
+
+    /* Some block has full range values, the block stop at the value that overflow */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uNBlock = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 64u );
+
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            if( 0u == ( i % 8u ) )
+            {
+                l_aiValues[j] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+            }
+            else
+            {
+                l_aiValues[j] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 24u;
+            }
+        }
+
+        l_eBlockRes = eDSP_BIQUADFILTER_ProcessBlock(&l_tCtxBlock, l_aiValues, l_uNBlock, l_aiFiltered, &l_uNFiltered,
+                                                     &l_uNProcessed);
+
+        l_uNSample = 0u;
+        l_uNSampleProc = 0u;
+        l_eSampleRes = e_eDSP_BIQUADFILTER_RES_OK;
+        for(uint32_t j = 0u; ( ( j < l_uNBlock ) && ( e_eDSP_BIQUADFILTER_RES_OK == l_eSampleRes ) ); j++)
+        {
+            l_eSampleRes = eDSP_BIQUADFILTER_InsertValueAndCalculate(&l_tCtxSample, l_aiValues[j], &l_iFiltered);
+            l_uNSampleProc++;
+
+            if( e_eDSP_BIQUADFILTER_RES_OK == l_eSampleRes )
+            {
+                if( ( l_uNSample >= l_uNFiltered ) || ( l_aiFiltered[l_uNSample] != l_iFiltered ) )
+                {
+                    l_bTestOk = false;
+                }
+
+                l_uNSample++;
+            }
+        }
+
+        if( ( l_uNSample != l_uNFiltered ) || ( l_uNSampleProc != l_uNProcessed ) || ( l_eBlockRes != l_eSampleRes ) )
+        {
+            l_bTestOk = false;
+        }
+
+        /* The status is not updated by the value that overflow, so the next block can go on */
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BlockVsSample 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BIQUADFILTERTST_BlockVsSample 1  -- FAIL \n");
+    }
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
@@ -0,0 +1,511 @@
+/**
+ * @file       eDSP_CICDECIMATORTST.c
+ *
+ * @brief      CIC decimator test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_CICDECIMATORTST.h"
+#include "eDSP_CICDECIMATOR.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_CICDECIMATORTST_BadPointer(void);
+static void eDSP_CICDECIMATORTST_BadInit(void);
+static void eDSP_CICDECIMATORTST_BadParamEntr(void);
+static void eDSP_CICDECIMATORTST_CorruptedContext(void);
+static void eDSP_CICDECIMATORTST_Gain(void);
+static void eDSP_CICDECIMATORTST_Reference(void);
+static void eDSP_CICDECIMATORTST_Wraparound(void);
+static void eDSP_CICDECIMATORTST_BlockVsSample(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_CICDECIMATORTST_ExeTest(void)
+{
+	(void)printf("\n\nCICDECIMATOR TEST START \n\n");
+
+    eDSP_CICDECIMATORTST_BadPointer();
+    eDSP_CICDECIMATORTST_BadInit();
+    eDSP_CICDECIMATORTST_BadParamEntr();
+    eDSP_CICDECIMATORTST_CorruptedContext();
+    eDSP_CICDECIMATORTST_Gain();
+    eDSP_CICDECIMATORTST_Reference();
+    eDSP_CICDECIMATORTST_Wraparound();
+    eDSP_CICDECIMATORTST_BlockVsSample();
+
+    (void)printf("\n\nCICDECIMATOR TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_CICDECIMATORTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_CICDECIMATOR_Ctx l_tCtx;
+    uint64_t l_auState[6u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint64_t l_uGain;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( ( e_eDSP_CICDECIMATOR_RES_BADPOINTER == eDSP_CICDECIMATOR_InitCtx(NULL, l_auState, 6u, 3u, 4u) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_BADPOINTER == eDSP_CICDECIMATOR_InitCtx(&l_tCtx, NULL, 6u, 3u, 4u) ) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_CICDECIMATOR_RES_BADPOINTER == eDSP_CICDECIMATOR_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_BADPOINTER == eDSP_CICDECIMATOR_IsInit(&l_tCtx, NULL) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_BADPOINTER == eDSP_CICDECIMATOR_GetGain(NULL, &l_uGain) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_BADPOINTER == eDSP_CICDECIMATOR_GetGain(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_CICDECIMATOR_RES_BADPOINTER == eDSP_CICDECIMATOR_InsertValueAndCalculate(NULL, 1, &l_iFiltered) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_BADPOINTER == eDSP_CICDECIMATOR_InsertValueAndCalculate(&l_tCtx, 1, NULL) ) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_CICDECIMATOR_RES_BADPOINTER ==
+          eDSP_CICDECIMATOR_ProcessBlock(NULL, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_BADPOINTER ==
+          eDSP_CICDECIMATOR_ProcessBlock(&l_tCtx, NULL, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_BADPOINTER ==
+          eDSP_CICDECIMATOR_ProcessBlock(&l_tCtx, l_aiValues, 2u, NULL, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_BADPOINTER ==
+          eDSP_CICDECIMATOR_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, NULL, &l_uNProcessed) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_BADPOINTER ==
+          eDSP_CICDECIMATOR_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, NULL) ) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadPointer 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_CICDECIMATORTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_CICDECIMATOR_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint64_t l_uGain;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_CICDECIMATOR_RES_OK == eDSP_CICDECIMATOR_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_CICDECIMATOR_RES_NOINITLIB == eDSP_CICDECIMATOR_GetGain(&l_tCtx, &l_uGain) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_NOINITLIB == eDSP_CICDECIMATOR_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_NOINITLIB ==
+          eDSP_CICDECIMATOR_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadInit 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_CICDECIMATORTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_CICDECIMATOR_Ctx l_tCtx;
+    uint64_t l_auState[126u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Function */
+    if( ( e_eDSP_CICDECIMATOR_RES_BADPARAM == eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 5u, 3u, 4u) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_BADPARAM == eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 0u, 0u, 4u) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_BADPARAM == eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 6u, 3u, 0u) ) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* 2^63 doesn't fit an int64_t, 2^62 does */
+    if( ( e_eDSP_CICDECIMATOR_RES_BADPARAM == eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 126u, 63u, 2u) ) &&
+        ( e_eDSP_CICDECIMATOR_RES_OK == eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 124u, 62u, 2u) ) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eDSP_CICDECIMATOR_RES_BADPARAM ==
+        eDSP_CICDECIMATOR_ProcessBlock(&l_tCtx, l_aiValues, 0u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BadParamEntr 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_CICDECIMATORTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_CICDECIMATOR_Ctx l_tCtx;
+    uint64_t l_auState[6u];
+    int64_t  l_iFiltered;
+    uint64_t l_uGain;
+
+    /* Function */
+    (void)eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 6u, 3u, 4u);
+    l_tCtx.puStateBuffer = NULL;
+    if( e_eDSP_CICDECIMATOR_RES_CORRUPTCTX == eDSP_CICDECIMATOR_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 6u, 3u, 4u);
+    l_tCtx.uSampleCnt = 4u;
+    if( e_eDSP_CICDECIMATOR_RES_CORRUPTCTX == eDSP_CICDECIMATOR_GetGain(&l_tCtx, &l_uGain) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    (void)eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 6u, 3u, 4u);
+    l_tCtx.uGain = 0u;
+    if( e_eDSP_CICDECIMATOR_RES_CORRUPTCTX == eDSP_CICDECIMATOR_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_CorruptedContext 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_CICDECIMATORTST_Gain(void)
+{
+    /* Local variable */
+    t_eDSP_CICDECIMATOR_Ctx l_tCtx;
+    uint64_t l_auState[8u];
+    int64_t  l_iFiltered;
+    uint64_t l_uGain;
+    e_eDSP_CICDECIMATOR_RES l_eRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uGain = 0u;
+    l_iFiltered = 0;
+
+    /* Function */
+    (void)eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 8u, 4u, 3u);
+    if( ( e_eDSP_CICDECIMATOR_RES_OK == eDSP_CICDECIMATOR_GetGain(&l_tCtx, &l_uGain) ) && ( 81u == l_uGain ) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_Gain 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_Gain 1  -- FAIL \n");
+    }
+
+    /* A constant input is amplified by the gain once the filter is full, one output every three input */
+    for(uint32_t i = 0u; ( ( i < 30u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_eRes = eDSP_CICDECIMATOR_InsertValueAndCalculate(&l_tCtx, -5, &l_iFiltered);
+
+        if( 2u == ( i % 3u ) )
+        {
+            if( ( e_eDSP_CICDECIMATOR_RES_OK != l_eRes ) || ( ( i > 12u ) && ( -405 != l_iFiltered ) ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+        else
+        {
+            if( e_eDSP_CICDECIMATOR_RES_NEEDSMOREVALUE != l_eRes )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_Gain 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_Gain 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_CICDECIMATORTST_Reference(void)
+{
+    /* Local variable */
+    t_eDSP_CICDECIMATOR_Ctx l_tCtx;
+    uint64_t l_auState[6u];
+    int64_t  l_aiStage[4u][300u];
+    int64_t  l_iFiltered;
+    uint64_t l_uSeed;
+    uint32_t l_uNOut;
+    e_eDSP_CICDECIMATOR_RES l_eRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0x6A09E667F3BCC908u;
+    l_uNOut = 0u;
+
+    /* Function */
+    (void)eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 6u, 3u, 5u);
+
+    /* The CIC is the same of three cascaded moving sum of five values, sampled one time every five */
+    for(uint32_t i = 0u; i < 300u; i++)
+    {
+        l_aiStage[0u][i] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 40u;
+    }
+
+    for(uint32_t s = 1u; s < 4u; s++)
+    {
+        for(uint32_t i = 0u; i < 300u; i++)
+        {
+            l_aiStage[s][i] = 0;
+
+            for(uint32_t j = 0u; ( ( j < 5u ) && ( j <= i ) ); j++)
+            {
+                l_aiStage[s][i] += l_aiStage[s - 1u][i - j];
+            }
+        }
+    }
+
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_eRes = eDSP_CICDECIMATOR_InsertValueAndCalculate(&l_tCtx, l_aiStage[0u][i], &l_iFiltered);
+
+        if( e_eDSP_CICDECIMATOR_RES_OK == l_eRes )
+        {
+            if( ( 4u != ( i % 5u ) ) || ( l_aiStage[3u][i] != l_iFiltered ) )
+            {
+                l_bTestOk = false;
+            }
+
+            l_uNOut++;
+        }
+        else if( e_eDSP_CICDECIMATOR_RES_NEEDSMOREVALUE != l_eRes )
+        {
+            l_bTestOk = false;
+        }
+        else
+        {
+            /* Nothing to check */
+        }
+    }
+
+    if( ( true == l_bTestOk ) && ( 60u == l_uNOut ) )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_Reference 1  -- FAIL \n");
+    }
+}
+
+static void eDSP_CICDECIMATORTST_Wraparound(void)
+{
+    /* Local variable */
+    t_eDSP_CICDECIMATOR_Ctx l_tCtx;
+    uint64_t l_auState[4u];
+    int64_t  l_iFiltered;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_iFiltered = 0;
+
+    /* Function */
+    (void)eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 4u, 2u, 2u);
+
+    /* The integrators wrap around many time, but the output fits and must be exact */
+    for(uint32_t i = 0u; ( ( i < 100u ) && ( true == l_bTestOk ) ); i++)
+    {
+        (void)eDSP_CICDECIMATOR_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL / 4, &l_iFiltered);
+
+        if( ( i > 4u ) && ( 1u == ( i % 2u ) ) && ( MIN_INT64VAL != l_iFiltered ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_Wraparound 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_Wraparound 1  -- FAIL \n");
+    }
+
+    (void)eDSP_CICDECIMATOR_InitCtx(&l_tCtx, l_auState, 4u, 2u, 2u);
+    l_bTestOk = true;
+
+    for(uint32_t i = 0u; ( ( i < 100u ) && ( true == l_bTestOk ) ); i++)
+    {
+        (void)eDSP_CICDECIMATOR_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL / 4, &l_iFiltered);
+
+        if( ( i > 4u ) && ( 1u == ( i % 2u ) ) && ( ( MAX_INT64VAL - 3 ) != l_iFiltered ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_Wraparound 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_Wraparound 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_CICDECIMATORTST_BlockVsSample(void)
+{
+    /* Local variable */
+    t_eDSP_CICDECIMATOR_Ctx l_tCtxBlock;
+    t_eDSP_CICDECIMATOR_Ctx l_tCtxSample;
+    uint64_t l_auStateBlock[8u];
+    uint64_t l_auStateSample[8u];
+    int64_t  l_aiValues[64u];
+    int64_t  l_aiFiltered[64u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uNBlock;
+    uint32_t l_uNSample;
+    uint64_t l_uSeed;
+    e_eDSP_CICDECIMATOR_RES l_eBlockRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0xBB67AE8584CAA73Bu;
+
+    /* Function */
+    (void)eDSP_CICDECIMATOR_InitCtx(&l_tCtxBlock, l_auStateBlock, 8u, 4u, 7u);
+    (void)eDSP_CICDECIMATOR_InitCtx(&l_tCtxSample, l_auStateSample, 8u, 4u, 7u);
+
+    /* Full range values, the output wrap around in the same way in both case */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uNBlock = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 64u );
+
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            l_aiValues[j] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+        }
+
+        l_eBlockRes = eDSP_CICDECIMATOR_ProcessBlock(&l_tCtxBlock, l_aiValues, l_uNBlock, l_aiFiltered,
+                                                     &l_uNFiltered, &l_uNProcessed);
+
+        l_uNSample = 0u;
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            if( e_eDSP_CICDECIMATOR_RES_OK ==
+                eDSP_CICDECIMATOR_InsertValueAndCalculate(&l_tCtxSample, l_aiValues[j], &l_iFiltered) )
+            {
+                if( ( l_uNSample >= l_uNFiltered ) || ( l_aiFiltered[l_uNSample] != l_iFiltered ) )
+                {
+                    l_bTestOk = false;
+                }
+
+                l_uNSample++;
+            }
+        }
+
+        /* Nothing can fail, every value is consumed */
+        if( ( l_uNSample != l_uNFiltered ) || ( l_uNBlock != l_uNProcessed ) ||
+            ( ( 0u == l_uNSample ) && ( e_eDSP_CICDECIMATOR_RES_NEEDSMOREVALUE != l_eBlockRes ) ) ||
+            ( ( 0u != l_uNSample ) && ( e_eDSP_CICDECIMATOR_RES_OK != l_eBlockRes ) ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BlockVsSample 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_CICDECIMATORTST_BlockVsSample 1  -- FAIL \n");
+    }
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
@@ -0,0 +1,812 @@
+/**
+ * @file       eDSP_DECIMATIONFILTERTST.c
+ *
+ * @brief      Decimator filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_DECIMATIONFILTERTST.h"
+#include "eDSP_DECIMATIONFILTER.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_DECIMATIONFILTERTST_BadPointer(void);
+static void eDSP_DECIMATIONFILTERTST_BadInit(void);
+static void eDSP_DECIMATIONFILTERTST_BadParamEntr(void);
+static void eDSP_DECIMATIONFILTERTST_CorruptedContext(void);
+static void eDSP_DECIMATIONFILTERTST_Reference(void);
+static void eDSP_DECIMATIONFILTERTST_Overflow(void);
+static void eDSP_DECIMATIONFILTERTST_Saturate(void);
+static void eDSP_DECIMATIONFILTERTST_BlockVsSample(void);
+static bool_t eDSP_DECIMATIONFILTERTST_CheckRef(const e_eDSP_DECIMATIONFILTER_TYPE p_eDecimType,
+                                                const uint32_t p_uDecimRatio, const bool_t p_bUseBlock,
+                                                const uint64_t p_uSeedInit);
+static bool_t eDSP_DECIMATIONFILTERTST_CheckBlock(const e_eDSP_DECIMATIONFILTER_TYPE p_eDecimType,
+                                                  const uint32_t p_uDecimRatio, const e_eDSP_TYPE_OVFMODE p_eOvfMode,
+                                                  const uint64_t p_uSeedInit);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_DECIMATIONFILTERTST_ExeTest(void)
+{
+	(void)printf("\n\nDECIMATIONFILTER TEST START \n\n");
+
+    eDSP_DECIMATIONFILTERTST_BadPointer();
+    eDSP_DECIMATIONFILTERTST_BadInit();
+    eDSP_DECIMATIONFILTERTST_BadParamEntr();
+    eDSP_DECIMATIONFILTERTST_CorruptedContext();
+    eDSP_DECIMATIONFILTERTST_Reference();
+    eDSP_DECIMATIONFILTERTST_Overflow();
+    eDSP_DECIMATIONFILTERTST_Saturate();
+    eDSP_DECIMATIONFILTERTST_BlockVsSample();
+
+    (void)printf("\n\nDECIMATIONFILTER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_DECIMATIONFILTERTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_DECIMATIONFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[5u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER ==
+          eDSP_DECIMATIONFILTER_InitCtx(NULL, l_aiWindow, 5u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 2u) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER ==
+          eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, NULL, 5u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 2u) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER == eDSP_DECIMATIONFILTER_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER == eDSP_DECIMATIONFILTER_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER ==
+          eDSP_DECIMATIONFILTER_InsertValueAndCalculate(NULL, 1, &l_iFiltered) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER ==
+          eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, 1, NULL) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER ==
+          eDSP_DECIMATIONFILTER_ProcessBlock(NULL, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER ==
+          eDSP_DECIMATIONFILTER_ProcessBlock(&l_tCtx, NULL, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER ==
+          eDSP_DECIMATIONFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, NULL, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER ==
+          eDSP_DECIMATIONFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, NULL, &l_uNProcessed) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER ==
+          eDSP_DECIMATIONFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, NULL) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER ==
+          eDSP_DECIMATIONFILTER_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER == eDSP_DECIMATIONFILTER_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_BADPOINTER == eDSP_DECIMATIONFILTER_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadPointer 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_DECIMATIONFILTERTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_DECIMATIONFILTER_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_DECIMATIONFILTER_RES_OK == eDSP_DECIMATIONFILTER_IsInit(&l_tCtx, &l_bIsInit) ) &&
+        ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DECIMATIONFILTER_RES_NOINITLIB ==
+          eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_NOINITLIB ==
+          eDSP_DECIMATIONFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DECIMATIONFILTER_RES_NOINITLIB ==
+          eDSP_DECIMATIONFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_NOINITLIB == eDSP_DECIMATIONFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadInit 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_DECIMATIONFILTERTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_DECIMATIONFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[5u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Function */
+    if( ( e_eDSP_DECIMATIONFILTER_RES_BADPARAM ==
+          eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 2u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 2u) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_BADPARAM ==
+          eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 0u) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_BADPARAM ==
+          eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, (e_eDSP_DECIMATIONFILTER_TYPE) 5, 2u) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eDSP_DECIMATIONFILTER_RES_OK ==
+        eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 2u) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eDSP_DECIMATIONFILTER_RES_BADPARAM ==
+        eDSP_DECIMATIONFILTER_ProcessBlock(&l_tCtx, l_aiValues, 0u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eDSP_DECIMATIONFILTER_RES_BADPARAM == eDSP_DECIMATIONFILTER_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BadParamEntr 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_DECIMATIONFILTERTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_DECIMATIONFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[5u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 2u);
+    l_tCtx.piWindowsBuffer = NULL;
+    if( e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX ==
+        eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    /* The values since the last output are counted only once the window is full */
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 2u);
+    l_tCtx.uSinceLastOut = 1u;
+    if( e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX ==
+        eDSP_DECIMATIONFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 2u);
+    for(uint32_t i = 0u; i < 5u; i++)
+    {
+        (void)eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered);
+    }
+    l_tCtx.uSinceLastOut = 2u;
+    if( e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX == eDSP_DECIMATIONFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 2u);
+    l_tCtx.eDecimType = (e_eDSP_DECIMATIONFILTER_TYPE) 5;
+    if( e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX ==
+        eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_CorruptedContext 4  -- FAIL \n");
+    }
+
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 2u);
+    l_tCtx.eOvfMode = (e_eDSP_TYPE_OVFMODE) 5;
+    if( e_eDSP_DECIMATIONFILTER_RES_CORRUPTCTX ==
+        eDSP_DECIMATIONFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_CorruptedContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_CorruptedContext 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_DECIMATIONFILTERTST_Reference(void)
+{
+    /* Function */
+    if( ( true == eDSP_DECIMATIONFILTERTST_CheckRef(e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 1u, false,
+                                                    0x2468ACE013579BDFu) ) &&
+        ( true == eDSP_DECIMATIONFILTERTST_CheckRef(e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 3u, false,
+                                                    0x0123456789ABCDEFu) ) &&
+        ( true == eDSP_DECIMATIONFILTERTST_CheckRef(e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 7u, false,
+                                                    0x3C6EF372FE94F82Bu) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Reference 1  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_DECIMATIONFILTERTST_CheckRef(e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN, 1u, false,
+                                                    0xA54FF53A5F1D36F1u) ) &&
+        ( true == eDSP_DECIMATIONFILTERTST_CheckRef(e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN, 2u, false,
+                                                    0x510E527FADE682D1u) ) &&
+        ( true == eDSP_DECIMATIONFILTERTST_CheckRef(e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN, 5u, false,
+                                                    0x9B05688C2B3E6C1Fu) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Reference 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Reference 2  -- FAIL \n");
+    }
+
+    /* The same values processed as blocks, a large value in a block fail the pre-scan and force the checked path */
+    if( ( true == eDSP_DECIMATIONFILTERTST_CheckRef(e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 3u, true,
+                                                    0x0123456789ABCDEFu) ) &&
+        ( true == eDSP_DECIMATIONFILTERTST_CheckRef(e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN, 2u, true,
+                                                    0x510E527FADE682D1u) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Reference 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Reference 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_DECIMATIONFILTERTST_Overflow(void)
+{
+    /* Local variable */
+    t_eDSP_DECIMATIONFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[3u];
+    int64_t  l_aiValues[5u] = { 1, MAX_INT64VAL, MAX_INT64VAL, 5, 6 };
+    int64_t  l_aiFiltered[5u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Init variable */
+    l_iFiltered = 1;
+
+    /* Function */
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 3u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 1u);
+    (void)eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    (void)eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    if( e_eDSP_DECIMATIONFILTER_RES_OVERFLOW ==
+        eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Overflow 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Overflow 1  -- FAIL \n");
+    }
+
+    /* The value is stored in the window even when the output overflow */
+    if( ( e_eDSP_DECIMATIONFILTER_RES_OVERFLOW ==
+          eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, 0, &l_iFiltered) ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_OK ==
+          eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered) ) &&
+        ( 0 == l_iFiltered ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Overflow 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Overflow 2  -- FAIL \n");
+    }
+
+    /* The value that overflow is counted as processed */
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 3u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 2u);
+    if( ( e_eDSP_DECIMATIONFILTER_RES_OVERFLOW ==
+          eDSP_DECIMATIONFILTER_ProcessBlock(&l_tCtx, l_aiValues, 5u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( 0u == l_uNFiltered ) && ( 3u == l_uNProcessed ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Overflow 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Overflow 3  -- FAIL \n");
+    }
+
+    /* The distance of the min value from the mean does not fit an int64_t, it is not an overflow */
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 3u, e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN, 1u);
+    (void)eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered);
+    (void)eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    if( ( e_eDSP_DECIMATIONFILTER_RES_OK ==
+          eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, 0, &l_iFiltered) ) &&
+        ( 0 == l_iFiltered ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Overflow 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Overflow 4  -- FAIL \n");
+    }
+
+    /* The mean is -1, its difference from the max value is exactly MIN_INT64VAL */
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 3u, e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN, 1u);
+    (void)eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    (void)eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered);
+    if( ( e_eDSP_DECIMATIONFILTER_RES_OK ==
+          eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, -2, &l_iFiltered) ) &&
+        ( -2 == l_iFiltered ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Overflow 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Overflow 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_DECIMATIONFILTERTST_Saturate(void)
+{
+    /* Local variable */
+    t_eDSP_DECIMATIONFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[3u];
+    int64_t  l_iFiltered;
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_iFiltered = 1;
+    l_uSatCnt = 0u;
+
+    /* Function */
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 3u, e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 1u);
+    if( e_eDSP_DECIMATIONFILTER_RES_OK == eDSP_DECIMATIONFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Saturate 1  -- FAIL \n");
+    }
+
+    /* The mean of the window always fit, nothing is clamped */
+    (void)eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    (void)eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    if( ( e_eDSP_DECIMATIONFILTER_RES_OK ==
+          eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered) ) &&
+        ( MAX_INT64VAL == l_iFiltered ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_OK == eDSP_DECIMATIONFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) &&
+        ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Saturate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Saturate 2  -- FAIL \n");
+    }
+
+    /* The distances from the mean are never clamped, the nearest is found without any saturation */
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 3u, e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN, 1u);
+    (void)eDSP_DECIMATIONFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE);
+    (void)eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    (void)eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered);
+    if( ( e_eDSP_DECIMATIONFILTER_RES_OK ==
+          eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, -2, &l_iFiltered) ) &&
+        ( -2 == l_iFiltered ) &&
+        ( e_eDSP_DECIMATIONFILTER_RES_OK == eDSP_DECIMATIONFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) &&
+        ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Saturate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Saturate 3  -- FAIL \n");
+    }
+
+    /* Setting the mode restart the count */
+    (void)eDSP_DECIMATIONFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE);
+    if( ( e_eDSP_DECIMATIONFILTER_RES_OK == eDSP_DECIMATIONFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) &&
+        ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Saturate 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_Saturate 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_DECIMATIONFILTERTST_BlockVsSample(void)
+{
+    /* Function */
+    if( ( true == eDSP_DECIMATIONFILTERTST_CheckBlock(e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 1u,
+                                                      e_eDSP_TYPE_OVFMODE_ERROR, 0x0BADC0FFEE0DDF00u) ) &&
+        ( true == eDSP_DECIMATIONFILTERTST_CheckBlock(e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 2u,
+                                                      e_eDSP_TYPE_OVFMODE_ERROR, 0x2468ACE013579BDFu) ) &&
+        ( true == eDSP_DECIMATIONFILTERTST_CheckBlock(e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 3u,
+                                                      e_eDSP_TYPE_OVFMODE_ERROR, 0x0123456789ABCDEFu) ) &&
+        ( true == eDSP_DECIMATIONFILTERTST_CheckBlock(e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 11u,
+                                                      e_eDSP_TYPE_OVFMODE_ERROR, 0x3C6EF372FE94F82Bu) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BlockVsSample 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BlockVsSample 1  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_DECIMATIONFILTERTST_CheckBlock(e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN, 1u,
+                                                      e_eDSP_TYPE_OVFMODE_ERROR, 0xA54FF53A5F1D36F1u) ) &&
+        ( true == eDSP_DECIMATIONFILTERTST_CheckBlock(e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN, 2u,
+                                                      e_eDSP_TYPE_OVFMODE_ERROR, 0x510E527FADE682D1u) ) &&
+        ( true == eDSP_DECIMATIONFILTERTST_CheckBlock(e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN, 7u,
+                                                      e_eDSP_TYPE_OVFMODE_ERROR, 0x9B05688C2B3E6C1Fu) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BlockVsSample 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BlockVsSample 2  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_DECIMATIONFILTERTST_CheckBlock(e_eDSP_DECIMATIONFILTER_TYPE_MEAN, 3u,
+                                                      e_eDSP_TYPE_OVFMODE_SATURATE, 0x1F83D9ABFB41BD6Bu) ) &&
+        ( true == eDSP_DECIMATIONFILTERTST_CheckBlock(e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN, 4u,
+                                                      e_eDSP_TYPE_OVFMODE_SATURATE, 0x5BE0CD19137E2179u) ) )
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BlockVsSample 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DECIMATIONFILTERTST_BlockVsSample 3  -- FAIL \n");
+    }
+}
+
+static bool_t eDSP_DECIMATIONFILTERTST_CheckRef(const e_eDSP_DECIMATIONFILTER_TYPE p_eDecimType,
+                                                const uint32_t p_uDecimRatio, const bool_t p_bUseBlock,
+                                                const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_DECIMATIONFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[5u];
+    int64_t  l_aiHistory[400u];
+    int64_t  l_aiFiltered[400u];
+    int64_t  l_iFiltered;
+    int64_t  l_iRefSum;
+    int64_t  l_iRefMean;
+    int64_t  l_iRef;
+    int64_t  l_iDiff;
+    int64_t  l_iRefDiff;
+    uint64_t l_uSeed;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uNOut;
+    e_eDSP_DECIMATIONFILTER_RES l_eRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+    l_uNOut = 0u;
+    l_iFiltered = 0;
+
+    /* Values up to 2^40, with one value near 2^60 every 50 that make the pre-scan fail for the whole block */
+    for(uint32_t i = 0u; i < 400u; i++)
+    {
+        l_aiHistory[i] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 24u;
+
+        if( ( true == p_bUseBlock ) && ( 17u == ( i % 50u ) ) )
+        {
+            l_aiHistory[i] = ( MAX_INT64VAL >> 3u ) - ( l_aiHistory[i] & 0xFFFF );
+        }
+    }
+
+    /* Function */
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, p_eDecimType, p_uDecimRatio);
+
+    if( true == p_bUseBlock )
+    {
+        /* Blocks of 40 values, the last values of a block and the first of the next one share the same window */
+        for(uint32_t i = 0u; ( ( i < 400u ) && ( true == l_bTestOk ) ); i += 40u)
+        {
+            l_eRes = eDSP_DECIMATIONFILTER_ProcessBlock(&l_tCtx, &l_aiHistory[i], 40u, &l_aiFiltered[l_uNOut],
+                                                        &l_uNFiltered, &l_uNProcessed);
+
+            if( ( e_eDSP_DECIMATIONFILTER_RES_OK != l_eRes ) || ( 40u != l_uNProcessed ) )
+            {
+                l_bTestOk = false;
+            }
+
+            l_uNOut += l_uNFiltered;
+        }
+    }
+    else
+    {
+        for(uint32_t i = 0u; ( ( i < 400u ) && ( true == l_bTestOk ) ); i++)
+        {
+            l_eRes = eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtx, l_aiHistory[i], &l_iFiltered);
+
+            if( e_eDSP_DECIMATIONFILTER_RES_OK == l_eRes )
+            {
+                l_aiFiltered[l_uNOut] = l_iFiltered;
+                l_uNOut++;
+            }
+            else if( e_eDSP_DECIMATIONFILTER_RES_NEEDSMOREVALUE != l_eRes )
+            {
+                l_bTestOk = false;
+            }
+            else
+            {
+                /* Nothing to store */
+            }
+        }
+    }
+
+    /* The first output is generated when the window is full, then one every p_uDecimRatio values */
+    if( ( 1u + ( 395u / p_uDecimRatio ) ) != l_uNOut )
+    {
+        l_bTestOk = false;
+    }
+
+    for(uint32_t k = 0u; ( ( k < l_uNOut ) && ( true == l_bTestOk ) ); k++)
+    {
+        l_iRefSum = 0;
+
+        for(uint32_t j = ( k * p_uDecimRatio ); j < ( ( k * p_uDecimRatio ) + 5u ); j++)
+        {
+            l_iRefSum += l_aiHistory[j];
+        }
+
+        /* Truncated toward zero like the C division */
+        l_iRefMean = l_iRefSum / 5;
+        l_iRef = l_iRefMean;
+
+        if( e_eDSP_DECIMATIONFILTER_TYPE_MEDIAN == p_eDecimType )
+        {
+            /* The value of the window nearest to the mean, random values have no tie */
+            l_iRefDiff = MAX_INT64VAL;
+
+            for(uint32_t j = ( k * p_uDecimRatio ); j < ( ( k * p_uDecimRatio ) + 5u ); j++)
+            {
+                l_iDiff = l_iRefMean - l_aiHistory[j];
+
+                if( l_iDiff < 0 )
+                {
+                    l_iDiff = -l_iDiff;
+                }
+
+                if( l_iDiff < l_iRefDiff )
+                {
+                    l_iRef = l_aiHistory[j];
+                    l_iRefDiff = l_iDiff;
+                }
+            }
+        }
+
+        if( l_iRef != l_aiFiltered[k] )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    return l_bTestOk;
+}
+
+static bool_t eDSP_DECIMATIONFILTERTST_CheckBlock(const e_eDSP_DECIMATIONFILTER_TYPE p_eDecimType,
+                                                  const uint32_t p_uDecimRatio, const e_eDSP_TYPE_OVFMODE p_eOvfMode,
+                                                  const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_DECIMATIONFILTER_Ctx l_tCtxBlock;
+    t_eDSP_DECIMATIONFILTER_Ctx l_tCtxSample;
+    int64_t  l_aiWindowBlock[9u];
+    int64_t  l_aiWindowSample[9u];
+    int64_t  l_aiValues[64u];
+    int64_t  l_aiFiltered[64u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uNBlock;
+    uint32_t l_uNSample;
+    uint32_t l_uNSampleIn;
+    uint32_t l_uSatCnt;
+    uint32_t l_uRefSatCnt;
+    uint64_t l_uSeed;
+    e_eDSP_DECIMATIONFILTER_RES l_eBlockRes;
+    e_eDSP_DECIMATIONFILTER_RES l_eSampleRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+    l_iFiltered = 0;
+    l_uSatCnt = 0u;
+    l_uRefSatCnt = 0u;
+
+    /* Function */
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtxBlock, l_aiWindowBlock, 9u, p_eDecimType, p_uDecimRatio);
+    (void)eDSP_DECIMATIONFILTER_InitCtx(&l_tCtxSample, l_aiWindowSample, 9u, p_eDecimType, p_uDecimRatio);
+    (void)eDSP_DECIMATIONFILTER_SetOvfMode(&l_tCtxBlock, p_eOvfMode);
+    (void)eDSP_DECIMATIONFILTER_SetOvfMode(&l_tCtxSample, p_eOvfMode);
+
+    /* Small values take the pre-scanned path. Values up to 2^59 fail the pre-scan, so the block use the checked path
+       even if most of the sums fit, and full range values overflow or saturate. The single value insertion always
+       use the checked path and must give the same result */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uNBlock = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 64u );
+
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            if( 0u == ( i % 4u ) )
+            {
+                l_aiValues[j] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+            }
+            else if( 1u == ( i % 4u ) )
+            {
+                l_aiValues[j] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 4u;
+            }
+            else
+            {
+                l_aiValues[j] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 16u;
+            }
+        }
+
+        l_eBlockRes = eDSP_DECIMATIONFILTER_ProcessBlock(&l_tCtxBlock, l_aiValues, l_uNBlock, l_aiFiltered,
+                                                         &l_uNFiltered, &l_uNProcessed);
+
+        /* Processing stop at the first error, feed the same values one by one */
+        l_uNSample = 0u;
+        l_uNSampleIn = 0u;
+        l_eSampleRes = e_eDSP_DECIMATIONFILTER_RES_NEEDSMOREVALUE;
+        for(uint32_t j = 0u; ( ( j < l_uNBlock ) && ( e_eDSP_DECIMATIONFILTER_RES_OVERFLOW != l_eSampleRes ) ); j++)
+        {
+            l_eSampleRes = eDSP_DECIMATIONFILTER_InsertValueAndCalculate(&l_tCtxSample, l_aiValues[j], &l_iFiltered);
+
+            l_uNSampleIn++;
+
+            if( e_eDSP_DECIMATIONFILTER_RES_OK == l_eSampleRes )
+            {
+                if( ( l_uNSample >= l_uNFiltered ) || ( l_aiFiltered[l_uNSample] != l_iFiltered ) )
+                {
+                    l_bTestOk = false;
+                }
+
+                l_uNSample++;
+            }
+        }
+
+        if( ( l_uNSample != l_uNFiltered ) || ( l_uNSampleIn != l_uNProcessed ) ||
+            ( ( e_eDSP_DECIMATIONFILTER_RES_OVERFLOW == l_eBlockRes ) &&
+              ( e_eDSP_DECIMATIONFILTER_RES_OVERFLOW != l_eSampleRes ) ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    /* The same numbers of clamped operations */
+    (void)eDSP_DECIMATIONFILTER_GetSatCnt(&l_tCtxBlock, &l_uSatCnt);
+    (void)eDSP_DECIMATIONFILTER_GetSatCnt(&l_tCtxSample, &l_uRefSatCnt);
+
+    if( l_uSatCnt != l_uRefSatCnt )
+    {
+        l_bTestOk = false;
+    }
+
+    return l_bTestOk;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
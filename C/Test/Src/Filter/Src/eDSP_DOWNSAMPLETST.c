@@ -0,0 +1,418 @@
+/**
+ * @file       eDSP_DOWNSAMPLETST.c
+ *
+ * @brief      Downsampler test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_DOWNSAMPLETST.h"
+#include "eDSP_DOWNSAMPLE.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_DOWNSAMPLETST_BadPointer(void);
+static void eDSP_DOWNSAMPLETST_BadInit(void);
+static void eDSP_DOWNSAMPLETST_BadParamEntr(void);
+static void eDSP_DOWNSAMPLETST_CorruptedContext(void);
+static void eDSP_DOWNSAMPLETST_Reference(void);
+static void eDSP_DOWNSAMPLETST_BlockVsSample(void);
+static bool_t eDSP_DOWNSAMPLETST_CheckBlock(const uint32_t p_uDowSampleIndex, const uint64_t p_uSeedInit);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_DOWNSAMPLETST_ExeTest(void)
+{
+	(void)printf("\n\nDOWNSAMPLE TEST START \n\n");
+
+    eDSP_DOWNSAMPLETST_BadPointer();
+    eDSP_DOWNSAMPLETST_BadInit();
+    eDSP_DOWNSAMPLETST_BadParamEntr();
+    eDSP_DOWNSAMPLETST_CorruptedContext();
+    eDSP_DOWNSAMPLETST_Reference();
+    eDSP_DOWNSAMPLETST_BlockVsSample();
+
+    (void)printf("\n\nDOWNSAMPLE TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_DOWNSAMPLETST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_DOWNSAMPLE_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( e_eDSP_DOWNSAMPLE_RES_BADPOINTER == eDSP_DOWNSAMPLE_InitCtx(NULL, 2u) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DOWNSAMPLE_RES_BADPOINTER == eDSP_DOWNSAMPLE_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_DOWNSAMPLE_RES_BADPOINTER == eDSP_DOWNSAMPLE_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DOWNSAMPLE_RES_BADPOINTER == eDSP_DOWNSAMPLE_InsertValueAndCalculate(NULL, 1, &l_iFiltered) ) &&
+        ( e_eDSP_DOWNSAMPLE_RES_BADPOINTER == eDSP_DOWNSAMPLE_InsertValueAndCalculate(&l_tCtx, 1, NULL) ) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DOWNSAMPLE_RES_BADPOINTER ==
+          eDSP_DOWNSAMPLE_ProcessBlock(NULL, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_DOWNSAMPLE_RES_BADPOINTER ==
+          eDSP_DOWNSAMPLE_ProcessBlock(&l_tCtx, NULL, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_DOWNSAMPLE_RES_BADPOINTER ==
+          eDSP_DOWNSAMPLE_ProcessBlock(&l_tCtx, l_aiValues, 2u, NULL, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_DOWNSAMPLE_RES_BADPOINTER ==
+          eDSP_DOWNSAMPLE_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, NULL, &l_uNProcessed) ) &&
+        ( e_eDSP_DOWNSAMPLE_RES_BADPOINTER ==
+          eDSP_DOWNSAMPLE_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, NULL) ) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadPointer 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_DOWNSAMPLETST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_DOWNSAMPLE_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_DOWNSAMPLE_RES_OK == eDSP_DOWNSAMPLE_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DOWNSAMPLE_RES_NOINITLIB == eDSP_DOWNSAMPLE_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) ) &&
+        ( e_eDSP_DOWNSAMPLE_RES_NOINITLIB ==
+          eDSP_DOWNSAMPLE_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadInit 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_DOWNSAMPLETST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_DOWNSAMPLE_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( e_eDSP_DOWNSAMPLE_RES_BADPARAM == eDSP_DOWNSAMPLE_InitCtx(&l_tCtx, 0u) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DOWNSAMPLE_RES_OK == eDSP_DOWNSAMPLE_InitCtx(&l_tCtx, 2u) ) &&
+        ( e_eDSP_DOWNSAMPLE_RES_OK == eDSP_DOWNSAMPLE_IsInit(&l_tCtx, &l_bIsInit) ) && ( true == l_bIsInit ) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eDSP_DOWNSAMPLE_RES_BADPARAM ==
+        eDSP_DOWNSAMPLE_ProcessBlock(&l_tCtx, l_aiValues, 0u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BadParamEntr 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_DOWNSAMPLETST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_DOWNSAMPLE_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Function */
+    (void)eDSP_DOWNSAMPLE_InitCtx(&l_tCtx, 3u);
+    l_tCtx.uDowSampleIndex = 0u;
+    if( e_eDSP_DOWNSAMPLE_RES_CORRUPTCTX == eDSP_DOWNSAMPLE_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_DOWNSAMPLE_InitCtx(&l_tCtx, 3u);
+    l_tCtx.uSampleCnt = 3u;
+    if( e_eDSP_DOWNSAMPLE_RES_CORRUPTCTX ==
+        eDSP_DOWNSAMPLE_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_CorruptedContext 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_DOWNSAMPLETST_Reference(void)
+{
+    /* Local variable */
+    t_eDSP_DOWNSAMPLE_Ctx l_tCtx;
+    int64_t  l_iFiltered;
+    e_eDSP_DOWNSAMPLE_RES l_eRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_iFiltered = 0;
+
+    /* Function */
+    (void)eDSP_DOWNSAMPLE_InitCtx(&l_tCtx, 1u);
+
+    /* A ratio of one keep every value */
+    for(uint32_t i = 0u; ( ( i < 10u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_eRes = eDSP_DOWNSAMPLE_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL + (int64_t) i, &l_iFiltered);
+
+        if( ( e_eDSP_DOWNSAMPLE_RES_OK != l_eRes ) || ( ( MIN_INT64VAL + (int64_t) i ) != l_iFiltered ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_Reference 1  -- FAIL \n");
+    }
+
+    /* The first value and then one every three are kept */
+    (void)eDSP_DOWNSAMPLE_InitCtx(&l_tCtx, 3u);
+
+    for(uint32_t i = 0u; ( ( i < 30u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_iFiltered = -1;
+        l_eRes = eDSP_DOWNSAMPLE_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL - (int64_t) i, &l_iFiltered);
+
+        if( 0u == ( i % 3u ) )
+        {
+            if( ( e_eDSP_DOWNSAMPLE_RES_OK != l_eRes ) || ( ( MAX_INT64VAL - (int64_t) i ) != l_iFiltered ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+        else if( ( e_eDSP_DOWNSAMPLE_RES_NEEDSMOREVALUE != l_eRes ) || ( -1 != l_iFiltered ) )
+        {
+            l_bTestOk = false;
+        }
+        else
+        {
+            /* Value discarded */
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_Reference 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_Reference 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_DOWNSAMPLETST_BlockVsSample(void)
+{
+    /* Local variable */
+    t_eDSP_DOWNSAMPLE_Ctx l_tCtx;
+    int64_t  l_aiValues[5u] = { 10, 11, 12, 13, 14 };
+    int64_t  l_aiFiltered[5u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Function */
+    if( ( true == eDSP_DOWNSAMPLETST_CheckBlock(1u, 0x0BADC0FFEE0DDF00u) ) &&
+        ( true == eDSP_DOWNSAMPLETST_CheckBlock(2u, 0x2468ACE013579BDFu) ) &&
+        ( true == eDSP_DOWNSAMPLETST_CheckBlock(7u, 0x0123456789ABCDEFu) ) &&
+        ( true == eDSP_DOWNSAMPLETST_CheckBlock(100u, 0x3C6EF372FE94F82Bu) ) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BlockVsSample 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BlockVsSample 1  -- FAIL \n");
+    }
+
+    /* A block without any kept value consume every value, the count continue in the next block */
+    (void)eDSP_DOWNSAMPLE_InitCtx(&l_tCtx, 8u);
+    (void)eDSP_DOWNSAMPLE_ProcessBlock(&l_tCtx, l_aiValues, 1u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed);
+    if( ( e_eDSP_DOWNSAMPLE_RES_NEEDSMOREVALUE ==
+          eDSP_DOWNSAMPLE_ProcessBlock(&l_tCtx, l_aiValues, 5u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( 0u == l_uNFiltered ) && ( 5u == l_uNProcessed ) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BlockVsSample 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BlockVsSample 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DOWNSAMPLE_RES_OK ==
+          eDSP_DOWNSAMPLE_ProcessBlock(&l_tCtx, l_aiValues, 5u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( 1u == l_uNFiltered ) && ( 5u == l_uNProcessed ) && ( 12 == l_aiFiltered[0u] ) )
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BlockVsSample 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DOWNSAMPLETST_BlockVsSample 3  -- FAIL \n");
+    }
+}
+
+static bool_t eDSP_DOWNSAMPLETST_CheckBlock(const uint32_t p_uDowSampleIndex, const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_DOWNSAMPLE_Ctx l_tCtxBlock;
+    t_eDSP_DOWNSAMPLE_Ctx l_tCtxSample;
+    int64_t  l_aiValues[64u];
+    int64_t  l_aiFiltered[64u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uNBlock;
+    uint32_t l_uNSample;
+    uint64_t l_uSeed;
+    e_eDSP_DOWNSAMPLE_RES l_eBlockRes;
+    e_eDSP_DOWNSAMPLE_RES l_eSampleRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+    l_iFiltered = 0;
+
+    /* Function */
+    (void)eDSP_DOWNSAMPLE_InitCtx(&l_tCtxBlock, p_uDowSampleIndex);
+    (void)eDSP_DOWNSAMPLE_InitCtx(&l_tCtxSample, p_uDowSampleIndex);
+
+    /* Blocks shorter and longer than the ratio, the kept values must be the same of the single value insertion even
+       when a group of values is split across two blocks */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uNBlock = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 64u );
+
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            l_aiValues[j] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+        }
+
+        l_eBlockRes = eDSP_DOWNSAMPLE_ProcessBlock(&l_tCtxBlock, l_aiValues, l_uNBlock, l_aiFiltered,
+                                                   &l_uNFiltered, &l_uNProcessed);
+
+        l_uNSample = 0u;
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            l_eSampleRes = eDSP_DOWNSAMPLE_InsertValueAndCalculate(&l_tCtxSample, l_aiValues[j], &l_iFiltered);
+
+            if( e_eDSP_DOWNSAMPLE_RES_OK == l_eSampleRes )
+            {
+                if( ( l_uNSample >= l_uNFiltered ) || ( l_aiFiltered[l_uNSample] != l_iFiltered ) )
+                {
+                    l_bTestOk = false;
+                }
+
+                l_uNSample++;
+            }
+        }
+
+        /* Nothing can fail, every value is consumed */
+        if( ( l_uNSample != l_uNFiltered ) || ( l_uNBlock != l_uNProcessed ) ||
+            ( ( 0u == l_uNFiltered ) && ( e_eDSP_DOWNSAMPLE_RES_NEEDSMOREVALUE != l_eBlockRes ) ) ||
+            ( ( 0u != l_uNFiltered ) && ( e_eDSP_DOWNSAMPLE_RES_OK != l_eBlockRes ) ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    return l_bTestOk;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
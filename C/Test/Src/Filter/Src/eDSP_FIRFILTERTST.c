@@ -0,0 +1,703 @@
+/**
+ * @file       eDSP_FIRFILTERTST.c
+ *
+ * @brief      FIR filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_FIRFILTERTST.h"
+#include "eDSP_FIRFILTER.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_FIRFILTERTST_BadPointer(void);
+static void eDSP_FIRFILTERTST_BadInit(void);
+static void eDSP_FIRFILTERTST_BadParamEntr(void);
+static void eDSP_FIRFILTERTST_CorruptedContext(void);
+static void eDSP_FIRFILTERTST_Reference(void);
+static void eDSP_FIRFILTERTST_Overflow(void);
+static void eDSP_FIRFILTERTST_Saturate(void);
+static void eDSP_FIRFILTERTST_BlockVsSample(void);
+static bool_t eDSP_FIRFILTERTST_CheckRef(const uint32_t p_uNCoeff, const uint32_t p_uInterp, const uint32_t p_uDecim,
+                                         const uint64_t p_uSeedInit);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_FIRFILTERTST_ExeTest(void)
+{
+	(void)printf("\n\nFIRFILTER TEST START \n\n");
+
+    eDSP_FIRFILTERTST_BadPointer();
+    eDSP_FIRFILTERTST_BadInit();
+    eDSP_FIRFILTERTST_BadParamEntr();
+    eDSP_FIRFILTERTST_CorruptedContext();
+    eDSP_FIRFILTERTST_Reference();
+    eDSP_FIRFILTERTST_Overflow();
+    eDSP_FIRFILTERTST_Saturate();
+    eDSP_FIRFILTERTST_BlockVsSample();
+
+    (void)printf("\n\nFIRFILTER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_FIRFILTERTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_FIRFILTER_Ctx l_tCtx;
+    int32_t  l_aiCoeff[4u] = { 1, 2, 3, 4 };
+    int64_t  l_aiHistory[4u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( ( e_eDSP_FIRFILTER_RES_BADPOINTER ==
+          eDSP_FIRFILTER_InitCtx(NULL, l_aiCoeff, 4u, 0u, l_aiHistory, 4u, 1u, 1u) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPOINTER ==
+          eDSP_FIRFILTER_InitCtx(&l_tCtx, NULL, 4u, 0u, l_aiHistory, 4u, 1u, 1u) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPOINTER ==
+          eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 4u, 0u, NULL, 4u, 1u, 1u) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FIRFILTER_RES_BADPOINTER == eDSP_FIRFILTER_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPOINTER == eDSP_FIRFILTER_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FIRFILTER_RES_BADPOINTER ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(NULL, 1, l_aiFiltered, 2u, &l_uNFiltered) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPOINTER ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, 1, NULL, 2u, &l_uNFiltered) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPOINTER ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, 1, l_aiFiltered, 2u, NULL) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FIRFILTER_RES_BADPOINTER ==
+          eDSP_FIRFILTER_ProcessBlock(NULL, l_aiValues, 2u, l_aiFiltered, 2u, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPOINTER ==
+          eDSP_FIRFILTER_ProcessBlock(&l_tCtx, NULL, 2u, l_aiFiltered, 2u, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPOINTER ==
+          eDSP_FIRFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, NULL, 2u, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPOINTER ==
+          eDSP_FIRFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, 2u, NULL, &l_uNProcessed) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPOINTER ==
+          eDSP_FIRFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, 2u, &l_uNFiltered, NULL) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FIRFILTER_RES_BADPOINTER == eDSP_FIRFILTER_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPOINTER == eDSP_FIRFILTER_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPOINTER == eDSP_FIRFILTER_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadPointer 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_FIRFILTERTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_FIRFILTER_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_FIRFILTER_RES_OK == eDSP_FIRFILTER_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FIRFILTER_RES_NOINITLIB ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, 1, l_aiFiltered, 2u, &l_uNFiltered) ) &&
+        ( e_eDSP_FIRFILTER_RES_NOINITLIB ==
+          eDSP_FIRFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, 2u, &l_uNFiltered, &l_uNProcessed) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FIRFILTER_RES_NOINITLIB == eDSP_FIRFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_FIRFILTER_RES_NOINITLIB == eDSP_FIRFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadInit 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_FIRFILTERTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_FIRFILTER_Ctx l_tCtx;
+    int32_t  l_aiCoeff[6u] = { 1, 1, 1, 1, 1, 1 };
+    int64_t  l_aiHistory[6u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[6u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Function */
+    if( ( e_eDSP_FIRFILTER_RES_BADPARAM ==
+          eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 0u, 0u, l_aiHistory, 0u, 1u, 1u) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPARAM ==
+          eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 32u, l_aiHistory, 6u, 1u, 1u) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPARAM ==
+          eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 0u, l_aiHistory, 5u, 1u, 1u) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* With L equal to 4 every phase has two coefficients */
+    if( ( e_eDSP_FIRFILTER_RES_BADPARAM ==
+          eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 0u, l_aiHistory, 6u, 4u, 1u) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPARAM ==
+          eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 0u, l_aiHistory, 6u, 0u, 1u) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPARAM ==
+          eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 0u, l_aiHistory, 6u, 1u, 0u) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPARAM ==
+          eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 0u, l_aiHistory, 1u, 65536u, 1u) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPARAM ==
+          eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 0u, l_aiHistory, 6u, 1u, 65536u) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eDSP_FIRFILTER_RES_OK == eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 0u, l_aiHistory, 2u, 3u, 1u) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    /* Every inserted value generate three filtered values */
+    if( ( e_eDSP_FIRFILTER_RES_BADPARAM ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, 1, l_aiFiltered, 2u, &l_uNFiltered) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPARAM ==
+          eDSP_FIRFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, 5u, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_FIRFILTER_RES_BADPARAM ==
+          eDSP_FIRFILTER_ProcessBlock(&l_tCtx, l_aiValues, 0u, l_aiFiltered, 6u, &l_uNFiltered, &l_uNProcessed) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    /* Nothing was inserted by the refused call */
+    if( ( e_eDSP_FIRFILTER_RES_OK ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, 7, l_aiFiltered, 3u, &l_uNFiltered) ) &&
+        ( 3u == l_uNFiltered ) && ( 7 == l_aiFiltered[0u] ) && ( 7 == l_aiFiltered[1u] ) && ( 7 == l_aiFiltered[2u] ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    if( e_eDSP_FIRFILTER_RES_BADPARAM == eDSP_FIRFILTER_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BadParamEntr 6  -- FAIL \n");
+    }
+}
+
+static void eDSP_FIRFILTERTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_FIRFILTER_Ctx l_tCtx;
+    int32_t  l_aiCoeff[6u] = { 1, 1, 1, 1, 1, 1 };
+    int64_t  l_aiHistory[6u];
+    int64_t  l_aiFiltered[6u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 0u, l_aiHistory, 6u, 1u, 1u);
+    l_tCtx.piCoeff = NULL;
+    if( e_eDSP_FIRFILTER_RES_CORRUPTCTX ==
+        eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, 1, l_aiFiltered, 6u, &l_uNFiltered) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 0u, l_aiHistory, 6u, 1u, 1u);
+    l_tCtx.uHistoryLen = 5u;
+    if( e_eDSP_FIRFILTER_RES_CORRUPTCTX == eDSP_FIRFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    (void)eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 0u, l_aiHistory, 3u, 2u, 3u);
+    l_tCtx.uNextOutPhase = 3u;
+    if( e_eDSP_FIRFILTER_RES_CORRUPTCTX == eDSP_FIRFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    (void)eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 6u, 0u, l_aiHistory, 6u, 1u, 1u);
+    l_tCtx.uCurDataLocation = 6u;
+    if( e_eDSP_FIRFILTER_RES_CORRUPTCTX ==
+        eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, 1, l_aiFiltered, 6u, &l_uNFiltered) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_CorruptedContext 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_FIRFILTERTST_Reference(void)
+{
+    /* Function */
+    if( true == eDSP_FIRFILTERTST_CheckRef(11u, 1u, 1u, 0x3C6EF372FE94F82Bu) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Reference 1  -- FAIL \n");
+    }
+
+    /* Interpolation, with a numbers of coefficients that is not a multiple of L */
+    if( ( true == eDSP_FIRFILTERTST_CheckRef(11u, 3u, 1u, 0xA54FF53A5F1D36F1u) ) &&
+        ( true == eDSP_FIRFILTERTST_CheckRef(12u, 4u, 1u, 0x510E527FADE682D1u) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Reference 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Reference 2  -- FAIL \n");
+    }
+
+    if( true == eDSP_FIRFILTERTST_CheckRef(9u, 1u, 4u, 0x9B05688C2B3E6C1Fu) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Reference 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Reference 3  -- FAIL \n");
+    }
+
+    /* Rational factors, both greater and lower than one */
+    if( ( true == eDSP_FIRFILTERTST_CheckRef(13u, 3u, 2u, 0x1F83D9ABFB41BD6Bu) ) &&
+        ( true == eDSP_FIRFILTERTST_CheckRef(10u, 2u, 5u, 0x5BE0CD19137E2179u) ) &&
+        ( true == eDSP_FIRFILTERTST_CheckRef(1u, 5u, 3u, 0xCBBB9D5DC1059ED8u) ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Reference 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Reference 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_FIRFILTERTST_Overflow(void)
+{
+    /* Local variable */
+    t_eDSP_FIRFILTER_Ctx l_tCtx;
+    int32_t  l_aiCoeff[2u] = { 2, 2 };
+    int64_t  l_aiHistory[2u];
+    int64_t  l_aiValues[4u] = { 1, 2, MAX_INT64VAL, 3 };
+    int64_t  l_aiFiltered[4u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Init variable */
+    l_uNFiltered = 1u;
+
+    /* Function */
+    (void)eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 2u, 1u, l_aiHistory, 2u, 1u, 1u);
+    if( ( e_eDSP_FIRFILTER_RES_OVERFLOW ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, l_aiFiltered, 2u, &l_uNFiltered) ) &&
+        ( 0u == l_uNFiltered ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Overflow 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Overflow 1  -- FAIL \n");
+    }
+
+    /* The value is inserted anyway, it overflow until it leave the history */
+    if( ( e_eDSP_FIRFILTER_RES_OVERFLOW ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, 0, l_aiFiltered, 2u, &l_uNFiltered) ) &&
+        ( e_eDSP_FIRFILTER_RES_OK ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, -3, l_aiFiltered, 2u, &l_uNFiltered) ) &&
+        ( 1u == l_uNFiltered ) && ( -3 == l_aiFiltered[0u] ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Overflow 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Overflow 2  -- FAIL \n");
+    }
+
+    /* The product fit, but the accumulation doesn't */
+    (void)eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL / 2, l_aiFiltered, 2u, &l_uNFiltered);
+    if( e_eDSP_FIRFILTER_RES_OVERFLOW ==
+        eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, -1, l_aiFiltered, 2u, &l_uNFiltered) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Overflow 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Overflow 3  -- FAIL \n");
+    }
+
+    /* The block stop after the third value, the last one is not taken */
+    (void)eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 2u, 1u, l_aiHistory, 2u, 1u, 1u);
+    if( ( e_eDSP_FIRFILTER_RES_OVERFLOW ==
+          eDSP_FIRFILTER_ProcessBlock(&l_tCtx, l_aiValues, 4u, l_aiFiltered, 4u, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( 2u == l_uNFiltered ) && ( 3u == l_uNProcessed ) && ( 1 == l_aiFiltered[0u] ) && ( 3 == l_aiFiltered[1u] ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Overflow 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Overflow 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_FIRFILTERTST_Saturate(void)
+{
+    /* Local variable */
+    t_eDSP_FIRFILTER_Ctx l_tCtx;
+    int32_t  l_aiCoeff[2u] = { 2, 2 };
+    int64_t  l_aiHistory[2u];
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_uNFiltered = 0u;
+    l_uSatCnt = 0u;
+
+    /* Function */
+    (void)eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, 2u, 1u, l_aiHistory, 2u, 1u, 1u);
+    if( e_eDSP_FIRFILTER_RES_OK == eDSP_FIRFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Saturate 1  -- FAIL \n");
+    }
+
+    /* The product is clamped to MAX_INT64VAL, and then the Q format is removed */
+    if( ( e_eDSP_FIRFILTER_RES_OK ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, l_aiFiltered, 2u, &l_uNFiltered) ) &&
+        ( 1u == l_uNFiltered ) && ( ( MAX_INT64VAL / 2 ) == l_aiFiltered[0u] ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Saturate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Saturate 2  -- FAIL \n");
+    }
+
+    /* Two products and the accumulation are clamped */
+    if( ( e_eDSP_FIRFILTER_RES_OK ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, l_aiFiltered, 2u, &l_uNFiltered) ) &&
+        ( ( MAX_INT64VAL / 2 ) == l_aiFiltered[0u] ) &&
+        ( e_eDSP_FIRFILTER_RES_OK == eDSP_FIRFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 4u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Saturate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Saturate 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FIRFILTER_RES_OK ==
+          eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, l_aiFiltered, 2u, &l_uNFiltered) ) &&
+        ( 0 == l_aiFiltered[0u] ) &&
+        ( e_eDSP_FIRFILTER_RES_OK == eDSP_FIRFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) ) &&
+        ( e_eDSP_FIRFILTER_RES_OK == eDSP_FIRFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_FIRFILTERTST_Saturate 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_Saturate 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_FIRFILTERTST_BlockVsSample(void)
+{
+    /* Local variable */
+    t_eDSP_FIRFILTER_Ctx l_tCtxBlock;
+    t_eDSP_FIRFILTER_Ctx l_tCtxSample;
+    int32_t  l_aiCoeff[8u] = { 3000, -12000, 40000, 65536, 40000, -12000, 3000, 7 };
+    int64_t  l_aiHistoryBlock[3u];
+    int64_t  l_aiHistorySample[3u];
+    int64_t  l_aiValues[64u];
+    int64_t  l_aiFiltered[100u];
+    int64_t  l_aiSampleFiltered[2u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uNCurFiltered;
+    uint32_t l_uNBlock;
+    uint32_t l_uNSample;
+    uint32_t l_uNSampleIn;
+    uint64_t l_uSeed;
+    e_eDSP_FIRFILTER_RES l_eBlockRes;
+    e_eDSP_FIRFILTER_RES l_eSampleRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0x428A2F98D728AE22u;
+
+    /* Function */
+    (void)eDSP_FIRFILTER_InitCtx(&l_tCtxBlock, l_aiCoeff, 8u, 16u, l_aiHistoryBlock, 3u, 3u, 2u);
+    (void)eDSP_FIRFILTER_InitCtx(&l_tCtxSample, l_aiCoeff, 8u, 16u, l_aiHistorySample, 3u, 3u, 2u);
+
+    /* Some block has full range values, the block stop after the value that overflow */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uNBlock = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 64u );
+
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            if( 0u == ( i % 8u ) )
+            {
+                l_aiValues[j] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+            }
+            else
+            {
+                l_aiValues[j] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 20u;
+            }
+        }
+
+        l_eBlockRes = eDSP_FIRFILTER_ProcessBlock(&l_tCtxBlock, l_aiValues, l_uNBlock, l_aiFiltered, 100u,
+                                                  &l_uNFiltered, &l_uNProcessed);
+
+        l_uNSample = 0u;
+        l_uNSampleIn = 0u;
+        l_eSampleRes = e_eDSP_FIRFILTER_RES_NEEDSMOREVALUE;
+        for(uint32_t j = 0u; ( ( j < l_uNBlock ) && ( e_eDSP_FIRFILTER_RES_OVERFLOW != l_eSampleRes ) ); j++)
+        {
+            l_eSampleRes = eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtxSample, l_aiValues[j], l_aiSampleFiltered,
+                                                                  2u, &l_uNCurFiltered);
+
+            l_uNSampleIn++;
+
+            for(uint32_t k = 0u; k < l_uNCurFiltered; k++)
+            {
+                if( ( l_uNSample >= l_uNFiltered ) || ( l_aiFiltered[l_uNSample] != l_aiSampleFiltered[k] ) )
+                {
+                    l_bTestOk = false;
+                }
+
+                l_uNSample++;
+            }
+        }
+
+        /* With L and M different the numbers of filtered values doesn't tell how many values were taken */
+        if( ( l_uNSample != l_uNFiltered ) || ( l_uNSampleIn != l_uNProcessed ) ||
+            ( ( e_eDSP_FIRFILTER_RES_OVERFLOW == l_eBlockRes ) != ( e_eDSP_FIRFILTER_RES_OVERFLOW == l_eSampleRes ) ) )
+        {
+            l_bTestOk = false;
+        }
+
+        /* Start again from the same state after an overflow */
+        if( e_eDSP_FIRFILTER_RES_OVERFLOW == l_eSampleRes )
+        {
+            (void)eDSP_FIRFILTER_InitCtx(&l_tCtxBlock, l_aiCoeff, 8u, 16u, l_aiHistoryBlock, 3u, 3u, 2u);
+            (void)eDSP_FIRFILTER_InitCtx(&l_tCtxSample, l_aiCoeff, 8u, 16u, l_aiHistorySample, 3u, 3u, 2u);
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_FIRFILTERTST_BlockVsSample 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FIRFILTERTST_BlockVsSample 1  -- FAIL \n");
+    }
+}
+
+static bool_t eDSP_FIRFILTERTST_CheckRef(const uint32_t p_uNCoeff, const uint32_t p_uInterp, const uint32_t p_uDecim,
+                                         const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_FIRFILTER_Ctx l_tCtx;
+    int32_t  l_aiCoeff[16u];
+    int64_t  l_aiHistory[16u];
+    int64_t  l_aiValues[100u];
+    int64_t  l_aiFiltered[8u];
+    int64_t  l_iAcc;
+    int64_t  l_iExpected;
+    uint64_t l_uSeed;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNOut;
+    uint32_t l_uHighIdx;
+    e_eDSP_FIRFILTER_RES l_eRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+    l_uNOut = 0u;
+
+    /* Function */
+    for(uint32_t i = 0u; i < p_uNCoeff; i++)
+    {
+        l_aiCoeff[i] = ( (int32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 65536u ) ) - 32768;
+    }
+
+    for(uint32_t i = 0u; i < 100u; i++)
+    {
+        l_aiValues[i] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 34u;
+    }
+
+    (void)eDSP_FIRFILTER_InitCtx(&l_tCtx, l_aiCoeff, p_uNCoeff, 15u, l_aiHistory,
+                                 ( ( p_uNCoeff + p_uInterp ) - 1u ) / p_uInterp, p_uInterp, p_uDecim);
+
+    for(uint32_t i = 0u; ( ( i < 100u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_eRes = eDSP_FIRFILTER_InsertValueAndCalculate(&l_tCtx, l_aiValues[i], l_aiFiltered, 8u, &l_uNFiltered);
+
+        if( ( e_eDSP_FIRFILTER_RES_OK != l_eRes ) && ( e_eDSP_FIRFILTER_RES_NEEDSMOREVALUE != l_eRes ) )
+        {
+            l_bTestOk = false;
+        }
+
+        /* Outputs are the samples 0, M, 2M ... of the zero stuffed input convolved with the coefficients */
+        for(uint32_t k = 0u; ( ( k < l_uNFiltered ) && ( true == l_bTestOk ) ); k++)
+        {
+            l_uHighIdx = l_uNOut * p_uDecim;
+
+            if( ( l_uHighIdx / p_uInterp ) != i )
+            {
+                l_bTestOk = false;
+            }
+            else
+            {
+                l_iAcc = 0;
+
+                for(uint32_t j = 0u; ( ( j < p_uNCoeff ) && ( j <= l_uHighIdx ) ); j++)
+                {
+                    if( 0u == ( ( l_uHighIdx - j ) % p_uInterp ) )
+                    {
+                        l_iAcc += ( (int64_t) l_aiCoeff[j] ) * l_aiValues[( l_uHighIdx - j ) / p_uInterp];
+                    }
+                }
+
+                l_iExpected = l_iAcc / 32768;
+
+                if( l_iExpected != l_aiFiltered[k] )
+                {
+                    l_bTestOk = false;
+                }
+            }
+
+            l_uNOut++;
+        }
+    }
+
+    /* Every output of the 100 * L samples at the high rate was returned */
+    if( l_uNOut != ( ( ( 100u * p_uInterp ) + p_uDecim - 1u ) / p_uDecim ) )
+    {
+        l_bTestOk = false;
+    }
+
+    return l_bTestOk;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
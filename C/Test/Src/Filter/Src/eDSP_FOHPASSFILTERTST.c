@@ -0,0 +1,927 @@
+/**
+ * @file       eDSP_FOHPASSFILTERTST.c
+ *
+ * @brief      First Order High pass filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_FOHPASSFILTERTST.h"
+#include "eDSP_FOHPASSFILTER.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_FOHPASSFILTERTST_BadPointer(void);
+static void eDSP_FOHPASSFILTERTST_BadInit(void);
+static void eDSP_FOHPASSFILTERTST_BadParamEntr(void);
+static void eDSP_FOHPASSFILTERTST_CorruptedContext(void);
+static void eDSP_FOHPASSFILTERTST_Overflow(void);
+static void eDSP_FOHPASSFILTERTST_Saturate(void);
+static void eDSP_FOHPASSFILTERTST_BlockVsSample(void);
+static void eDSP_FOHPASSFILTERTST_DtVsFixed(void);
+static void eDSP_FOHPASSFILTERTST_DtQuant(void);
+static void eDSP_FOHPASSFILTERTST_CacheStats(void);
+static bool_t eDSP_FOHPASSFILTERTST_CheckBlock(const e_eDSP_TYPE_OVFMODE p_eOvfMode, const uint64_t p_uSeedInit);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_FOHPASSFILTERTST_ExeTest(void)
+{
+	(void)printf("\n\nFOHPASSFILTER TEST START \n\n");
+
+    eDSP_FOHPASSFILTERTST_BadPointer();
+    eDSP_FOHPASSFILTERTST_BadInit();
+    eDSP_FOHPASSFILTERTST_BadParamEntr();
+    eDSP_FOHPASSFILTERTST_CorruptedContext();
+    eDSP_FOHPASSFILTERTST_Overflow();
+    eDSP_FOHPASSFILTERTST_Saturate();
+    eDSP_FOHPASSFILTERTST_BlockVsSample();
+    eDSP_FOHPASSFILTERTST_DtVsFixed();
+    eDSP_FOHPASSFILTERTST_DtQuant();
+    eDSP_FOHPASSFILTERTST_CacheStats();
+
+    (void)printf("\n\nFOHPASSFILTER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_FOHPASSFILTERTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtx;
+    t_eDSP_FOHPASSFILTER_CoeffCache l_atCache[4u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uHit;
+    uint32_t l_uMiss;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_InitCtx(NULL, 10000u, 10000u) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_InsertValueAndCalculate(NULL, 1, &l_iFiltered) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, 1, NULL) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER ==
+          eDSP_FOHPASSFILTER_ProcessBlock(NULL, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER ==
+          eDSP_FOHPASSFILTER_ProcessBlock(&l_tCtx, NULL, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER ==
+          eDSP_FOHPASSFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, NULL, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER ==
+          eDSP_FOHPASSFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, NULL, &l_uNProcessed) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER ==
+          eDSP_FOHPASSFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, NULL) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_SetCoeffCache(NULL, l_atCache, 4u, 0u) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtx, NULL, 4u, 0u) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER ==
+          eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(NULL, 1, 1000u, &l_iFiltered) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER ==
+          eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtx, 1, 1000u, NULL) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_GetCacheStats(NULL, &l_uHit, &l_uMiss) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtx, NULL, &l_uMiss) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPOINTER == eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtx, &l_uHit, NULL) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadPointer 8  -- FAIL \n");
+    }
+}
+
+static void eDSP_FOHPASSFILTERTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtx;
+    t_eDSP_FOHPASSFILTER_CoeffCache l_atCache[4u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uHit;
+    uint32_t l_uMiss;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_NOINITLIB ==
+          eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_NOINITLIB ==
+          eDSP_FOHPASSFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_NOINITLIB == eDSP_FOHPASSFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_NOINITLIB == eDSP_FOHPASSFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_NOINITLIB == eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtx, l_atCache, 4u, 0u) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_NOINITLIB == eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtx, &l_uHit, &l_uMiss) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_NOINITLIB ==
+          eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtx, 1, 1000u, &l_iFiltered) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadInit 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_FOHPASSFILTERTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtx;
+    t_eDSP_FOHPASSFILTER_CoeffCache l_atCache[4u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Function */
+    if( ( e_eDSP_FOHPASSFILTER_RES_BADPARAM == eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 0u, 10000u) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPARAM == eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 0u) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 10000u) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eDSP_FOHPASSFILTER_RES_BADPARAM ==
+        eDSP_FOHPASSFILTER_ProcessBlock(&l_tCtx, l_aiValues, 0u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eDSP_FOHPASSFILTER_RES_BADPARAM == eDSP_FOHPASSFILTER_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    /* The len must be a power of two */
+    if( ( e_eDSP_FOHPASSFILTER_RES_BADPARAM == eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtx, l_atCache, 0u, 0u) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPARAM == eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtx, l_atCache, 3u, 0u) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_BADPARAM == eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtx, l_atCache, 4u, 32u) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    if( e_eDSP_FOHPASSFILTER_RES_BADPARAM ==
+        eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtx, 1, 0u, &l_iFiltered) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BadParamEntr 6  -- FAIL \n");
+    }
+}
+
+static void eDSP_FOHPASSFILTERTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtx;
+    t_eDSP_FOHPASSFILTER_CoeffCache l_atCache[4u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uHit;
+    uint32_t l_uMiss;
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 10000u);
+    l_tCtx.uBetaQ31 = 0x80000001u;
+    if( e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX == eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 10000u);
+    l_tCtx.uCutFreqMilHz = 0u;
+    if( e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX ==
+        eDSP_FOHPASSFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 10000u);
+    l_tCtx.eOvfMode = (e_eDSP_TYPE_OVFMODE) 5;
+    if( ( e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX == eDSP_FOHPASSFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX == eDSP_FOHPASSFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    /* A cache without buffer */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 10000u);
+    l_tCtx.uCacheLen = 4u;
+    if( e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX ==
+        eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtx, 1, 1000u, &l_iFiltered) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 4  -- FAIL \n");
+    }
+
+    /* The index of the cache is masked, a len that is not a power of two would read out of the buffer */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 10000u);
+    (void)eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtx, l_atCache, 4u, 0u);
+    l_tCtx.uCacheLen = 3u;
+    if( e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX == eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtx, &l_uHit, &l_uMiss) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 5  -- FAIL \n");
+    }
+
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 10000u);
+    (void)eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtx, l_atCache, 4u, 0u);
+    l_tCtx.uDtQuantShift = 32u;
+    if( e_eDSP_FOHPASSFILTER_RES_CORRUPTCTX == eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtx, l_atCache, 4u, 0u) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CorruptedContext 6  -- FAIL \n");
+    }
+}
+
+static void eDSP_FOHPASSFILTERTST_Overflow(void)
+{
+    /* Local variable */
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtx;
+    t_eDSP_FOHPASSFILTER_Ctx l_tRefCtx;
+    int64_t  l_aiValues[4u] = { MAX_INT64VAL, 0, MIN_INT64VAL, -1 };
+    int64_t  l_aiFiltered[4u];
+    int64_t  l_iFiltered;
+    int64_t  l_iRefFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Init variable */
+    l_iFiltered = 0;
+    l_iRefFiltered = 0;
+
+    /* Function */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 10000u);
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tRefCtx, 10000u, 10000u);
+    (void)eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered);
+    (void)eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tRefCtx, MIN_INT64VAL, &l_iRefFiltered);
+    if( e_eDSP_FOHPASSFILTER_RES_OVERFLOW ==
+        eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Overflow 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Overflow 1  -- FAIL \n");
+    }
+
+    /* The discarded value doesn't change the next ones */
+    (void)eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tRefCtx, -1, &l_iRefFiltered);
+    if( ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, -1, &l_iFiltered) ) &&
+        ( l_iRefFiltered == l_iFiltered ) && ( l_iFiltered > 0 ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Overflow 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Overflow 2  -- FAIL \n");
+    }
+
+    /* The difference of the inputs fit, but added to a large negative output it doesn't */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 10000u);
+    (void)eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    if( ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, 0, &l_iFiltered) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_OVERFLOW ==
+          eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Overflow 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Overflow 3  -- FAIL \n");
+    }
+
+    /* The value that overflow is counted as processed, but not as filtered */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 10000u);
+    if( ( e_eDSP_FOHPASSFILTER_RES_OVERFLOW ==
+          eDSP_FOHPASSFILTER_ProcessBlock(&l_tCtx, l_aiValues, 4u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( 1u == l_uNFiltered ) && ( 3u == l_uNProcessed ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Overflow 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Overflow 4  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_OVERFLOW ==
+          eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtx, MIN_INT64VAL, 10000u, &l_iFiltered) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_OK ==
+          eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtx, -1, 10000u, &l_iFiltered) ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Overflow 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Overflow 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_FOHPASSFILTERTST_Saturate(void)
+{
+    /* Local variable */
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtx;
+    int64_t  l_iFiltered;
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_iFiltered = 0;
+    l_uSatCnt = 0u;
+
+    /* Function */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 10000u);
+    if( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Saturate 1  -- FAIL \n");
+    }
+
+    /* Only the sum of the output and of the difference is clamped, beta is less than one and so the output is
+       greater than the min value */
+    (void)eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    (void)eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, 0, &l_iFiltered);
+    if( ( e_eDSP_FOHPASSFILTER_RES_OK ==
+          eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered) ) &&
+        ( l_iFiltered > MIN_INT64VAL ) && ( l_iFiltered < 0 ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Saturate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Saturate 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 1u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Saturate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Saturate 3  -- FAIL \n");
+    }
+
+    /* Setting the mode restart the count */
+    (void)eDSP_FOHPASSFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE);
+    if( ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Saturate 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_Saturate 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_FOHPASSFILTERTST_BlockVsSample(void)
+{
+    /* Function */
+    if( true == eDSP_FOHPASSFILTERTST_CheckBlock(e_eDSP_TYPE_OVFMODE_ERROR, 0x0BADC0FFEE0DDF00u) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BlockVsSample 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BlockVsSample 1  -- FAIL \n");
+    }
+
+    if( true == eDSP_FOHPASSFILTERTST_CheckBlock(e_eDSP_TYPE_OVFMODE_SATURATE, 0x2468ACE013579BDFu) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BlockVsSample 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_BlockVsSample 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_FOHPASSFILTERTST_DtVsFixed(void)
+{
+    /* Local variable */
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtxDt;
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtxFixed;
+    int64_t  l_iValue;
+    int64_t  l_iFiltered;
+    int64_t  l_iRefFiltered;
+    uint64_t l_uSeed;
+    uint32_t l_uHit;
+    uint32_t l_uMiss;
+    e_eDSP_FOHPASSFILTER_RES l_eRes;
+    e_eDSP_FOHPASSFILTER_RES l_eRefRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0x3C6EF372FE94F82Bu;
+    l_iFiltered = 0;
+    l_iRefFiltered = 0;
+
+    /* Function */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtxDt, 10000u, 1000u);
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtxFixed, 10000u, 1000u);
+
+    /* Without cache the coefficient of the sample period is calculated again for every value */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_iValue = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 16u;
+        l_eRes = eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtxDt, l_iValue, 1000u, &l_iFiltered);
+        l_eRefRes = eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtxFixed, l_iValue, &l_iRefFiltered);
+
+        if( ( l_eRefRes != l_eRes ) || ( l_iRefFiltered != l_iFiltered ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( ( true == l_bTestOk ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtxDt, &l_uHit, &l_uMiss) ) &&
+        ( 0u == l_uHit ) && ( 300u == l_uMiss ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_DtVsFixed 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_DtVsFixed 1  -- FAIL \n");
+    }
+
+    /* A time that is not the sample period of the init must behave like a filter initialized with that period */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtxDt, 10000u, 1000u);
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtxFixed, 10000u, 3000u);
+
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_iValue = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 16u;
+        l_eRes = eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtxDt, l_iValue, 3000u, &l_iFiltered);
+        l_eRefRes = eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtxFixed, l_iValue, &l_iRefFiltered);
+
+        if( ( l_eRefRes != l_eRes ) || ( l_iRefFiltered != l_iFiltered ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_DtVsFixed 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_DtVsFixed 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_FOHPASSFILTERTST_DtQuant(void)
+{
+    /* Local variable */
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtxDt;
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtxFixed;
+    t_eDSP_FOHPASSFILTER_CoeffCache l_atCache[8u];
+    int64_t  l_iValue;
+    int64_t  l_iFiltered;
+    int64_t  l_iRefFiltered;
+    uint64_t l_uSeed;
+    uint32_t l_uDt;
+    uint32_t l_uHit;
+    uint32_t l_uMiss;
+    e_eDSP_FOHPASSFILTER_RES l_eRes;
+    e_eDSP_FOHPASSFILTER_RES l_eRefRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0xA54FF53A5F1D36F1u;
+    l_iFiltered = 0;
+    l_iRefFiltered = 0;
+
+    /* Function */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtxDt, 10000u, 1000u);
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtxFixed, 10000u, 1600u);
+    (void)eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtxDt, l_atCache, 8u, 4u);
+
+    /* With steps of 16us every time in [1592, 1607] is rounded to 1600us, and so to the same coefficient */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_iValue = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 16u;
+        l_uDt = 1592u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 16u );
+        l_eRes = eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtxDt, l_iValue, l_uDt, &l_iFiltered);
+        l_eRefRes = eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtxFixed, l_iValue, &l_iRefFiltered);
+
+        if( ( l_eRefRes != l_eRes ) || ( l_iRefFiltered != l_iFiltered ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_DtQuant 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_DtQuant 1  -- FAIL \n");
+    }
+
+    /* Only the first value calculate the coefficient */
+    if( ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtxDt, &l_uHit, &l_uMiss) ) &&
+        ( 299u == l_uHit ) && ( 1u == l_uMiss ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_DtQuant 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_DtQuant 2  -- FAIL \n");
+    }
+
+    /* A time shorter than half step is rounded to one step and not to zero */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtxDt, 10000u, 1000u);
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtxFixed, 10000u, 16u);
+    (void)eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtxDt, l_atCache, 8u, 4u);
+
+    for(uint32_t i = 0u; ( ( i < 100u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_iValue = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 16u;
+        l_eRes = eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtxDt, l_iValue, 1u, &l_iFiltered);
+        l_eRefRes = eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtxFixed, l_iValue, &l_iRefFiltered);
+
+        if( ( l_eRefRes != l_eRes ) || ( l_iRefFiltered != l_iFiltered ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_DtQuant 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_DtQuant 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_FOHPASSFILTERTST_CacheStats(void)
+{
+    /* Local variable */
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtx;
+    t_eDSP_FOHPASSFILTER_Ctx l_tRefCtx;
+    t_eDSP_FOHPASSFILTER_CoeffCache l_atCache[4u];
+    uint32_t l_auDt[6u] = { 1001u, 1001u, 1002u, 1001u, 1005u, 1001u };
+    int64_t  l_iFiltered;
+    int64_t  l_iRefFiltered;
+    uint32_t l_uHit;
+    uint32_t l_uMiss;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_iFiltered = 0;
+    l_iRefFiltered = 0;
+
+    /* Function */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtx, 10000u, 1000u);
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tRefCtx, 10000u, 1000u);
+    if( ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtx, l_atCache, 4u, 0u) ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtx, &l_uHit, &l_uMiss) ) &&
+        ( 0u == l_uHit ) && ( 0u == l_uMiss ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CacheStats 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CacheStats 1  -- FAIL \n");
+    }
+
+    /* 1001, 1002 and 1005 use the entry 1, 2 and 1 of the cache, 1005 evict 1001. A cached coefficient must give
+       the same result of the one calculated by a filter without cache */
+    for(uint32_t i = 0u; i < 6u; i++)
+    {
+        (void)eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtx, 1000 * ( (int64_t) i ), l_auDt[i], &l_iFiltered);
+        (void)eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tRefCtx, 1000 * ( (int64_t) i ), l_auDt[i],
+                                                           &l_iRefFiltered);
+
+        if( l_iRefFiltered != l_iFiltered )
+        {
+            l_bTestOk = false;
+        }
+
+        if( 3u == i )
+        {
+            (void)eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtx, &l_uHit, &l_uMiss);
+
+            if( ( 2u != l_uHit ) || ( 2u != l_uMiss ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+
+    if( ( true == l_bTestOk ) &&
+        ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtx, &l_uHit, &l_uMiss) ) &&
+        ( 2u == l_uHit ) && ( 4u == l_uMiss ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CacheStats 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CacheStats 2  -- FAIL \n");
+    }
+
+    /* The fixed period doesn't use the cache */
+    (void)eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtx, 7000, &l_iFiltered);
+    if( ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtx, &l_uHit, &l_uMiss) ) &&
+        ( 2u == l_uHit ) && ( 4u == l_uMiss ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CacheStats 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CacheStats 3  -- FAIL \n");
+    }
+
+    /* Setting the cache again clear the entries and the counters */
+    (void)eDSP_FOHPASSFILTER_SetCoeffCache(&l_tCtx, l_atCache, 4u, 0u);
+    (void)eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtx, 8000, 1002u, &l_iFiltered);
+    if( ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtx, &l_uHit, &l_uMiss) ) &&
+        ( 0u == l_uHit ) && ( 1u == l_uMiss ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CacheStats 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CacheStats 4  -- FAIL \n");
+    }
+
+    /* The counters stop at the max value */
+    l_tCtx.uCacheHit = MAX_UINT32VAL;
+    (void)eDSP_FOHPASSFILTER_InsertValueDtAndCalculate(&l_tCtx, 9000, 1002u, &l_iFiltered);
+    if( ( e_eDSP_FOHPASSFILTER_RES_OK == eDSP_FOHPASSFILTER_GetCacheStats(&l_tCtx, &l_uHit, &l_uMiss) ) &&
+        ( MAX_UINT32VAL == l_uHit ) && ( 1u == l_uMiss ) )
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CacheStats 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_FOHPASSFILTERTST_CacheStats 5  -- FAIL \n");
+    }
+}
+
+static bool_t eDSP_FOHPASSFILTERTST_CheckBlock(const e_eDSP_TYPE_OVFMODE p_eOvfMode, const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtxBlock;
+    t_eDSP_FOHPASSFILTER_Ctx l_tCtxSample;
+    int64_t  l_aiValues[64u];
+    int64_t  l_aiFiltered[64u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uNBlock;
+    uint32_t l_uNSample;
+    uint32_t l_uNSampleIn;
+    uint32_t l_uSatCnt;
+    uint32_t l_uRefSatCnt;
+    uint64_t l_uSeed;
+    e_eDSP_FOHPASSFILTER_RES l_eBlockRes;
+    e_eDSP_FOHPASSFILTER_RES l_eSampleRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+    l_iFiltered = 0;
+    l_uSatCnt = 0u;
+    l_uRefSatCnt = 0u;
+
+    /* Function */
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtxBlock, 10000u, 10000u);
+    (void)eDSP_FOHPASSFILTER_InitCtx(&l_tCtxSample, 10000u, 10000u);
+    (void)eDSP_FOHPASSFILTER_SetOvfMode(&l_tCtxBlock, p_eOvfMode);
+    (void)eDSP_FOHPASSFILTER_SetOvfMode(&l_tCtxSample, p_eOvfMode);
+
+    /* Small values and extreme values that overflow or saturate must give the same result of the single value
+       insertion */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uNBlock = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 64u );
+
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            if( 0u == ( i % 4u ) )
+            {
+                l_aiValues[j] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+            }
+            else
+            {
+                l_aiValues[j] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 16u;
+            }
+        }
+
+        l_eBlockRes = eDSP_FOHPASSFILTER_ProcessBlock(&l_tCtxBlock, l_aiValues, l_uNBlock, l_aiFiltered,
+                                                      &l_uNFiltered, &l_uNProcessed);
+
+        /* Processing stop at the first error, feed the same values one by one */
+        l_uNSample = 0u;
+        l_uNSampleIn = 0u;
+        l_eSampleRes = e_eDSP_FOHPASSFILTER_RES_NEEDSMOREVALUE;
+        for(uint32_t j = 0u; ( ( j < l_uNBlock ) && ( e_eDSP_FOHPASSFILTER_RES_OVERFLOW != l_eSampleRes ) ); j++)
+        {
+            l_eSampleRes = eDSP_FOHPASSFILTER_InsertValueAndCalculate(&l_tCtxSample, l_aiValues[j], &l_iFiltered);
+
+            l_uNSampleIn++;
+
+            if( e_eDSP_FOHPASSFILTER_RES_OK == l_eSampleRes )
+            {
+                if( ( l_uNSample >= l_uNFiltered ) || ( l_aiFiltered[l_uNSample] != l_iFiltered ) )
+                {
+                    l_bTestOk = false;
+                }
+
+                l_uNSample++;
+            }
+        }
+
+        if( ( l_uNSample != l_uNFiltered ) || ( l_uNSampleIn != l_uNProcessed ) ||
+            ( ( e_eDSP_FOHPASSFILTER_RES_OVERFLOW == l_eBlockRes ) &&
+              ( e_eDSP_FOHPASSFILTER_RES_OVERFLOW != l_eSampleRes ) ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    /* The same numbers of clamped operations */
+    (void)eDSP_FOHPASSFILTER_GetSatCnt(&l_tCtxBlock, &l_uSatCnt);
+    (void)eDSP_FOHPASSFILTER_GetSatCnt(&l_tCtxSample, &l_uRefSatCnt);
+
+    if( ( l_uSatCnt != l_uRefSatCnt ) || ( ( e_eDSP_TYPE_OVFMODE_SATURATE == p_eOvfMode ) && ( 0u == l_uSatCnt ) ) )
+    {
+        l_bTestOk = false;
+    }
+
+    return l_bTestOk;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
@@ -0,0 +1,504 @@
+/**
+ * @file       eDSP_MCFOLPASSFILTERTST.c
+ *
+ * @brief      Multi channel first order low pass filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_MCFOLPASSFILTERTST.h"
+#include "eDSP_MCFOLPASSFILTER.h"
+#include "eDSP_FOLPASSFILTER.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_MCFOLPASSFILTERTST_BadPointer(void);
+static void eDSP_MCFOLPASSFILTERTST_BadInit(void);
+static void eDSP_MCFOLPASSFILTERTST_BadParamEntr(void);
+static void eDSP_MCFOLPASSFILTERTST_CorruptedContext(void);
+static void eDSP_MCFOLPASSFILTERTST_SingleChannel(void);
+static void eDSP_MCFOLPASSFILTERTST_Overflow(void);
+static void eDSP_MCFOLPASSFILTERTST_Saturate(void);
+static bool_t eDSP_MCFOLPASSFILTERTST_CheckRef(const uint32_t p_uNChannels, const e_eDSP_TYPE_OVFMODE p_eOvfMode,
+                                               const uint64_t p_uSeedInit);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_MCFOLPASSFILTERTST_ExeTest(void)
+{
+	(void)printf("\n\nMCFOLPASSFILTER TEST START \n\n");
+
+    eDSP_MCFOLPASSFILTERTST_BadPointer();
+    eDSP_MCFOLPASSFILTERTST_BadInit();
+    eDSP_MCFOLPASSFILTERTST_BadParamEntr();
+    eDSP_MCFOLPASSFILTERTST_CorruptedContext();
+    eDSP_MCFOLPASSFILTERTST_SingleChannel();
+    eDSP_MCFOLPASSFILTERTST_Overflow();
+    eDSP_MCFOLPASSFILTERTST_Saturate();
+
+    (void)printf("\n\nMCFOLPASSFILTER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_MCFOLPASSFILTERTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_MCFOLPASSFILTER_Ctx l_tCtx;
+    int64_t  l_aiPrevOut[2u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( ( e_eDSP_MCFOLPASSFILTER_RES_BADPOINTER ==
+          eDSP_MCFOLPASSFILTER_InitCtx(NULL, l_aiPrevOut, 2u, 10000u, 10000u) ) &&
+        ( e_eDSP_MCFOLPASSFILTER_RES_BADPOINTER ==
+          eDSP_MCFOLPASSFILTER_InitCtx(&l_tCtx, NULL, 2u, 10000u, 10000u) ) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MCFOLPASSFILTER_RES_BADPOINTER == eDSP_MCFOLPASSFILTER_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_MCFOLPASSFILTER_RES_BADPOINTER == eDSP_MCFOLPASSFILTER_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MCFOLPASSFILTER_RES_BADPOINTER ==
+          eDSP_MCFOLPASSFILTER_InsertValuesAndCalculate(NULL, l_aiValues, l_aiFiltered) ) &&
+        ( e_eDSP_MCFOLPASSFILTER_RES_BADPOINTER ==
+          eDSP_MCFOLPASSFILTER_InsertValuesAndCalculate(&l_tCtx, NULL, l_aiFiltered) ) &&
+        ( e_eDSP_MCFOLPASSFILTER_RES_BADPOINTER ==
+          eDSP_MCFOLPASSFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, NULL) ) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MCFOLPASSFILTER_RES_BADPOINTER ==
+          eDSP_MCFOLPASSFILTER_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_MCFOLPASSFILTER_RES_BADPOINTER == eDSP_MCFOLPASSFILTER_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_MCFOLPASSFILTER_RES_BADPOINTER == eDSP_MCFOLPASSFILTER_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadPointer 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MCFOLPASSFILTERTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_MCFOLPASSFILTER_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_MCFOLPASSFILTER_RES_OK == eDSP_MCFOLPASSFILTER_IsInit(&l_tCtx, &l_bIsInit) ) &&
+        ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MCFOLPASSFILTER_RES_NOINITLIB ==
+          eDSP_MCFOLPASSFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered) ) &&
+        ( e_eDSP_MCFOLPASSFILTER_RES_NOINITLIB ==
+          eDSP_MCFOLPASSFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_MCFOLPASSFILTER_RES_NOINITLIB == eDSP_MCFOLPASSFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadInit 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_MCFOLPASSFILTERTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_MCFOLPASSFILTER_Ctx l_tCtx;
+    int64_t  l_aiPrevOut[2u];
+
+    /* Function */
+    if( ( e_eDSP_MCFOLPASSFILTER_RES_BADPARAM ==
+          eDSP_MCFOLPASSFILTER_InitCtx(&l_tCtx, l_aiPrevOut, 0u, 10000u, 10000u) ) &&
+        ( e_eDSP_MCFOLPASSFILTER_RES_BADPARAM ==
+          eDSP_MCFOLPASSFILTER_InitCtx(&l_tCtx, l_aiPrevOut, 2u, 0u, 10000u) ) &&
+        ( e_eDSP_MCFOLPASSFILTER_RES_BADPARAM ==
+          eDSP_MCFOLPASSFILTER_InitCtx(&l_tCtx, l_aiPrevOut, 2u, 10000u, 0u) ) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MCFOLPASSFILTER_RES_OK ==
+          eDSP_MCFOLPASSFILTER_InitCtx(&l_tCtx, l_aiPrevOut, 2u, 10000u, 10000u) ) &&
+        ( e_eDSP_MCFOLPASSFILTER_RES_BADPARAM ==
+          eDSP_MCFOLPASSFILTER_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) ) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_BadParamEntr 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_MCFOLPASSFILTERTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_MCFOLPASSFILTER_Ctx l_tCtx;
+    int64_t  l_aiPrevOut[2u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_MCFOLPASSFILTER_InitCtx(&l_tCtx, l_aiPrevOut, 2u, 10000u, 10000u);
+    l_tCtx.piPrevOutValue = NULL;
+    if( e_eDSP_MCFOLPASSFILTER_RES_CORRUPTCTX ==
+        eDSP_MCFOLPASSFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_MCFOLPASSFILTER_InitCtx(&l_tCtx, l_aiPrevOut, 2u, 10000u, 10000u);
+    l_tCtx.uNChannels = 0u;
+    if( e_eDSP_MCFOLPASSFILTER_RES_CORRUPTCTX == eDSP_MCFOLPASSFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    (void)eDSP_MCFOLPASSFILTER_InitCtx(&l_tCtx, l_aiPrevOut, 2u, 10000u, 10000u);
+    l_tCtx.uAlphaQ31 = 0x80000001u;
+    if( e_eDSP_MCFOLPASSFILTER_RES_CORRUPTCTX ==
+        eDSP_MCFOLPASSFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    (void)eDSP_MCFOLPASSFILTER_InitCtx(&l_tCtx, l_aiPrevOut, 2u, 10000u, 10000u);
+    l_tCtx.eOvfMode = (e_eDSP_TYPE_OVFMODE) 5;
+    if( e_eDSP_MCFOLPASSFILTER_RES_CORRUPTCTX ==
+        eDSP_MCFOLPASSFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_CorruptedContext 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MCFOLPASSFILTERTST_SingleChannel(void)
+{
+    /* Function */
+    if( true == eDSP_MCFOLPASSFILTERTST_CheckRef(1u, e_eDSP_TYPE_OVFMODE_ERROR, 0x243F6A8885A308D3u) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_SingleChannel 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_SingleChannel 1  -- FAIL \n");
+    }
+
+    /* Channels that fill exactly the vectors, and ones that leave a tail to the portable loop */
+    if( ( true == eDSP_MCFOLPASSFILTERTST_CheckRef(4u, e_eDSP_TYPE_OVFMODE_ERROR, 0x13198A2E03707344u) ) &&
+        ( true == eDSP_MCFOLPASSFILTERTST_CheckRef(8u, e_eDSP_TYPE_OVFMODE_ERROR, 0xA4093822299F31D0u) ) &&
+        ( true == eDSP_MCFOLPASSFILTERTST_CheckRef(16u, e_eDSP_TYPE_OVFMODE_ERROR, 0x082EFA98EC4E6C89u) ) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_SingleChannel 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_SingleChannel 2  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_MCFOLPASSFILTERTST_CheckRef(3u, e_eDSP_TYPE_OVFMODE_ERROR, 0x452821E638D01377u) ) &&
+        ( true == eDSP_MCFOLPASSFILTERTST_CheckRef(13u, e_eDSP_TYPE_OVFMODE_ERROR, 0xBE5466CF34E90C6Cu) ) &&
+        ( true == eDSP_MCFOLPASSFILTERTST_CheckRef(19u, e_eDSP_TYPE_OVFMODE_ERROR, 0xC0AC29B7C97C50DDu) ) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_SingleChannel 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_SingleChannel 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_MCFOLPASSFILTERTST_Overflow(void)
+{
+    /* Local variable */
+    t_eDSP_MCFOLPASSFILTER_Ctx l_tCtx;
+    t_eDSP_FOLPASSFILTER_Ctx l_atRefCtx[9u];
+    int64_t  l_aiPrevOut[9u];
+    int64_t  l_aiValues[9u];
+    int64_t  l_aiFiltered[9u];
+    int64_t  l_iRefFiltered;
+    bool_t   l_bTestOk;
+
+    /* Init variable */
+    l_bTestOk = true;
+
+    /* Function */
+    (void)eDSP_MCFOLPASSFILTER_InitCtx(&l_tCtx, l_aiPrevOut, 9u, 10000u, 10000u);
+
+    for(uint32_t c = 0u; c < 9u; c++)
+    {
+        (void)eDSP_FOLPASSFILTER_InitCtx(&l_atRefCtx[c], 10000u, 10000u);
+        l_aiValues[c] = 1000 * ( (int64_t) c );
+        (void)eDSP_FOLPASSFILTER_InsertValueAndCalculate(&l_atRefCtx[c], l_aiValues[c], &l_iRefFiltered);
+    }
+    l_aiValues[7u] = MIN_INT64VAL;
+
+    if( e_eDSP_MCFOLPASSFILTER_RES_NEEDSMOREVALUE ==
+        eDSP_MCFOLPASSFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_Overflow 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_Overflow 1  -- FAIL \n");
+    }
+
+    /* Only the last channel of the vectors overflow, no channel can be updated */
+    for(uint32_t c = 0u; c < 9u; c++)
+    {
+        l_aiValues[c] = -500 * ( (int64_t) c );
+        l_aiFiltered[c] = 7;
+    }
+    l_aiValues[7u] = MAX_INT64VAL;
+
+    if( e_eDSP_MCFOLPASSFILTER_RES_OVERFLOW ==
+        eDSP_MCFOLPASSFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered) )
+    {
+        for(uint32_t c = 0u; c < 9u; c++)
+        {
+            if( ( 7 != l_aiFiltered[c] ) ||
+                ( ( 7u != c ) && ( ( 1000 * ( (int64_t) c ) ) != l_aiPrevOut[c] ) ) ||
+                ( ( 7u == c ) && ( MIN_INT64VAL != l_aiPrevOut[c] ) ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+    else
+    {
+        l_bTestOk = false;
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_Overflow 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_Overflow 2  -- FAIL \n");
+    }
+
+    /* The discarded tick doesn't change the next ones */
+    l_aiValues[7u] = MIN_INT64VAL;
+
+    if( e_eDSP_MCFOLPASSFILTER_RES_OK ==
+        eDSP_MCFOLPASSFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered) )
+    {
+        for(uint32_t c = 0u; c < 9u; c++)
+        {
+            (void)eDSP_FOLPASSFILTER_InsertValueAndCalculate(&l_atRefCtx[c], l_aiValues[c], &l_iRefFiltered);
+
+            if( ( 7u != c ) && ( l_iRefFiltered != l_aiFiltered[c] ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+
+        if( MIN_INT64VAL != l_aiFiltered[7u] )
+        {
+            l_bTestOk = false;
+        }
+    }
+    else
+    {
+        l_bTestOk = false;
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_Overflow 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_Overflow 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_MCFOLPASSFILTERTST_Saturate(void)
+{
+    /* Function */
+    if( ( true == eDSP_MCFOLPASSFILTERTST_CheckRef(1u, e_eDSP_TYPE_OVFMODE_SATURATE, 0x3F84D5B5B5470917u) ) &&
+        ( true == eDSP_MCFOLPASSFILTERTST_CheckRef(8u, e_eDSP_TYPE_OVFMODE_SATURATE, 0x9216D5D98979FB1Bu) ) &&
+        ( true == eDSP_MCFOLPASSFILTERTST_CheckRef(13u, e_eDSP_TYPE_OVFMODE_SATURATE, 0xD1310BA698DFB5ACu) ) )
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCFOLPASSFILTERTST_Saturate 1  -- FAIL \n");
+    }
+}
+
+static bool_t eDSP_MCFOLPASSFILTERTST_CheckRef(const uint32_t p_uNChannels, const e_eDSP_TYPE_OVFMODE p_eOvfMode,
+                                               const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_MCFOLPASSFILTER_Ctx l_tCtx;
+    t_eDSP_FOLPASSFILTER_Ctx l_atRefCtx[19u];
+    int64_t  l_aiPrevOut[19u];
+    int64_t  l_aiValues[19u];
+    int64_t  l_aiFiltered[19u];
+    int64_t  l_iRefFiltered;
+    uint64_t l_uSeed;
+    uint32_t l_uSatCnt;
+    uint32_t l_uRefSatCnt;
+    e_eDSP_MCFOLPASSFILTER_RES l_eRes;
+    e_eDSP_FOLPASSFILTER_RES l_eRefRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+    l_uSatCnt = 0u;
+
+    /* Function */
+    (void)eDSP_MCFOLPASSFILTER_InitCtx(&l_tCtx, l_aiPrevOut, p_uNChannels, 10000u, 10000u);
+    (void)eDSP_MCFOLPASSFILTER_SetOvfMode(&l_tCtx, p_eOvfMode);
+
+    for(uint32_t c = 0u; c < p_uNChannels; c++)
+    {
+        (void)eDSP_FOLPASSFILTER_InitCtx(&l_atRefCtx[c], 10000u, 10000u);
+        (void)eDSP_FOLPASSFILTER_SetOvfMode(&l_atRefCtx[c], p_eOvfMode);
+    }
+
+    /* Every channel must behave like a single channel filter. Saturation is per channel, so only there the
+       values can use the full range */
+    for(uint32_t i = 0u; ( ( i < 400u ) && ( true == l_bTestOk ) ); i++)
+    {
+        for(uint32_t c = 0u; c < p_uNChannels; c++)
+        {
+            l_aiValues[c] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+
+            if( e_eDSP_TYPE_OVFMODE_ERROR == p_eOvfMode )
+            {
+                l_aiValues[c] = l_aiValues[c] >> ( 2u + ( c % 40u ) );
+            }
+        }
+
+        l_eRes = eDSP_MCFOLPASSFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered);
+
+        for(uint32_t c = 0u; c < p_uNChannels; c++)
+        {
+            l_eRefRes = eDSP_FOLPASSFILTER_InsertValueAndCalculate(&l_atRefCtx[c], l_aiValues[c], &l_iRefFiltered);
+
+            if( 0u == i )
+            {
+                if( ( e_eDSP_FOLPASSFILTER_RES_NEEDSMOREVALUE != l_eRefRes ) ||
+                    ( e_eDSP_MCFOLPASSFILTER_RES_NEEDSMOREVALUE != l_eRes ) )
+                {
+                    l_bTestOk = false;
+                }
+            }
+            else if( ( e_eDSP_FOLPASSFILTER_RES_OK != l_eRefRes ) || ( e_eDSP_MCFOLPASSFILTER_RES_OK != l_eRes ) ||
+                     ( l_iRefFiltered != l_aiFiltered[c] ) )
+            {
+                l_bTestOk = false;
+            }
+            else
+            {
+                /* Same value */
+            }
+        }
+    }
+
+    /* The same numbers of clamped operations */
+    for(uint32_t c = 0u; c < p_uNChannels; c++)
+    {
+        (void)eDSP_FOLPASSFILTER_GetSatCnt(&l_atRefCtx[c], &l_uRefSatCnt);
+        l_uSatCnt += l_uRefSatCnt;
+    }
+
+    if( ( e_eDSP_MCFOLPASSFILTER_RES_OK != eDSP_MCFOLPASSFILTER_GetSatCnt(&l_tCtx, &l_uRefSatCnt) ) ||
+        ( l_uSatCnt != l_uRefSatCnt ) )
+    {
+        l_bTestOk = false;
+    }
+
+    if( ( e_eDSP_TYPE_OVFMODE_SATURATE == p_eOvfMode ) && ( 0u == l_uSatCnt ) )
+    {
+        l_bTestOk = false;
+    }
+
+    return l_bTestOk;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
@@ -0,0 +1,431 @@
+/**
+ * @file       eDSP_MCMOVMEANFILTERTST.c
+ *
+ * @brief      Multi channel moving mean filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_MCMOVMEANFILTERTST.h"
+#include "eDSP_MCMOVMEANFILTER.h"
+#include "eDSP_MOVMEANFILTER.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_MCMOVMEANFILTERTST_BadPointer(void);
+static void eDSP_MCMOVMEANFILTERTST_BadInit(void);
+static void eDSP_MCMOVMEANFILTERTST_BadParamEntr(void);
+static void eDSP_MCMOVMEANFILTERTST_CorruptedContext(void);
+static void eDSP_MCMOVMEANFILTERTST_SingleChannel(void);
+static void eDSP_MCMOVMEANFILTERTST_Saturate(void);
+static bool_t eDSP_MCMOVMEANFILTERTST_CheckRef(const uint32_t p_uNChannels, const e_eDSP_TYPE_OVFMODE p_eOvfMode,
+                                               const uint64_t p_uSeedInit);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_MCMOVMEANFILTERTST_ExeTest(void)
+{
+	(void)printf("\n\nMCMOVMEANFILTER TEST START \n\n");
+
+    eDSP_MCMOVMEANFILTERTST_BadPointer();
+    eDSP_MCMOVMEANFILTERTST_BadInit();
+    eDSP_MCMOVMEANFILTERTST_BadParamEntr();
+    eDSP_MCMOVMEANFILTERTST_CorruptedContext();
+    eDSP_MCMOVMEANFILTERTST_SingleChannel();
+    eDSP_MCMOVMEANFILTERTST_Saturate();
+
+    (void)printf("\n\nMCMOVMEANFILTER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_MCMOVMEANFILTERTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_MCMOVMEANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[6u];
+    uint64_t l_auSumLow[2u];
+    int64_t  l_aiSumHigh[2u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MCMOVMEANFILTER_InitCtx(NULL, l_aiWindow, 6u, l_auSumLow, l_aiSumHigh, 2u, 3u) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, NULL, 6u, l_auSumLow, l_aiSumHigh, 2u, 3u) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 6u, NULL, l_aiSumHigh, 2u, 3u) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 6u, l_auSumLow, NULL, 2u, 3u) ) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER == eDSP_MCMOVMEANFILTER_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER == eDSP_MCMOVMEANFILTER_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MCMOVMEANFILTER_InsertValuesAndCalculate(NULL, l_aiValues, l_aiFiltered) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MCMOVMEANFILTER_InsertValuesAndCalculate(&l_tCtx, NULL, l_aiFiltered) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MCMOVMEANFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, NULL) ) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MCMOVMEANFILTER_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER == eDSP_MCMOVMEANFILTER_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_BADPOINTER == eDSP_MCMOVMEANFILTER_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadPointer 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MCMOVMEANFILTERTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_MCMOVMEANFILTER_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_MCMOVMEANFILTER_RES_OK == eDSP_MCMOVMEANFILTER_IsInit(&l_tCtx, &l_bIsInit) ) &&
+        ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MCMOVMEANFILTER_RES_NOINITLIB ==
+          eDSP_MCMOVMEANFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_NOINITLIB ==
+          eDSP_MCMOVMEANFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_NOINITLIB == eDSP_MCMOVMEANFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadInit 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_MCMOVMEANFILTERTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_MCMOVMEANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[6u];
+    uint64_t l_auSumLow[2u];
+    int64_t  l_aiSumHigh[2u];
+
+    /* Function */
+    if( ( e_eDSP_MCMOVMEANFILTER_RES_BADPARAM ==
+          eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 0u, l_auSumLow, l_aiSumHigh, 0u, 3u) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_BADPARAM ==
+          eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 4u, l_auSumLow, l_aiSumHigh, 2u, 2u) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_BADPARAM ==
+          eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, l_auSumLow, l_aiSumHigh, 2u, 3u) ) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* The product of the channels and of the windows len doesn't fit an uint32_t */
+    if( e_eDSP_MCMOVMEANFILTER_RES_BADPARAM ==
+        eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 0u, l_auSumLow, l_aiSumHigh, 0x10000u, 0x10000u) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MCMOVMEANFILTER_RES_OK ==
+          eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 6u, l_auSumLow, l_aiSumHigh, 2u, 3u) ) &&
+        ( e_eDSP_MCMOVMEANFILTER_RES_BADPARAM ==
+          eDSP_MCMOVMEANFILTER_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) ) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_BadParamEntr 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_MCMOVMEANFILTERTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_MCMOVMEANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[6u];
+    uint64_t l_auSumLow[2u];
+    int64_t  l_aiSumHigh[2u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 6u, l_auSumLow, l_aiSumHigh, 2u, 3u);
+    l_tCtx.piWindowsSumHigh = NULL;
+    if( e_eDSP_MCMOVMEANFILTER_RES_CORRUPTCTX ==
+        eDSP_MCMOVMEANFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 6u, l_auSumLow, l_aiSumHigh, 2u, 3u);
+    l_tCtx.uCurDataLocation = 3u;
+    if( e_eDSP_MCMOVMEANFILTER_RES_CORRUPTCTX == eDSP_MCMOVMEANFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    (void)eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 6u, l_auSumLow, l_aiSumHigh, 2u, 3u);
+    (void)eDSP_MCMOVMEANFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered);
+    l_tCtx.uCurDataLocation = 2u;
+    if( e_eDSP_MCMOVMEANFILTER_RES_CORRUPTCTX ==
+        eDSP_MCMOVMEANFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    (void)eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 6u, l_auSumLow, l_aiSumHigh, 2u, 3u);
+    l_tCtx.eOvfMode = (e_eDSP_TYPE_OVFMODE) 5;
+    if( e_eDSP_MCMOVMEANFILTER_RES_CORRUPTCTX ==
+        eDSP_MCMOVMEANFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_CorruptedContext 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MCMOVMEANFILTERTST_SingleChannel(void)
+{
+    /* Function */
+    if( true == eDSP_MCMOVMEANFILTERTST_CheckRef(1u, e_eDSP_TYPE_OVFMODE_ERROR, 0x243F6A8885A308D3u) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_SingleChannel 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_SingleChannel 1  -- FAIL \n");
+    }
+
+    /* Channels that fill exactly the vectors, and ones that leave a tail to the portable loop */
+    if( ( true == eDSP_MCMOVMEANFILTERTST_CheckRef(4u, e_eDSP_TYPE_OVFMODE_ERROR, 0x13198A2E03707344u) ) &&
+        ( true == eDSP_MCMOVMEANFILTERTST_CheckRef(8u, e_eDSP_TYPE_OVFMODE_ERROR, 0xA4093822299F31D0u) ) &&
+        ( true == eDSP_MCMOVMEANFILTERTST_CheckRef(16u, e_eDSP_TYPE_OVFMODE_ERROR, 0x082EFA98EC4E6C89u) ) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_SingleChannel 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_SingleChannel 2  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_MCMOVMEANFILTERTST_CheckRef(3u, e_eDSP_TYPE_OVFMODE_ERROR, 0x452821E638D01377u) ) &&
+        ( true == eDSP_MCMOVMEANFILTERTST_CheckRef(13u, e_eDSP_TYPE_OVFMODE_ERROR, 0xBE5466CF34E90C6Cu) ) &&
+        ( true == eDSP_MCMOVMEANFILTERTST_CheckRef(19u, e_eDSP_TYPE_OVFMODE_ERROR, 0xC0AC29B7C97C50DDu) ) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_SingleChannel 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_SingleChannel 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_MCMOVMEANFILTERTST_Saturate(void)
+{
+    /* Function */
+    if( ( true == eDSP_MCMOVMEANFILTERTST_CheckRef(1u, e_eDSP_TYPE_OVFMODE_SATURATE, 0x3F84D5B5B5470917u) ) &&
+        ( true == eDSP_MCMOVMEANFILTERTST_CheckRef(8u, e_eDSP_TYPE_OVFMODE_SATURATE, 0x9216D5D98979FB1Bu) ) &&
+        ( true == eDSP_MCMOVMEANFILTERTST_CheckRef(13u, e_eDSP_TYPE_OVFMODE_SATURATE, 0xD1310BA698DFB5ACu) ) )
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MCMOVMEANFILTERTST_Saturate 1  -- FAIL \n");
+    }
+}
+
+static bool_t eDSP_MCMOVMEANFILTERTST_CheckRef(const uint32_t p_uNChannels, const e_eDSP_TYPE_OVFMODE p_eOvfMode,
+                                               const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_MCMOVMEANFILTER_Ctx l_tCtx;
+    t_eDSP_MOVMEANFILTER_Ctx l_atRefCtx[19u];
+    int64_t  l_aiWindow[5u * 19u];
+    int64_t  l_aiRefWindow[19u][5u];
+    uint64_t l_auSumLow[19u];
+    int64_t  l_aiSumHigh[19u];
+    int64_t  l_aiValues[19u];
+    int64_t  l_aiFiltered[19u];
+    int64_t  l_aiExpected[19u];
+    int64_t  l_iRefFiltered;
+    uint64_t l_uSeed;
+    uint32_t l_uSatCnt;
+    uint32_t l_uRefSatCnt;
+    e_eDSP_MCMOVMEANFILTER_RES l_eRes;
+    e_eDSP_MCMOVMEANFILTER_RES l_eExpRes;
+    e_eDSP_MOVMEANFILTER_RES l_eRefRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+    l_uSatCnt = 0u;
+
+    /* Function */
+    (void)eDSP_MCMOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u * p_uNChannels, l_auSumLow, l_aiSumHigh, p_uNChannels,
+                                       5u);
+    (void)eDSP_MCMOVMEANFILTER_SetOvfMode(&l_tCtx, p_eOvfMode);
+
+    for(uint32_t c = 0u; c < p_uNChannels; c++)
+    {
+        (void)eDSP_MOVMEANFILTER_InitCtx(&l_atRefCtx[c], l_aiRefWindow[c], 5u);
+        (void)eDSP_MOVMEANFILTER_SetOvfMode(&l_atRefCtx[c], p_eOvfMode);
+        l_aiFiltered[c] = 0;
+        l_aiExpected[c] = 0;
+    }
+
+    /* Every channel must behave like a single channel filter, the filtered value of a channel that overflow is
+       left unchanged */
+    for(uint32_t i = 0u; ( ( i < 400u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_eExpRes = e_eDSP_MCMOVMEANFILTER_RES_OK;
+
+        for(uint32_t c = 0u; c < p_uNChannels; c++)
+        {
+            /* Runs of full range values, so the sums cross the int64_t limits and come back */
+            if( ( ( i / 16u ) % 3u ) == 0u )
+            {
+                l_aiValues[c] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+            }
+            else
+            {
+                l_aiValues[c] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> ( 1u + ( c % 40u ) );
+            }
+
+            l_eRefRes = eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_atRefCtx[c], l_aiValues[c], &l_iRefFiltered);
+
+            if( e_eDSP_MOVMEANFILTER_RES_OK == l_eRefRes )
+            {
+                l_aiExpected[c] = l_iRefFiltered;
+            }
+            else if( e_eDSP_MOVMEANFILTER_RES_OVERFLOW == l_eRefRes )
+            {
+                l_eExpRes = e_eDSP_MCMOVMEANFILTER_RES_OVERFLOW;
+            }
+            else
+            {
+                l_eExpRes = e_eDSP_MCMOVMEANFILTER_RES_NEEDSMOREVALUE;
+            }
+        }
+
+        l_eRes = eDSP_MCMOVMEANFILTER_InsertValuesAndCalculate(&l_tCtx, l_aiValues, l_aiFiltered);
+
+        if( l_eExpRes != l_eRes )
+        {
+            l_bTestOk = false;
+        }
+
+        for(uint32_t c = 0u; c < p_uNChannels; c++)
+        {
+            if( l_aiExpected[c] != l_aiFiltered[c] )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+
+    /* The same numbers of clamped operations */
+    for(uint32_t c = 0u; c < p_uNChannels; c++)
+    {
+        (void)eDSP_MOVMEANFILTER_GetSatCnt(&l_atRefCtx[c], &l_uRefSatCnt);
+        l_uSatCnt += l_uRefSatCnt;
+    }
+
+    if( ( e_eDSP_MCMOVMEANFILTER_RES_OK != eDSP_MCMOVMEANFILTER_GetSatCnt(&l_tCtx, &l_uRefSatCnt) ) ||
+        ( l_uSatCnt != l_uRefSatCnt ) )
+    {
+        l_bTestOk = false;
+    }
+
+    return l_bTestOk;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
@@ -0,0 +1,572 @@
+/**
+ * @file       eDSP_MOVMEANFILTERTST.c
+ *
+ * @brief      Moving mean filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_MOVMEANFILTERTST.h"
+#include "eDSP_MOVMEANFILTER.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_MOVMEANFILTERTST_BadPointer(void);
+static void eDSP_MOVMEANFILTERTST_BadInit(void);
+static void eDSP_MOVMEANFILTERTST_BadParamEntr(void);
+static void eDSP_MOVMEANFILTERTST_CorruptedContext(void);
+static void eDSP_MOVMEANFILTERTST_Reference(void);
+static void eDSP_MOVMEANFILTERTST_Overflow(void);
+static void eDSP_MOVMEANFILTERTST_Saturate(void);
+static void eDSP_MOVMEANFILTERTST_BlockVsSample(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_MOVMEANFILTERTST_ExeTest(void)
+{
+	(void)printf("\n\nMOVMEANFILTER TEST START \n\n");
+
+    eDSP_MOVMEANFILTERTST_BadPointer();
+    eDSP_MOVMEANFILTERTST_BadInit();
+    eDSP_MOVMEANFILTERTST_BadParamEntr();
+    eDSP_MOVMEANFILTERTST_CorruptedContext();
+    eDSP_MOVMEANFILTERTST_Reference();
+    eDSP_MOVMEANFILTERTST_Overflow();
+    eDSP_MOVMEANFILTERTST_Saturate();
+    eDSP_MOVMEANFILTERTST_BlockVsSample();
+
+    (void)printf("\n\nMOVMEANFILTER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_MOVMEANFILTERTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[5u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( e_eDSP_MOVMEANFILTER_RES_BADPOINTER == eDSP_MOVMEANFILTER_InitCtx(NULL, l_aiWindow, 5u) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eDSP_MOVMEANFILTER_RES_BADPOINTER == eDSP_MOVMEANFILTER_InitCtx(&l_tCtx, NULL, 5u) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER == eDSP_MOVMEANFILTER_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER == eDSP_MOVMEANFILTER_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER == eDSP_MOVMEANFILTER_InsertValueAndCalculate(NULL, 1, &l_iFiltered) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER == eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, 1, NULL) ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEANFILTER_ProcessBlock(NULL, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEANFILTER_ProcessBlock(&l_tCtx, NULL, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEANFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, NULL, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEANFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, NULL, &l_uNProcessed) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEANFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, NULL) ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER == eDSP_MOVMEANFILTER_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER == eDSP_MOVMEANFILTER_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_BADPOINTER == eDSP_MOVMEANFILTER_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadPointer 6  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEANFILTERTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEANFILTER_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_MOVMEANFILTER_RES_OK == eDSP_MOVMEANFILTER_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEANFILTER_RES_NOINITLIB ==
+          eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_NOINITLIB ==
+          eDSP_MOVMEANFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEANFILTER_RES_NOINITLIB == eDSP_MOVMEANFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_NOINITLIB == eDSP_MOVMEANFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadInit 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEANFILTERTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[5u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Function */
+    if( e_eDSP_MOVMEANFILTER_RES_BADPARAM == eDSP_MOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 2u) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eDSP_MOVMEANFILTER_RES_OK == eDSP_MOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eDSP_MOVMEANFILTER_RES_BADPARAM ==
+        eDSP_MOVMEANFILTER_ProcessBlock(&l_tCtx, l_aiValues, 0u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eDSP_MOVMEANFILTER_RES_BADPARAM == eDSP_MOVMEANFILTER_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BadParamEntr 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEANFILTERTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[5u];
+    int64_t  l_iFiltered;
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_MOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u);
+    l_tCtx.piWindowsBuffer = NULL;
+    if( e_eDSP_MOVMEANFILTER_RES_CORRUPTCTX == eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_MOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u);
+    l_tCtx.uCurDataLocation = 5u;
+    if( e_eDSP_MOVMEANFILTER_RES_CORRUPTCTX == eDSP_MOVMEANFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    /* The high part of the sum can't be far from zero when only two values are inserted */
+    (void)eDSP_MOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u);
+    (void)eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered);
+    (void)eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered);
+    l_tCtx.iWindowsSumHigh = 3;
+    if( e_eDSP_MOVMEANFILTER_RES_CORRUPTCTX == eDSP_MOVMEANFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    (void)eDSP_MOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u);
+    l_tCtx.eOvfMode = (e_eDSP_TYPE_OVFMODE) 5;
+    if( e_eDSP_MOVMEANFILTER_RES_CORRUPTCTX == eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_CorruptedContext 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEANFILTERTST_Reference(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[7u];
+    int64_t  l_aiHistory[500u];
+    uint64_t l_uSeed;
+    int64_t  l_iFiltered;
+    int64_t  l_iRefSum;
+    e_eDSP_MOVMEANFILTER_RES l_eRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0x2468ACE013579BDFu;
+
+    /* Function */
+    (void)eDSP_MOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 7u);
+
+    /* Values up to 2^40, the reference sum of the window can't overflow */
+    for(uint32_t i = 0u; ( ( i < 500u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_aiHistory[i] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 24u;
+        l_eRes = eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, l_aiHistory[i], &l_iFiltered);
+
+        if( i < 6u )
+        {
+            if( e_eDSP_MOVMEANFILTER_RES_NEEDSMOREVALUE != l_eRes )
+            {
+                l_bTestOk = false;
+            }
+        }
+        else
+        {
+            l_iRefSum = 0;
+
+            for(uint32_t j = i - 6u; j <= i; j++)
+            {
+                l_iRefSum += l_aiHistory[j];
+            }
+
+            /* Truncated toward zero like the C division */
+            if( ( e_eDSP_MOVMEANFILTER_RES_OK != l_eRes ) || ( ( l_iRefSum / 7 ) != l_iFiltered ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Reference 1  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEANFILTERTST_Overflow(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEANFILTER_Ctx l_tCtx;
+    int64_t l_aiWindow[3u];
+    int64_t l_iFiltered;
+
+    /* Init variable */
+    l_iFiltered = 0;
+
+    /* Function */
+    (void)eDSP_MOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 3u);
+    (void)eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    (void)eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    if( e_eDSP_MOVMEANFILTER_RES_OVERFLOW ==
+        eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Overflow 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Overflow 1  -- FAIL \n");
+    }
+
+    /* The sum is exact, so it is correct again as soon as it fit */
+    if( ( e_eDSP_MOVMEANFILTER_RES_OK ==
+          eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered) ) &&
+        ( ( ( MAX_INT64VAL - 1 ) / 3 ) == l_iFiltered ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Overflow 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Overflow 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEANFILTER_RES_OVERFLOW ==
+          eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_OVERFLOW ==
+          eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered) ) &&
+        ( e_eDSP_MOVMEANFILTER_RES_OVERFLOW ==
+          eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, 0, &l_iFiltered) ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Overflow 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Overflow 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEANFILTER_RES_OK == eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, 0, &l_iFiltered) ) &&
+        ( ( MIN_INT64VAL / 3 ) == l_iFiltered ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Overflow 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Overflow 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEANFILTERTST_Saturate(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[3u];
+    int64_t  l_iFiltered;
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_iFiltered = 0;
+    l_uSatCnt = 1u;
+
+    /* Function */
+    (void)eDSP_MOVMEANFILTER_InitCtx(&l_tCtx, l_aiWindow, 3u);
+    if( e_eDSP_MOVMEANFILTER_RES_OK == eDSP_MOVMEANFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Saturate 1  -- FAIL \n");
+    }
+
+    /* The mean of the window always fit, nothing is clamped */
+    (void)eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    (void)eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    if( ( e_eDSP_MOVMEANFILTER_RES_OK ==
+          eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered) ) &&
+        ( MAX_INT64VAL == l_iFiltered ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Saturate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Saturate 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEANFILTER_RES_OK ==
+          eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered) ) &&
+        ( ( ( MAX_INT64VAL - 1 ) / 3 ) == l_iFiltered ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Saturate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Saturate 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEANFILTER_RES_OK == eDSP_MOVMEANFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Saturate 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_Saturate 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEANFILTERTST_BlockVsSample(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEANFILTER_Ctx l_tCtxBlock;
+    t_eDSP_MOVMEANFILTER_Ctx l_tCtxSample;
+    int64_t  l_aiWindowBlock[9u];
+    int64_t  l_aiWindowSample[9u];
+    int64_t  l_aiValues[64u];
+    int64_t  l_aiFiltered[64u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uNBlock;
+    uint32_t l_uNSample;
+    uint32_t l_uNSampleIn;
+    uint64_t l_uSeed;
+    e_eDSP_MOVMEANFILTER_RES l_eBlockRes;
+    e_eDSP_MOVMEANFILTER_RES l_eSampleRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0x0BADC0FFEE0DDF00u;
+
+    /* Function */
+    (void)eDSP_MOVMEANFILTER_InitCtx(&l_tCtxBlock, l_aiWindowBlock, 9u);
+    (void)eDSP_MOVMEANFILTER_InitCtx(&l_tCtxSample, l_aiWindowSample, 9u);
+
+    /* Blocks shorter and longer than the window, with small values that take the unchecked path and extreme values
+       that overflow, must give the same result of the single value insertion */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uNBlock = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 64u );
+
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            if( 0u == ( i % 4u ) )
+            {
+                l_aiValues[j] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+            }
+            else
+            {
+                l_aiValues[j] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 16u;
+            }
+        }
+
+        l_eBlockRes = eDSP_MOVMEANFILTER_ProcessBlock(&l_tCtxBlock, l_aiValues, l_uNBlock, l_aiFiltered,
+                                                      &l_uNFiltered, &l_uNProcessed);
+
+        /* Processing stop at the first error, feed the same values one by one */
+        l_uNSample = 0u;
+        l_uNSampleIn = 0u;
+        l_eSampleRes = e_eDSP_MOVMEANFILTER_RES_NEEDSMOREVALUE;
+        for(uint32_t j = 0u; ( ( j < l_uNBlock ) && ( e_eDSP_MOVMEANFILTER_RES_OVERFLOW != l_eSampleRes ) ); j++)
+        {
+            l_eSampleRes = eDSP_MOVMEANFILTER_InsertValueAndCalculate(&l_tCtxSample, l_aiValues[j], &l_iFiltered);
+
+            l_uNSampleIn++;
+
+            if( e_eDSP_MOVMEANFILTER_RES_OK == l_eSampleRes )
+            {
+                if( ( l_uNSample >= l_uNFiltered ) || ( l_aiFiltered[l_uNSample] != l_iFiltered ) )
+                {
+                    l_bTestOk = false;
+                }
+
+                l_uNSample++;
+            }
+        }
+
+        if( ( l_uNSample != l_uNFiltered ) || ( l_uNSampleIn != l_uNProcessed ) ||
+            ( ( e_eDSP_MOVMEANFILTER_RES_OVERFLOW == l_eBlockRes ) &&
+              ( e_eDSP_MOVMEANFILTER_RES_OVERFLOW != l_eSampleRes ) ) )
+        {
+            l_bTestOk = false;
+        }
+
+        /* Start again from the same state after an overflow */
+        if( e_eDSP_MOVMEANFILTER_RES_OVERFLOW == l_eSampleRes )
+        {
+            (void)eDSP_MOVMEANFILTER_InitCtx(&l_tCtxBlock, l_aiWindowBlock, 9u);
+            (void)eDSP_MOVMEANFILTER_InitCtx(&l_tCtxSample, l_aiWindowSample, 9u);
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BlockVsSample 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEANFILTERTST_BlockVsSample 1  -- FAIL \n");
+    }
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
@@ -0,0 +1,638 @@
+/**
+ * @file       eDSP_MOVMEDIANFILTERTST.c
+ *
+ * @brief      Moving median filter test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_MOVMEDIANFILTERTST.h"
+#include "eDSP_MOVMEDIANFILTER.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_MOVMEDIANFILTERTST_BadPointer(void);
+static void eDSP_MOVMEDIANFILTERTST_BadInit(void);
+static void eDSP_MOVMEDIANFILTERTST_BadParamEntr(void);
+static void eDSP_MOVMEDIANFILTERTST_CorruptedContext(void);
+static void eDSP_MOVMEDIANFILTERTST_Reference(void);
+static void eDSP_MOVMEDIANFILTERTST_Overflow(void);
+static void eDSP_MOVMEDIANFILTERTST_Saturate(void);
+static void eDSP_MOVMEDIANFILTERTST_BlockVsSample(void);
+static bool_t eDSP_MOVMEDIANFILTERTST_CheckRef(const uint32_t p_uWinLen, const uint32_t p_uRange,
+                                               const uint64_t p_uSeedInit);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_MOVMEDIANFILTERTST_ExeTest(void)
+{
+	(void)printf("\n\nMOVMEDIANFILTER TEST START \n\n");
+
+    eDSP_MOVMEDIANFILTERTST_BadPointer();
+    eDSP_MOVMEDIANFILTERTST_BadInit();
+    eDSP_MOVMEDIANFILTERTST_BadParamEntr();
+    eDSP_MOVMEDIANFILTERTST_CorruptedContext();
+    eDSP_MOVMEDIANFILTERTST_Reference();
+    eDSP_MOVMEDIANFILTERTST_Overflow();
+    eDSP_MOVMEDIANFILTERTST_Saturate();
+    eDSP_MOVMEDIANFILTERTST_BlockVsSample();
+
+    (void)printf("\n\nMOVMEDIANFILTER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_MOVMEDIANFILTERTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEDIANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[5u];
+    uint32_t l_auHeap[10u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEDIANFILTER_InitCtx(NULL, l_aiWindow, 5u, l_auHeap, 10u) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, NULL, 5u, l_auHeap, 10u) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, NULL, 10u) ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER == eDSP_MOVMEDIANFILTER_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER == eDSP_MOVMEDIANFILTER_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(NULL, 1, &l_iFiltered) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER == eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, 1, NULL) ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEDIANFILTER_ProcessBlock(NULL, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEDIANFILTER_ProcessBlock(&l_tCtx, NULL, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEDIANFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, NULL, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEDIANFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, NULL, &l_uNProcessed) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEDIANFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, NULL) ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER ==
+          eDSP_MOVMEDIANFILTER_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER == eDSP_MOVMEDIANFILTER_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPOINTER == eDSP_MOVMEDIANFILTER_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadPointer 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEDIANFILTERTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEDIANFILTER_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_OK == eDSP_MOVMEDIANFILTER_IsInit(&l_tCtx, &l_bIsInit) ) &&
+        ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_NOINITLIB ==
+          eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_NOINITLIB ==
+          eDSP_MOVMEDIANFILTER_ProcessBlock(&l_tCtx, l_aiValues, 2u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_NOINITLIB ==
+          eDSP_MOVMEDIANFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_NOINITLIB == eDSP_MOVMEDIANFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadInit 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEDIANFILTERTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEDIANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[5u];
+    uint32_t l_auHeap[10u];
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    int64_t  l_aiFiltered[2u];
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+
+    /* Function */
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_BADPARAM ==
+          eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, 2u, l_auHeap, 4u) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPARAM ==
+          eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, l_auHeap, 9u) ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* The heap position must fit an int32_t */
+    if( e_eDSP_MOVMEDIANFILTER_RES_BADPARAM ==
+        eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, 0x40000000u, l_auHeap, 0x80000000u) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eDSP_MOVMEDIANFILTER_RES_OK == eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, l_auHeap, 10u) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_BADPARAM ==
+          eDSP_MOVMEDIANFILTER_ProcessBlock(&l_tCtx, l_aiValues, 0u, l_aiFiltered, &l_uNFiltered, &l_uNProcessed) ) &&
+        ( e_eDSP_MOVMEDIANFILTER_RES_BADPARAM == eDSP_MOVMEDIANFILTER_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BadParamEntr 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEDIANFILTERTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEDIANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[5u];
+    uint32_t l_auHeap[10u];
+    int64_t  l_iFiltered;
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, l_auHeap, 10u);
+    l_tCtx.puHeapBuffer = NULL;
+    if( e_eDSP_MOVMEDIANFILTER_RES_CORRUPTCTX ==
+        eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, l_auHeap, 10u);
+    l_tCtx.uCurDataLocation = 5u;
+    if( e_eDSP_MOVMEDIANFILTER_RES_CORRUPTCTX == eDSP_MOVMEDIANFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    /* During the fill the next slot is always the numbers of inserted values */
+    (void)eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, l_auHeap, 10u);
+    (void)eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered);
+    l_tCtx.uCurDataLocation = 3u;
+    if( e_eDSP_MOVMEDIANFILTER_RES_CORRUPTCTX ==
+        eDSP_MOVMEDIANFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    (void)eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, 5u, l_auHeap, 10u);
+    l_tCtx.eOvfMode = (e_eDSP_TYPE_OVFMODE) 5;
+    if( e_eDSP_MOVMEDIANFILTER_RES_CORRUPTCTX ==
+        eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, 1, &l_iFiltered) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_CorruptedContext 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEDIANFILTERTST_Reference(void)
+{
+    /* Function */
+    if( true == eDSP_MOVMEDIANFILTERTST_CheckRef(7u, 0u, 0x13579BDF2468ACE0u) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Reference 1  -- FAIL \n");
+    }
+
+    /* Few different values, so a lot of equal values are in the heaps */
+    if( true == eDSP_MOVMEDIANFILTERTST_CheckRef(7u, 5u, 0x0F0F0F0FF0F0F0F0u) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Reference 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Reference 2  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_MOVMEDIANFILTERTST_CheckRef(6u, 0u, 0x1122334455667788u) ) &&
+        ( true == eDSP_MOVMEDIANFILTERTST_CheckRef(6u, 4u, 0x8877665544332211u) ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Reference 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Reference 3  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_MOVMEDIANFILTERTST_CheckRef(3u, 0u, 0x0123456789ABCDEFu) ) &&
+        ( true == eDSP_MOVMEDIANFILTERTST_CheckRef(4u, 3u, 0xFEDCBA9876543210u) ) &&
+        ( true == eDSP_MOVMEDIANFILTERTST_CheckRef(32u, 0u, 0xA5A5A5A55A5A5A5Au) ) &&
+        ( true == eDSP_MOVMEDIANFILTERTST_CheckRef(33u, 9u, 0x5A5A5A5AA5A5A5A5u) ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Reference 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Reference 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEDIANFILTERTST_Overflow(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEDIANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[4u];
+    uint32_t l_auHeap[8u];
+    int64_t  l_iFiltered;
+
+    /* Init variable */
+    l_iFiltered = 0;
+
+    /* Function */
+    (void)eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, 4u, l_auHeap, 8u);
+    (void)eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    (void)eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    (void)eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered);
+    if( e_eDSP_MOVMEDIANFILTER_RES_OVERFLOW ==
+        eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Overflow 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Overflow 1  -- FAIL \n");
+    }
+
+    /* The value is inserted anyway, the central values are now MIN_INT64VAL and MAX_INT64VAL */
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_OK ==
+          eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered) ) &&
+        ( 0 == l_iFiltered ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Overflow 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Overflow 2  -- FAIL \n");
+    }
+
+    if( e_eDSP_MOVMEDIANFILTER_RES_OVERFLOW ==
+        eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Overflow 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Overflow 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEDIANFILTERTST_Saturate(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEDIANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[4u];
+    uint32_t l_auHeap[8u];
+    int64_t  l_iFiltered;
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_iFiltered = 0;
+    l_uSatCnt = 1u;
+
+    /* Function */
+    (void)eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, 4u, l_auHeap, 8u);
+    if( e_eDSP_MOVMEDIANFILTER_RES_OK == eDSP_MOVMEDIANFILTER_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Saturate 1  -- FAIL \n");
+    }
+
+    /* The middle of two int64_t always fit */
+    (void)eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    (void)eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered);
+    (void)eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered);
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_OK ==
+          eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MAX_INT64VAL, &l_iFiltered) ) &&
+        ( MAX_INT64VAL == l_iFiltered ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Saturate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Saturate 2  -- FAIL \n");
+    }
+
+    /* Central values MIN_INT64VAL + 1 and MIN_INT64VAL, truncated toward zero */
+    (void)eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL, &l_iFiltered);
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_OK ==
+          eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, MIN_INT64VAL + 1, &l_iFiltered) ) &&
+        ( ( MIN_INT64VAL + 1 ) == l_iFiltered ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Saturate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Saturate 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MOVMEDIANFILTER_RES_OK == eDSP_MOVMEDIANFILTER_GetSatCnt(&l_tCtx, &l_uSatCnt) ) &&
+        ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Saturate 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_Saturate 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_MOVMEDIANFILTERTST_BlockVsSample(void)
+{
+    /* Local variable */
+    t_eDSP_MOVMEDIANFILTER_Ctx l_tCtxBlock;
+    t_eDSP_MOVMEDIANFILTER_Ctx l_tCtxSample;
+    int64_t  l_aiWindowBlock[6u];
+    int64_t  l_aiWindowSample[6u];
+    uint32_t l_auHeapBlock[12u];
+    uint32_t l_auHeapSample[12u];
+    int64_t  l_aiValues[64u];
+    int64_t  l_aiFiltered[64u];
+    int64_t  l_iFiltered;
+    uint32_t l_uNFiltered;
+    uint32_t l_uNProcessed;
+    uint32_t l_uNBlock;
+    uint32_t l_uNSample;
+    uint32_t l_uNSampleIn;
+    uint64_t l_uSeed;
+    e_eDSP_MOVMEDIANFILTER_RES l_eBlockRes;
+    e_eDSP_MOVMEDIANFILTER_RES l_eSampleRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0x0DDF00D0BADC0FFEu;
+
+    /* Function */
+    (void)eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtxBlock, l_aiWindowBlock, 6u, l_auHeapBlock, 12u);
+    (void)eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtxSample, l_aiWindowSample, 6u, l_auHeapSample, 12u);
+
+    /* Full range values, so the sum of the central values overflow some time and the block stop there */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uNBlock = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 64u );
+
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            l_aiValues[j] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+        }
+
+        l_eBlockRes = eDSP_MOVMEDIANFILTER_ProcessBlock(&l_tCtxBlock, l_aiValues, l_uNBlock, l_aiFiltered,
+                                                        &l_uNFiltered, &l_uNProcessed);
+
+        l_uNSample = 0u;
+        l_uNSampleIn = 0u;
+        l_eSampleRes = e_eDSP_MOVMEDIANFILTER_RES_NEEDSMOREVALUE;
+        for(uint32_t j = 0u; ( ( j < l_uNBlock ) && ( e_eDSP_MOVMEDIANFILTER_RES_OVERFLOW != l_eSampleRes ) ); j++)
+        {
+            l_eSampleRes = eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtxSample, l_aiValues[j], &l_iFiltered);
+
+            l_uNSampleIn++;
+
+            if( e_eDSP_MOVMEDIANFILTER_RES_OK == l_eSampleRes )
+            {
+                if( ( l_uNSample >= l_uNFiltered ) || ( l_aiFiltered[l_uNSample] != l_iFiltered ) )
+                {
+                    l_bTestOk = false;
+                }
+
+                l_uNSample++;
+            }
+        }
+
+        if( ( l_uNSample != l_uNFiltered ) || ( l_uNSampleIn != l_uNProcessed ) ||
+            ( ( e_eDSP_MOVMEDIANFILTER_RES_OVERFLOW == l_eBlockRes ) &&
+              ( e_eDSP_MOVMEDIANFILTER_RES_OVERFLOW != l_eSampleRes ) ) )
+        {
+            l_bTestOk = false;
+        }
+
+        /* Start again from the same state after an overflow */
+        if( e_eDSP_MOVMEDIANFILTER_RES_OVERFLOW == l_eSampleRes )
+        {
+            (void)eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtxBlock, l_aiWindowBlock, 6u, l_auHeapBlock, 12u);
+            (void)eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtxSample, l_aiWindowSample, 6u, l_auHeapSample, 12u);
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BlockVsSample 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MOVMEDIANFILTERTST_BlockVsSample 1  -- FAIL \n");
+    }
+}
+
+static bool_t eDSP_MOVMEDIANFILTERTST_CheckRef(const uint32_t p_uWinLen, const uint32_t p_uRange,
+                                               const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_MOVMEDIANFILTER_Ctx l_tCtx;
+    int64_t  l_aiWindow[33u];
+    uint32_t l_auHeap[66u];
+    int64_t  l_aiHistory[400u];
+    int64_t  l_aiSorted[33u];
+    int64_t  l_iFiltered;
+    int64_t  l_iExpected;
+    int64_t  l_iTemp;
+    uint64_t l_uSeed;
+    uint32_t l_uPos;
+    e_eDSP_MOVMEDIANFILTER_RES l_eRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+
+    /* Function */
+    (void)eDSP_MOVMEDIANFILTER_InitCtx(&l_tCtx, l_aiWindow, p_uWinLen, l_auHeap, 2u * p_uWinLen);
+
+    for(uint32_t i = 0u; ( ( i < 400u ) && ( true == l_bTestOk ) ); i++)
+    {
+        /* Values up to 2^40 so the sum of the central values fit, or only p_uRange different values */
+        if( 0u == p_uRange )
+        {
+            l_aiHistory[i] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 24u;
+        }
+        else
+        {
+            l_aiHistory[i] = ( (int64_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % p_uRange ) ) - 2;
+        }
+
+        l_eRes = eDSP_MOVMEDIANFILTER_InsertValueAndCalculate(&l_tCtx, l_aiHistory[i], &l_iFiltered);
+
+        if( ( i + 1u ) < p_uWinLen )
+        {
+            if( e_eDSP_MOVMEDIANFILTER_RES_NEEDSMOREVALUE != l_eRes )
+            {
+                l_bTestOk = false;
+            }
+        }
+        else
+        {
+            /* Insertion sort of the last p_uWinLen values */
+            for(uint32_t j = 0u; j < p_uWinLen; j++)
+            {
+                l_iTemp = l_aiHistory[( i + 1u + j ) - p_uWinLen];
+                l_uPos = j;
+
+                while( ( l_uPos > 0u ) && ( l_aiSorted[l_uPos - 1u] > l_iTemp ) )
+                {
+                    l_aiSorted[l_uPos] = l_aiSorted[l_uPos - 1u];
+                    l_uPos--;
+                }
+
+                l_aiSorted[l_uPos] = l_iTemp;
+            }
+
+            if( 0u != ( p_uWinLen & 1u ) )
+            {
+                l_iExpected = l_aiSorted[p_uWinLen / 2u];
+            }
+            else
+            {
+                l_iExpected = ( l_aiSorted[( p_uWinLen / 2u ) - 1u] + l_aiSorted[p_uWinLen / 2u] ) / 2;
+            }
+
+            if( ( e_eDSP_MOVMEDIANFILTER_RES_OK != l_eRes ) || ( l_iExpected != l_iFiltered ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+
+    return l_bTestOk;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
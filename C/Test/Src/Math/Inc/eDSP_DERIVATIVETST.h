@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_DERIVATIVETST.h
+ *
+ * @brief      Derivative test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_DERIVATIVETST_H
+#define EDSP_DERIVATIVETST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the derivative module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_DERIVATIVETST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_DERIVATIVETST_H */
\ No newline at end of file
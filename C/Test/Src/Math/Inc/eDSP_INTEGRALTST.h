@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_INTEGRALTST.h
+ *
+ * @brief      Integral test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_INTEGRALTST_H
+#define EDSP_INTEGRALTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the integral module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_INTEGRALTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_INTEGRALTST_H */
\ No newline at end of file
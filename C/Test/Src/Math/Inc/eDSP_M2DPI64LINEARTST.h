@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_M2DPI64LINEARTST.h
+ *
+ * @brief      Multiple 2D point linearization test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_M2DPI64LINEARTST_H
+#define EDSP_M2DPI64LINEARTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the multiple 2D point linearization module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_M2DPI64LINEARTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_M2DPI64LINEARTST_H */
\ No newline at end of file
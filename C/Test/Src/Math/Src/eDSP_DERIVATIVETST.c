@@ -0,0 +1,740 @@
+/**
+ * @file       eDSP_DERIVATIVETST.c
+ *
+ * @brief      Derivative test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_DERIVATIVETST.h"
+#include "eDSP_DERIVATIVE.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_DERIVATIVETST_BadPointer(void);
+static void eDSP_DERIVATIVETST_BadInit(void);
+static void eDSP_DERIVATIVETST_BadParamEntr(void);
+static void eDSP_DERIVATIVETST_CorruptedContext(void);
+static void eDSP_DERIVATIVETST_Stencil(void);
+static void eDSP_DERIVATIVETST_Reference(void);
+static void eDSP_DERIVATIVETST_Overflow(void);
+static void eDSP_DERIVATIVETST_Saturate(void);
+static void eDSP_DERIVATIVETST_BlockVsSample(void);
+static bool_t eDSP_DERIVATIVETST_CheckPoly(const e_eDSP_DERIVATIVE_STENCIL p_eStencil, const int64_t* p_piValues,
+                                           const uint32_t p_uNValues, const uint32_t p_uTime,
+                                           const int64_t p_iExpected);
+static bool_t eDSP_DERIVATIVETST_CheckRef(const e_eDSP_DERIVATIVE_STENCIL p_eStencil, const uint64_t p_uSeedInit);
+static bool_t eDSP_DERIVATIVETST_CheckBlock(const e_eDSP_DERIVATIVE_STENCIL p_eStencil,
+                                            const e_eDSP_TYPE_OVFMODE p_eOvfMode, const uint64_t p_uSeedInit);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_DERIVATIVETST_ExeTest(void)
+{
+	(void)printf("\n\nDERIVATIVE TEST START \n\n");
+
+    eDSP_DERIVATIVETST_BadPointer();
+    eDSP_DERIVATIVETST_BadInit();
+    eDSP_DERIVATIVETST_BadParamEntr();
+    eDSP_DERIVATIVETST_CorruptedContext();
+    eDSP_DERIVATIVETST_Stencil();
+    eDSP_DERIVATIVETST_Reference();
+    eDSP_DERIVATIVETST_Overflow();
+    eDSP_DERIVATIVETST_Saturate();
+    eDSP_DERIVATIVETST_BlockVsSample();
+
+    (void)printf("\n\nDERIVATIVE TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_DERIVATIVETST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_DERIVATIVE_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    uint32_t l_auTimes[2u] = { 1u, 1u };
+    int64_t  l_aiDerivate[2u];
+    int64_t  l_iDerivate;
+    uint32_t l_uNDerivate;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( e_eDSP_DERIVATIVE_RES_BADPOINTER == eDSP_DERIVATIVE_InitCtx(NULL, e_eDSP_DERIVATIVE_STENCIL_BACKWARD) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DERIVATIVE_RES_BADPOINTER == eDSP_DERIVATIVE_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_DERIVATIVE_RES_BADPOINTER == eDSP_DERIVATIVE_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DERIVATIVE_RES_BADPOINTER ==
+          eDSP_DERIVATIVE_InsertValueAndGetDerivate(NULL, 1, 1u, &l_iDerivate) ) &&
+        ( e_eDSP_DERIVATIVE_RES_BADPOINTER == eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, 1, 1u, NULL) ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DERIVATIVE_RES_BADPOINTER ==
+          eDSP_DERIVATIVE_ProcessBlock(NULL, l_aiValues, l_auTimes, 2u, l_aiDerivate, &l_uNDerivate,
+                                       &l_uNProcessed) ) &&
+        ( e_eDSP_DERIVATIVE_RES_BADPOINTER ==
+          eDSP_DERIVATIVE_ProcessBlock(&l_tCtx, NULL, l_auTimes, 2u, l_aiDerivate, &l_uNDerivate, &l_uNProcessed) ) &&
+        ( e_eDSP_DERIVATIVE_RES_BADPOINTER ==
+          eDSP_DERIVATIVE_ProcessBlock(&l_tCtx, l_aiValues, NULL, 2u, l_aiDerivate, &l_uNDerivate, &l_uNProcessed) ) &&
+        ( e_eDSP_DERIVATIVE_RES_BADPOINTER ==
+          eDSP_DERIVATIVE_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 2u, NULL, &l_uNDerivate, &l_uNProcessed) ) &&
+        ( e_eDSP_DERIVATIVE_RES_BADPOINTER ==
+          eDSP_DERIVATIVE_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 2u, l_aiDerivate, NULL, &l_uNProcessed) ) &&
+        ( e_eDSP_DERIVATIVE_RES_BADPOINTER ==
+          eDSP_DERIVATIVE_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 2u, l_aiDerivate, &l_uNDerivate, NULL) ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DERIVATIVE_RES_BADPOINTER == eDSP_DERIVATIVE_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_DERIVATIVE_RES_BADPOINTER == eDSP_DERIVATIVE_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_DERIVATIVE_RES_BADPOINTER == eDSP_DERIVATIVE_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadPointer 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_DERIVATIVETST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_DERIVATIVE_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    uint32_t l_auTimes[2u] = { 1u, 1u };
+    int64_t  l_aiDerivate[2u];
+    int64_t  l_iDerivate;
+    uint32_t l_uNDerivate;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_DERIVATIVE_RES_OK == eDSP_DERIVATIVE_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DERIVATIVE_RES_NOINITLIB ==
+          eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, 1, 1u, &l_iDerivate) ) &&
+        ( e_eDSP_DERIVATIVE_RES_NOINITLIB ==
+          eDSP_DERIVATIVE_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 2u, l_aiDerivate, &l_uNDerivate,
+                                       &l_uNProcessed) ) &&
+        ( e_eDSP_DERIVATIVE_RES_NOINITLIB == eDSP_DERIVATIVE_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_DERIVATIVE_RES_NOINITLIB == eDSP_DERIVATIVE_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadInit 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DERIVATIVE_RES_OK == eDSP_DERIVATIVE_InitCtx(&l_tCtx, e_eDSP_DERIVATIVE_STENCIL_SAVGOL) ) &&
+        ( e_eDSP_DERIVATIVE_RES_OK == eDSP_DERIVATIVE_IsInit(&l_tCtx, &l_bIsInit) ) && ( true == l_bIsInit ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadInit 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_DERIVATIVETST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_DERIVATIVE_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 9, 2 };
+    uint32_t l_auTimes[2u] = { 1u, 1u };
+    int64_t  l_aiDerivate[2u];
+    int64_t  l_iDerivate;
+    uint32_t l_uNDerivate;
+    uint32_t l_uNProcessed;
+
+    /* Function */
+    if( e_eDSP_DERIVATIVE_RES_BADPARAM == eDSP_DERIVATIVE_InitCtx(&l_tCtx, (e_eDSP_DERIVATIVE_STENCIL) 4) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* A value without time is refused and not inserted */
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtx, e_eDSP_DERIVATIVE_STENCIL_BACKWARD);
+    if( ( e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE ==
+          eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, 3, 1u, &l_iDerivate) ) &&
+        ( e_eDSP_DERIVATIVE_RES_BADPARAM ==
+          eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, 100, 0u, &l_iDerivate) ) &&
+        ( e_eDSP_DERIVATIVE_RES_OK == eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, 7, 2u, &l_iDerivate) ) &&
+        ( 2 == l_iDerivate ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eDSP_DERIVATIVE_RES_BADPARAM ==
+        eDSP_DERIVATIVE_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 0u, l_aiDerivate, &l_uNDerivate, &l_uNProcessed) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    /* The block stop at the value without time */
+    l_auTimes[1u] = 0u;
+    if( ( e_eDSP_DERIVATIVE_RES_BADPARAM ==
+          eDSP_DERIVATIVE_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 2u, l_aiDerivate, &l_uNDerivate,
+                                       &l_uNProcessed) ) &&
+        ( 1u == l_uNDerivate ) && ( 2 == l_aiDerivate[0u] ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    if( e_eDSP_DERIVATIVE_RES_BADPARAM == eDSP_DERIVATIVE_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BadParamEntr 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_DERIVATIVETST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_DERIVATIVE_Ctx l_tCtx;
+    int64_t  l_iDerivate;
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtx, e_eDSP_DERIVATIVE_STENCIL_CENTRAL);
+    l_tCtx.eStencil = (e_eDSP_DERIVATIVE_STENCIL) 9;
+    if( e_eDSP_DERIVATIVE_RES_CORRUPTCTX == eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, 1, 1u, &l_iDerivate) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtx, e_eDSP_DERIVATIVE_STENCIL_CENTRAL);
+    l_tCtx.uNPoints = 4u;
+    if( e_eDSP_DERIVATIVE_RES_CORRUPTCTX == eDSP_DERIVATIVE_GetSatCnt(&l_tCtx, &l_uSatCnt) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    /* The positions not filled yet are zero, the filled ones have a time */
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtx, e_eDSP_DERIVATIVE_STENCIL_FIVEPOINT);
+    (void)eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, 1, 1u, &l_iDerivate);
+    l_tCtx.aiValues[0u] = 5;
+    if( e_eDSP_DERIVATIVE_RES_CORRUPTCTX == eDSP_DERIVATIVE_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtx, e_eDSP_DERIVATIVE_STENCIL_FIVEPOINT);
+    (void)eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, 1, 1u, &l_iDerivate);
+    l_tCtx.uFilledData = 2u;
+    if( e_eDSP_DERIVATIVE_RES_CORRUPTCTX == eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, 1, 1u, &l_iDerivate) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_CorruptedContext 4  -- FAIL \n");
+    }
+
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtx, e_eDSP_DERIVATIVE_STENCIL_BACKWARD);
+    l_tCtx.eOvfMode = (e_eDSP_TYPE_OVFMODE) 5;
+    if( e_eDSP_DERIVATIVE_RES_CORRUPTCTX == eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, 1, 1u, &l_iDerivate) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_CorruptedContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_CorruptedContext 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_DERIVATIVETST_Stencil(void)
+{
+    /* Local variable */
+    const int64_t l_aiLine[2u] = { 5, 11 };
+    const int64_t l_aiSquare[7u] = { 0, 4, 16, 36, 64, 100, 144 };
+    const int64_t l_aiCube[5u] = { 0, 1, 8, 27, 64 };
+
+    /* Function */
+    /* 3 * t + 5 with h = 2 */
+    if( true == eDSP_DERIVATIVETST_CheckPoly(e_eDSP_DERIVATIVE_STENCIL_BACKWARD, l_aiLine, 2u, 2u, 3) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Stencil 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Stencil 1  -- FAIL \n");
+    }
+
+    /* t^2 with h = 2, the central stencil refer to the middle of the window, t = 2 */
+    if( true == eDSP_DERIVATIVETST_CheckPoly(e_eDSP_DERIVATIVE_STENCIL_CENTRAL, l_aiSquare, 3u, 2u, 4) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Stencil 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Stencil 2  -- FAIL \n");
+    }
+
+    /* t^3 with h = 1 in t = 2 */
+    if( true == eDSP_DERIVATIVETST_CheckPoly(e_eDSP_DERIVATIVE_STENCIL_FIVEPOINT, l_aiCube, 5u, 1u, 12) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Stencil 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Stencil 3  -- FAIL \n");
+    }
+
+    /* t^2 with h = 2 in t = 6 */
+    if( true == eDSP_DERIVATIVETST_CheckPoly(e_eDSP_DERIVATIVE_STENCIL_SAVGOL, l_aiSquare, 7u, 2u, 12) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Stencil 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Stencil 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_DERIVATIVETST_Reference(void)
+{
+    /* Function */
+    if( ( true == eDSP_DERIVATIVETST_CheckRef(e_eDSP_DERIVATIVE_STENCIL_BACKWARD, 0x243F6A8885A308D3u) ) &&
+        ( true == eDSP_DERIVATIVETST_CheckRef(e_eDSP_DERIVATIVE_STENCIL_CENTRAL, 0x13198A2E03707344u) ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Reference 1  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_DERIVATIVETST_CheckRef(e_eDSP_DERIVATIVE_STENCIL_FIVEPOINT, 0xA4093822299F31D0u) ) &&
+        ( true == eDSP_DERIVATIVETST_CheckRef(e_eDSP_DERIVATIVE_STENCIL_SAVGOL, 0x082EFA98EC4E6C89u) ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Reference 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Reference 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_DERIVATIVETST_Overflow(void)
+{
+    /* Local variable */
+    t_eDSP_DERIVATIVE_Ctx l_tCtx;
+    int64_t  l_iDerivate;
+
+    /* Function */
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtx, e_eDSP_DERIVATIVE_STENCIL_BACKWARD);
+    (void)eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, MIN_INT64VAL, 1u, &l_iDerivate);
+    if( e_eDSP_DERIVATIVE_RES_OVERFLOW ==
+        eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, MAX_INT64VAL, 1u, &l_iDerivate) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Overflow 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Overflow 1  -- FAIL \n");
+    }
+
+    /* The value is inserted anyway */
+    if( ( e_eDSP_DERIVATIVE_RES_OK ==
+          eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, MAX_INT64VAL, 1u, &l_iDerivate) ) &&
+        ( 0 == l_iDerivate ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Overflow 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Overflow 2  -- FAIL \n");
+    }
+
+    /* The weighted sum exceed an int64_t but the derivate doesn't */
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtx, e_eDSP_DERIVATIVE_STENCIL_CENTRAL);
+    (void)eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, MIN_INT64VAL, 1u, &l_iDerivate);
+    (void)eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, 0, 1u, &l_iDerivate);
+    if( ( e_eDSP_DERIVATIVE_RES_OK ==
+          eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, MAX_INT64VAL, 1u, &l_iDerivate) ) &&
+        ( MAX_INT64VAL == l_iDerivate ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Overflow 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Overflow 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_DERIVATIVETST_Saturate(void)
+{
+    /* Local variable */
+    t_eDSP_DERIVATIVE_Ctx l_tCtx;
+    int64_t  l_iDerivate;
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtx, e_eDSP_DERIVATIVE_STENCIL_BACKWARD);
+    (void)eDSP_DERIVATIVE_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE);
+    (void)eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, MIN_INT64VAL, 1u, &l_iDerivate);
+    if( ( e_eDSP_DERIVATIVE_RES_OK ==
+          eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, MAX_INT64VAL, 1u, &l_iDerivate) ) &&
+        ( MAX_INT64VAL == l_iDerivate ) &&
+        ( e_eDSP_DERIVATIVE_RES_OK ==
+          eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, MIN_INT64VAL, 1u, &l_iDerivate) ) &&
+        ( MIN_INT64VAL == l_iDerivate ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Saturate 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DERIVATIVE_RES_OK == eDSP_DERIVATIVE_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 2u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Saturate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Saturate 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_DERIVATIVE_RES_OK == eDSP_DERIVATIVE_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) ) &&
+        ( e_eDSP_DERIVATIVE_RES_OK == eDSP_DERIVATIVE_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_Saturate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_Saturate 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_DERIVATIVETST_BlockVsSample(void)
+{
+    /* Function */
+    if( ( true == eDSP_DERIVATIVETST_CheckBlock(e_eDSP_DERIVATIVE_STENCIL_BACKWARD, e_eDSP_TYPE_OVFMODE_ERROR,
+                                                0x452821E638D01377u) ) &&
+        ( true == eDSP_DERIVATIVETST_CheckBlock(e_eDSP_DERIVATIVE_STENCIL_CENTRAL, e_eDSP_TYPE_OVFMODE_ERROR,
+                                                0xBE5466CF34E90C6Cu) ) &&
+        ( true == eDSP_DERIVATIVETST_CheckBlock(e_eDSP_DERIVATIVE_STENCIL_FIVEPOINT, e_eDSP_TYPE_OVFMODE_ERROR,
+                                                0xC0AC29B7C97C50DDu) ) &&
+        ( true == eDSP_DERIVATIVETST_CheckBlock(e_eDSP_DERIVATIVE_STENCIL_SAVGOL, e_eDSP_TYPE_OVFMODE_ERROR,
+                                                0x3F84D5B5B5470917u) ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BlockVsSample 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BlockVsSample 1  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_DERIVATIVETST_CheckBlock(e_eDSP_DERIVATIVE_STENCIL_BACKWARD, e_eDSP_TYPE_OVFMODE_SATURATE,
+                                                0x9216D5D98979FB1Bu) ) &&
+        ( true == eDSP_DERIVATIVETST_CheckBlock(e_eDSP_DERIVATIVE_STENCIL_FIVEPOINT, e_eDSP_TYPE_OVFMODE_SATURATE,
+                                                0xD1310BA698DFB5ACu) ) &&
+        ( true == eDSP_DERIVATIVETST_CheckBlock(e_eDSP_DERIVATIVE_STENCIL_SAVGOL, e_eDSP_TYPE_OVFMODE_SATURATE,
+                                                0x2FFD72DBD01ADFB7u) ) )
+    {
+        (void)printf("eDSP_DERIVATIVETST_BlockVsSample 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_DERIVATIVETST_BlockVsSample 2  -- FAIL \n");
+    }
+}
+
+static bool_t eDSP_DERIVATIVETST_CheckPoly(const e_eDSP_DERIVATIVE_STENCIL p_eStencil, const int64_t* p_piValues,
+                                           const uint32_t p_uNValues, const uint32_t p_uTime,
+                                           const int64_t p_iExpected)
+{
+    /* Local variable */
+    t_eDSP_DERIVATIVE_Ctx l_tCtx;
+    int64_t  l_iDerivate;
+    e_eDSP_DERIVATIVE_RES l_eRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_iDerivate = 0;
+    l_eRes = e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE;
+
+    /* Function */
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtx, p_eStencil);
+
+    /* The derivate is available only when the window of the stencil is full */
+    for(uint32_t i = 0u; i < p_uNValues; i++)
+    {
+        l_eRes = eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, p_piValues[i], p_uTime, &l_iDerivate);
+
+        if( ( ( i + 1u ) < p_uNValues ) && ( e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE != l_eRes ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( ( e_eDSP_DERIVATIVE_RES_OK != l_eRes ) || ( p_iExpected != l_iDerivate ) )
+    {
+        l_bTestOk = false;
+    }
+
+    return l_bTestOk;
+}
+
+static bool_t eDSP_DERIVATIVETST_CheckRef(const e_eDSP_DERIVATIVE_STENCIL p_eStencil, const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    static const int64_t l_aaiWeight[4u][7u] =
+    {
+        { -1,  1,  0,  0,  0,  0,  0 },
+        { -1,  0,  1,  0,  0,  0,  0 },
+        {  1, -8,  0,  8, -1,  0,  0 },
+        { -3, -2, -1,  0,  1,  2,  3 }
+    };
+    static const int64_t l_aiNorm[4u] = { 1, 2, 12, 28 };
+    static const uint32_t l_auNPoints[4u] = { 2u, 3u, 5u, 7u };
+    t_eDSP_DERIVATIVE_Ctx l_tCtx;
+    int64_t  l_aiValues[300u];
+    uint32_t l_auTimes[300u];
+    int64_t  l_iDerivate;
+    int64_t  l_iSum;
+    int64_t  l_iTime;
+    uint32_t l_uNPoints;
+    uint32_t l_uFirst;
+    uint64_t l_uSeed;
+    e_eDSP_DERIVATIVE_RES l_eRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+    l_uNPoints = l_auNPoints[p_eStencil];
+
+    /* Function */
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtx, p_eStencil);
+
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_aiValues[i] = ( (int64_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 2000001u ) ) - 1000000;
+        l_auTimes[i] = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 1000u );
+
+        l_eRes = eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtx, l_aiValues[i], l_auTimes[i], &l_iDerivate);
+
+        if( ( i + 1u ) < l_uNPoints )
+        {
+            if( e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE != l_eRes )
+            {
+                l_bTestOk = false;
+            }
+        }
+        else
+        {
+            /* SUM[ w(k) * ( points - 1 ) * value(k) ] / ( norm * time of the window ), truncated toward zero */
+            l_uFirst = ( i + 1u ) - l_uNPoints;
+            l_iSum = 0;
+            l_iTime = 0;
+
+            for(uint32_t k = 0u; k < l_uNPoints; k++)
+            {
+                l_iSum += l_aaiWeight[p_eStencil][k] * ( (int64_t) ( l_uNPoints - 1u ) ) * l_aiValues[l_uFirst + k];
+
+                if( k > 0u )
+                {
+                    l_iTime += (int64_t) l_auTimes[l_uFirst + k];
+                }
+            }
+
+            if( ( e_eDSP_DERIVATIVE_RES_OK != l_eRes ) ||
+                ( ( l_iSum / ( l_aiNorm[p_eStencil] * l_iTime ) ) != l_iDerivate ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+
+    return l_bTestOk;
+}
+
+static bool_t eDSP_DERIVATIVETST_CheckBlock(const e_eDSP_DERIVATIVE_STENCIL p_eStencil,
+                                            const e_eDSP_TYPE_OVFMODE p_eOvfMode, const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_DERIVATIVE_Ctx l_tCtxBlock;
+    t_eDSP_DERIVATIVE_Ctx l_tCtxSample;
+    int64_t  l_aiValues[64u];
+    uint32_t l_auTimes[64u];
+    int64_t  l_aiDerivate[64u];
+    int64_t  l_iDerivate;
+    uint32_t l_uNDerivate;
+    uint32_t l_uNProcessed;
+    uint32_t l_uNBlock;
+    uint32_t l_uNSample;
+    uint32_t l_uNSampleIn;
+    uint64_t l_uSeed;
+    e_eDSP_DERIVATIVE_RES l_eBlockRes;
+    e_eDSP_DERIVATIVE_RES l_eSampleRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+
+    /* Function */
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtxBlock, p_eStencil);
+    (void)eDSP_DERIVATIVE_InitCtx(&l_tCtxSample, p_eStencil);
+    (void)eDSP_DERIVATIVE_SetOvfMode(&l_tCtxBlock, p_eOvfMode);
+    (void)eDSP_DERIVATIVE_SetOvfMode(&l_tCtxSample, p_eOvfMode);
+
+    /* Small values take the windows calculated inside the pre-scanned block, full range values with short times
+       reach the limits */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uNBlock = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 64u );
+
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            if( 0u == ( i % 4u ) )
+            {
+                l_aiValues[j] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+                l_auTimes[j] = 1u;
+            }
+            else
+            {
+                l_aiValues[j] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 24u;
+                l_auTimes[j] = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 1000u );
+            }
+        }
+
+        l_eBlockRes = eDSP_DERIVATIVE_ProcessBlock(&l_tCtxBlock, l_aiValues, l_auTimes, l_uNBlock, l_aiDerivate,
+                                                   &l_uNDerivate, &l_uNProcessed);
+
+        /* Processing stop at the first error, feed the same values one by one */
+        l_uNSample = 0u;
+        l_uNSampleIn = 0u;
+        l_eSampleRes = e_eDSP_DERIVATIVE_RES_NEEDSMOREVALUE;
+        for(uint32_t j = 0u; ( ( j < l_uNBlock ) && ( e_eDSP_DERIVATIVE_RES_OVERFLOW != l_eSampleRes ) ); j++)
+        {
+            l_eSampleRes = eDSP_DERIVATIVE_InsertValueAndGetDerivate(&l_tCtxSample, l_aiValues[j], l_auTimes[j],
+                                                                     &l_iDerivate);
+
+            l_uNSampleIn++;
+
+            if( e_eDSP_DERIVATIVE_RES_OK == l_eSampleRes )
+            {
+                if( ( l_uNSample >= l_uNDerivate ) || ( l_aiDerivate[l_uNSample] != l_iDerivate ) )
+                {
+                    l_bTestOk = false;
+                }
+
+                l_uNSample++;
+            }
+        }
+
+        if( ( l_uNSample != l_uNDerivate ) || ( l_uNSampleIn != l_uNProcessed ) ||
+            ( ( e_eDSP_DERIVATIVE_RES_OVERFLOW == l_eBlockRes ) &&
+              ( e_eDSP_DERIVATIVE_RES_OVERFLOW != l_eSampleRes ) ) )
+        {
+            l_bTestOk = false;
+        }
+
+        /* Start again from the same state after an overflow */
+        if( e_eDSP_DERIVATIVE_RES_OVERFLOW == l_eSampleRes )
+        {
+            (void)eDSP_DERIVATIVE_InitCtx(&l_tCtxBlock, p_eStencil);
+            (void)eDSP_DERIVATIVE_InitCtx(&l_tCtxSample, p_eStencil);
+        }
+    }
+
+    return l_bTestOk;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
@@ -0,0 +1,783 @@
+/**
+ * @file       eDSP_INTEGRALTST.c
+ *
+ * @brief      Integral test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_INTEGRALTST.h"
+#include "eDSP_INTEGRAL.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_INTEGRALTST_BadPointer(void);
+static void eDSP_INTEGRALTST_BadInit(void);
+static void eDSP_INTEGRALTST_BadParamEntr(void);
+static void eDSP_INTEGRALTST_CorruptedContext(void);
+static void eDSP_INTEGRALTST_Rule(void);
+static void eDSP_INTEGRALTST_Reference(void);
+static void eDSP_INTEGRALTST_Overflow(void);
+static void eDSP_INTEGRALTST_Saturate(void);
+static void eDSP_INTEGRALTST_BlockVsSample(void);
+static bool_t eDSP_INTEGRALTST_CheckRef(const e_eDSP_INTEGRAL_RULE p_eRule, const uint64_t p_uSeedInit);
+static bool_t eDSP_INTEGRALTST_CheckBlock(const e_eDSP_INTEGRAL_RULE p_eRule, const e_eDSP_TYPE_OVFMODE p_eOvfMode,
+                                          const uint64_t p_uSeedInit);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_INTEGRALTST_ExeTest(void)
+{
+	(void)printf("\n\nINTEGRAL TEST START \n\n");
+
+    eDSP_INTEGRALTST_BadPointer();
+    eDSP_INTEGRALTST_BadInit();
+    eDSP_INTEGRALTST_BadParamEntr();
+    eDSP_INTEGRALTST_CorruptedContext();
+    eDSP_INTEGRALTST_Rule();
+    eDSP_INTEGRALTST_Reference();
+    eDSP_INTEGRALTST_Overflow();
+    eDSP_INTEGRALTST_Saturate();
+    eDSP_INTEGRALTST_BlockVsSample();
+
+    (void)printf("\n\nINTEGRAL TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_INTEGRALTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_INTEGRAL_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    uint32_t l_auTimes[2u] = { 1u, 1u };
+    int64_t  l_aiIntegral[2u];
+    int64_t  l_iIntegral;
+    uint32_t l_uNIntegral;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Function */
+    if( e_eDSP_INTEGRAL_RES_BADPOINTER == eDSP_INTEGRAL_InitCtx(NULL, e_eDSP_INTEGRAL_RULE_LEFT) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_INTEGRAL_RES_BADPOINTER == eDSP_INTEGRAL_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_INTEGRAL_RES_BADPOINTER == eDSP_INTEGRAL_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_INTEGRAL_RES_BADPOINTER == eDSP_INTEGRAL_InsertValueAndCalcIntegral(NULL, 1, 1u, &l_iIntegral) ) &&
+        ( e_eDSP_INTEGRAL_RES_BADPOINTER == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 1, 1u, NULL) ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_INTEGRAL_RES_BADPOINTER ==
+          eDSP_INTEGRAL_ProcessBlock(NULL, l_aiValues, l_auTimes, 2u, l_aiIntegral, &l_uNIntegral, &l_uNProcessed) ) &&
+        ( e_eDSP_INTEGRAL_RES_BADPOINTER ==
+          eDSP_INTEGRAL_ProcessBlock(&l_tCtx, NULL, l_auTimes, 2u, l_aiIntegral, &l_uNIntegral, &l_uNProcessed) ) &&
+        ( e_eDSP_INTEGRAL_RES_BADPOINTER ==
+          eDSP_INTEGRAL_ProcessBlock(&l_tCtx, l_aiValues, NULL, 2u, l_aiIntegral, &l_uNIntegral, &l_uNProcessed) ) &&
+        ( e_eDSP_INTEGRAL_RES_BADPOINTER ==
+          eDSP_INTEGRAL_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 2u, NULL, &l_uNIntegral, &l_uNProcessed) ) &&
+        ( e_eDSP_INTEGRAL_RES_BADPOINTER ==
+          eDSP_INTEGRAL_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 2u, l_aiIntegral, NULL, &l_uNProcessed) ) &&
+        ( e_eDSP_INTEGRAL_RES_BADPOINTER ==
+          eDSP_INTEGRAL_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 2u, l_aiIntegral, &l_uNIntegral, NULL) ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_INTEGRAL_RES_BADPOINTER == eDSP_INTEGRAL_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_INTEGRAL_RES_BADPOINTER == eDSP_INTEGRAL_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_INTEGRAL_RES_BADPOINTER == eDSP_INTEGRAL_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadPointer 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_INTEGRALTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_INTEGRAL_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    uint32_t l_auTimes[2u] = { 1u, 1u };
+    int64_t  l_aiIntegral[2u];
+    int64_t  l_iIntegral;
+    uint32_t l_uNIntegral;
+    uint32_t l_uNProcessed;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+
+    /* Function */
+    if( ( e_eDSP_INTEGRAL_RES_OK == eDSP_INTEGRAL_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_INTEGRAL_RES_NOINITLIB == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 1, 1u, &l_iIntegral) ) &&
+        ( e_eDSP_INTEGRAL_RES_NOINITLIB ==
+          eDSP_INTEGRAL_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 2u, l_aiIntegral, &l_uNIntegral,
+                                     &l_uNProcessed) ) &&
+        ( e_eDSP_INTEGRAL_RES_NOINITLIB == eDSP_INTEGRAL_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_INTEGRAL_RES_NOINITLIB == eDSP_INTEGRAL_GetSatCnt(&l_tCtx, &l_uSatCnt) ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_INTEGRAL_RES_OK == eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_SIMPSON) ) &&
+        ( e_eDSP_INTEGRAL_RES_OK == eDSP_INTEGRAL_IsInit(&l_tCtx, &l_bIsInit) ) && ( true == l_bIsInit ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadInit 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_INTEGRALTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_INTEGRAL_Ctx l_tCtx;
+    int64_t  l_aiValues[2u] = { 1, 2 };
+    uint32_t l_auTimes[2u] = { 1u, 1u };
+    int64_t  l_aiIntegral[2u];
+    int64_t  l_iIntegral;
+    uint32_t l_uNIntegral;
+    uint32_t l_uNProcessed;
+
+    /* Function */
+    if( e_eDSP_INTEGRAL_RES_BADPARAM == eDSP_INTEGRAL_InitCtx(&l_tCtx, (e_eDSP_INTEGRAL_RULE) 4) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* A value without time is refused and not inserted */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_RIGHT);
+    if( ( e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE ==
+          eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 3, 1u, &l_iIntegral) ) &&
+        ( e_eDSP_INTEGRAL_RES_BADPARAM == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 100, 0u, &l_iIntegral) ) &&
+        ( e_eDSP_INTEGRAL_RES_OK == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 5, 2u, &l_iIntegral) ) &&
+        ( 10 == l_iIntegral ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eDSP_INTEGRAL_RES_BADPARAM ==
+        eDSP_INTEGRAL_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 0u, l_aiIntegral, &l_uNIntegral, &l_uNProcessed) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    /* The block stop at the value without time */
+    l_auTimes[1u] = 0u;
+    if( ( e_eDSP_INTEGRAL_RES_BADPARAM ==
+          eDSP_INTEGRAL_ProcessBlock(&l_tCtx, l_aiValues, l_auTimes, 2u, l_aiIntegral, &l_uNIntegral,
+                                     &l_uNProcessed) ) &&
+        ( 1u == l_uNIntegral ) && ( 11 == l_aiIntegral[0u] ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    if( e_eDSP_INTEGRAL_RES_BADPARAM == eDSP_INTEGRAL_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BadParamEntr 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_INTEGRALTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_INTEGRAL_Ctx l_tCtx;
+    int64_t  l_iIntegral;
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_LEFT);
+    l_tCtx.eRule = (e_eDSP_INTEGRAL_RULE) 7;
+    if( e_eDSP_INTEGRAL_RES_CORRUPTCTX == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 1, 1u, &l_iIntegral) )
+    {
+        (void)printf("eDSP_INTEGRALTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_LEFT);
+    l_tCtx.uIntegral = 3;
+    if( e_eDSP_INTEGRAL_RES_CORRUPTCTX == eDSP_INTEGRAL_GetSatCnt(&l_tCtx, &l_uSatCnt) )
+    {
+        (void)printf("eDSP_INTEGRALTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    /* The accumulator can't exceed the unit of the rule times the int64_t limits */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_LEFT);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 1, 1u, &l_iIntegral);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 1, 1u, &l_iIntegral);
+    l_tCtx.iAccHigh = 5;
+    if( e_eDSP_INTEGRAL_RES_CORRUPTCTX == eDSP_INTEGRAL_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) )
+    {
+        (void)printf("eDSP_INTEGRALTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    /* Only the Simpson rule leave a pair open */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_TRAPEZOID);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 1, 1u, &l_iIntegral);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 1, 1u, &l_iIntegral);
+    l_tCtx.bIsPairOpen = true;
+    if( e_eDSP_INTEGRAL_RES_CORRUPTCTX == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 1, 1u, &l_iIntegral) )
+    {
+        (void)printf("eDSP_INTEGRALTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_CorruptedContext 4  -- FAIL \n");
+    }
+
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_LEFT);
+    l_tCtx.eOvfMode = (e_eDSP_TYPE_OVFMODE) 5;
+    if( e_eDSP_INTEGRAL_RES_CORRUPTCTX == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 1, 1u, &l_iIntegral) )
+    {
+        (void)printf("eDSP_INTEGRALTST_CorruptedContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_CorruptedContext 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_INTEGRALTST_Rule(void)
+{
+    /* Local variable */
+    t_eDSP_INTEGRAL_Ctx l_tCtx;
+    int64_t  l_iIntegral1;
+    int64_t  l_iIntegral2;
+
+    /* Function */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_LEFT);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 4, 1u, &l_iIntegral1);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 10, 3u, &l_iIntegral1);
+    if( 12 == l_iIntegral1 )
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 1  -- FAIL \n");
+    }
+
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_RIGHT);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 4, 1u, &l_iIntegral1);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 10, 3u, &l_iIntegral1);
+    if( 30 == l_iIntegral1 )
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 2  -- FAIL \n");
+    }
+
+    /* Half are kept between the steps, and the returned integral is truncated toward zero */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_TRAPEZOID);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 0, 1u, &l_iIntegral1);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 1, 1u, &l_iIntegral1);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 2, 1u, &l_iIntegral2);
+    if( ( 0 == l_iIntegral1 ) && ( 2 == l_iIntegral2 ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 3  -- FAIL \n");
+    }
+
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_TRAPEZOID);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 0, 1u, &l_iIntegral1);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, -1, 1u, &l_iIntegral1);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, -2, 1u, &l_iIntegral2);
+    if( ( 0 == l_iIntegral1 ) && ( -2 == l_iIntegral2 ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 4  -- FAIL \n");
+    }
+
+    /* Simpson is exact for x^3 sampled at 0, 3 and 6, the open half use the trapezoid */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_SIMPSON);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 0, 1u, &l_iIntegral1);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 27, 3u, &l_iIntegral1);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 216, 3u, &l_iIntegral2);
+    if( ( 40 == l_iIntegral1 ) && ( 324 == l_iIntegral2 ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 5  -- FAIL \n");
+    }
+
+    /* A pair with two different times use the trapezoid on both intervals */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_SIMPSON);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 0, 1u, &l_iIntegral1);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 27, 3u, &l_iIntegral1);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 216, 4u, &l_iIntegral2);
+    if( ( 40 == l_iIntegral1 ) && ( 526 == l_iIntegral2 ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Rule 6  -- FAIL \n");
+    }
+}
+
+static void eDSP_INTEGRALTST_Reference(void)
+{
+    /* Function */
+    if( ( true == eDSP_INTEGRALTST_CheckRef(e_eDSP_INTEGRAL_RULE_LEFT, 0x243F6A8885A308D3u) ) &&
+        ( true == eDSP_INTEGRALTST_CheckRef(e_eDSP_INTEGRAL_RULE_RIGHT, 0x13198A2E03707344u) ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Reference 1  -- FAIL \n");
+    }
+
+    if( true == eDSP_INTEGRALTST_CheckRef(e_eDSP_INTEGRAL_RULE_TRAPEZOID, 0xA4093822299F31D0u) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Reference 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Reference 2  -- FAIL \n");
+    }
+
+    if( true == eDSP_INTEGRALTST_CheckRef(e_eDSP_INTEGRAL_RULE_SIMPSON, 0x082EFA98EC4E6C89u) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Reference 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Reference 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_INTEGRALTST_Overflow(void)
+{
+    /* Local variable */
+    t_eDSP_INTEGRAL_Ctx l_tCtx;
+    int64_t  l_iIntegral;
+
+    /* Function */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_LEFT);
+    if( ( e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE ==
+          eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, MAX_INT64VAL, 1u, &l_iIntegral) ) &&
+        ( e_eDSP_INTEGRAL_RES_OVERFLOW == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 0, 2u, &l_iIntegral) ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Overflow 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Overflow 1  -- FAIL \n");
+    }
+
+    /* The value is inserted, but the interval that overflow is not integrated */
+    if( ( e_eDSP_INTEGRAL_RES_OK == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 9, 1u, &l_iIntegral) ) &&
+        ( 0 == l_iIntegral ) &&
+        ( e_eDSP_INTEGRAL_RES_OK == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 0, 2u, &l_iIntegral) ) &&
+        ( 18 == l_iIntegral ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Overflow 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Overflow 2  -- FAIL \n");
+    }
+
+    /* The integral reach the limit in more steps */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_RIGHT);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 0, 1u, &l_iIntegral);
+    if( ( e_eDSP_INTEGRAL_RES_OK ==
+          eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, MAX_INT64VAL / 4, 2u, &l_iIntegral) ) &&
+        ( e_eDSP_INTEGRAL_RES_OK ==
+          eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, MAX_INT64VAL / 4, 2u, &l_iIntegral) ) &&
+        ( ( MAX_INT64VAL - 3 ) == l_iIntegral ) &&
+        ( e_eDSP_INTEGRAL_RES_OVERFLOW ==
+          eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, MAX_INT64VAL / 4, 2u, &l_iIntegral) ) &&
+        ( e_eDSP_INTEGRAL_RES_OK ==
+          eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, -( MAX_INT64VAL / 4 ), 2u, &l_iIntegral) ) &&
+        ( ( ( MAX_INT64VAL / 4 ) * 2 ) == l_iIntegral ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Overflow 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Overflow 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_INTEGRALTST_Saturate(void)
+{
+    /* Local variable */
+    t_eDSP_INTEGRAL_Ctx l_tCtx;
+    int64_t  l_iIntegral;
+    uint32_t l_uSatCnt;
+
+    /* Function */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, e_eDSP_INTEGRAL_RULE_LEFT);
+    (void)eDSP_INTEGRAL_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE);
+    (void)eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, MAX_INT64VAL, 1u, &l_iIntegral);
+    if( ( e_eDSP_INTEGRAL_RES_OK == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, -5, 2u, &l_iIntegral) ) &&
+        ( MAX_INT64VAL == l_iIntegral ) &&
+        ( e_eDSP_INTEGRAL_RES_OK == eDSP_INTEGRAL_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 1u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Saturate 1  -- FAIL \n");
+    }
+
+    /* The accumulator is clamped too, so the integral leave the limit as soon as the values change sign */
+    if( ( e_eDSP_INTEGRAL_RES_OK == eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, 0, 1u, &l_iIntegral) ) &&
+        ( ( MAX_INT64VAL - 5 ) == l_iIntegral ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Saturate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Saturate 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_INTEGRAL_RES_OK == eDSP_INTEGRAL_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) ) &&
+        ( e_eDSP_INTEGRAL_RES_OK == eDSP_INTEGRAL_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_Saturate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_Saturate 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_INTEGRALTST_BlockVsSample(void)
+{
+    /* Function */
+    if( ( true == eDSP_INTEGRALTST_CheckBlock(e_eDSP_INTEGRAL_RULE_LEFT, e_eDSP_TYPE_OVFMODE_ERROR,
+                                              0x452821E638D01377u) ) &&
+        ( true == eDSP_INTEGRALTST_CheckBlock(e_eDSP_INTEGRAL_RULE_RIGHT, e_eDSP_TYPE_OVFMODE_ERROR,
+                                              0xBE5466CF34E90C6Cu) ) &&
+        ( true == eDSP_INTEGRALTST_CheckBlock(e_eDSP_INTEGRAL_RULE_TRAPEZOID, e_eDSP_TYPE_OVFMODE_ERROR,
+                                              0xC0AC29B7C97C50DDu) ) &&
+        ( true == eDSP_INTEGRALTST_CheckBlock(e_eDSP_INTEGRAL_RULE_SIMPSON, e_eDSP_TYPE_OVFMODE_ERROR,
+                                              0x3F84D5B5B5470917u) ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BlockVsSample 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BlockVsSample 1  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_INTEGRALTST_CheckBlock(e_eDSP_INTEGRAL_RULE_LEFT, e_eDSP_TYPE_OVFMODE_SATURATE,
+                                              0x9216D5D98979FB1Bu) ) &&
+        ( true == eDSP_INTEGRALTST_CheckBlock(e_eDSP_INTEGRAL_RULE_TRAPEZOID, e_eDSP_TYPE_OVFMODE_SATURATE,
+                                              0xD1310BA698DFB5ACu) ) &&
+        ( true == eDSP_INTEGRALTST_CheckBlock(e_eDSP_INTEGRAL_RULE_SIMPSON, e_eDSP_TYPE_OVFMODE_SATURATE,
+                                              0x2FFD72DBD01ADFB7u) ) )
+    {
+        (void)printf("eDSP_INTEGRALTST_BlockVsSample 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_INTEGRALTST_BlockVsSample 2  -- FAIL \n");
+    }
+}
+
+static bool_t eDSP_INTEGRALTST_CheckRef(const e_eDSP_INTEGRAL_RULE p_eRule, const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_INTEGRAL_Ctx l_tCtx;
+    int64_t  l_aiValues[300u];
+    uint32_t l_auTimes[300u];
+    int64_t  l_iIntegral;
+    int64_t  l_iAcc;
+    int64_t  l_iRef;
+    uint64_t l_uSeed;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+    l_iAcc = 0;
+
+    /* Function */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtx, p_eRule);
+
+    /* Values and times small enough to keep the reference, six times the integral, in an int64_t. One time out of
+       three is the same, so that the Simpson rule find pairs with the same time */
+    for(uint32_t i = 0u; i < 300u; i++)
+    {
+        l_aiValues[i] = ( (int64_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 2000001u ) ) - 1000000;
+
+        if( 0u == ( eDSP_TSTRAND_Rand(&l_uSeed) % 3u ) )
+        {
+            l_auTimes[i] = 7u;
+        }
+        else
+        {
+            l_auTimes[i] = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 100u );
+        }
+    }
+
+    if( e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE !=
+        eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, l_aiValues[0u], l_auTimes[0u], &l_iIntegral) )
+    {
+        l_bTestOk = false;
+    }
+
+    for(uint32_t i = 1u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        switch( p_eRule )
+        {
+            case e_eDSP_INTEGRAL_RULE_LEFT:
+            {
+                l_iAcc += l_aiValues[i - 1u] * ( (int64_t) l_auTimes[i] );
+                l_iRef = l_iAcc;
+                break;
+            }
+
+            case e_eDSP_INTEGRAL_RULE_RIGHT:
+            {
+                l_iAcc += l_aiValues[i] * ( (int64_t) l_auTimes[i] );
+                l_iRef = l_iAcc;
+                break;
+            }
+
+            case e_eDSP_INTEGRAL_RULE_TRAPEZOID:
+            {
+                l_iAcc += ( l_aiValues[i - 1u] + l_aiValues[i] ) * ( (int64_t) l_auTimes[i] );
+                l_iRef = l_iAcc / 2;
+                break;
+            }
+
+            default:
+            {
+                /* Pairs of intervals, the open one use the trapezoid */
+                if( 1u == ( i % 2u ) )
+                {
+                    l_iRef = ( l_iAcc +
+                               ( ( l_aiValues[i - 1u] + l_aiValues[i] ) * 3 * ( (int64_t) l_auTimes[i] ) ) ) / 6;
+                }
+                else
+                {
+                    if( l_auTimes[i] == l_auTimes[i - 1u] )
+                    {
+                        l_iAcc += ( l_aiValues[i - 2u] + ( 4 * l_aiValues[i - 1u] ) + l_aiValues[i] ) * 2 *
+                                  ( (int64_t) l_auTimes[i] );
+                    }
+                    else
+                    {
+                        l_iAcc += ( ( l_aiValues[i - 2u] + l_aiValues[i - 1u] ) * 3 *
+                                    ( (int64_t) l_auTimes[i - 1u] ) ) +
+                                  ( ( l_aiValues[i - 1u] + l_aiValues[i] ) * 3 * ( (int64_t) l_auTimes[i] ) );
+                    }
+
+                    l_iRef = l_iAcc / 6;
+                }
+                break;
+            }
+        }
+
+        if( ( e_eDSP_INTEGRAL_RES_OK !=
+              eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtx, l_aiValues[i], l_auTimes[i], &l_iIntegral) ) ||
+            ( l_iRef != l_iIntegral ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    return l_bTestOk;
+}
+
+static bool_t eDSP_INTEGRALTST_CheckBlock(const e_eDSP_INTEGRAL_RULE p_eRule, const e_eDSP_TYPE_OVFMODE p_eOvfMode,
+                                          const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_INTEGRAL_Ctx l_tCtxBlock;
+    t_eDSP_INTEGRAL_Ctx l_tCtxSample;
+    int64_t  l_aiValues[64u];
+    uint32_t l_auTimes[64u];
+    int64_t  l_aiIntegral[64u];
+    int64_t  l_iIntegral;
+    uint32_t l_uNIntegral;
+    uint32_t l_uNProcessed;
+    uint32_t l_uNBlock;
+    uint32_t l_uNSample;
+    uint32_t l_uNSampleIn;
+    uint64_t l_uSeed;
+    e_eDSP_INTEGRAL_RES l_eBlockRes;
+    e_eDSP_INTEGRAL_RES l_eSampleRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+
+    /* Function */
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtxBlock, p_eRule);
+    (void)eDSP_INTEGRAL_InitCtx(&l_tCtxSample, p_eRule);
+    (void)eDSP_INTEGRAL_SetOvfMode(&l_tCtxBlock, p_eOvfMode);
+    (void)eDSP_INTEGRAL_SetOvfMode(&l_tCtxSample, p_eOvfMode);
+
+    /* Small values take the prefix sum of the pre-scanned block, large values and times reach the limits */
+    for(uint32_t i = 0u; ( ( i < 300u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uNBlock = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 64u );
+
+        for(uint32_t j = 0u; j < l_uNBlock; j++)
+        {
+            if( 0u == ( i % 4u ) )
+            {
+                l_aiValues[j] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 12u;
+                l_auTimes[j] = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 0x1000u );
+            }
+            else
+            {
+                l_aiValues[j] = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> 40u;
+                l_auTimes[j] = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 4u );
+            }
+        }
+
+        l_eBlockRes = eDSP_INTEGRAL_ProcessBlock(&l_tCtxBlock, l_aiValues, l_auTimes, l_uNBlock, l_aiIntegral,
+                                                 &l_uNIntegral, &l_uNProcessed);
+
+        /* Processing stop at the first error, feed the same values one by one */
+        l_uNSample = 0u;
+        l_uNSampleIn = 0u;
+        l_eSampleRes = e_eDSP_INTEGRAL_RES_NEEDSMOREVALUE;
+        for(uint32_t j = 0u; ( ( j < l_uNBlock ) && ( e_eDSP_INTEGRAL_RES_OVERFLOW != l_eSampleRes ) ); j++)
+        {
+            l_eSampleRes = eDSP_INTEGRAL_InsertValueAndCalcIntegral(&l_tCtxSample, l_aiValues[j], l_auTimes[j],
+                                                                    &l_iIntegral);
+
+            l_uNSampleIn++;
+
+            if( e_eDSP_INTEGRAL_RES_OK == l_eSampleRes )
+            {
+                if( ( l_uNSample >= l_uNIntegral ) || ( l_aiIntegral[l_uNSample] != l_iIntegral ) )
+                {
+                    l_bTestOk = false;
+                }
+
+                l_uNSample++;
+            }
+        }
+
+        if( ( l_uNSample != l_uNIntegral ) || ( l_uNSampleIn != l_uNProcessed ) ||
+            ( ( e_eDSP_INTEGRAL_RES_OVERFLOW == l_eBlockRes ) && ( e_eDSP_INTEGRAL_RES_OVERFLOW != l_eSampleRes ) ) )
+        {
+            l_bTestOk = false;
+        }
+
+        /* Start again from the same state after an overflow */
+        if( e_eDSP_INTEGRAL_RES_OVERFLOW == l_eSampleRes )
+        {
+            (void)eDSP_INTEGRAL_InitCtx(&l_tCtxBlock, p_eRule);
+            (void)eDSP_INTEGRAL_InitCtx(&l_tCtxSample, p_eRule);
+        }
+    }
+
+    return l_bTestOk;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
@@ -0,0 +1,1073 @@
+/**
+ * @file       eDSP_M2DPI64LINEARTST.c
+ *
+ * @brief      Multiple 2D point linearization test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_M2DPI64LINEARTST.h"
+#include "eDSP_M2DPI64LINEAR.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_M2DPI64LINEARTST_BadPointer(void);
+static void eDSP_M2DPI64LINEARTST_BadInit(void);
+static void eDSP_M2DPI64LINEARTST_BadParamEntr(void);
+static void eDSP_M2DPI64LINEARTST_CorruptedContext(void);
+static void eDSP_M2DPI64LINEARTST_Linearize(void);
+static void eDSP_M2DPI64LINEARTST_Search(void);
+static void eDSP_M2DPI64LINEARTST_Overflow(void);
+static void eDSP_M2DPI64LINEARTST_Saturate(void);
+static void eDSP_M2DPI64LINEARTST_SlopeTable(void);
+static void eDSP_M2DPI64LINEARTST_Resample(void);
+static void eDSP_M2DPI64LINEARTST_BatchVsSingle(void);
+static void eDSP_M2DPI64LINEARTST_BuildSeries(t_eDSP_TYPE_2DPI64* const p_ptPoints, const uint32_t p_uNPoint,
+                                              const uint32_t p_uStepMode, const bool_t p_bFullRange,
+                                              uint64_t* const p_puSeed);
+static int64_t eDSP_M2DPI64LINEARTST_RefLinearize(const t_eDSP_TYPE_2DPI64* p_ptPoints, const uint32_t p_uNPoint,
+                                                  const int64_t p_iX);
+static int64_t eDSP_M2DPI64LINEARTST_RandX(const t_eDSP_TYPE_2DPI64* p_ptPoints, const uint32_t p_uNPoint,
+                                           uint64_t* const p_puSeed);
+static bool_t eDSP_M2DPI64LINEARTST_CheckRef(const uint32_t p_uStepMode, const e_eDSP_M2DPI64LINEAR_GRID p_eGrid,
+                                             const uint64_t p_uSeedInit);
+static bool_t eDSP_M2DPI64LINEARTST_CheckBatch(const uint32_t p_uStepMode, const e_eDSP_TYPE_OVFMODE p_eOvfMode,
+                                               const uint64_t p_uSeedInit);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_M2DPI64LINEARTST_ExeTest(void)
+{
+	(void)printf("\n\nM2DPI64LINEAR TEST START \n\n");
+
+    eDSP_M2DPI64LINEARTST_BadPointer();
+    eDSP_M2DPI64LINEARTST_BadInit();
+    eDSP_M2DPI64LINEARTST_BadParamEntr();
+    eDSP_M2DPI64LINEARTST_CorruptedContext();
+    eDSP_M2DPI64LINEARTST_Linearize();
+    eDSP_M2DPI64LINEARTST_Search();
+    eDSP_M2DPI64LINEARTST_Overflow();
+    eDSP_M2DPI64LINEARTST_Saturate();
+    eDSP_M2DPI64LINEARTST_SlopeTable();
+    eDSP_M2DPI64LINEARTST_Resample();
+    eDSP_M2DPI64LINEARTST_BatchVsSingle();
+
+    (void)printf("\n\nM2DPI64LINEAR TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_M2DPI64LINEARTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtx;
+    t_eDSP_TYPE_2DPI64 l_atPoints[3u] = { { 0, 0 }, { 10, 100 }, { 20, 0 } };
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tSeries;
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tNullSeries;
+    t_eDSP_M2DPI64LINEAR_Segment l_atSeg[2u];
+    t_eDSP_TYPE_2DPI64 l_atOut[8u];
+    int64_t  l_aiX[2u] = { 1, 2 };
+    int64_t  l_aiY[2u];
+    int64_t  l_iY;
+    uint32_t l_uNLinearized;
+    uint32_t l_uSatCnt;
+    uint32_t l_uNOut;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tSeries.uNumPoint = 3u;
+    l_tSeries.ptPointArray = l_atPoints;
+    l_tNullSeries.uNumPoint = 3u;
+    l_tNullSeries.ptPointArray = NULL;
+
+    /* Function */
+    if( ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_InitCtx(NULL, l_tSeries) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tNullSeries) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_IsInit(NULL, &l_bIsInit) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_IsInit(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_Linearize(NULL, 1, &l_iY) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 1, NULL) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER ==
+          eDSP_M2DPI64LINEAR_LinearizeBatch(NULL, l_aiX, 2u, l_aiY, &l_uNLinearized) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER ==
+          eDSP_M2DPI64LINEAR_LinearizeBatch(&l_tCtx, NULL, 2u, l_aiY, &l_uNLinearized) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER ==
+          eDSP_M2DPI64LINEAR_LinearizeBatch(&l_tCtx, l_aiX, 2u, NULL, &l_uNLinearized) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER ==
+          eDSP_M2DPI64LINEAR_LinearizeBatch(&l_tCtx, l_aiX, 2u, l_aiY, NULL) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_SetOvfMode(NULL, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_GetSatCnt(NULL, &l_uSatCnt) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_GetSatCnt(&l_tCtx, NULL) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_SetSlopeTable(NULL, l_atSeg, 2u) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_SetSlopeTable(&l_tCtx, NULL, 2u) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER == eDSP_M2DPI64LINEAR_Verify(NULL) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER ==
+          eDSP_M2DPI64LINEAR_ResampleUniform(l_tNullSeries, 10u, l_atOut, 8u, &l_uNOut) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER ==
+          eDSP_M2DPI64LINEAR_ResampleUniform(l_tSeries, 10u, NULL, 8u, &l_uNOut) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPOINTER ==
+          eDSP_M2DPI64LINEAR_ResampleUniform(l_tSeries, 10u, l_atOut, 8u, NULL) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadPointer 7  -- FAIL \n");
+    }
+}
+
+static void eDSP_M2DPI64LINEARTST_BadInit(void)
+{
+    /* Local variable */
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtx;
+    t_eDSP_TYPE_2DPI64 l_atPoints[3u] = { { 0, 0 }, { 10, 100 }, { 20, 0 } };
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tSeries;
+    t_eDSP_M2DPI64LINEAR_Segment l_atSeg[2u];
+    int64_t  l_aiX[2u] = { 1, 2 };
+    int64_t  l_aiY[2u];
+    int64_t  l_iY;
+    uint32_t l_uNLinearized;
+    uint32_t l_uSatCnt;
+    bool_t   l_bIsInit;
+
+    /* Init variable */
+    l_tCtx.bIsInit = false;
+    l_tSeries.uNumPoint = 3u;
+    l_tSeries.ptPointArray = l_atPoints;
+
+    /* Function */
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_IsInit(&l_tCtx, &l_bIsInit) ) && ( false == l_bIsInit ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_M2DPI64LINEAR_RES_NOINITLIB == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 1, &l_iY) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_NOINITLIB ==
+          eDSP_M2DPI64LINEAR_LinearizeBatch(&l_tCtx, l_aiX, 2u, l_aiY, &l_uNLinearized) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_NOINITLIB == eDSP_M2DPI64LINEAR_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_NOINITLIB == eDSP_M2DPI64LINEAR_GetSatCnt(&l_tCtx, &l_uSatCnt) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_NOINITLIB == eDSP_M2DPI64LINEAR_SetSlopeTable(&l_tCtx, l_atSeg, 2u) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_NOINITLIB == eDSP_M2DPI64LINEAR_Verify(&l_tCtx) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_IsInit(&l_tCtx, &l_bIsInit) ) && ( true == l_bIsInit ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadInit 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_M2DPI64LINEARTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtx;
+    t_eDSP_TYPE_2DPI64 l_atPoints[4u] = { { 0, 0 }, { 10, 100 }, { 20, 0 }, { 30, 100 } };
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tSeries;
+    t_eDSP_M2DPI64LINEAR_Segment l_atSeg[4u];
+    t_eDSP_TYPE_2DPI64 l_atOut[8u];
+    int64_t  l_aiX[2u] = { 1, 2 };
+    int64_t  l_aiY[2u];
+    uint32_t l_uNLinearized;
+    uint32_t l_uNOut;
+
+    /* Init variable */
+    l_tSeries.ptPointArray = l_atPoints;
+
+    /* Function */
+    l_tSeries.uNumPoint = 2u;
+    if( e_eDSP_M2DPI64LINEAR_RES_BADPARAM == eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    /* Two point with the same X and a series not in order */
+    l_tSeries.uNumPoint = 4u;
+    l_atPoints[2u].uX = 10;
+    if( e_eDSP_M2DPI64LINEAR_RES_BADPARAM == eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    l_atPoints[2u].uX = 5;
+    if( e_eDSP_M2DPI64LINEAR_RES_BADPARAM == eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    l_atPoints[2u].uX = 20;
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    if( ( e_eDSP_M2DPI64LINEAR_RES_BADPARAM ==
+          eDSP_M2DPI64LINEAR_LinearizeBatch(&l_tCtx, l_aiX, 0u, l_aiY, &l_uNLinearized) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPARAM ==
+          eDSP_M2DPI64LINEAR_SetOvfMode(&l_tCtx, (e_eDSP_TYPE_OVFMODE) 5) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    /* The table must have one segment for every couple of point */
+    if( ( e_eDSP_M2DPI64LINEAR_RES_BADPARAM == eDSP_M2DPI64LINEAR_SetSlopeTable(&l_tCtx, l_atSeg, 4u) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPARAM == eDSP_M2DPI64LINEAR_SetSlopeTable(&l_tCtx, l_atSeg, 2u) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_SetSlopeTable(&l_tCtx, l_atSeg, 3u) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    /* No grid of three point can follow the series without error */
+    if( ( e_eDSP_M2DPI64LINEAR_RES_BADPARAM ==
+          eDSP_M2DPI64LINEAR_ResampleUniform(l_tSeries, 10u, l_atOut, 2u, &l_uNOut) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_BADPARAM ==
+          eDSP_M2DPI64LINEAR_ResampleUniform(l_tSeries, 0u, l_atOut, 3u, &l_uNOut) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BadParamEntr 6  -- FAIL \n");
+    }
+}
+
+static void eDSP_M2DPI64LINEARTST_CorruptedContext(void)
+{
+    /* Local variable */
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtx;
+    t_eDSP_TYPE_2DPI64 l_atPoints[4u] = { { 0, 0 }, { 16, 100 }, { 32, 0 }, { 48, 100 } };
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tSeries;
+    t_eDSP_M2DPI64LINEAR_Segment l_atSeg[3u];
+    int64_t  l_iY;
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_tSeries.uNumPoint = 4u;
+    l_tSeries.ptPointArray = l_atPoints;
+
+    /* Function */
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    l_tCtx.eOvfMode = (e_eDSP_TYPE_OVFMODE) 5;
+    if( e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 1, &l_iY) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 1  -- FAIL \n");
+    }
+
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    l_tCtx.uLastSegment = 3u;
+    if( e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX == eDSP_M2DPI64LINEAR_GetSatCnt(&l_tCtx, &l_uSatCnt) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 2  -- FAIL \n");
+    }
+
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    l_tCtx.tPoinSeries.uNumPoint = 2u;
+    if( e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX == eDSP_M2DPI64LINEAR_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_ERROR) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 3  -- FAIL \n");
+    }
+
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    l_tCtx.tGrid.uShift = 64u;
+    if( e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 1, &l_iY) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 4  -- FAIL \n");
+    }
+
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    l_tCtx.tGrid.eType = (e_eDSP_M2DPI64LINEAR_GRID) 9;
+    if( e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 1, &l_iY) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 5  -- FAIL \n");
+    }
+
+    /* A grid still coherent but different from the one of the series is found only by the verify */
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    l_tCtx.tGrid.eType = e_eDSP_M2DPI64LINEAR_GRID_NONE;
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 1, &l_iY) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX == eDSP_M2DPI64LINEAR_Verify(&l_tCtx) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 6  -- FAIL \n");
+    }
+
+    /* The series is checked only by the verify */
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    if( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Verify(&l_tCtx) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 7  -- FAIL \n");
+    }
+
+    l_atPoints[1u].uY = 101;
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 1, &l_iY) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX == eDSP_M2DPI64LINEAR_Verify(&l_tCtx) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 8  -- FAIL \n");
+    }
+
+    l_atPoints[1u].uY = 100;
+    l_atPoints[2u].uX = 16;
+    if( e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX == eDSP_M2DPI64LINEAR_Verify(&l_tCtx) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 9  -- FAIL \n");
+    }
+
+    /* Every segment of the table is checked by the verify */
+    l_atPoints[2u].uX = 32;
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    (void)eDSP_M2DPI64LINEAR_SetSlopeTable(&l_tCtx, l_atSeg, 3u);
+    if( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Verify(&l_tCtx) )
+    {
+        l_atSeg[2u].iIntercept++;
+
+        if( e_eDSP_M2DPI64LINEAR_RES_CORRUPTCTX == eDSP_M2DPI64LINEAR_Verify(&l_tCtx) )
+        {
+            (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_CorruptedContext 10 -- FAIL \n");
+    }
+}
+
+static void eDSP_M2DPI64LINEARTST_Linearize(void)
+{
+    /* Local variable */
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtx;
+    t_eDSP_TYPE_2DPI64 l_atPoints[4u] = { { 0, 0 }, { 10, 100 }, { 20, 100 }, { 40, 0 } };
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tSeries;
+    int64_t  l_iY;
+
+    /* Init variable */
+    l_tSeries.uNumPoint = 4u;
+    l_tSeries.ptPointArray = l_atPoints;
+
+    /* Function */
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 5, &l_iY) ) && ( 50 == l_iY ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 10, &l_iY) ) && ( 100 == l_iY ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 15, &l_iY) ) && ( 100 == l_iY ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 30, &l_iY) ) && ( 50 == l_iY ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Linearize 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Linearize 1  -- FAIL \n");
+    }
+
+    /* Outside the series the first and the last segment are extended */
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, -10, &l_iY) ) && ( -100 == l_iY ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 50, &l_iY) ) && ( -50 == l_iY ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Linearize 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Linearize 2  -- FAIL \n");
+    }
+
+    /* The result is truncated toward zero */
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 21, &l_iY) ) && ( 95 == l_iY ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, -1, &l_iY) ) && ( -10 == l_iY ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 41, &l_iY) ) && ( -5 == l_iY ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Linearize 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Linearize 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_M2DPI64LINEARTST_Search(void)
+{
+    /* Function */
+    if( true == eDSP_M2DPI64LINEARTST_CheckRef(0u, e_eDSP_M2DPI64LINEAR_GRID_NONE, 0x243F6A8885A308D3u) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Search 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Search 1  -- FAIL \n");
+    }
+
+    if( true == eDSP_M2DPI64LINEARTST_CheckRef(1u, e_eDSP_M2DPI64LINEAR_GRID_SHIFT, 0x13198A2E03707344u) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Search 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Search 2  -- FAIL \n");
+    }
+
+    if( true == eDSP_M2DPI64LINEARTST_CheckRef(2u, e_eDSP_M2DPI64LINEAR_GRID_RECIP, 0xA4093822299F31D0u) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Search 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Search 3  -- FAIL \n");
+    }
+
+    if( true == eDSP_M2DPI64LINEARTST_CheckRef(3u, e_eDSP_M2DPI64LINEAR_GRID_DIV, 0x082EFA98EC4E6C89u) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Search 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Search 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_M2DPI64LINEARTST_Overflow(void)
+{
+    /* Local variable */
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtx;
+    t_eDSP_TYPE_2DPI64 l_atPoints[3u] = { { 0, 0 }, { 1, MAX_INT64VAL }, { 2, 0 } };
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tSeries;
+    int64_t  l_aiX[4u] = { 1, 0, -2, 2 };
+    int64_t  l_aiY[4u];
+    int64_t  l_iY;
+    uint32_t l_uNLinearized;
+
+    /* Init variable */
+    l_tSeries.uNumPoint = 3u;
+    l_tSeries.ptPointArray = l_atPoints;
+
+    /* Function */
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, -1, &l_iY) ) &&
+        ( -MAX_INT64VAL == l_iY ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OVERFLOW == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, -2, &l_iY) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OVERFLOW == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, 4, &l_iY) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Overflow 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Overflow 1  -- FAIL \n");
+    }
+
+    /* The batch stop at the first value in overflow */
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OVERFLOW ==
+          eDSP_M2DPI64LINEAR_LinearizeBatch(&l_tCtx, l_aiX, 4u, l_aiY, &l_uNLinearized) ) &&
+        ( 2u == l_uNLinearized ) && ( MAX_INT64VAL == l_aiY[0u] ) && ( 0 == l_aiY[1u] ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Overflow 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Overflow 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_M2DPI64LINEARTST_Saturate(void)
+{
+    /* Local variable */
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtx;
+    t_eDSP_TYPE_2DPI64 l_atPoints[3u] = { { 0, 0 }, { 1, MAX_INT64VAL }, { 2, 0 } };
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tSeries;
+    int64_t  l_aiX[4u] = { 1, -2, 0, -3 };
+    int64_t  l_aiY[4u];
+    int64_t  l_iY;
+    uint32_t l_uNLinearized;
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_tSeries.uNumPoint = 3u;
+    l_tSeries.ptPointArray = l_atPoints;
+
+    /* Function */
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    (void)eDSP_M2DPI64LINEAR_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE);
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, -2, &l_iY) ) &&
+        ( MIN_INT64VAL == l_iY ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( l_uSatCnt > 0u ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Saturate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Saturate 1  -- FAIL \n");
+    }
+
+    /* No value is discarded by the batch */
+    (void)eDSP_M2DPI64LINEAR_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE);
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK ==
+          eDSP_M2DPI64LINEAR_LinearizeBatch(&l_tCtx, l_aiX, 4u, l_aiY, &l_uNLinearized) ) &&
+        ( 4u == l_uNLinearized ) && ( MAX_INT64VAL == l_aiY[0u] ) && ( MIN_INT64VAL == l_aiY[1u] ) &&
+        ( 0 == l_aiY[2u] ) && ( MIN_INT64VAL == l_aiY[3u] ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( l_uSatCnt > 0u ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Saturate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Saturate 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_SetOvfMode(&l_tCtx, e_eDSP_TYPE_OVFMODE_SATURATE) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_GetSatCnt(&l_tCtx, &l_uSatCnt) ) && ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Saturate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Saturate 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_M2DPI64LINEARTST_SlopeTable(void)
+{
+    /* Local variable */
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtx;
+    t_eDSP_TYPE_2DPI64 l_atPoints[40u];
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tSeries;
+    t_eDSP_M2DPI64LINEAR_Segment l_atSeg[39u];
+    int64_t  l_iX;
+    int64_t  l_iY;
+    int64_t  l_iDiff;
+    uint64_t l_uSeed;
+    bool_t   l_bTestOk;
+
+    /* Init variable */
+    l_uSeed = 0x452821E638D01377u;
+    l_tSeries.uNumPoint = 40u;
+    l_tSeries.ptPointArray = l_atPoints;
+    l_bTestOk = true;
+
+    /* Function */
+    eDSP_M2DPI64LINEARTST_BuildSeries(l_atPoints, 40u, 0u, false, &l_uSeed);
+    (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries);
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_SetSlopeTable(&l_tCtx, l_atSeg, 39u) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_Verify(&l_tCtx) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_SlopeTable 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_SlopeTable 1  -- FAIL \n");
+    }
+
+    /* Inside the series the result is rounded, so it can differ by up to two from the truncated one */
+    for(uint32_t i = 0u; ( ( i < 2000u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_iX = eDSP_M2DPI64LINEARTST_RandX(l_atPoints, 40u, &l_uSeed);
+
+        if( e_eDSP_M2DPI64LINEAR_RES_OK != eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, l_iX, &l_iY) )
+        {
+            l_bTestOk = false;
+        }
+        else
+        {
+            l_iDiff = l_iY - eDSP_M2DPI64LINEARTST_RefLinearize(l_atPoints, 40u, l_iX);
+
+            if( ( l_iX > l_atPoints[0u].uX ) && ( l_iX <= l_atPoints[39u].uX ) )
+            {
+                if( ( l_iDiff > 2 ) || ( l_iDiff < -2 ) )
+                {
+                    l_bTestOk = false;
+                }
+            }
+            else
+            {
+                if( 0 != l_iDiff )
+                {
+                    l_bTestOk = false;
+                }
+            }
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_SlopeTable 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_SlopeTable 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_M2DPI64LINEARTST_Resample(void)
+{
+    /* Local variable */
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtxSrc;
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtxGrid;
+    t_eDSP_TYPE_2DPI64 l_atPoints[20u];
+    t_eDSP_TYPE_2DPI64 l_atGrid[4096u];
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tSeries;
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tGridSeries;
+    int64_t  l_iX;
+    int64_t  l_iYSrc;
+    int64_t  l_iYGrid;
+    int64_t  l_iDiff;
+    uint32_t l_uNOut;
+    uint64_t l_uSeed;
+    bool_t   l_bTestOk;
+
+    /* Init variable */
+    l_uSeed = 0xBE5466CF34E90C6Cu;
+    l_tSeries.uNumPoint = 20u;
+    l_tSeries.ptPointArray = l_atPoints;
+    l_bTestOk = true;
+
+    /* Function */
+    l_atPoints[0u].uX = 0;
+    l_atPoints[0u].uY = 0;
+    for(uint32_t i = 1u; i < 20u; i++)
+    {
+        l_atPoints[i].uX = l_atPoints[i - 1u].uX + 1 + (int64_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 100000u );
+        l_atPoints[i].uY = ( (int64_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 200001u ) ) - 100000;
+    }
+
+    if( e_eDSP_M2DPI64LINEAR_RES_OK ==
+        eDSP_M2DPI64LINEAR_ResampleUniform(l_tSeries, 1000u, l_atGrid, 4096u, &l_uNOut) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Resample 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Resample 1  -- FAIL \n");
+    }
+
+    /* The grid start from the first X, cover the last one and has a step that is a power of two */
+    l_tGridSeries.uNumPoint = l_uNOut;
+    l_tGridSeries.ptPointArray = l_atGrid;
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_InitCtx(&l_tCtxSrc, l_tSeries) ) &&
+        ( e_eDSP_M2DPI64LINEAR_RES_OK == eDSP_M2DPI64LINEAR_InitCtx(&l_tCtxGrid, l_tGridSeries) ) &&
+        ( e_eDSP_M2DPI64LINEAR_GRID_SHIFT == l_tCtxGrid.tGrid.eType ) &&
+        ( l_atGrid[0u].uX == l_atPoints[0u].uX ) && ( l_atGrid[l_uNOut - 1u].uX >= l_atPoints[19u].uX ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Resample 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Resample 2  -- FAIL \n");
+    }
+
+    /* Between the first and the last X only the truncation is added to the max error */
+    for(uint32_t i = 0u; ( ( i < 5000u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_iX = l_atPoints[0u].uX +
+               (int64_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % ( (uint64_t) l_atPoints[19u].uX + 1u ) );
+
+        if( ( e_eDSP_M2DPI64LINEAR_RES_OK != eDSP_M2DPI64LINEAR_Linearize(&l_tCtxSrc, l_iX, &l_iYSrc) ) ||
+            ( e_eDSP_M2DPI64LINEAR_RES_OK != eDSP_M2DPI64LINEAR_Linearize(&l_tCtxGrid, l_iX, &l_iYGrid) ) )
+        {
+            l_bTestOk = false;
+        }
+        else
+        {
+            l_iDiff = l_iYGrid - l_iYSrc;
+
+            if( ( l_iDiff > 1001 ) || ( l_iDiff < -1001 ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Resample 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_Resample 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_M2DPI64LINEARTST_BatchVsSingle(void)
+{
+    /* Function */
+    if( ( true == eDSP_M2DPI64LINEARTST_CheckBatch(0u, e_eDSP_TYPE_OVFMODE_ERROR, 0xC0AC29B7C97C50DDu) ) &&
+        ( true == eDSP_M2DPI64LINEARTST_CheckBatch(1u, e_eDSP_TYPE_OVFMODE_ERROR, 0x3F84D5B5B5470917u) ) &&
+        ( true == eDSP_M2DPI64LINEARTST_CheckBatch(2u, e_eDSP_TYPE_OVFMODE_ERROR, 0x9216D5D98979FB1Bu) ) &&
+        ( true == eDSP_M2DPI64LINEARTST_CheckBatch(3u, e_eDSP_TYPE_OVFMODE_ERROR, 0xD1310BA698DFB5ACu) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BatchVsSingle 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BatchVsSingle 1  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_M2DPI64LINEARTST_CheckBatch(0u, e_eDSP_TYPE_OVFMODE_SATURATE, 0x2FFD72DBD01ADFB7u) ) &&
+        ( true == eDSP_M2DPI64LINEARTST_CheckBatch(1u, e_eDSP_TYPE_OVFMODE_SATURATE, 0xB8E1AFED6A267E96u) ) &&
+        ( true == eDSP_M2DPI64LINEARTST_CheckBatch(2u, e_eDSP_TYPE_OVFMODE_SATURATE, 0xBA7C9045F12C7F99u) ) &&
+        ( true == eDSP_M2DPI64LINEARTST_CheckBatch(3u, e_eDSP_TYPE_OVFMODE_SATURATE, 0x24A19947B3916CF7u) ) )
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BatchVsSingle 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_M2DPI64LINEARTST_BatchVsSingle 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_M2DPI64LINEARTST_BuildSeries(t_eDSP_TYPE_2DPI64* const p_ptPoints, const uint32_t p_uNPoint,
+                                              const uint32_t p_uStepMode, const bool_t p_bFullRange,
+                                              uint64_t* const p_puSeed)
+{
+    /* Local variable */
+    int64_t l_iX;
+
+    /* Init variable */
+    l_iX = ( (int64_t) ( eDSP_TSTRAND_Rand(p_puSeed) % 2000001u ) ) - 1000000;
+
+    /* Function */
+    /* Step mode 0 is a random series, 1 a grid with a power of two step, 2 a narrow grid and 3 a wide grid */
+    for(uint32_t i = 0u; i < p_uNPoint; i++)
+    {
+        p_ptPoints[i].uX = l_iX;
+
+        if( true == p_bFullRange )
+        {
+            p_ptPoints[i].uY = (int64_t) eDSP_TSTRAND_Rand(p_puSeed);
+        }
+        else
+        {
+            p_ptPoints[i].uY = ( (int64_t) ( eDSP_TSTRAND_Rand(p_puSeed) % 200000001u ) ) - 100000000;
+        }
+
+        if( 0u == p_uStepMode )
+        {
+            l_iX += 1 + (int64_t) ( eDSP_TSTRAND_Rand(p_puSeed) % 100000u );
+        }
+        else if( 1u == p_uStepMode )
+        {
+            l_iX += 64;
+        }
+        else if( 2u == p_uStepMode )
+        {
+            l_iX += 1000;
+        }
+        else
+        {
+            l_iX += 5000000000;
+        }
+    }
+}
+
+static int64_t eDSP_M2DPI64LINEARTST_RefLinearize(const t_eDSP_TYPE_2DPI64* p_ptPoints, const uint32_t p_uNPoint,
+                                                  const int64_t p_iX)
+{
+    /* Local variable */
+    uint32_t l_uIndx;
+
+    /* Init variable */
+    l_uIndx = 0u;
+
+    /* Function */
+    /* X in ( X[i], X[i + 1] ] use the segment i, outside the series the first and the last segment are used */
+    while( ( ( l_uIndx + 2u ) < p_uNPoint ) && ( p_iX > p_ptPoints[l_uIndx + 1u].uX ) )
+    {
+        l_uIndx++;
+    }
+
+    return p_ptPoints[l_uIndx].uY +
+           ( ( ( p_ptPoints[l_uIndx + 1u].uY - p_ptPoints[l_uIndx].uY ) * ( p_iX - p_ptPoints[l_uIndx].uX ) ) /
+             ( p_ptPoints[l_uIndx + 1u].uX - p_ptPoints[l_uIndx].uX ) );
+}
+
+static int64_t eDSP_M2DPI64LINEARTST_RandX(const t_eDSP_TYPE_2DPI64* p_ptPoints, const uint32_t p_uNPoint,
+                                           uint64_t* const p_puSeed)
+{
+    /* Local variable */
+    int64_t  l_iX;
+    uint64_t l_uSpan;
+
+    /* Function */
+    /* One value out of eight is a point of the series, the others are in the series or just outside it */
+    if( 0u == ( eDSP_TSTRAND_Rand(p_puSeed) % 8u ) )
+    {
+        l_iX = p_ptPoints[eDSP_TSTRAND_Rand(p_puSeed) % p_uNPoint].uX;
+    }
+    else
+    {
+        l_uSpan = ( (uint64_t) p_ptPoints[p_uNPoint - 1u].uX ) - ( (uint64_t) p_ptPoints[0u].uX );
+        l_iX = ( p_ptPoints[0u].uX - 1000 ) +
+               (int64_t) ( eDSP_TSTRAND_Rand(p_puSeed) % ( l_uSpan + 2000u ) );
+    }
+
+    return l_iX;
+}
+
+static bool_t eDSP_M2DPI64LINEARTST_CheckRef(const uint32_t p_uStepMode, const e_eDSP_M2DPI64LINEAR_GRID p_eGrid,
+                                             const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtx;
+    t_eDSP_TYPE_2DPI64 l_atPoints[50u];
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tSeries;
+    int64_t  l_iX;
+    int64_t  l_iY;
+    uint64_t l_uSeed;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+    l_tSeries.uNumPoint = 50u;
+    l_tSeries.ptPointArray = l_atPoints;
+
+    /* Function */
+    eDSP_M2DPI64LINEARTST_BuildSeries(l_atPoints, 50u, p_uStepMode, false, &l_uSeed);
+
+    if( ( e_eDSP_M2DPI64LINEAR_RES_OK != eDSP_M2DPI64LINEAR_InitCtx(&l_tCtx, l_tSeries) ) ||
+        ( p_eGrid != l_tCtx.tGrid.eType ) )
+    {
+        l_bTestOk = false;
+    }
+
+    for(uint32_t i = 0u; ( ( i < 3000u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_iX = eDSP_M2DPI64LINEARTST_RandX(l_atPoints, 50u, &l_uSeed);
+
+        if( ( e_eDSP_M2DPI64LINEAR_RES_OK != eDSP_M2DPI64LINEAR_Linearize(&l_tCtx, l_iX, &l_iY) ) ||
+            ( eDSP_M2DPI64LINEARTST_RefLinearize(l_atPoints, 50u, l_iX) != l_iY ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    return l_bTestOk;
+}
+
+static bool_t eDSP_M2DPI64LINEARTST_CheckBatch(const uint32_t p_uStepMode, const e_eDSP_TYPE_OVFMODE p_eOvfMode,
+                                               const uint64_t p_uSeedInit)
+{
+    /* Local variable */
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtxBatch;
+    t_eDSP_M2DPI64LINEAR_Ctx l_tCtxSingle;
+    t_eDSP_TYPE_2DPI64 l_atPoints[64u];
+    t_eDSP_M2DPI64LINEAR_PointSeries l_tSeries;
+    int64_t  l_aiX[200u];
+    int64_t  l_aiY[200u];
+    int64_t  l_iY;
+    int64_t  l_iTemp;
+    uint32_t l_uNBlock;
+    uint32_t l_uNLinearized;
+    uint32_t l_uNSingle;
+    uint32_t l_uSatCntBatch;
+    uint32_t l_uSatCntSingle;
+    uint64_t l_uSeed;
+    e_eDSP_M2DPI64LINEAR_RES l_eBatchRes;
+    e_eDSP_M2DPI64LINEAR_RES l_eSingleRes;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = p_uSeedInit;
+    l_tSeries.ptPointArray = l_atPoints;
+
+    /* Function */
+    /* The batch can take the SIMD kernels, the single value always the scalar calculation, every result must be the
+       same bit for bit. Full range Y reach the overflow and the values that the kernels leave to the scalar path */
+    for(uint32_t i = 0u; ( ( i < 200u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_tSeries.uNumPoint = 3u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 62u );
+        eDSP_M2DPI64LINEARTST_BuildSeries(l_atPoints, l_tSeries.uNumPoint, p_uStepMode, ( 0u == ( i % 3u ) ),
+                                          &l_uSeed);
+        (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtxBatch, l_tSeries);
+        (void)eDSP_M2DPI64LINEAR_InitCtx(&l_tCtxSingle, l_tSeries);
+        (void)eDSP_M2DPI64LINEAR_SetOvfMode(&l_tCtxBatch, p_eOvfMode);
+        (void)eDSP_M2DPI64LINEAR_SetOvfMode(&l_tCtxSingle, p_eOvfMode);
+
+        /* More block on the same context, the last segment is kept between them */
+        for(uint32_t j = 0u; ( ( j < 3u ) && ( true == l_bTestOk ) ); j++)
+        {
+            l_uNBlock = 1u + (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 200u );
+
+            for(uint32_t k = 0u; k < l_uNBlock; k++)
+            {
+                l_aiX[k] = eDSP_M2DPI64LINEARTST_RandX(l_atPoints, l_tSeries.uNumPoint, &l_uSeed);
+            }
+
+            /* Half of the block are in order, like a stream */
+            if( 0u == ( eDSP_TSTRAND_Rand(&l_uSeed) % 2u ) )
+            {
+                for(uint32_t k = 1u; k < l_uNBlock; k++)
+                {
+                    for(uint32_t m = k; ( m > 0u ) && ( l_aiX[m] < l_aiX[m - 1u] ); m--)
+                    {
+                        l_iTemp = l_aiX[m];
+                        l_aiX[m] = l_aiX[m - 1u];
+                        l_aiX[m - 1u] = l_iTemp;
+                    }
+                }
+            }
+
+            l_eBatchRes = eDSP_M2DPI64LINEAR_LinearizeBatch(&l_tCtxBatch, l_aiX, l_uNBlock, l_aiY, &l_uNLinearized);
+
+            l_uNSingle = 0u;
+            l_eSingleRes = e_eDSP_M2DPI64LINEAR_RES_OK;
+            while( ( l_uNSingle < l_uNBlock ) && ( e_eDSP_M2DPI64LINEAR_RES_OK == l_eSingleRes ) )
+            {
+                l_eSingleRes = eDSP_M2DPI64LINEAR_Linearize(&l_tCtxSingle, l_aiX[l_uNSingle], &l_iY);
+
+                if( e_eDSP_M2DPI64LINEAR_RES_OK == l_eSingleRes )
+                {
+                    if( ( l_uNSingle >= l_uNLinearized ) || ( l_aiY[l_uNSingle] != l_iY ) )
+                    {
+                        l_bTestOk = false;
+                    }
+
+                    l_uNSingle++;
+                }
+            }
+
+            (void)eDSP_M2DPI64LINEAR_GetSatCnt(&l_tCtxBatch, &l_uSatCntBatch);
+            (void)eDSP_M2DPI64LINEAR_GetSatCnt(&l_tCtxSingle, &l_uSatCntSingle);
+
+            if( ( l_eBatchRes != l_eSingleRes ) || ( l_uNSingle != l_uNLinearized ) ||
+                ( l_uSatCntBatch != l_uSatCntSingle ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+
+    return l_bTestOk;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
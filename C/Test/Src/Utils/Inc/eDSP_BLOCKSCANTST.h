@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_BLOCKSCANTST.h
+ *
+ * @brief      Block scan test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_BLOCKSCANTST_H
+#define EDSP_BLOCKSCANTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the block scan module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_BLOCKSCANTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_BLOCKSCANTST_H */
\ No newline at end of file
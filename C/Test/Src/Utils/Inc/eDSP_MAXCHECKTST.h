@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_MAXCHECKTST.h
+ *
+ * @brief      Max check test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_MAXCHECKTST_H
+#define EDSP_MAXCHECKTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the max check module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_MAXCHECKTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_MAXCHECKTST_H */
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_Q31ARITHTST.h
+ *
+ * @brief      Q31 arithmetic test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_Q31ARITHTST_H
+#define EDSP_Q31ARITHTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the Q31 arithmetic module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_Q31ARITHTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_Q31ARITHTST_H */
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+ * @file       eDSP_SATARITHTST.h
+ *
+ * @brief      Saturated arithmetic test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_SATARITHTST_H
+#define EDSP_SATARITHTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the saturated arithmetic module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eDSP_SATARITHTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_SATARITHTST_H */
\ No newline at end of file
@@ -0,0 +1,49 @@
+/**
+ * @file       eDSP_TSTRAND.h
+ *
+ * @brief      Pseudo random generator shared by the tests
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EDSP_TSTRAND_H
+#define EDSP_TSTRAND_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Generate the next pseudo random value with a xorshift, the same sequence on every target, so a test
+ *              that fail can be repeated. Every test keep its own seed.
+ *
+ * @param[in]   p_puSeed        - Pointer to the seed, updated with the generated value. Cannot be zero
+ *
+ * @return      The generated value
+ */
+uint64_t eDSP_TSTRAND_Rand(uint64_t* const p_puSeed);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EDSP_TSTRAND_H */
\ No newline at end of file
@@ -0,0 +1,300 @@
+/**
+ * @file       eDSP_BLOCKSCANTST.c
+ *
+ * @brief      Block scan test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_BLOCKSCANTST.h"
+#include "eDSP_BLOCKSCAN.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_BLOCKSCANTST_EmptyBlock(void);
+static void eDSP_BLOCKSCANTST_MinMaxI64(void);
+static void eDSP_BLOCKSCANTST_Merge(void);
+static void eDSP_BLOCKSCANTST_MinMaxU32(void);
+static void eDSP_BLOCKSCANTST_WindowSafe(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_BLOCKSCANTST_ExeTest(void)
+{
+	(void)printf("\n\nBLOCKSCAN TEST START \n\n");
+
+    eDSP_BLOCKSCANTST_EmptyBlock();
+    eDSP_BLOCKSCANTST_MinMaxI64();
+    eDSP_BLOCKSCANTST_Merge();
+    eDSP_BLOCKSCANTST_MinMaxU32();
+    eDSP_BLOCKSCANTST_WindowSafe();
+
+    (void)printf("\n\nBLOCKSCAN TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_BLOCKSCANTST_EmptyBlock(void)
+{
+    /* Local variable */
+    int64_t  l_iMin;
+    int64_t  l_iMax;
+    uint32_t l_uMin;
+    uint32_t l_uMax;
+
+    /* Init variable */
+    l_iMin = MAX_INT64VAL;
+    l_iMax = MIN_INT64VAL;
+    l_uMin = MAX_UINT32VAL;
+    l_uMax = 0u;
+
+    /* Function */
+    eDSP_BLOCKSCAN_MinMaxI64(NULL, 0u, &l_iMin, &l_iMax);
+    if( ( MAX_INT64VAL == l_iMin ) && ( MIN_INT64VAL == l_iMax ) )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_EmptyBlock 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_EmptyBlock 1  -- FAIL \n");
+    }
+
+    eDSP_BLOCKSCAN_MinMaxU32(NULL, 0u, &l_uMin, &l_uMax);
+    if( ( MAX_UINT32VAL == l_uMin ) && ( 0u == l_uMax ) )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_EmptyBlock 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_EmptyBlock 2  -- FAIL \n");
+    }
+
+    /* Nothing scanned is never safe */
+    if( false == eDSP_BLOCKSCAN_IsWindowSafe(l_iMin, l_iMax, 1u) )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_EmptyBlock 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_EmptyBlock 3  -- FAIL \n");
+    }
+}
+
+static void eDSP_BLOCKSCANTST_MinMaxI64(void)
+{
+    /* Local variable */
+    int64_t  l_aiValues[80u];
+    uint64_t l_uSeed;
+    int64_t  l_iMin;
+    int64_t  l_iMax;
+    int64_t  l_iRefMin;
+    int64_t  l_iRefMax;
+    uint32_t l_uOffset;
+    uint32_t l_uLen;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0x1234567887654321u;
+
+    /* Every length and start offset, so the SIMD kernels, when built, are compared with the plain scan on every
+       alignment and every tail length */
+    for(uint32_t i = 0u; ( ( i < 2000u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uOffset = i % 8u;
+        l_uLen = ( i / 8u ) % 72u;
+
+        for(uint32_t j = 0u; j < 80u; j++)
+        {
+            /* Narrow values some time, so equal values and both signs are used */
+            if( 0u == ( i & 1u ) )
+            {
+                l_aiValues[j] = (int64_t) eDSP_TSTRAND_Rand(&l_uSeed);
+            }
+            else
+            {
+                l_aiValues[j] = ( (int64_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 7u ) ) - 3;
+            }
+        }
+
+        l_iRefMin = MAX_INT64VAL;
+        l_iRefMax = MIN_INT64VAL;
+
+        for(uint32_t j = 0u; j < l_uLen; j++)
+        {
+            if( l_aiValues[l_uOffset + j] < l_iRefMin )
+            {
+                l_iRefMin = l_aiValues[l_uOffset + j];
+            }
+
+            if( l_aiValues[l_uOffset + j] > l_iRefMax )
+            {
+                l_iRefMax = l_aiValues[l_uOffset + j];
+            }
+        }
+
+        l_iMin = MAX_INT64VAL;
+        l_iMax = MIN_INT64VAL;
+        eDSP_BLOCKSCAN_MinMaxI64(&l_aiValues[l_uOffset], l_uLen, &l_iMin, &l_iMax);
+
+        if( ( l_iRefMin != l_iMin ) || ( l_iRefMax != l_iMax ) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_MinMaxI64 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_MinMaxI64 1  -- FAIL \n");
+    }
+
+    /* Extreme values in the last lane */
+    for(uint32_t j = 0u; j < 80u; j++)
+    {
+        l_aiValues[j] = 0;
+    }
+
+    l_aiValues[78u] = MIN_INT64VAL;
+    l_aiValues[79u] = MAX_INT64VAL;
+    l_iMin = MAX_INT64VAL;
+    l_iMax = MIN_INT64VAL;
+    eDSP_BLOCKSCAN_MinMaxI64(l_aiValues, 80u, &l_iMin, &l_iMax);
+
+    if( ( MIN_INT64VAL == l_iMin ) && ( MAX_INT64VAL == l_iMax ) )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_MinMaxI64 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_MinMaxI64 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_BLOCKSCANTST_Merge(void)
+{
+    /* Local variable */
+    int64_t l_aiValues1[5u] = { 4, 7, -2, 9, 0 };
+    int64_t l_aiValues2[3u] = { 12, 3, 5 };
+    int64_t l_aiValues3[9u] = { -5, 1, 1, 1, 1, 1, 1, 1, 1 };
+    int64_t l_iMin;
+    int64_t l_iMax;
+
+    /* Init variable */
+    l_iMin = MAX_INT64VAL;
+    l_iMax = MIN_INT64VAL;
+
+    /* Function */
+    eDSP_BLOCKSCAN_MinMaxI64(l_aiValues1, 5u, &l_iMin, &l_iMax);
+    eDSP_BLOCKSCAN_MinMaxI64(l_aiValues2, 3u, &l_iMin, &l_iMax);
+    if( ( -2 == l_iMin ) && ( 12 == l_iMax ) )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_Merge 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_Merge 1  -- FAIL \n");
+    }
+
+    eDSP_BLOCKSCAN_MinMaxI64(l_aiValues3, 9u, &l_iMin, &l_iMax);
+    if( ( -5 == l_iMin ) && ( 12 == l_iMax ) )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_Merge 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_Merge 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_BLOCKSCANTST_MinMaxU32(void)
+{
+    /* Local variable */
+    uint32_t l_auValues[7u] = { 40u, 0xFFFFFFF0u, 3u, 17u, 3u, 99u, 0x80000000u };
+    uint32_t l_uMin;
+    uint32_t l_uMax;
+
+    /* Init variable */
+    l_uMin = MAX_UINT32VAL;
+    l_uMax = 0u;
+
+    /* Function */
+    eDSP_BLOCKSCAN_MinMaxU32(l_auValues, 7u, &l_uMin, &l_uMax);
+    if( ( 3u == l_uMin ) && ( 0xFFFFFFF0u == l_uMax ) )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_MinMaxU32 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_MinMaxU32 1  -- FAIL \n");
+    }
+}
+
+static void eDSP_BLOCKSCANTST_WindowSafe(void)
+{
+    /* Function */
+    if( true == eDSP_BLOCKSCAN_IsWindowSafe(MIN_INT64VAL / 2, MAX_INT64VAL / 2, 2u) )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_WindowSafe 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_WindowSafe 1  -- FAIL \n");
+    }
+
+    /* The sum of three values can overflow */
+    if( false == eDSP_BLOCKSCAN_IsWindowSafe(MIN_INT64VAL / 2, MAX_INT64VAL / 2, 3u) )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_WindowSafe 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_WindowSafe 2  -- FAIL \n");
+    }
+
+    /* A single value fit, but the distance between them doesn't */
+    if( false == eDSP_BLOCKSCAN_IsWindowSafe(-1, MAX_INT64VAL, 1u) )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_WindowSafe 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_WindowSafe 3  -- FAIL \n");
+    }
+
+    if( ( true == eDSP_BLOCKSCAN_IsWindowSafe(-1000, 1000, MAX_UINT32VAL) ) &&
+        ( true == eDSP_BLOCKSCAN_IsWindowSafe(5, 5, 1u) ) )
+    {
+        (void)printf("eDSP_BLOCKSCANTST_WindowSafe 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_BLOCKSCANTST_WindowSafe 4  -- FAIL \n");
+    }
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
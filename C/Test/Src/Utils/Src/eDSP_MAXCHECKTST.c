@@ -0,0 +1,570 @@
+/**
+ * @file       eDSP_MAXCHECKTST.c
+ *
+ * @brief      Max check test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_MAXCHECKTST.h"
+#include "eDSP_MAXCHECK.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_MAXCHECKTST_BadParam(void);
+static void eDSP_MAXCHECKTST_AddSub(void);
+static void eDSP_MAXCHECKTST_Mul(void);
+static void eDSP_MAXCHECKTST_MulDiv(void);
+static void eDSP_MAXCHECKTST_DivI128(void);
+static void eDSP_MAXCHECKTST_MulAddI128(void);
+#if defined(__SIZEOF_INT128__)
+static void eDSP_MAXCHECKTST_Reference(void);
+static int64_t eDSP_MAXCHECKTST_RandOperand(uint64_t* const p_puSeed);
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_MAXCHECKTST_ExeTest(void)
+{
+	(void)printf("\n\nMAXCHECK TEST START \n\n");
+
+    eDSP_MAXCHECKTST_BadParam();
+    eDSP_MAXCHECKTST_AddSub();
+    eDSP_MAXCHECKTST_Mul();
+    eDSP_MAXCHECKTST_MulDiv();
+    eDSP_MAXCHECKTST_DivI128();
+    eDSP_MAXCHECKTST_MulAddI128();
+#if defined(__SIZEOF_INT128__)
+    eDSP_MAXCHECKTST_Reference();
+#endif
+
+    (void)printf("\n\nMAXCHECK TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_MAXCHECKTST_BadParam(void)
+{
+    /* Local variable */
+    int64_t l_iRes;
+
+    /* Function */
+    l_iRes = 12;
+    if( e_eDSP_MAXCHECK_BADPARAM == eDSP_MAXCHECK_MulDivI64(10, 10, 0, &l_iRes) )
+    {
+        if( 12 == l_iRes )
+        {
+            (void)printf("eDSP_MAXCHECKTST_BadParam 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eDSP_MAXCHECKTST_BadParam 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_BadParam 1  -- FAIL \n");
+    }
+
+    if( e_eDSP_MAXCHECK_BADPARAM == eDSP_MAXCHECK_DivI128(0, 10u, 0, &l_iRes) )
+    {
+        if( 12 == l_iRes )
+        {
+            (void)printf("eDSP_MAXCHECKTST_BadParam 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eDSP_MAXCHECKTST_BadParam 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_BadParam 2  -- FAIL \n");
+    }
+}
+
+static void eDSP_MAXCHECKTST_AddSub(void)
+{
+    /* Local variable */
+    int64_t l_iRes;
+
+    /* Function */
+    if( ( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_SUMI64Check(MAX_INT64VAL, 1) ) &&
+        ( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_SUMI64Check(MIN_INT64VAL, -1) ) &&
+        ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_SUMI64Check(MAX_INT64VAL, MIN_INT64VAL) ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_SUBTI64Check(MIN_INT64VAL, 1) ) &&
+        ( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_SUBTI64Check(0, MIN_INT64VAL) ) &&
+        ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_SUBTI64Check(-1, MIN_INT64VAL) ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 2  -- FAIL \n");
+    }
+
+    l_iRes = 0;
+    if( ( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_AddI64(MAX_INT64VAL, 1, &l_iRes) ) && ( 0 == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_AddI64(MAX_INT64VAL, -1, &l_iRes) ) &&
+        ( ( MAX_INT64VAL - 1 ) == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 4  -- FAIL \n");
+    }
+
+    l_iRes = 0;
+    if( ( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_SubI64(0, MIN_INT64VAL, &l_iRes) ) && ( 0 == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 5  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_SubI64(-1, MIN_INT64VAL, &l_iRes) ) && ( MAX_INT64VAL == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_AddSub 6  -- FAIL \n");
+    }
+}
+
+static void eDSP_MAXCHECKTST_Mul(void)
+{
+    /* Local variable */
+    int64_t l_iRes;
+
+    /* Function */
+    if( ( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_MOLTIPI64Check(MIN_INT64VAL, -1) ) &&
+        ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_MOLTIPI64Check(MIN_INT64VAL, 1) ) &&
+        ( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_MOLTIPI64Check(0x100000000, 0x80000000) ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_Mul 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_Mul 1  -- FAIL \n");
+    }
+
+    l_iRes = 0;
+    if( ( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_MulI64(MIN_INT64VAL, -1, &l_iRes) ) && ( 0 == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_Mul 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_Mul 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_MulI64(-0x100000000, 0x80000000, &l_iRes) ) &&
+        ( MIN_INT64VAL == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_Mul 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_Mul 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_MulI64(3037000499, 3037000499, &l_iRes) ) &&
+        ( 9223372030926249001 == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_Mul 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_Mul 4  -- FAIL \n");
+    }
+
+    if( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_MulI64(-3037000500, -3037000500, &l_iRes) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_Mul 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_Mul 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_MAXCHECKTST_MulDiv(void)
+{
+    /* Local variable */
+    int64_t l_iRes;
+
+    /* Function */
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_MulDivI64(7, -3, 2, &l_iRes) ) && ( -10 == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 1  -- FAIL \n");
+    }
+
+    /* The product need 126 bit, only the result must fit */
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_MulDivI64(MAX_INT64VAL, MAX_INT64VAL, MAX_INT64VAL, &l_iRes) ) &&
+        ( MAX_INT64VAL == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_MulDivI64(MIN_INT64VAL, MIN_INT64VAL, MIN_INT64VAL, &l_iRes) ) &&
+        ( MIN_INT64VAL == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 3  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_MulDivI64(MIN_INT64VAL, -1, -1, &l_iRes) ) &&
+        ( MIN_INT64VAL == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 4  -- FAIL \n");
+    }
+
+    l_iRes = 0;
+    if( ( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_MulDivI64(MIN_INT64VAL, -1, 1, &l_iRes) ) && ( 0 == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 5  -- FAIL \n");
+    }
+
+    if( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_MulDivI64(MAX_INT64VAL, 3, 2, &l_iRes) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 6  -- FAIL \n");
+    }
+
+    /* ( 2^63 - 1 ) * 1000003 / 1000007 is truncated toward zero */
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_MulDivI64(MAX_INT64VAL, -1000003, 1000007, &l_iRes) ) &&
+        ( -9223335143624880997 == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulDiv 7  -- FAIL \n");
+    }
+}
+
+static void eDSP_MAXCHECKTST_DivI128(void)
+{
+    /* Local variable */
+    int64_t l_iRes;
+
+    /* Function */
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_DivI128(0, 0x8000000000000000u, -1, &l_iRes) ) &&
+        ( MIN_INT64VAL == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 1  -- FAIL \n");
+    }
+
+    if( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_DivI128(0, 0x8000000000000000u, 1, &l_iRes) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 2  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_DivI128(-1, 0x8000000000000000u, 1, &l_iRes) ) &&
+        ( MIN_INT64VAL == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 3  -- FAIL \n");
+    }
+
+    /* -2^64 */
+    if( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_DivI128(-1, 0u, 1, &l_iRes) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 4  -- FAIL \n");
+    }
+
+    /* -2^64 / 3, truncated toward zero */
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_DivI128(-1, 0u, 3, &l_iRes) ) && ( -6148914691236517205 == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 5  -- FAIL \n");
+    }
+
+    /* -7 / 2 */
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_DivI128(-1, 0xFFFFFFFFFFFFFFF9u, 2, &l_iRes) ) && ( -3 == l_iRes ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_DivI128 6  -- FAIL \n");
+    }
+}
+
+static void eDSP_MAXCHECKTST_MulAddI128(void)
+{
+    /* Local variable */
+    int64_t  l_iHigh;
+    uint64_t l_uLow;
+
+    /* Init variable */
+    l_iHigh = 0;
+    l_uLow = 0u;
+
+    /* Function, ( 2^63 - 1 )^2 = 2^126 - 2^64 + 1 */
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_MulAddI128(MAX_INT64VAL, MAX_INT64VAL, &l_iHigh, &l_uLow) ) &&
+        ( 0x3FFFFFFFFFFFFFFF == l_iHigh ) && ( 1u == l_uLow ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulAddI128 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulAddI128 1  -- FAIL \n");
+    }
+
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_MulAddI128(MAX_INT64VAL, MAX_INT64VAL, &l_iHigh, &l_uLow) ) &&
+        ( 0x7FFFFFFFFFFFFFFE == l_iHigh ) && ( 2u == l_uLow ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulAddI128 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulAddI128 2  -- FAIL \n");
+    }
+
+    /* The third one exceed 2^127, nothing is updated */
+    if( ( e_eDSP_MAXCHECK_OVERFLOW == eDSP_MAXCHECK_MulAddI128(MAX_INT64VAL, MAX_INT64VAL, &l_iHigh, &l_uLow) ) &&
+        ( 0x7FFFFFFFFFFFFFFE == l_iHigh ) && ( 2u == l_uLow ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulAddI128 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulAddI128 3  -- FAIL \n");
+    }
+
+    /* Going back to a negative value */
+    l_iHigh = 0;
+    l_uLow = 5u;
+    if( ( e_eDSP_MAXCHECK_RES_OK == eDSP_MAXCHECK_MulAddI128(-3, 2, &l_iHigh, &l_uLow) ) &&
+        ( -1 == l_iHigh ) && ( 0xFFFFFFFFFFFFFFFFu == l_uLow ) )
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulAddI128 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_MulAddI128 4  -- FAIL \n");
+    }
+}
+
+#if defined(__SIZEOF_INT128__)
+static void eDSP_MAXCHECKTST_Reference(void)
+{
+    /* Local variable */
+    uint64_t l_uSeed;
+    int64_t  l_iFirst;
+    int64_t  l_iSecond;
+    int64_t  l_iDivisor;
+    int64_t  l_iHigh;
+    uint64_t l_uLow;
+    int64_t  l_iRes;
+    e_eDSP_MAXCHECK_RES l_eRes;
+    t_eDSP_MAXCHECK_I128 l_iExpected;
+    bool_t   l_bTestOk = true;
+    bool_t   l_bOvf;
+
+    /* Init variable */
+    l_uSeed = 0x0123456789ABCDEFu;
+
+    /* Compare the checked operation with the compiler 128 bit arithmetic */
+    for(uint32_t i = 0u; ( ( i < 200000u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_iFirst = eDSP_MAXCHECKTST_RandOperand(&l_uSeed);
+        l_iSecond = eDSP_MAXCHECKTST_RandOperand(&l_uSeed);
+        l_iDivisor = eDSP_MAXCHECKTST_RandOperand(&l_uSeed);
+
+        if( 0 != l_iDivisor )
+        {
+            l_iExpected = ( ( (t_eDSP_MAXCHECK_I128) l_iFirst ) * l_iSecond ) / l_iDivisor;
+            l_bOvf = ( ( l_iExpected > MAX_INT64VAL ) || ( l_iExpected < MIN_INT64VAL ) );
+            l_eRes = eDSP_MAXCHECK_MulDivI64(l_iFirst, l_iSecond, l_iDivisor, &l_iRes);
+
+            if( true == l_bOvf )
+            {
+                if( e_eDSP_MAXCHECK_OVERFLOW != l_eRes )
+                {
+                    l_bTestOk = false;
+                }
+            }
+            else
+            {
+                if( ( e_eDSP_MAXCHECK_RES_OK != l_eRes ) || ( ( (int64_t) l_iExpected ) != l_iRes ) )
+                {
+                    l_bTestOk = false;
+                }
+            }
+
+            /* Divide the product, or a random 128 bit value */
+            l_iHigh = eDSP_MAXCHECKTST_RandOperand(&l_uSeed);
+            l_uLow = eDSP_TSTRAND_Rand(&l_uSeed);
+
+            if( 0u == ( l_uLow & 1u ) )
+            {
+                l_iExpected = ( (t_eDSP_MAXCHECK_I128) l_iFirst ) * l_iSecond;
+                l_iHigh = (int64_t) ( l_iExpected >> 64 );
+                l_uLow = (uint64_t) l_iExpected;
+            }
+
+            l_iExpected = (t_eDSP_MAXCHECK_I128) ( ( ( (t_eDSP_MAXCHECK_U128) ( (uint64_t) l_iHigh ) ) << 64 ) |
+                                                   l_uLow );
+            l_iExpected = l_iExpected / l_iDivisor;
+            l_bOvf = ( ( l_iExpected > MAX_INT64VAL ) || ( l_iExpected < MIN_INT64VAL ) );
+            l_eRes = eDSP_MAXCHECK_DivI128(l_iHigh, l_uLow, l_iDivisor, &l_iRes);
+
+            if( true == l_bOvf )
+            {
+                if( e_eDSP_MAXCHECK_OVERFLOW != l_eRes )
+                {
+                    l_bTestOk = false;
+                }
+            }
+            else
+            {
+                if( ( e_eDSP_MAXCHECK_RES_OK != l_eRes ) || ( ( (int64_t) l_iExpected ) != l_iRes ) )
+                {
+                    l_bTestOk = false;
+                }
+            }
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_MAXCHECKTST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_MAXCHECKTST_Reference 1  -- FAIL \n");
+    }
+}
+
+static int64_t eDSP_MAXCHECKTST_RandOperand(uint64_t* const p_puSeed)
+{
+    /* Local variable */
+    int64_t  l_iRes;
+    uint64_t l_uVal;
+    const int64_t l_aiEdge[8u] = { 0, 1, -1, MAX_INT64VAL, MIN_INT64VAL, MIN_INT64VAL + 1, 0x100000000, 0xFFFFFFFF };
+
+    /* Mix full range, short and edge values so every division path is used */
+    l_uVal = eDSP_TSTRAND_Rand(p_puSeed);
+
+    switch( eDSP_TSTRAND_Rand(p_puSeed) % 5u )
+    {
+        case 0u:
+        {
+            l_iRes = (int64_t) ( l_uVal >> 1u );
+            break;
+        }
+
+        case 1u:
+        {
+            l_iRes = -( (int64_t) ( l_uVal >> ( 1u + ( eDSP_TSTRAND_Rand(p_puSeed) % 63u ) ) ) );
+            break;
+        }
+
+        case 2u:
+        {
+            l_iRes = (int64_t) ( l_uVal >> ( 1u + ( eDSP_TSTRAND_Rand(p_puSeed) % 63u ) ) );
+            break;
+        }
+
+        case 3u:
+        {
+            l_iRes = l_aiEdge[l_uVal % 8u];
+            break;
+        }
+
+        default:
+        {
+            l_iRes = ( (int64_t) ( l_uVal & 0xFFFFu ) ) - 0x8000;
+            break;
+        }
+    }
+
+    return l_iRes;
+}
+#endif
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
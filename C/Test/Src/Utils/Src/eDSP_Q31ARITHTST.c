@@ -0,0 +1,192 @@
+/**
+ * @file       eDSP_Q31ARITHTST.c
+ *
+ * @brief      Q31 arithmetic test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_Q31ARITHTST.h"
+#include "eDSP_Q31ARITH.h"
+#include "eDSP_MAXCHECK.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_Q31ARITHTST_CalcAlpha(void);
+static void eDSP_Q31ARITHTST_MulI64(void);
+#if defined(__SIZEOF_INT128__)
+static void eDSP_Q31ARITHTST_Reference(void);
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_Q31ARITHTST_ExeTest(void)
+{
+	(void)printf("\n\nQ31ARITH TEST START \n\n");
+
+    eDSP_Q31ARITHTST_CalcAlpha();
+    eDSP_Q31ARITHTST_MulI64();
+#if defined(__SIZEOF_INT128__)
+    eDSP_Q31ARITHTST_Reference();
+#endif
+
+    (void)printf("\n\nQ31ARITH TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_Q31ARITHTST_CalcAlpha(void)
+{
+    /* Local variable */
+    uint32_t l_uPrevAlpha;
+    uint32_t l_uAlpha;
+    bool_t   l_bTestOk = true;
+
+    /* Function */
+    if( 0u == eDSP_Q31ARITH_CalcAlpha(0u, 1000u) )
+    {
+        (void)printf("eDSP_Q31ARITHTST_CalcAlpha 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_Q31ARITHTST_CalcAlpha 1  -- FAIL \n");
+    }
+
+    /* Fc * dt equal to RC, alpha is one half */
+    if( 0x40000000u == eDSP_Q31ARITH_CalcAlpha(159154943u, 1u) )
+    {
+        (void)printf("eDSP_Q31ARITHTST_CalcAlpha 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_Q31ARITHTST_CalcAlpha 2  -- FAIL \n");
+    }
+
+    if( ( 0x80000000u == eDSP_Q31ARITH_CalcAlpha(MAX_UINT64VAL, 2u) ) &&
+        ( 0x80000000u == eDSP_Q31ARITH_CalcAlpha(0x100000000u, 0x100000000u) ) )
+    {
+        (void)printf("eDSP_Q31ARITHTST_CalcAlpha 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_Q31ARITHTST_CalcAlpha 3  -- FAIL \n");
+    }
+
+    /* Alpha never decrease when the time grow */
+    l_uPrevAlpha = 0u;
+    for(uint32_t i = 0u; ( ( i < 64u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_uAlpha = eDSP_Q31ARITH_CalcAlpha(1000u, ( (uint64_t) 1u ) << i);
+
+        if( ( l_uAlpha < l_uPrevAlpha ) || ( l_uAlpha > 0x80000000u ) )
+        {
+            l_bTestOk = false;
+        }
+
+        l_uPrevAlpha = l_uAlpha;
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_Q31ARITHTST_CalcAlpha 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_Q31ARITHTST_CalcAlpha 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_Q31ARITHTST_MulI64(void)
+{
+    /* Function */
+    if( ( MAX_INT64VAL == eDSP_Q31ARITH_MulI64(MAX_INT64VAL, 0x80000000u) ) &&
+        ( MIN_INT64VAL == eDSP_Q31ARITH_MulI64(MIN_INT64VAL, 0x80000000u) ) &&
+        ( -7 == eDSP_Q31ARITH_MulI64(-7, 0x80000000u) ) )
+    {
+        (void)printf("eDSP_Q31ARITHTST_MulI64 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_Q31ARITHTST_MulI64 1  -- FAIL \n");
+    }
+
+    if( ( 0 == eDSP_Q31ARITH_MulI64(MAX_INT64VAL, 0u) ) && ( 0 == eDSP_Q31ARITH_MulI64(MIN_INT64VAL, 0u) ) )
+    {
+        (void)printf("eDSP_Q31ARITHTST_MulI64 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_Q31ARITHTST_MulI64 2  -- FAIL \n");
+    }
+
+    /* One half of 3 and -3, rounded to the nearest with the half going up */
+    if( ( 2 == eDSP_Q31ARITH_MulI64(3, 0x40000000u) ) && ( -1 == eDSP_Q31ARITH_MulI64(-3, 0x40000000u) ) )
+    {
+        (void)printf("eDSP_Q31ARITHTST_MulI64 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_Q31ARITHTST_MulI64 3  -- FAIL \n");
+    }
+}
+
+#if defined(__SIZEOF_INT128__)
+static void eDSP_Q31ARITHTST_Reference(void)
+{
+    /* Local variable */
+    uint64_t l_uSeed;
+    int64_t  l_iValue;
+    uint32_t l_uCoeff;
+    t_eDSP_MAXCHECK_I128 l_iExpected;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0x5555AAAA3333CCCCu;
+
+    /* Compare with the product done on 128 bit and rounded with the half going up */
+    for(uint32_t i = 0u; ( ( i < 200000u ) && ( true == l_bTestOk ) ); i++)
+    {
+        l_iValue = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> ( eDSP_TSTRAND_Rand(&l_uSeed) % 63u );
+        l_uCoeff = (uint32_t) ( eDSP_TSTRAND_Rand(&l_uSeed) % 0x80000001u );
+        l_iExpected = ( ( ( (t_eDSP_MAXCHECK_I128) l_iValue ) * l_uCoeff ) + 0x40000000 ) >> 31;
+
+        if( ( (int64_t) l_iExpected ) != eDSP_Q31ARITH_MulI64(l_iValue, l_uCoeff) )
+        {
+            l_bTestOk = false;
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_Q31ARITHTST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_Q31ARITHTST_Reference 1  -- FAIL \n");
+    }
+}
+#endif
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
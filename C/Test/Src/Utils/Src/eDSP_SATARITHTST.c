@@ -0,0 +1,444 @@
+/**
+ * @file       eDSP_SATARITHTST.c
+ *
+ * @brief      Saturated arithmetic test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_SATARITHTST.h"
+#include "eDSP_SATARITH.h"
+#include "eDSP_MAXCHECK.h"
+#include "eDSP_TSTRAND.h"
+#include <stdio.h>
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "CERT-STR32-C"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eDSP_SATARITHTST_AddSub(void);
+static void eDSP_SATARITHTST_Mul(void);
+static void eDSP_SATARITHTST_MulDiv(void);
+static void eDSP_SATARITHTST_DivI128(void);
+static void eDSP_SATARITHTST_StickyCounter(void);
+#if defined(__SIZEOF_INT128__)
+static void eDSP_SATARITHTST_Reference(void);
+#endif
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eDSP_SATARITHTST_ExeTest(void)
+{
+	(void)printf("\n\nSATARITH TEST START \n\n");
+
+    eDSP_SATARITHTST_AddSub();
+    eDSP_SATARITHTST_Mul();
+    eDSP_SATARITHTST_MulDiv();
+    eDSP_SATARITHTST_DivI128();
+    eDSP_SATARITHTST_StickyCounter();
+#if defined(__SIZEOF_INT128__)
+    eDSP_SATARITHTST_Reference();
+#endif
+
+    (void)printf("\n\nSATARITH TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static void eDSP_SATARITHTST_AddSub(void)
+{
+    /* Local variable */
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_uSatCnt = 0u;
+
+    /* Function */
+    if( ( MAX_INT64VAL == eDSP_SATARITH_AddI64(MAX_INT64VAL, 1, &l_uSatCnt) ) && ( 1u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 1  -- FAIL \n");
+    }
+
+    if( ( MIN_INT64VAL == eDSP_SATARITH_AddI64(MIN_INT64VAL, -1, &l_uSatCnt) ) && ( 2u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 2  -- FAIL \n");
+    }
+
+    if( ( -1 == eDSP_SATARITH_AddI64(MAX_INT64VAL, MIN_INT64VAL, &l_uSatCnt) ) && ( 2u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 3  -- FAIL \n");
+    }
+
+    if( ( MAX_INT64VAL == eDSP_SATARITH_SubI64(0, MIN_INT64VAL, &l_uSatCnt) ) && ( 3u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 4  -- FAIL \n");
+    }
+
+    if( ( MIN_INT64VAL == eDSP_SATARITH_SubI64(MIN_INT64VAL + 1, 2, &l_uSatCnt) ) && ( 4u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 5  -- FAIL \n");
+    }
+
+    if( ( MAX_INT64VAL == eDSP_SATARITH_SubI64(-1, MIN_INT64VAL, &l_uSatCnt) ) && ( 4u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_AddSub 6  -- FAIL \n");
+    }
+}
+
+static void eDSP_SATARITHTST_Mul(void)
+{
+    /* Local variable */
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_uSatCnt = 0u;
+
+    /* Function */
+    if( ( MAX_INT64VAL == eDSP_SATARITH_MulI64(MIN_INT64VAL, -1, &l_uSatCnt) ) && ( 1u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_Mul 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_Mul 1  -- FAIL \n");
+    }
+
+    if( ( MIN_INT64VAL == eDSP_SATARITH_MulI64(-3037000500, 3037000500, &l_uSatCnt) ) && ( 2u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_Mul 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_Mul 2  -- FAIL \n");
+    }
+
+    if( ( MIN_INT64VAL == eDSP_SATARITH_MulI64(-0x100000000, 0x80000000, &l_uSatCnt) ) && ( 2u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_Mul 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_Mul 3  -- FAIL \n");
+    }
+
+    if( ( 0 == eDSP_SATARITH_MulI64(0, MIN_INT64VAL, &l_uSatCnt) ) && ( 2u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_Mul 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_Mul 4  -- FAIL \n");
+    }
+}
+
+static void eDSP_SATARITHTST_MulDiv(void)
+{
+    /* Local variable */
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_uSatCnt = 0u;
+
+    /* Function */
+    if( ( -10 == eDSP_SATARITH_MulDivI64(7, -3, 2, &l_uSatCnt) ) && ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 1  -- FAIL \n");
+    }
+
+    if( ( MAX_INT64VAL == eDSP_SATARITH_MulDivI64(MAX_INT64VAL, MAX_INT64VAL, MAX_INT64VAL, &l_uSatCnt) ) &&
+        ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 2  -- FAIL \n");
+    }
+
+    if( ( MIN_INT64VAL == eDSP_SATARITH_MulDivI64(MAX_INT64VAL, -3, 2, &l_uSatCnt) ) && ( 1u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 3  -- FAIL \n");
+    }
+
+    /* Zero divisor saturate to the sign of the product */
+    if( ( MIN_INT64VAL == eDSP_SATARITH_MulDivI64(3, -2, 0, &l_uSatCnt) ) && ( 2u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 4  -- FAIL \n");
+    }
+
+    if( ( MAX_INT64VAL == eDSP_SATARITH_MulDivI64(-3, -2, 0, &l_uSatCnt) ) && ( 3u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 5  -- FAIL \n");
+    }
+
+    /* Zero product is always zero */
+    if( ( 0 == eDSP_SATARITH_MulDivI64(0, -2, 0, &l_uSatCnt) ) && ( 3u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_MulDiv 6  -- FAIL \n");
+    }
+}
+
+static void eDSP_SATARITHTST_DivI128(void)
+{
+    /* Local variable */
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_uSatCnt = 0u;
+
+    /* Function */
+    if( ( MIN_INT64VAL == eDSP_SATARITH_DivI128(0, 0x8000000000000000u, -1, &l_uSatCnt) ) && ( 0u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_DivI128 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_DivI128 1  -- FAIL \n");
+    }
+
+    if( ( MAX_INT64VAL == eDSP_SATARITH_DivI128(0, 0x8000000000000000u, 1, &l_uSatCnt) ) && ( 1u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_DivI128 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_DivI128 2  -- FAIL \n");
+    }
+
+    if( ( MIN_INT64VAL == eDSP_SATARITH_DivI128(-1, 0u, 1, &l_uSatCnt) ) && ( 2u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_DivI128 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_DivI128 3  -- FAIL \n");
+    }
+
+    /* Zero divisor saturate to the sign of the dividend */
+    if( ( MIN_INT64VAL == eDSP_SATARITH_DivI128(-1, 0u, 0, &l_uSatCnt) ) && ( 3u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_DivI128 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_DivI128 4  -- FAIL \n");
+    }
+
+    if( ( 0 == eDSP_SATARITH_DivI128(0, 0u, 0, &l_uSatCnt) ) && ( 3u == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_DivI128 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_DivI128 5  -- FAIL \n");
+    }
+}
+
+static void eDSP_SATARITHTST_StickyCounter(void)
+{
+    /* Local variable */
+    uint32_t l_uSatCnt;
+
+    /* Init variable */
+    l_uSatCnt = MAX_UINT32VAL - 1u;
+
+    /* Function */
+    if( ( MAX_INT64VAL == eDSP_SATARITH_AddI64(MAX_INT64VAL, MAX_INT64VAL, &l_uSatCnt) ) &&
+        ( MAX_UINT32VAL == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_StickyCounter 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_StickyCounter 1  -- FAIL \n");
+    }
+
+    if( ( MAX_INT64VAL == eDSP_SATARITH_MulI64(MAX_INT64VAL, MAX_INT64VAL, &l_uSatCnt) ) &&
+        ( MAX_UINT32VAL == l_uSatCnt ) )
+    {
+        (void)printf("eDSP_SATARITHTST_StickyCounter 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_StickyCounter 2  -- FAIL \n");
+    }
+}
+
+#if defined(__SIZEOF_INT128__)
+static void eDSP_SATARITHTST_Reference(void)
+{
+    /* Local variable */
+    uint64_t l_uSeed;
+    int64_t  l_iFirst;
+    int64_t  l_iSecond;
+    int64_t  l_iDivisor;
+    int64_t  l_iRes;
+    uint32_t l_uSatCnt;
+    uint32_t l_uExpSatCnt;
+    t_eDSP_MAXCHECK_I128 l_iExpected;
+    bool_t   l_bTestOk = true;
+
+    /* Init variable */
+    l_uSeed = 0x0F1E2D3C4B5A6978u;
+    l_uSatCnt = 0u;
+    l_uExpSatCnt = 0u;
+
+    /* Compare the clamped operation with the compiler 128 bit arithmetic */
+    for(uint32_t i = 0u; ( ( i < 200000u ) && ( true == l_bTestOk ) ); i++)
+    {
+        /* Shift the operands so both small and full range values are used */
+        l_iFirst = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> ( eDSP_TSTRAND_Rand(&l_uSeed) % 63u );
+        l_iSecond = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >> ( eDSP_TSTRAND_Rand(&l_uSeed) % 63u );
+        l_iDivisor = ( (int64_t) eDSP_TSTRAND_Rand(&l_uSeed) ) >>
+                     ( 1u + ( eDSP_TSTRAND_Rand(&l_uSeed) % 62u ) );
+
+        if( 0 != l_iDivisor )
+        {
+            /* Sum */
+            l_iExpected = ( (t_eDSP_MAXCHECK_I128) l_iFirst ) + l_iSecond;
+            l_iRes = eDSP_SATARITH_AddI64(l_iFirst, l_iSecond, &l_uSatCnt);
+
+            if( l_iExpected > MAX_INT64VAL )
+            {
+                l_iExpected = MAX_INT64VAL;
+                l_uExpSatCnt++;
+            }
+            else if( l_iExpected < MIN_INT64VAL )
+            {
+                l_iExpected = MIN_INT64VAL;
+                l_uExpSatCnt++;
+            }
+            else
+            {
+                /* Not clamped */
+            }
+
+            if( ( ( (int64_t) l_iExpected ) != l_iRes ) || ( l_uExpSatCnt != l_uSatCnt ) )
+            {
+                l_bTestOk = false;
+            }
+
+            /* Product */
+            l_iExpected = ( (t_eDSP_MAXCHECK_I128) l_iFirst ) * l_iSecond;
+            l_iRes = eDSP_SATARITH_MulI64(l_iFirst, l_iSecond, &l_uSatCnt);
+
+            if( l_iExpected > MAX_INT64VAL )
+            {
+                l_iExpected = MAX_INT64VAL;
+                l_uExpSatCnt++;
+            }
+            else if( l_iExpected < MIN_INT64VAL )
+            {
+                l_iExpected = MIN_INT64VAL;
+                l_uExpSatCnt++;
+            }
+            else
+            {
+                /* Not clamped */
+            }
+
+            if( ( ( (int64_t) l_iExpected ) != l_iRes ) || ( l_uExpSatCnt != l_uSatCnt ) )
+            {
+                l_bTestOk = false;
+            }
+
+            /* Product and division */
+            l_iExpected = ( ( (t_eDSP_MAXCHECK_I128) l_iFirst ) * l_iSecond ) / l_iDivisor;
+            l_iRes = eDSP_SATARITH_MulDivI64(l_iFirst, l_iSecond, l_iDivisor, &l_uSatCnt);
+
+            if( l_iExpected > MAX_INT64VAL )
+            {
+                l_iExpected = MAX_INT64VAL;
+                l_uExpSatCnt++;
+            }
+            else if( l_iExpected < MIN_INT64VAL )
+            {
+                l_iExpected = MIN_INT64VAL;
+                l_uExpSatCnt++;
+            }
+            else
+            {
+                /* Not clamped */
+            }
+
+            if( ( ( (int64_t) l_iExpected ) != l_iRes ) || ( l_uExpSatCnt != l_uSatCnt ) )
+            {
+                l_bTestOk = false;
+            }
+        }
+    }
+
+    if( true == l_bTestOk )
+    {
+        (void)printf("eDSP_SATARITHTST_Reference 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eDSP_SATARITHTST_Reference 1  -- FAIL \n");
+    }
+}
+#endif
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "CERT-STR32-C"
+#endif
\ No newline at end of file
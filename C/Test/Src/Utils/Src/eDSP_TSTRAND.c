@@ -0,0 +1,28 @@
+/**
+ * @file       eDSP_TSTRAND.c
+ *
+ * @brief      Pseudo random generator shared by the tests
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eDSP_TSTRAND.h"
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+uint64_t eDSP_TSTRAND_Rand(uint64_t* const p_puSeed)
+{
+    /* Xorshift, the same sequence on every target */
+    *p_puSeed ^= ( *p_puSeed << 13u );
+    *p_puSeed ^= ( *p_puSeed >> 7u );
+    *p_puSeed ^= ( *p_puSeed << 17u );
+
+    return *p_puSeed;
+}
\ No newline at end of file